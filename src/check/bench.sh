@@ -0,0 +1,95 @@
+#! /bin/sh
+# Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+#
+# This file is part of the Scotch software package for static mapping,
+# graph partitioning and sparse matrix ordering.
+#
+# This software is governed by the CeCILL-C license under French law
+# and abiding by the rules of distribution of free software. You can
+# use, modify and/or redistribute the software under the terms of the
+# CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+# URL: "http://www.cecill.info".
+#
+# This script runs the benchmark programs over generated graphs and
+# over the graphs of the "grf" directory, and appends their results,
+# in CSV format, to the given result file. Each phase is run in a
+# separate process, so that peak memory values only account for this
+# phase. Peak memory values are -1 when Scotch has not been compiled
+# with flag COMMON_MEMORY_TRACE.
+#
+# Usage: bench.sh bin_dir bench_dir grf_dir work_dir result_file [mpiexec]
+#
+#   bin_dir     : directory of the Scotch programs (gmk_*).
+#   bench_dir   : directory of the benchmark programs.
+#   grf_dir     : directory of the compressed source graphs.
+#   work_dir    : directory where graphs are generated.
+#   result_file : CSV file to which results are appended.
+#   mpiexec     : default MPI launcher, if any.
+#
+# The following environment variables can be set:
+#
+#   BENCH_PARTS   : number of parts for partitioning and mapping (16).
+#   BENCH_THREADS : number of threads per process (1).
+#   BENCH_PROCS   : number of processes for distributed runs (4).
+#   BENCH_MPIEXEC : MPI launcher, overriding the default one;
+#                   distributed runs are skipped if it is empty or
+#                   if bench_ptscotch_dgraph_order is absent.
+#   BENCH_SIZE    : size factor of generated graphs (1).
+#   BENCH_TGTDIR  : directory of the Scotch target files; when set,
+#                   graphs are also mapped onto "k512.tgt".
+#
+# Graphs are always mapped onto a generated 512-terminal tree-leaf
+# target. Running the benchmark against a library compiled with flag
+# -DKGRAPHMAPFMDISTMAX=0 measures the effect of the domain distance
+# cache of the k-way FM refinement method on these target mappings.
+
+if [ $# -lt 5 ] || [ $# -gt 6 ]; then
+  echo "usage: $0 bin_dir bench_dir grf_dir work_dir result_file [mpiexec]" 1>&2
+  exit 1
+fi
+
+BINDIR=$1
+BENCHDIR=$2
+GRFDIR=$3
+WORKDIR=$4
+RESFILE=$5
+
+PARTS=${BENCH_PARTS:-16}
+THREADS=${BENCH_THREADS:-1}
+PROCS=${BENCH_PROCS:-4}
+SIZE=${BENCH_SIZE:-1}
+MPIEXEC=${BENCH_MPIEXEC-$6}
+TGTDIR=${BENCH_TGTDIR-}
+
+mkdir -p "$WORKDIR" || exit 1
+
+echo "tleaf 3 8 50 8 10 8 1" > "$WORKDIR/tleaf512.tgt" || exit 1
+TARGETS="$WORKDIR/tleaf512.tgt"
+if [ -n "$TGTDIR" ]; then
+  TARGETS="$TGTDIR/k512.tgt $TARGETS"
+fi
+
+"$BINDIR/gmk_m2" `expr 256 \* $SIZE` `expr 256 \* $SIZE` "$WORKDIR/m2.grf" || exit 1
+"$BINDIR/gmk_m3" `expr 40 \* $SIZE` `expr 40 \* $SIZE` `expr 40 \* $SIZE` "$WORKDIR/m3.grf" || exit 1
+"$BINDIR/gmk_hy" `expr 13 + $SIZE` "$WORKDIR/hy.grf" || exit 1
+GRAPHS="m2 m3 hy"
+
+for GRFFILE in "$GRFDIR"/*.grf.gz; do
+  NAME=`basename "$GRFFILE" .grf.gz`
+  gzip -dc "$GRFFILE" > "$WORKDIR/$NAME.grf" || exit 1
+  GRAPHS="$GRAPHS $NAME"
+done
+
+for NAME in $GRAPHS; do
+  for PHASE in coarsen part map order; do
+    "$BENCHDIR/bench_scotch_graph" $PHASE $NAME "$WORKDIR/$NAME.grf" "$RESFILE" $PARTS $THREADS || exit 1
+  done
+  for TGTFILE in $TARGETS; do
+    "$BENCHDIR/bench_scotch_graph" map $NAME-`basename "$TGTFILE" .tgt` "$WORKDIR/$NAME.grf" "$RESFILE" $PARTS $THREADS "$TGTFILE" || exit 1
+  done
+  if [ -n "$MPIEXEC" ] && [ -x "$BENCHDIR/bench_ptscotch_dgraph_order" ]; then
+    $MPIEXEC -n $PROCS "$BENCHDIR/bench_ptscotch_dgraph_order" $NAME "$WORKDIR/$NAME.grf" "$RESFILE" $THREADS || exit 1
+  fi
+done
+
+exit 0
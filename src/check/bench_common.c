@@ -0,0 +1,271 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : bench_common.c                          **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module contains the routines       **/
+/**                shared by the benchmark programs:       **/
+/**                timing, result output and ordering      **/
+/**                quality evaluation.                     **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+
+#include "scotch.h"
+#include "bench_common.h"
+
+/*************************/
+/*                       */
+/* The timing routine.   */
+/*                       */
+/*************************/
+
+/* This routine returns the wall-clock
+** time, in seconds.
+** It returns:
+** - x  : the time.
+*/
+
+double
+benchClock (void)
+{
+  struct timeval      tvdat;
+
+  gettimeofday (&tvdat, NULL);
+
+  return ((double) tvdat.tv_sec + (double) tvdat.tv_usec * 1.0e-6);
+}
+
+/*************************/
+/*                       */
+/* The output routines.  */
+/*                       */
+/*************************/
+
+/* This routine opens the given result
+** file in append mode, so that successive
+** runs accumulate in the same file, and
+** writes the CSV header line if the file
+** is empty.
+** It returns:
+** - !NULL  : pointer to the opened file.
+** - NULL   : on error.
+*/
+
+FILE *
+benchOpen (
+const char * const          filenam)
+{
+  FILE *              fileptr;
+
+  if ((fileptr = fopen (filenam, "a")) == NULL) {
+    SCOTCH_errorPrint ("benchOpen: cannot open result file");
+    return (NULL);
+  }
+
+  fseek (fileptr, 0, SEEK_END);
+  if ((ftell (fileptr) == 0) &&
+      (fprintf (fileptr, "version,program,graph,phase,procs,threads,parts,vertices,arcs,time,memmax,metric,value\n") == EOF)) {
+    SCOTCH_errorPrint ("benchOpen: cannot write result file");
+    fclose (fileptr);
+    return (NULL);
+  }
+
+  return (fileptr);
+}
+
+/* This routine writes one result line,
+** for the given metric, to the given
+** result file.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+benchWrite (
+FILE * const                fileptr,
+const BenchRecord * const   recoptr,
+const char * const          metrstr,
+const double                metrval)
+{
+  int                 versval;
+  int                 relaval;
+  int                 patcval;
+
+  SCOTCH_version (&versval, &relaval, &patcval);
+
+  if (fprintf (fileptr, "%d.%d.%d,%s,%s,%s,%d,%d,%ld,%ld,%ld,%.6f,%ld,%s,%.10g\n",
+               versval, relaval, patcval,
+               recoptr->progstr,
+               recoptr->namestr,
+               recoptr->phasstr,
+               recoptr->procnbr,
+               recoptr->thrdnbr,
+               (long) recoptr->partnbr,
+               (long) recoptr->vertnbr,
+               (long) recoptr->edgenbr,
+               recoptr->timeval,
+               (long) recoptr->memomax,
+               metrstr,
+               metrval) == EOF) {
+    SCOTCH_errorPrint ("benchWrite: cannot write result file");
+    return (1);
+  }
+
+  return (0);
+}
+
+/**************************************/
+/*                                    */
+/* The ordering evaluation routine.   */
+/*                                    */
+/**************************************/
+
+/* This routine computes the number of
+** non-zeros and the operation count of
+** the Cholesky factorization of the
+** matrix of the given graph, reordered
+** by the given inverse permutation, not
+** taking vertex loads into account. The
+** elimination tree is computed with path
+** compression, after which every row
+** subtree is traversed once, in time
+** proportional to the number of non-zeros.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+benchFactor (
+const SCOTCH_Num            baseval,
+const SCOTCH_Num            vertnbr,
+const SCOTCH_Num * const    verttab,
+const SCOTCH_Num * const    vendtab,
+const SCOTCH_Num * const    edgetab,
+const SCOTCH_Num * const    peritab,              /* Inverse permutation, based */
+double * const              nnzpptr,
+double * const              opcpptr)
+{
+  SCOTCH_Num *        permtab;                    /* Direct permutation, not based  */
+  SCOTCH_Num *        fathtab;                    /* Elimination tree               */
+  SCOTCH_Num *        anactab;                    /* Compressed ancestor array      */
+  SCOTCH_Num *        cnbrtab;                    /* Extra-diagonal column counts   */
+  SCOTCH_Num          ordenum;
+  double              nnzpsum;
+  double              opcpsum;
+
+  if ((permtab = malloc (4 * vertnbr * sizeof (SCOTCH_Num) + 1)) == NULL) {
+    SCOTCH_errorPrint ("benchFactor: out of memory");
+    return (1);
+  }
+  fathtab = permtab + vertnbr;
+  anactab = fathtab + vertnbr;
+  cnbrtab = anactab + vertnbr;
+
+  for (ordenum = 0; ordenum < vertnbr; ordenum ++)
+    permtab[peritab[ordenum] - baseval] = ordenum;
+
+  for (ordenum = 0; ordenum < vertnbr; ordenum ++) { /* Build elimination tree */
+    SCOTCH_Num          vertnum;
+    SCOTCH_Num          edgenum;
+
+    fathtab[ordenum] =
+    anactab[ordenum] = -1;
+    vertnum = peritab[ordenum] - baseval;
+    for (edgenum = verttab[vertnum] - baseval; edgenum < vendtab[vertnum] - baseval; edgenum ++) {
+      SCOTCH_Num          ordeend;
+
+      for (ordeend = permtab[edgetab[edgenum] - baseval]; (ordeend < ordenum) && (anactab[ordeend] != ordenum); ) {
+        SCOTCH_Num          ordetmp;
+
+        ordetmp = anactab[ordeend];
+        anactab[ordeend] = ordenum;               /* Compress path to current root */
+        if (ordetmp == -1) {                      /* If root of subtree reached    */
+          fathtab[ordeend] = ordenum;
+          break;
+        }
+        ordeend = ordetmp;
+      }
+    }
+  }
+
+  memset (cnbrtab, 0, vertnbr * sizeof (SCOTCH_Num));
+  for (ordenum = 0; ordenum < vertnbr; ordenum ++) { /* Traverse row subtrees; re-use ancestor array as flag array */
+    SCOTCH_Num          vertnum;
+    SCOTCH_Num          edgenum;
+
+    anactab[ordenum] = ordenum;
+    vertnum = peritab[ordenum] - baseval;
+    for (edgenum = verttab[vertnum] - baseval; edgenum < vendtab[vertnum] - baseval; edgenum ++) {
+      SCOTCH_Num          ordeend;
+
+      for (ordeend = permtab[edgetab[edgenum] - baseval];
+           (ordeend < ordenum) && (anactab[ordeend] != ordenum); ordeend = fathtab[ordeend]) {
+        anactab[ordeend] = ordenum;
+        cnbrtab[ordeend] ++;                      /* Row of current vertex is non-zero in column */
+      }
+    }
+  }
+
+  for (ordenum = 0, nnzpsum = opcpsum = 0.0; ordenum < vertnbr; ordenum ++) {
+    double              cnbrval;
+
+    cnbrval  = (double) (cnbrtab[ordenum] + 1);   /* Extra-diagonals, plus diagonal */
+    nnzpsum += cnbrval;
+    opcpsum += cnbrval * cnbrval;
+  }
+
+  *nnzpptr = nnzpsum;
+  *opcpptr = opcpsum;
+
+  free (permtab);
+  return (0);
+}
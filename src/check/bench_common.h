@@ -0,0 +1,75 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : bench_common.h                          **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the declarations of     **/
+/**                the routines shared by the benchmark    **/
+/**                programs.                               **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The benchmark record, which describes
+    the run being measured. One line is
+    written to the result file per metric. +*/
+
+typedef struct BenchRecord_ {
+  const char *              progstr;              /*+ Name of benchmark program  +*/
+  const char *              namestr;              /*+ Name of benchmark graph    +*/
+  const char *              phasstr;              /*+ Name of benchmarked phase  +*/
+  int                       procnbr;              /*+ Number of processes        +*/
+  int                       thrdnbr;              /*+ Number of threads          +*/
+  SCOTCH_Num                partnbr;              /*+ Number of parts, if any    +*/
+  SCOTCH_Num                vertnbr;              /*+ Number of graph vertices   +*/
+  SCOTCH_Num                edgenbr;              /*+ Number of graph arcs       +*/
+  double                    timeval;              /*+ Wall-clock time of phase   +*/
+  SCOTCH_Idx                memomax;              /*+ Peak memory, -1 if unknown +*/
+} BenchRecord;
+
+/*
+**  The function prototypes.
+*/
+
+double                      benchClock          (void);
+FILE *                      benchOpen           (const char * const);
+int                         benchWrite          (FILE * const, const BenchRecord * const, const char * const, const double);
+int                         benchFactor         (const SCOTCH_Num, const SCOTCH_Num, const SCOTCH_Num * const, const SCOTCH_Num * const, const SCOTCH_Num * const, const SCOTCH_Num * const, double * const, double * const);
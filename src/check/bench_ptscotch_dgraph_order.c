@@ -0,0 +1,224 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : bench_ptscotch_dgraph_order.c           **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module measures the performance    **/
+/**                of the SCOTCH_dgraphOrder() routine.    **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <mpi.h>
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+
+#include "ptscotch.h"
+#include "bench_common.h"
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  MPI_Comm            proccomm;
+  int                 procglbnbr;                 /* Number of processes sharing graph data */
+  int                 proclocnum;                 /* Number of this process                 */
+  SCOTCH_Context      contdat;
+  SCOTCH_Dgraph       grafdat;                    /* Source graph                           */
+  SCOTCH_Dgraph       cgrfdat;                    /* Graph bound to context                 */
+  SCOTCH_Graph        centdat;                    /* Centralized graph, on root process     */
+  SCOTCH_Dordering    ordedat;
+  SCOTCH_Ordering     corddat;
+  SCOTCH_Strat        stradat;
+  BenchRecord         recodat;
+  SCOTCH_Num *        permtab;
+  double              timeval;
+  double              memoloc;
+  double              memoglb;
+  double              nnzpval;
+  double              opcpval;
+  FILE *              fileptr;
+  int                 o;
+#ifdef SCOTCH_PTHREAD
+  int                 thrdlvlreqval;
+  int                 thrdlvlproval;
+#endif /* SCOTCH_PTHREAD */
+
+  SCOTCH_errorProg (argv[0]);
+
+#ifdef SCOTCH_PTHREAD
+  thrdlvlreqval = MPI_THREAD_MULTIPLE;
+  if (MPI_Init_thread (&argc, &argv, thrdlvlreqval, &thrdlvlproval) != MPI_SUCCESS)
+    SCOTCH_errorPrint ("main: Cannot initialize (1)");
+  if (thrdlvlreqval > thrdlvlproval)
+    SCOTCH_errorPrint ("main: MPI implementation is not thread-safe: recompile without SCOTCH_PTHREAD");
+#else /* SCOTCH_PTHREAD */
+  if (MPI_Init (&argc, &argv) != MPI_SUCCESS)
+    SCOTCH_errorPrint ("main: Cannot initialize (2)");
+#endif /* SCOTCH_PTHREAD */
+
+  if ((argc < 4) || (argc > 5)) {
+    SCOTCH_errorPrint ("usage: %s name graph_file result_file [threads]", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  proccomm = MPI_COMM_WORLD;
+  MPI_Comm_size (proccomm, &procglbnbr);          /* Get communicator data */
+  MPI_Comm_rank (proccomm, &proclocnum);
+
+  recodat.progstr = "ptscotch";
+  recodat.namestr = argv[1];
+  recodat.phasstr = "dorder";
+  recodat.procnbr = procglbnbr;
+  recodat.thrdnbr = (argc > 4) ? atoi (argv[4]) : 1;
+  recodat.partnbr = 0;
+  if (recodat.thrdnbr < 1) {
+    SCOTCH_errorPrint ("main: invalid number of threads");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_dgraphInit (&grafdat, proccomm) != 0) { /* Initialize source graph */
+    SCOTCH_errorPrint ("main: cannot initialize graph");
+    exit (EXIT_FAILURE);
+  }
+
+  fileptr = NULL;
+  if ((proclocnum == 0) &&
+      ((fileptr = fopen (argv[2], "r")) == NULL)) {
+    SCOTCH_errorPrint ("main: cannot open graph file");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_dgraphLoad (&grafdat, fileptr, -1, 0) != 0) {
+    SCOTCH_errorPrint ("main: cannot load graph");
+    exit (EXIT_FAILURE);
+  }
+
+  if (fileptr != NULL)
+    fclose (fileptr);
+
+  SCOTCH_dgraphSize (&grafdat, &recodat.vertnbr, NULL, &recodat.edgenbr, NULL);
+
+  SCOTCH_contextInit (&contdat);                  /* Run with prescribed number of threads */
+  SCOTCH_dgraphInit  (&cgrfdat, proccomm);
+  if ((SCOTCH_contextThreadSpawn (&contdat, recodat.thrdnbr, NULL) != 0) ||
+      (SCOTCH_contextBindDgraph (&contdat, &grafdat, &cgrfdat) != 0)) {
+    SCOTCH_errorPrint ("main: cannot initialize context");
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_stratInit (&stradat);                    /* Use default strategy */
+
+  MPI_Barrier (proccomm);                         /* Start all processes at the same time */
+  timeval = MPI_Wtime ();
+  SCOTCH_dgraphOrderInit (&grafdat, &ordedat);
+  o = SCOTCH_dgraphOrderCompute (&cgrfdat, &ordedat, &stradat);
+  timeval = MPI_Wtime () - timeval;
+  memoloc = (double) SCOTCH_memMax ();
+
+  MPI_Allreduce (&timeval, &recodat.timeval, 1, MPI_DOUBLE, MPI_MAX, proccomm);
+  MPI_Allreduce (&memoloc, &memoglb, 1, MPI_DOUBLE, MPI_MAX, proccomm); /* Peak memory over all processes */
+  recodat.memomax = (SCOTCH_Idx) memoglb;
+
+  MPI_Allreduce (MPI_IN_PLACE, &o, 1, MPI_INT, MPI_MAX, proccomm);
+  if (o != 0) {
+    SCOTCH_errorPrint ("main: cannot order graph");
+    exit (EXIT_FAILURE);
+  }
+
+  permtab = NULL;
+  SCOTCH_graphInit (&centdat);
+  if (proclocnum == 0) {                          /* Root process gathers graph and ordering */
+    if ((permtab = malloc (recodat.vertnbr * 2 * sizeof (SCOTCH_Num) + 1)) == NULL) {
+      SCOTCH_errorPrint ("main: out of memory");
+      exit (EXIT_FAILURE);
+    }
+    SCOTCH_dgraphCorderInit (&grafdat, &corddat, permtab, permtab + recodat.vertnbr, NULL, NULL, NULL);
+  }
+  if ((SCOTCH_dgraphGather (&grafdat, (proclocnum == 0) ? &centdat : NULL) != 0) ||
+      (SCOTCH_dgraphOrderGather (&grafdat, &ordedat, (proclocnum == 0) ? &corddat : NULL) != 0)) {
+    SCOTCH_errorPrint ("main: cannot gather graph or ordering");
+    exit (EXIT_FAILURE);
+  }
+
+  if (proclocnum == 0) {
+    SCOTCH_Num          baseval;
+    SCOTCH_Num *        verttab;
+    SCOTCH_Num *        vendtab;
+    SCOTCH_Num *        edgetab;
+
+    SCOTCH_graphData (&centdat, &baseval, NULL, &verttab, &vendtab, NULL, NULL, NULL, &edgetab, NULL);
+    if ((benchFactor (baseval, recodat.vertnbr, verttab, vendtab, edgetab, permtab + recodat.vertnbr, &nnzpval, &opcpval) != 0) ||
+        ((fileptr = benchOpen (argv[3])) == NULL) ||
+        (benchWrite (fileptr, &recodat, "nnz", nnzpval) != 0) ||
+        (benchWrite (fileptr, &recodat, "opc", opcpval) != 0)) {
+      SCOTCH_errorPrint ("main: benchmark failed");
+      exit (EXIT_FAILURE);
+    }
+    fclose (fileptr);
+
+    printf ("%s\t%s\t%g s\n", recodat.namestr, recodat.phasstr, recodat.timeval);
+
+    SCOTCH_dgraphCorderExit (&grafdat, &corddat);
+    free (permtab);
+  }
+
+  SCOTCH_graphExit        (&centdat);
+  SCOTCH_dgraphOrderExit  (&grafdat, &ordedat);
+  SCOTCH_stratExit        (&stradat);
+  SCOTCH_dgraphExit       (&cgrfdat);             /* Free the context graph before its bound context */
+  SCOTCH_contextExit      (&contdat);
+  SCOTCH_dgraphExit       (&grafdat);
+
+  MPI_Finalize ();
+  exit (EXIT_SUCCESS);
+}
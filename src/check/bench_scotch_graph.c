@@ -0,0 +1,363 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : bench_scotch_graph.c                    **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module measures the performance    **/
+/**                of the SCOTCH_graphCoarsen(),           **/
+/**                SCOTCH_graphPart(), SCOTCH_graphMap()   **/
+/**                and SCOTCH_graphOrder() routines.       **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/**   NOTES      : # Only one phase is run per process,    **/
+/**                  so that the peak memory footprint     **/
+/**                  returned by SCOTCH_memMax(), when     **/
+/**                  memory tracing is enabled, only       **/
+/**                  accounts for this phase.              **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#if (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H))
+#include <stdint.h>
+#endif /* (((defined __STDC_VERSION__) && (__STDC_VERSION__ >= 199901L)) || (defined HAVE_STDINT_H)) */
+#include <stdlib.h>
+#include <string.h>
+
+#include "scotch.h"
+#include "bench_common.h"
+
+/**************************************/
+/*                                    */
+/* The partition evaluation routine.  */
+/*                                    */
+/**************************************/
+
+/* This routine computes the communication
+** load of the given mapping, that is, the
+** sum over all cut edges of their loads
+** multiplied by the distance between the
+** terminal domains of their ends, as well
+** as the maximum imbalance ratio of parts.
+** When no architecture is provided, all
+** distances are equal to 1, and the
+** communication load is the edge cut.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+benchGraphMapView (
+SCOTCH_Graph * const        grafptr,
+SCOTCH_Arch * const         archptr,              /* Target architecture, or NULL */
+const SCOTCH_Num            partnbr,
+const SCOTCH_Num * const    parttab,
+double * const              commptr,
+double * const              imbaptr)
+{
+  SCOTCH_Num          baseval;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num          vertnum;
+  SCOTCH_Num *        verttab;
+  SCOTCH_Num *        vendtab;
+  SCOTCH_Num *        velotab;
+  SCOTCH_Num *        edgetab;
+  SCOTCH_Num *        edlotab;
+  SCOTCH_ArchDom *    domntab;
+  double *            loadtab;
+  double              loadsum;
+  double              loadmax;
+  double              commsum;
+  SCOTCH_Num          partnum;
+
+  SCOTCH_graphData (grafptr, &baseval, &vertnbr, &verttab, &vendtab, &velotab, NULL, NULL, &edgetab, &edlotab);
+
+  if (((loadtab = malloc (partnbr * sizeof (double))) == NULL) ||
+      ((domntab = malloc (partnbr * sizeof (SCOTCH_ArchDom))) == NULL)) {
+    SCOTCH_errorPrint ("benchGraphMapView: out of memory");
+    if (loadtab != NULL)
+      free (loadtab);
+    return (1);
+  }
+  memset (loadtab, 0, partnbr * sizeof (double));
+  if (archptr != NULL) {
+    for (partnum = 0; partnum < partnbr; partnum ++)
+      SCOTCH_archDomTerm (archptr, &domntab[partnum], partnum);
+  }
+
+  for (vertnum = 0, commsum = loadsum = 0.0; vertnum < vertnbr; vertnum ++) {
+    SCOTCH_Num          partval;
+    SCOTCH_Num          edgenum;
+    double              veloval;
+
+    partval  = parttab[vertnum];
+    veloval  = (velotab != NULL) ? (double) velotab[vertnum] : 1.0;
+    loadsum += veloval;
+    loadtab[partval] += veloval;
+
+    for (edgenum = verttab[vertnum] - baseval; edgenum < vendtab[vertnum] - baseval; edgenum ++) {
+      SCOTCH_Num          partend;
+
+      partend = parttab[edgetab[edgenum] - baseval];
+      if (partend == partval)
+        continue;
+
+      commsum += ((edlotab != NULL) ? (double) edlotab[edgenum] : 1.0) *
+                 ((archptr != NULL) ? (double) SCOTCH_archDomDist (archptr, &domntab[partval], &domntab[partend]) : 1.0);
+    }
+  }
+
+  for (partnum = 0, loadmax = 0.0; partnum < partnbr; partnum ++) {
+    if (loadmax < loadtab[partnum])
+      loadmax = loadtab[partnum];
+  }
+
+  *commptr = commsum / 2.0;                       /* Every cut edge has been counted twice */
+  *imbaptr = (loadsum > 0.0) ? (loadmax * (double) partnbr / loadsum - 1.0) : 0.0;
+
+  free (domntab);
+  free (loadtab);
+  return (0);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  FILE *              fileptr;
+  SCOTCH_Context      contdat;
+  SCOTCH_Graph        grafdat;                    /* Source graph                 */
+  SCOTCH_Graph        cgrfdat;                    /* Graph bound to context       */
+  SCOTCH_Strat        stradat;
+  BenchRecord         recodat;
+  SCOTCH_Num          baseval;
+  SCOTCH_Num *        verttab;
+  SCOTCH_Num *        vendtab;
+  SCOTCH_Num *        edgetab;
+  int                 o;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if ((argc < 5) || (argc > 8)) {
+    SCOTCH_errorPrint ("usage: %s coarsen|part|map|order name graph_file result_file [parts [threads [target_file]]]", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  recodat.progstr = "scotch";
+  recodat.phasstr = argv[1];
+  recodat.namestr = argv[2];
+  recodat.procnbr = 1;
+  recodat.partnbr = (argc > 5) ? (SCOTCH_Num) atol (argv[5]) : 16;
+  recodat.thrdnbr = (argc > 6) ? atoi (argv[6]) : 1;
+  if ((recodat.partnbr < 1) || (recodat.thrdnbr < 1)) {
+    SCOTCH_errorPrint ("main: invalid number of parts or threads");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphInit (&grafdat) != 0) {         /* Initialize source graph */
+    SCOTCH_errorPrint ("main: cannot initialize graph");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((fileptr = fopen (argv[3], "r")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open graph file");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphLoad (&grafdat, fileptr, -1, 0) != 0) { /* Read source graph */
+    SCOTCH_errorPrint ("main: cannot load graph");
+    exit (EXIT_FAILURE);
+  }
+
+  fclose (fileptr);
+
+  SCOTCH_graphData (&grafdat, &baseval, &recodat.vertnbr, &verttab, &vendtab, NULL, NULL, &recodat.edgenbr, &edgetab, NULL);
+
+  SCOTCH_contextInit (&contdat);                  /* Run with prescribed number of threads */
+  SCOTCH_graphInit   (&cgrfdat);
+  if ((SCOTCH_contextThreadSpawn (&contdat, recodat.thrdnbr, NULL) != 0) ||
+      (SCOTCH_contextBindGraph (&contdat, &grafdat, &cgrfdat) != 0)) {
+    SCOTCH_errorPrint ("main: cannot initialize context");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((fileptr = benchOpen (argv[4])) == NULL)
+    exit (EXIT_FAILURE);
+
+  SCOTCH_stratInit (&stradat);                    /* Use default strategies */
+
+  o = 1;                                          /* Assume phase name is invalid */
+  if (strcmp (recodat.phasstr, "coarsen") == 0) {
+    SCOTCH_Graph        coargrafdat;
+    SCOTCH_Num *        coarmulttab;
+    SCOTCH_Num          coarvertnbr;
+    SCOTCH_Num          coaredgenbr;
+
+    recodat.partnbr = 0;
+    if ((coarmulttab = malloc (recodat.vertnbr * 2 * sizeof (SCOTCH_Num) + 1)) == NULL) {
+      SCOTCH_errorPrint ("main: out of memory (1)");
+      exit (EXIT_FAILURE);
+    }
+
+    recodat.timeval = benchClock ();
+    o = SCOTCH_graphCoarsen (&cgrfdat, 1, 1.0, SCOTCH_COARSENNONE, &coargrafdat, coarmulttab);
+    recodat.timeval = benchClock () - recodat.timeval;
+    recodat.memomax = SCOTCH_memMax ();
+
+    if (o == 0) {
+      SCOTCH_graphSize (&coargrafdat, &coarvertnbr, &coaredgenbr);
+      SCOTCH_graphExit (&coargrafdat);
+      o = benchWrite (fileptr, &recodat, "coarse_vertices", (double) coarvertnbr) |
+          benchWrite (fileptr, &recodat, "coarse_arcs", (double) coaredgenbr);
+    }
+    free (coarmulttab);
+  }
+  else if ((strcmp (recodat.phasstr, "part") == 0) ||
+           (strcmp (recodat.phasstr, "map") == 0)) {
+    SCOTCH_Arch         archdat;
+    SCOTCH_Arch *       archptr;
+    SCOTCH_Num *        parttab;
+    double              commval;
+    double              imbaval;
+
+    if ((parttab = malloc (recodat.vertnbr * sizeof (SCOTCH_Num) + 1)) == NULL) {
+      SCOTCH_errorPrint ("main: out of memory (2)");
+      exit (EXIT_FAILURE);
+    }
+
+    archptr = NULL;
+    if ((recodat.phasstr[0] == 'm') && (argc > 7)) { /* Map onto target architecture read from file */
+      FILE *              tgtfptr;
+
+      archptr = &archdat;
+      SCOTCH_archInit (archptr);
+      if ((tgtfptr = fopen (argv[7], "r")) == NULL) {
+        SCOTCH_errorPrint ("main: cannot open target file");
+        exit (EXIT_FAILURE);
+      }
+      if (SCOTCH_archLoad (archptr, tgtfptr) != 0) {
+        SCOTCH_errorPrint ("main: cannot load target architecture");
+        exit (EXIT_FAILURE);
+      }
+      fclose (tgtfptr);
+      recodat.partnbr = SCOTCH_archSize (archptr);
+    }
+    else if (recodat.phasstr[0] == 'm') {         /* Map onto the most square 2D mesh of prescribed size */
+      SCOTCH_Num          xdimval;
+
+      for (xdimval = 1; (xdimval + 1) * (xdimval + 1) <= recodat.partnbr; xdimval ++) ;
+      while ((recodat.partnbr % xdimval) != 0)
+        xdimval --;
+
+      archptr = &archdat;
+      SCOTCH_archInit  (archptr);
+      SCOTCH_archMesh2 (archptr, xdimval, recodat.partnbr / xdimval);
+    }
+
+    recodat.timeval = benchClock ();
+    o = (archptr != NULL) ? SCOTCH_graphMap  (&cgrfdat, archptr, &stradat, parttab)
+                          : SCOTCH_graphPart (&cgrfdat, recodat.partnbr, &stradat, parttab);
+    recodat.timeval = benchClock () - recodat.timeval;
+    recodat.memomax = SCOTCH_memMax ();
+
+    if (o == 0) {
+      o = benchGraphMapView (&grafdat, archptr, recodat.partnbr, parttab, &commval, &imbaval);
+      if (o == 0)
+        o = benchWrite (fileptr, &recodat, (archptr != NULL) ? "comm_load" : "edge_cut", commval) |
+            benchWrite (fileptr, &recodat, "imbalance", imbaval);
+    }
+
+    if (archptr != NULL)
+      SCOTCH_archExit (archptr);
+    free (parttab);
+  }
+  else if (strcmp (recodat.phasstr, "order") == 0) {
+    SCOTCH_Num *        permtab;
+    double              nnzpval;
+    double              opcpval;
+
+    recodat.partnbr = 0;
+    if ((permtab = malloc (recodat.vertnbr * 2 * sizeof (SCOTCH_Num) + 1)) == NULL) {
+      SCOTCH_errorPrint ("main: out of memory (3)");
+      exit (EXIT_FAILURE);
+    }
+
+    recodat.timeval = benchClock ();
+    o = SCOTCH_graphOrder (&cgrfdat, &stradat, permtab, permtab + recodat.vertnbr, NULL, NULL, NULL);
+    recodat.timeval = benchClock () - recodat.timeval;
+    recodat.memomax = SCOTCH_memMax ();
+
+    if (o == 0) {
+      o = benchFactor (baseval, recodat.vertnbr, verttab, vendtab, edgetab, permtab + recodat.vertnbr, &nnzpval, &opcpval);
+      if (o == 0)
+        o = benchWrite (fileptr, &recodat, "nnz", nnzpval) |
+            benchWrite (fileptr, &recodat, "opc", opcpval);
+    }
+    free (permtab);
+  }
+  else
+    SCOTCH_errorPrint ("main: invalid phase name");
+
+  if (o != 0) {
+    SCOTCH_errorPrint ("main: benchmark failed");
+    exit (EXIT_FAILURE);
+  }
+
+  printf ("%s\t%s\t%g s\n", recodat.namestr, recodat.phasstr, recodat.timeval);
+
+  fclose (fileptr);
+
+  SCOTCH_stratExit   (&stradat);
+  SCOTCH_graphExit   (&cgrfdat);                  /* Free the context graph before its bound context */
+  SCOTCH_contextExit (&contdat);
+  SCOTCH_graphExit   (&grafdat);
+
+  exit (EXIT_SUCCESS);
+}
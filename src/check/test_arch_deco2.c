@@ -0,0 +1,399 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_arch_deco2.c                       **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the distance routine  **/
+/**                of type-2 decomposition-described       **/
+/**                architectures, which relies on distance **/
+/**                tables, landmark pruning and hashed     **/
+/**                local searches, against a plain         **/
+/**                exhaustive search over full arrays.     **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define ARCH_DECO2                                /* To access level data */
+
+#include <stdio.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+#include "../libscotch/graph.h"
+#include "../libscotch/arch.h"
+#include "../libscotch/arch_deco2.h"
+#include "../libscotch/arch_sub.h"
+#include "scotch.h"
+
+/***************************/
+/*                         */
+/* The reference routines. */
+/*                         */
+/***************************/
+
+/* This routine performs the local search of
+** ARCHDECO2PASSNBR passes between the two
+** given vertices of the given level, using
+** distance and queue arrays spanning the
+** whole level graph.
+** It returns:
+** - >= 0  : distance found at this level.
+** - -1    : if path not found at this level.
+*/
+
+static
+Anum
+testDeco2DistLevl (
+const ArchDeco2Levl * const levlptr,
+const Gnum                  vertnum0,
+const Gnum                  vertnum1,
+Gnum * const                disttab,
+Gnum * const                queutab)
+{
+  Gnum *              disttax;
+  Gnum                queuheadidx;
+  Gnum                queutailidx;
+  Anum                distmin;
+  int                 passnbr;
+
+  const Gnum * const  verttax = levlptr->grafdat.verttax;
+  const Gnum * const  vendtax = levlptr->grafdat.vendtax;
+  const Gnum * const  velotax = levlptr->grafdat.velotax;
+  const Gnum * const  edgetax = levlptr->grafdat.edgetax;
+  const Gnum * const  edlotax = levlptr->grafdat.edlotax;
+
+  disttax = disttab - levlptr->grafdat.baseval;
+  memSet (disttab, ~0, levlptr->grafdat.vertnbr * sizeof (Gnum));
+  disttax[vertnum0] = (velotax != NULL) ? ((velotax[vertnum0] + velotax[vertnum1]) / 2) : 0;
+
+  distmin     = -1;
+  passnbr     = ARCHDECO2PASSNBR;
+  queutab[0]  = vertnum0;
+  queutab[1]  = -1;                               /* Pass marker */
+  queutailidx = 0;
+  queuheadidx = 2;
+  while (queutailidx != queuheadidx) {
+    Gnum                vertnum;
+    Gnum                edgenum;
+
+    vertnum = queutab[queutailidx ++];
+    if (vertnum < 0) {                            /* If end of pass */
+      if (passnbr == 0)
+        break;
+      queutab[queuheadidx ++] = vertnum;
+      passnbr --;
+      continue;
+    }
+
+    for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
+      Gnum                vertend;
+      Gnum                disttmp;
+
+      vertend = edgetax[edgenum];
+      disttmp = disttax[vertnum] + ((edlotax != NULL) ? edlotax[edgenum] : 1);
+      if (vertend == vertnum1) {                  /* If end vertex reached, end search after this pass */
+        if ((distmin < 0) || (distmin > disttmp))
+          distmin = disttmp;
+        passnbr = 0;
+        continue;
+      }
+
+      disttmp += (velotax != NULL) ? velotax[vertend] : 0;
+      if (disttax[vertend] < 0) {
+        queutab[queuheadidx ++] = vertend;
+        disttax[vertend] = disttmp;
+      }
+      else if (disttax[vertend] > disttmp)
+        disttax[vertend] = disttmp;
+    }
+  }
+
+  return (distmin);
+}
+
+/* This routine computes the distance between
+** the two given domains by searching every
+** level, from the finest level at which both
+** domains exist up to the level at which a
+** path is found or both domains merge.
+** It returns:
+** - >= 0  : distance between domains.
+*/
+
+static
+Anum
+testDeco2Dist (
+const ArchDeco2 * const     archptr,
+Anum                        domnidx0,
+Anum                        domnidx1,
+Gnum * const                disttab,
+Gnum * const                queutab)
+{
+  const ArchDeco2Levl * levlptr;
+  Anum                  levlnum;
+  Anum                  levlnum0;
+  Anum                  levlnum1;
+
+  const ArchSubData * const   domntab = archptr->domntab;
+  const ArchDeco2Data * const doextab = archptr->doextab;
+  const Anum * const          vnumtab = archptr->vnumtab;
+
+  if (domnidx0 == domnidx1)
+    return (0);
+
+  levlnum0 = doextab[domnidx0].levlnum;
+  levlnum1 = doextab[domnidx1].levlnum;
+  levlnum  = MAX (levlnum0, levlnum1);
+  levlptr  = &archptr->levltab[levlnum];
+
+  while ((levlnum0 < levlnum1) &&                 /* Bring both domains to the same level, if possible */
+         (doextab[domntab[domnidx0].dfatidx].levlnum <= levlnum1)) {
+    domnidx0 = domntab[domnidx0].dfatidx;
+    levlnum0 = doextab[domnidx0].levlnum;
+  }
+  while ((levlnum1 < levlnum0) &&
+         (doextab[domntab[domnidx1].dfatidx].levlnum <= levlnum0)) {
+    domnidx1 = domntab[domnidx1].dfatidx;
+    levlnum1 = doextab[domnidx1].levlnum;
+  }
+
+  while (domnidx0 != domnidx1) {
+    Anum                distval;
+
+    distval = testDeco2DistLevl (levlptr,
+                                 vnumtab[doextab[domnidx0].vnumidx - (levlnum - levlnum0)],
+                                 vnumtab[doextab[domnidx1].vnumidx - (levlnum - levlnum1)],
+                                 disttab, queutab);
+    if (distval >= 0)
+      return (distval);
+
+    levlnum ++;                                   /* Try at coarser level */
+    levlptr ++;
+    if (doextab[domntab[domnidx0].dfatidx].levlnum <= levlnum) {
+      domnidx0 = domntab[domnidx0].dfatidx;
+      levlnum0 = levlnum;
+    }
+    if (doextab[domntab[domnidx1].dfatidx].levlnum <= levlnum) {
+      domnidx1 = domntab[domnidx1].dfatidx;
+      levlnum1 = levlnum;
+    }
+  }
+
+  return (levlptr->grafdat.velotax[vnumtab[domnidx0]]); /* Same domain: half distance of domain */
+}
+
+/*************************/
+/*                       */
+/* The checking routine. */
+/*                       */
+/*************************/
+
+/* This routine checks that the given
+** architecture exercises all the distance
+** computation paths, and that the distances
+** between all pairs of terminal domains are
+** the ones of the reference search.
+** It returns:
+** - 0   : if all distances are correct.
+** - !0  : on error.
+*/
+
+static
+int
+testDeco2Check (
+const Arch * const          archptr)
+{
+  const ArchDeco2 *     deco2ptr;
+  const ArchDeco2Levl * levlptr;
+  ArchDom               domndat0;
+  ArchDom               domndat1;
+  Gnum *                disttab;
+  Gnum *                queutab;
+  Gnum                  vertmax;
+  Gnum                  vertnum0;
+  Gnum                  vertnum1;
+  Gnum                  prunnbr;
+  Anum                  levlnum;
+  Anum                  tablnbr;
+  Anum                  termnum0;
+  Anum                  termnum1;
+  int                   o;
+
+  if (archptr->class->domDist != (Anum (*) ()) archDeco2DomDist) {
+    SCOTCH_errorPrint ("testDeco2Check: not a type-2 decomposition-described architecture");
+    return (1);
+  }
+  deco2ptr = (const ArchDeco2 *) &archptr->data;
+
+  levlptr = &deco2ptr->levltab[0];
+  if ((levlptr->grafdat.vertnbr <= ARCHDECO2DISTTABMAX) || /* Finest level must be searched, not tabulated */
+      (levlptr->disttab != NULL) ||
+      (levlptr->landtab == NULL)) {
+    SCOTCH_errorPrint ("testDeco2Check: finest level should have landmarks");
+    return (1);
+  }
+  for (levlnum = 0, tablnbr = 0, vertmax = 0; levlnum <= deco2ptr->levlmax; levlnum ++) {
+    if (deco2ptr->levltab[levlnum].disttab != NULL)
+      tablnbr ++;
+    if (vertmax < deco2ptr->levltab[levlnum].grafdat.vertnbr)
+      vertmax = deco2ptr->levltab[levlnum].grafdat.vertnbr;
+  }
+  if (tablnbr <= 0) {
+    SCOTCH_errorPrint ("testDeco2Check: no level has a distance table");
+    return (1);
+  }
+
+  for (vertnum0 = levlptr->grafdat.baseval, prunnbr = 0; /* Count finest vertex pairs pruned by landmarks */
+       vertnum0 < levlptr->grafdat.vertnnd; vertnum0 ++) {
+    for (vertnum1 = levlptr->grafdat.baseval; vertnum1 < levlptr->grafdat.vertnnd; vertnum1 ++) {
+      const byte *        landptr0;
+      const byte *        landptr1;
+      int                 landnum;
+
+      landptr0 = levlptr->landtab + (vertnum0 - levlptr->grafdat.baseval) * ARCHDECO2LANDNBR;
+      landptr1 = levlptr->landtab + (vertnum1 - levlptr->grafdat.baseval) * ARCHDECO2LANDNBR;
+      for (landnum = 0; landnum < ARCHDECO2LANDNBR; landnum ++) {
+        if (abs ((int) landptr0[landnum] - (int) landptr1[landnum]) > (ARCHDECO2PASSNBR + 1)) {
+          prunnbr ++;
+          break;
+        }
+      }
+    }
+  }
+  if ((prunnbr <= 0) ||
+      (prunnbr >= (levlptr->grafdat.vertnbr * levlptr->grafdat.vertnbr))) {
+    SCOTCH_errorPrint ("testDeco2Check: landmarks should prune some searches only");
+    return (1);
+  }
+  printf ("Levels: %ld, tabulated: %ld, finest vertices: %ld, pruned pairs: %ld\n",
+          (long) (deco2ptr->levlmax + 1), (long) tablnbr, (long) levlptr->grafdat.vertnbr, (long) prunnbr);
+
+  if (((disttab = malloc (vertmax * sizeof (Gnum))) == NULL) ||
+      ((queutab = malloc ((vertmax + ARCHDECO2PASSNBR + 2) * sizeof (Gnum))) == NULL)) {
+    SCOTCH_errorPrint ("testDeco2Check: out of memory");
+    return (1);
+  }
+
+  o = 0;
+  for (termnum0 = 0; termnum0 < deco2ptr->termnbr; termnum0 ++) {
+    archDomTerm (archptr, &domndat0, termnum0);
+    for (termnum1 = 0; termnum1 < deco2ptr->termnbr; termnum1 ++) {
+      Anum                distval;
+      Anum                distref;
+
+      archDomTerm (archptr, &domndat1, termnum1);
+      distval = archDomDist (archptr, &domndat0, &domndat1);
+      distref = testDeco2Dist (deco2ptr, domndat0.data.deco2.domnidx, domndat1.data.deco2.domnidx, disttab, queutab);
+      if (distval != distref) {
+        SCOTCH_errorPrint ("testDeco2Check: invalid distance between terminals %ld and %ld (%ld, should be %ld)",
+                           (long) termnum0, (long) termnum1, (long) distval, (long) distref);
+        o = 1;
+        goto abort;
+      }
+    }
+  }
+
+abort:
+  free (queutab);
+  free (disttab);
+
+  return (o);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  FILE *              fileptr;
+  SCOTCH_Graph        grafdat;
+  SCOTCH_Arch         archdat;
+  SCOTCH_Num          vertnbr;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if (argc != 2) {
+    SCOTCH_errorPrint ("usage: %s graph_file", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_randomReset ();
+
+  if (SCOTCH_graphInit (&grafdat) != 0) {
+    SCOTCH_errorPrint ("main: cannot initialize graph");
+    exit (EXIT_FAILURE);
+  }
+  if ((fileptr = fopen (argv[1], "r")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open file");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_graphLoad (&grafdat, fileptr, -1, 0) != 0) {
+    SCOTCH_errorPrint ("main: cannot load graph");
+    exit (EXIT_FAILURE);
+  }
+  fclose (fileptr);
+
+  SCOTCH_graphSize (&grafdat, &vertnbr, NULL);
+  if (vertnbr <= ARCHDECO2DISTTABMAX) {
+    SCOTCH_errorPrint ("main: graph is too small");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((SCOTCH_archInit   (&archdat) != 0) ||
+      (SCOTCH_archBuild2 (&archdat, &grafdat, vertnbr, NULL) != 0)) {
+    SCOTCH_errorPrint ("main: cannot build architecture");
+    exit (EXIT_FAILURE);
+  }
+
+  if (testDeco2Check ((Arch *) &archdat) != 0)
+    exit (EXIT_FAILURE);
+
+  SCOTCH_archExit  (&archdat);
+  SCOTCH_graphExit (&grafdat);
+
+  exit (EXIT_SUCCESS);
+}
@@ -0,0 +1,215 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_common_sort.c                      **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the radix sorting     **/
+/**                routines of the common module.          **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#ifndef _XOPEN_SOURCE
+#define _XOPEN_SOURCE               600
+#endif /* _XOPEN_SOURCE */
+#ifndef __USE_XOPEN2K
+#define __USE_XOPEN2K                             /* For POSIX pthread_barrier_t */
+#endif /* __USE_XOPEN2K */
+
+#include <stdio.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+#include "../libscotch/common_thread.h"
+#include "../libscotch/common_thread_system.h"
+
+/*************************/
+/*                       */
+/* The checking routine. */
+/*                       */
+/*************************/
+
+/* This routine sorts a random array of
+** pairs with all radix sorting routines,
+** and checks the results against those
+** of the quicksort routines. The second
+** value of each pair is its initial index,
+** so that pair integrity can be checked.
+** It returns:
+** - 0   : if all results are correct.
+** - !0  : on error.
+*/
+
+static
+int
+testSort (
+INT * const                 reftab,               /* Reference array      */
+INT * const                 sorttab,              /* Array to sort        */
+const INT                   sortnbr,              /* Number of pairs      */
+const INT                   keybas,               /* Minimum key value    */
+const INT                   keyrng,               /* Range of key values  */
+Context * const             contptr)              /* Context, or NULL     */
+{
+  INT                 sortnum;
+
+  for (sortnum = 0; sortnum < sortnbr; sortnum ++) {
+    reftab[2 * sortnum]     = keybas + (INT) intRandVal (&intranddat, (UINT) keyrng);
+    reftab[2 * sortnum + 1] = sortnum;
+  }
+
+  memCpy (sorttab, reftab, 2 * sortnbr * sizeof (INT));
+  intRsort2asc1 (sorttab, sortnbr, contptr);
+  for (sortnum = 1; sortnum < sortnbr; sortnum ++) {
+    if (sorttab[2 * sortnum] < sorttab[2 * sortnum - 2]) {
+      SCOTCH_errorPrint ("testSort: invalid order (1)");
+      return (1);
+    }
+  }
+  for (sortnum = 0; sortnum < sortnbr; sortnum ++) { /* Check that pairs have not been altered */
+    if (reftab[2 * sorttab[2 * sortnum + 1]] != sorttab[2 * sortnum]) {
+      SCOTCH_errorPrint ("testSort: invalid pair");
+      return (1);
+    }
+  }
+
+  for (sortnum = 0; sortnum < 2 * sortnbr; sortnum ++) /* Sort random pairs by both keys */
+    reftab[sortnum] = keybas + (INT) intRandVal (&intranddat, (UINT) keyrng);
+  memCpy (sorttab, reftab, 2 * sortnbr * sizeof (INT));
+  intSort2asc2  (reftab,  sortnbr);
+  intRsort2asc2 (sorttab, sortnbr, contptr);
+  if (memcmp (sorttab, reftab, 2 * sortnbr * sizeof (INT)) != 0) {
+    SCOTCH_errorPrint ("testSort: invalid order (2)");
+    return (1);
+  }
+
+  for (sortnum = 0; sortnum < 2 * sortnbr; sortnum ++) /* Sort key values alone */
+    reftab[sortnum] = keybas + (INT) intRandVal (&intranddat, (UINT) keyrng);
+  memCpy (sorttab, reftab, 2 * sortnbr * sizeof (INT));
+  intSort1asc1  (reftab,  2 * sortnbr);
+  intRsort1asc1 (sorttab, 2 * sortnbr, contptr);
+  if (memcmp (sorttab, reftab, 2 * sortnbr * sizeof (INT)) != 0) {
+    SCOTCH_errorPrint ("testSort: invalid order (3)");
+    return (1);
+  }
+
+  return (0);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  ThreadContext       thrddat;
+  Context             contdat;
+  INT *               reftab;
+  INT *               sorttab;
+  INT                 sortmax;
+  int                 thrdnbr;
+  int                 passnum;
+
+  static const INT    sortnbrtab[] = { 0, 1, 100, 4095, 4096, 10007, 100000 };
+  static const INT    keyrngtab[]  = { 1, 7, 1000, INTVALMAX };
+
+  SCOTCH_errorProg (argv[0]);
+
+  intRandInit (&intranddat);                      /* Initialize random generator */
+
+  sortmax = 100000;
+  if (argc > 2) {
+    SCOTCH_errorPrint ("usage: %s [thrdnbr]", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+#ifdef SCOTCH_PTHREAD_NUMBER
+  thrdnbr = SCOTCH_PTHREAD_NUMBER;                /* If prescribed number defined at compile time, use it as default */
+#else /* SCOTCH_PTHREAD_NUMBER */
+  thrdnbr = -1;                                   /* Else take the number of cores at run time */
+#endif /* SCOTCH_PTHREAD_NUMBER */
+  thrdnbr = envGetInt ("SCOTCH_PTHREAD_NUMBER", thrdnbr);
+  if (argc > 1)
+    thrdnbr = atoi (argv[1]);
+  if (thrdnbr < 1)
+    thrdnbr = threadSystemCoreNbr ();
+
+  if (threadContextInit (&thrddat, thrdnbr, NULL) != 0) {
+    SCOTCH_errorPrint ("main: cannot initialize thread context");
+    exit              (EXIT_FAILURE);
+  }
+  contdat.thrdptr = &thrddat;                     /* Only the thread context is used by sorting routines */
+  contdat.randptr = &intranddat;
+  contdat.valuptr = NULL;
+
+  if (((reftab  = malloc (2 * sortmax * sizeof (INT))) == NULL) ||
+      ((sorttab = malloc (2 * sortmax * sizeof (INT))) == NULL)) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+
+  for (passnum = 0; passnum < (int) (sizeof (sortnbrtab) / sizeof (INT)); passnum ++) {
+    int                 keynum;
+
+    for (keynum = 0; keynum < (int) (sizeof (keyrngtab) / sizeof (INT)); keynum ++) {
+      INT                 keybas;
+
+      keybas = (keyrngtab[keynum] == INTVALMAX) ? (- INTVALMAX / 2) : -3; /* Test negative keys too */
+      if ((testSort (reftab, sorttab, sortnbrtab[passnum], keybas, keyrngtab[keynum], NULL) != 0) ||
+          (testSort (reftab, sorttab, sortnbrtab[passnum], keybas, keyrngtab[keynum], &contdat) != 0)) {
+        SCOTCH_errorPrint ("main: error for " INTSTRING " items with key range " INTSTRING,
+                           (INT) sortnbrtab[passnum], (INT) keyrngtab[keynum]);
+        exit (EXIT_FAILURE);
+      }
+    }
+  }
+
+  free (sorttab);
+  free (reftab);
+
+  threadContextExit (&thrddat);
+
+  exit (EXIT_SUCCESS);
+}
@@ -0,0 +1,489 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_dgraph_fold.c                      **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the node-aware        **/
+/**                folding of distributed graphs and of    **/
+/**                distributed halo graphs, by forcing a   **/
+/**                node mapping which permutes process     **/
+/**                ranks and comparing both folded halves  **/
+/**                to the centralized graph.               **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+#include "../libscotch/graph.h"
+#include "../libscotch/dgraph.h"
+#include "../libscotch/dgraph_fold_comm.h"
+#include "../libscotch/hdgraph.h"
+
+#define PROCNODSIZ                  2             /* Number of processes per simulated node */
+
+/*************************/
+/*                       */
+/* The checking routine. */
+/*                       */
+/*************************/
+
+/* This routine checks that the given folded
+** graph holds, for its share of vertices, the
+** same vertex loads and adjacencies as the
+** centralized graph, using the original global
+** numbers of folded vertices. It also checks
+** that every original vertex has been folded
+** exactly once in the folded communicator.
+** It returns:
+** - 0   : if folded graph is consistent.
+** - !0  : on error.
+*/
+
+static
+int
+testDgraphFoldCheck (
+Dgraph * const              fldgrafptr,           /* Folded graph                            */
+const Gnum * const          fldvnumloctab,        /* Original global numbers of local vertices */
+const Graph * const         cgrfptr)              /* Centralized original graph              */
+{
+  Gnum *              fldvnumgsttax;              /* Original numbers of local and ghost vertices */
+  Gnum *              edgetab;                    /* Sorted adjacency of folded vertex            */
+  Gnum *              edgeorgtab;                 /* Sorted adjacency of original vertex          */
+  int *               vertflagtab;                /* Number of times original vertices are folded */
+  int *               vertflagtmp;
+  Gnum                vertlocnum;
+  Gnum                vertnum;
+  int                 o;
+
+  if (dgraphCheck (fldgrafptr) != 0) {
+    SCOTCH_errorPrint ("testDgraphFoldCheck: invalid folded graph");
+    return (1);
+  }
+  if ((fldgrafptr->vertglbnbr != cgrfptr->vertnbr) ||
+      (fldgrafptr->edgeglbnbr != cgrfptr->edgenbr) ||
+      (fldgrafptr->veloglbsum != cgrfptr->velosum)) {
+    SCOTCH_errorPrint ("testDgraphFoldCheck: invalid folded graph sizes");
+    return (1);
+  }
+  if (dgraphGhst (fldgrafptr) != 0) {
+    SCOTCH_errorPrint ("testDgraphFoldCheck: cannot compute ghost edge array");
+    return (1);
+  }
+
+  if (memAllocGroup ((void **) (void *)
+                     &fldvnumgsttax, (size_t) (fldgrafptr->vertgstnbr * sizeof (Gnum)),
+                     &edgetab,       (size_t) (cgrfptr->degrmax       * sizeof (Gnum)),
+                     &edgeorgtab,    (size_t) (cgrfptr->degrmax       * sizeof (Gnum)),
+                     &vertflagtab,   (size_t) (cgrfptr->vertnbr       * sizeof (int)),
+                     &vertflagtmp,   (size_t) (cgrfptr->vertnbr       * sizeof (int)), NULL) == NULL) {
+    SCOTCH_errorPrint ("testDgraphFoldCheck: out of memory");
+    return (1);
+  }
+  memCpy (fldvnumgsttax, fldvnumloctab, fldgrafptr->vertlocnbr * sizeof (Gnum));
+  memSet (vertflagtmp, 0, cgrfptr->vertnbr * sizeof (int));
+  fldvnumgsttax -= fldgrafptr->baseval;
+
+  o = 1;                                          /* Assume an error */
+  if (dgraphHaloSync (fldgrafptr, fldvnumgsttax + fldgrafptr->baseval, GNUM_MPI) != 0) {
+    SCOTCH_errorPrint ("testDgraphFoldCheck: cannot halo original vertex numbers");
+    goto abort;
+  }
+
+  for (vertlocnum = fldgrafptr->baseval; vertlocnum < fldgrafptr->vertlocnnd; vertlocnum ++) {
+    Gnum                vertorgnum;
+    Gnum                degrval;
+    Gnum                edgelocnum;
+    Gnum                edgenum;
+
+    vertorgnum = fldvnumgsttax[vertlocnum];
+    if ((vertorgnum < cgrfptr->baseval) || (vertorgnum >= cgrfptr->vertnnd)) {
+      SCOTCH_errorPrint ("testDgraphFoldCheck: invalid original vertex number");
+      goto abort;
+    }
+    vertflagtmp[vertorgnum - cgrfptr->baseval] ++;
+
+    if ((fldgrafptr->veloloctax != NULL) &&
+        (fldgrafptr->veloloctax[vertlocnum] != ((cgrfptr->velotax != NULL) ? cgrfptr->velotax[vertorgnum] : 1))) {
+      SCOTCH_errorPrint ("testDgraphFoldCheck: invalid vertex load");
+      goto abort;
+    }
+
+    degrval = fldgrafptr->vendloctax[vertlocnum] - fldgrafptr->vertloctax[vertlocnum];
+    if (degrval != (cgrfptr->vendtax[vertorgnum] - cgrfptr->verttax[vertorgnum])) {
+      SCOTCH_errorPrint ("testDgraphFoldCheck: invalid vertex degree");
+      goto abort;
+    }
+    for (edgelocnum = fldgrafptr->vertloctax[vertlocnum], edgenum = 0;
+         edgelocnum < fldgrafptr->vendloctax[vertlocnum]; edgelocnum ++, edgenum ++)
+      edgetab[edgenum] = fldvnumgsttax[fldgrafptr->edgegsttax[edgelocnum]];
+    memCpy (edgeorgtab, cgrfptr->edgetax + cgrfptr->verttax[vertorgnum], degrval * sizeof (Gnum));
+    intSort1asc1 (edgetab,    degrval);
+    intSort1asc1 (edgeorgtab, degrval);
+    if (memcmp (edgetab, edgeorgtab, degrval * sizeof (Gnum)) != 0) {
+      SCOTCH_errorPrint ("testDgraphFoldCheck: invalid vertex adjacency");
+      goto abort;
+    }
+  }
+
+  if (MPI_Allreduce (vertflagtmp, vertflagtab, cgrfptr->vertnbr, MPI_INT, MPI_SUM, fldgrafptr->proccomm) != MPI_SUCCESS) {
+    SCOTCH_errorPrint ("testDgraphFoldCheck: communication error");
+    goto abort;
+  }
+  for (vertnum = 0; vertnum < cgrfptr->vertnbr; vertnum ++) {
+    if (vertflagtab[vertnum] != 1) {
+      SCOTCH_errorPrint ("testDgraphFoldCheck: vertex not folded exactly once");
+      goto abort;
+    }
+  }
+
+  o = 0;                                          /* Everything went fine */
+abort :
+  memFree (fldvnumgsttax + fldgrafptr->baseval);  /* Free group leader */
+
+  return (o);
+}
+
+/* This routine checks that the given folded
+** halo graph holds, for its share of vertices
+** of the induced subgraph, the same vertex
+** loads as the centralized graph, all of the
+** edges of the centralized graph, either as
+** plain or halo edges, and only plain edges
+** to vertices of the induced subgraph. It also
+** checks that every vertex of the induced
+** subgraph has been folded exactly once in
+** the folded communicator.
+** It returns:
+** - 0   : if folded graph is consistent.
+** - !0  : on error.
+*/
+
+static
+int
+testHdgraphFoldCheck (
+Hdgraph * const             fldgrafptr,           /* Folded halo graph                          */
+const int * const           indflagtab,           /* Flags of induced vertices, by original number */
+const Graph * const         cgrfptr)              /* Centralized original graph                 */
+{
+  int *               vertflagtab;                /* Number of times original vertices are folded */
+  int *               vertflagtmp;
+  Gnum                vertlocnum;
+  Gnum                vertnum;
+  int                 o;
+
+  if (hdgraphCheck (fldgrafptr) != 0) {
+    SCOTCH_errorPrint ("testHdgraphFoldCheck: invalid folded graph");
+    return (1);
+  }
+
+  if (memAllocGroup ((void **) (void *)
+                     &vertflagtab, (size_t) (cgrfptr->vertnbr * sizeof (int)),
+                     &vertflagtmp, (size_t) (cgrfptr->vertnbr * sizeof (int)), NULL) == NULL) {
+    SCOTCH_errorPrint ("testHdgraphFoldCheck: out of memory");
+    return (1);
+  }
+  memSet (vertflagtmp, 0, cgrfptr->vertnbr * sizeof (int));
+
+  o = 1;                                          /* Assume an error */
+  for (vertlocnum = fldgrafptr->s.baseval; vertlocnum < fldgrafptr->s.vertlocnnd; vertlocnum ++) {
+    Gnum                vertorgnum;
+    Gnum                degrval;
+    Gnum                edgenum;
+
+    vertorgnum = fldgrafptr->s.vnumloctax[vertlocnum];
+    if ((vertorgnum < cgrfptr->baseval) || (vertorgnum >= cgrfptr->vertnnd) ||
+        (indflagtab[vertorgnum - cgrfptr->baseval] == 0)) {
+      SCOTCH_errorPrint ("testHdgraphFoldCheck: invalid original vertex number");
+      goto abort;
+    }
+    vertflagtmp[vertorgnum - cgrfptr->baseval] ++;
+
+    if ((fldgrafptr->s.veloloctax != NULL) &&
+        (fldgrafptr->s.veloloctax[vertlocnum] != ((cgrfptr->velotax != NULL) ? cgrfptr->velotax[vertorgnum] : 1))) {
+      SCOTCH_errorPrint ("testHdgraphFoldCheck: invalid vertex load");
+      goto abort;
+    }
+
+    if ((fldgrafptr->vhndloctax[vertlocnum] - fldgrafptr->s.vertloctax[vertlocnum]) != /* Halo edges are kept */
+        (cgrfptr->vendtax[vertorgnum] - cgrfptr->verttax[vertorgnum])) {
+      SCOTCH_errorPrint ("testHdgraphFoldCheck: invalid vertex degree");
+      goto abort;
+    }
+    for (edgenum = cgrfptr->verttax[vertorgnum], degrval = 0; edgenum < cgrfptr->vendtax[vertorgnum]; edgenum ++)
+      degrval += indflagtab[cgrfptr->edgetax[edgenum] - cgrfptr->baseval];
+    if ((fldgrafptr->s.vendloctax[vertlocnum] - fldgrafptr->s.vertloctax[vertlocnum]) != degrval) {
+      SCOTCH_errorPrint ("testHdgraphFoldCheck: invalid non-halo vertex degree");
+      goto abort;
+    }
+  }
+
+  if (MPI_Allreduce (vertflagtmp, vertflagtab, cgrfptr->vertnbr, MPI_INT, MPI_SUM, fldgrafptr->s.proccomm) != MPI_SUCCESS) {
+    SCOTCH_errorPrint ("testHdgraphFoldCheck: communication error");
+    goto abort;
+  }
+  for (vertnum = 0; vertnum < cgrfptr->vertnbr; vertnum ++) {
+    if (vertflagtab[vertnum] != indflagtab[vertnum]) {
+      SCOTCH_errorPrint ("testHdgraphFoldCheck: vertex not folded exactly once");
+      goto abort;
+    }
+  }
+
+  o = 0;                                          /* Everything went fine */
+abort :
+  memFree (vertflagtab);                          /* Free group leader */
+
+  return (o);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  MPI_Comm            proccomm;
+  int                 procglbnbr;                 /* Number of processes sharing graph data */
+  int                 proclocnum;                 /* Number of this process                 */
+  int                 procldrnum;                 /* Leader of simulated node of process    */
+  const int *         procnodtab;
+  const int *         procnodtmp;
+  Dgraph              grafdat;
+  Graph               cgrfdat;
+  Hdgraph             hgrfdat;                    /* Halo graph without halo, built on grafdat */
+  Hdgraph             indgrafdat;                 /* Induced halo graph                        */
+  Gnum *              vnumloctab;                 /* Original global numbers of vertices */
+  Gnum *              indlisttab;                 /* List of induced local vertices      */
+  Gnum                indlistnbr;
+  int *               indflagtab;                 /* Flags of induced vertices           */
+  Gnum                vertlocnum;
+  Gnum                vertnum;
+  FILE *              fileptr;
+  int                 partval;
+#ifdef SCOTCH_PTHREAD
+  int                 thrdlvlreqval;
+  int                 thrdlvlproval;
+#endif /* SCOTCH_PTHREAD */
+
+  SCOTCH_errorProg (argv[0]);
+
+#ifdef SCOTCH_PTHREAD
+  thrdlvlreqval = MPI_THREAD_MULTIPLE;
+  if (MPI_Init_thread (&argc, &argv, thrdlvlreqval, &thrdlvlproval) != MPI_SUCCESS)
+    SCOTCH_errorPrint ("main: Cannot initialize (1)");
+  if (thrdlvlreqval > thrdlvlproval)
+    SCOTCH_errorPrint ("main: MPI implementation is not thread-safe: recompile without SCOTCH_PTHREAD");
+#else /* SCOTCH_PTHREAD */
+  if (MPI_Init (&argc, &argv) != MPI_SUCCESS)
+    SCOTCH_errorPrint ("main: Cannot initialize (2)");
+#endif /* SCOTCH_PTHREAD */
+
+  if (argc != 2) {
+    SCOTCH_errorPrint ("usage: %s graph_file", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  proccomm = MPI_COMM_WORLD;
+  MPI_Comm_size (proccomm, &procglbnbr);          /* Get communicator data */
+  MPI_Comm_rank (proccomm, &proclocnum);
+  if (procglbnbr < 3) {                           /* Need at least two simulated nodes */
+    SCOTCH_errorPrint ("main: at least three processes are required");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((fileptr = fopen (argv[1], "r")) == NULL) { /* Every process reads centralized reference graph */
+    SCOTCH_errorPrint ("main: cannot open file (1)");
+    exit (EXIT_FAILURE);
+  }
+  graphInit (&cgrfdat);
+  if (graphLoad (&cgrfdat, fileptr, -1, 0) != 0) {
+    SCOTCH_errorPrint ("main: cannot load centralized graph");
+    exit (EXIT_FAILURE);
+  }
+  fclose (fileptr);
+
+  fileptr = NULL;
+  if ((proclocnum == 0) &&
+      ((fileptr = fopen (argv[1], "r")) == NULL)) {
+    SCOTCH_errorPrint ("main: cannot open file (2)");
+    exit (EXIT_FAILURE);
+  }
+  dgraphInit (&grafdat, proccomm);
+  if (dgraphLoad (&grafdat, fileptr, -1, 0) != 0) {
+    SCOTCH_errorPrint ("main: cannot load distributed graph");
+    exit (EXIT_FAILURE);
+  }
+  if (fileptr != NULL)
+    fclose (fileptr);
+
+  procldrnum = proclocnum - (proclocnum % PROCNODSIZ); /* Simulate nodes of consecutive processes */
+  if (dgraphFoldCommNode2 (&grafdat, procldrnum, &procnodtab) != 0) {
+    SCOTCH_errorPrint ("main: cannot compute node data");
+    exit (EXIT_FAILURE);
+  }
+  if ((procnodtab == NULL) ||                     /* Simulated node mapping must permute processes */
+      (procnodtab[procglbnbr + 1] == 1)) {
+    SCOTCH_errorPrint ("main: invalid node data");
+    exit (EXIT_FAILURE);
+  }
+  if ((dgraphFoldCommNode (&grafdat, &procnodtmp) != 0) || /* Node data must be cached on communicator */
+      (procnodtmp != procnodtab)) {
+    SCOTCH_errorPrint ("main: node data not cached");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((vnumloctab = memAlloc (grafdat.vertlocnbr * sizeof (Gnum))) == NULL) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+  for (vertlocnum = 0; vertlocnum < grafdat.vertlocnbr; vertlocnum ++)
+    vnumloctab[vertlocnum] = grafdat.procvrttab[proclocnum] + vertlocnum;
+
+  for (partval = 0; partval < 2; partval ++) {
+    Dgraph              fldgrafdat;
+    Gnum *              fldvnumloctab;
+    int                 fldprocnum;               /* Expected rank in folded communicator */
+    int                 fldprocnbr;
+
+    fldprocnbr = (procglbnbr + 1) / 2;
+    fldprocnum = procnodtab[procglbnbr + proclocnum] - ((partval == 0) ? 0 : fldprocnbr);
+    if (partval != 0)
+      fldprocnbr = procglbnbr - fldprocnbr;
+
+    fldvnumloctab = NULL;
+    if (dgraphFold (&grafdat, partval, &fldgrafdat, vnumloctab, (void **) (void *) &fldvnumloctab, GNUM_MPI) != 0) {
+      SCOTCH_errorPrint ("main: cannot fold graph");
+      exit (EXIT_FAILURE);
+    }
+
+    if ((fldprocnum >= 0) && (fldprocnum < fldprocnbr)) { /* If process belongs to folded part */
+      if ((fldgrafdat.proccomm == MPI_COMM_NULL) ||
+          (fldgrafdat.proclocnum != fldprocnum) ||
+          (fldgrafdat.procglbnbr != fldprocnbr)) {
+        SCOTCH_errorPrint ("main: invalid folded communicator (%d)", partval);
+        exit (EXIT_FAILURE);
+      }
+      if (testDgraphFoldCheck (&fldgrafdat, fldvnumloctab, &cgrfdat) != 0) {
+        SCOTCH_errorPrint ("main: invalid folded graph (%d)", partval);
+        exit (EXIT_FAILURE);
+      }
+
+      memFree    (fldvnumloctab);
+      dgraphExit (&fldgrafdat);
+    }
+  }
+
+  if (memAllocGroup ((void **) (void *)          /* Induce subgraph with halo from vertices not multiple of 3 */
+                     &indlisttab, (size_t) (grafdat.vertlocnbr * sizeof (Gnum)),
+                     &indflagtab, (size_t) (cgrfdat.vertnbr    * sizeof (int)), NULL) == NULL) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+  for (vertnum = 0; vertnum < cgrfdat.vertnbr; vertnum ++)
+    indflagtab[vertnum] = ((vertnum % 3) != 0) ? 1 : 0;
+  for (vertlocnum = indlistnbr = 0; vertlocnum < grafdat.vertlocnbr; vertlocnum ++) {
+    if (indflagtab[grafdat.procvrttab[proclocnum] - grafdat.baseval + vertlocnum] != 0)
+      indlisttab[indlistnbr ++] = vertlocnum + grafdat.baseval;
+  }
+
+  if (dgraphGhst (&grafdat) != 0) {               /* Ghost edge array must belong to original graph */
+    SCOTCH_errorPrint ("main: cannot compute ghost edge array");
+    exit (EXIT_FAILURE);
+  }
+  hgrfdat.s            = grafdat;                 /* Copy non-halo graph data     */
+  hgrfdat.s.flagval   &= ~DGRAPHFREEALL;          /* Do not free anything from it */
+  hgrfdat.vhallocnbr   = 0;                       /* No halo on graph             */
+  hgrfdat.vhndloctax   = hgrfdat.s.vendloctax;
+  hgrfdat.ehallocnbr   = 0;
+  hgrfdat.levlnum      = 0;
+  hgrfdat.contptr      = NULL;                    /* No threaded routine called   */
+  if (hdgraphInduceList (&hgrfdat, indlistnbr, indlisttab, &indgrafdat) != 0) {
+    SCOTCH_errorPrint ("main: cannot induce halo graph");
+    exit (EXIT_FAILURE);
+  }
+
+  for (partval = 0; partval < 2; partval ++) {
+    Hdgraph             fldgrafdat;
+    int                 fldprocnum;               /* Expected rank in folded communicator */
+    int                 fldprocnbr;
+
+    fldprocnbr = (procglbnbr + 1) / 2;
+    fldprocnum = procnodtab[procglbnbr + proclocnum] - ((partval == 0) ? 0 : fldprocnbr);
+    if (partval != 0)
+      fldprocnbr = procglbnbr - fldprocnbr;
+
+    if (hdgraphFold (&indgrafdat, partval, &fldgrafdat) != 0) {
+      SCOTCH_errorPrint ("main: cannot fold halo graph");
+      exit (EXIT_FAILURE);
+    }
+
+    if ((fldprocnum >= 0) && (fldprocnum < fldprocnbr)) { /* If process belongs to folded part */
+      if ((fldgrafdat.s.proccomm == MPI_COMM_NULL) ||
+          (fldgrafdat.s.proclocnum != fldprocnum) ||
+          (fldgrafdat.s.procglbnbr != fldprocnbr) ||
+          (fldgrafdat.s.vertglbnbr != indgrafdat.s.vertglbnbr)) {
+        SCOTCH_errorPrint ("main: invalid folded halo communicator (%d)", partval);
+        exit (EXIT_FAILURE);
+      }
+      if (testHdgraphFoldCheck (&fldgrafdat, indflagtab, &cgrfdat) != 0) {
+        SCOTCH_errorPrint ("main: invalid folded halo graph (%d)", partval);
+        exit (EXIT_FAILURE);
+      }
+
+      hdgraphExit (&fldgrafdat);
+    }
+  }
+
+  hdgraphExit (&indgrafdat);
+  hdgraphExit (&hgrfdat);
+  memFree     (indlisttab);                       /* Free group leader */
+  memFree     (vnumloctab);
+  dgraphExit  (&grafdat);
+  graphExit  (&cgrfdat);
+
+  MPI_Finalize ();
+  exit (EXIT_SUCCESS);
+}
@@ -0,0 +1,246 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_gain.c                             **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the gain table        **/
+/**                routines.                               **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+#include "../libscotch/gain.h"
+
+/*
+**  The type and structure definitions.
+*/
+
+/* The gain cell structure. */
+
+typedef struct TestGain_ {
+  GainLink                  linkdat;              /* TRICK: FIRST */
+  INT                       gainval;              /* Gain value, or GAINMAX if not in table */
+} TestGain;
+
+/*************************/
+/*                       */
+/* The checking routine. */
+/*                       */
+/*************************/
+
+/* This routine checks that the first link
+** of the gain table is of minimum entry,
+** and that scanning the table yields all
+** the links in non-decreasing entry order.
+** It returns:
+** - 0   : if table is consistent.
+** - !0  : on error.
+*/
+
+static
+int
+testGainCheck (
+GainTabl * const            tablptr,
+const TestGain * const      nodetab,
+const int                   nodesiz,
+const int                   nodenbr)
+{
+  const GainLink *    linkptr;
+  const GainEntr *    entrptr;
+  int                 nodenum;
+  int                 linknbr;
+
+  linkptr = gainTablFrst (tablptr);
+  if (linkptr == NULL) {
+    if (nodenbr != 0) {
+      SCOTCH_errorPrint ("testGainCheck: table should not be empty");
+      return (1);
+    }
+    return (0);
+  }
+
+  for (nodenum = 0; nodenum < nodesiz; nodenum ++) { /* Check that no link has a smaller entry */
+    if ((nodetab[nodenum].gainval != GAINMAX) &&
+        (nodetab[nodenum].linkdat.tabl < linkptr->tabl)) {
+      SCOTCH_errorPrint ("testGainCheck: link is not of minimum entry");
+      return (1);
+    }
+  }
+
+  for (linknbr = 0, entrptr = linkptr->tabl; linkptr != NULL;
+       linknbr ++, linkptr = gainTablNext (tablptr, linkptr)) {
+    if (linkptr->tabl < entrptr) {
+      SCOTCH_errorPrint ("testGainCheck: links not in entry order");
+      return (1);
+    }
+    entrptr = linkptr->tabl;
+  }
+  if (linknbr != nodenbr) {
+    SCOTCH_errorPrint ("testGainCheck: invalid number of links");
+    return (1);
+  }
+
+  return (0);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  TestGain *          nodetab;
+  int                 nodesiz;
+  int                 nodenbr;
+  int                 nodenum;
+  int                 passnbr;
+  int                 passnum;
+  int                 tablnum;
+
+  SCOTCH_errorProg (argv[0]);
+
+  intRandInit (&intranddat);                      /* Initialize random generator */
+
+  nodesiz = 100;
+  passnbr = -1;
+  switch (argc) {
+    case 4 :
+      intRandSeed (&intranddat, MAX (0, atoi (argv[3])));
+    case 3 :
+      passnbr = MAX (1, atoi (argv[2]));
+    case 2 :
+      nodesiz = MAX (1, atoi (argv[1]));
+    case 1 :
+      break;
+    default :
+      SCOTCH_errorPrint ("usage: %s [nodenbr [passnbr [seed]]]", argv[0]);
+      exit (EXIT_FAILURE);
+  }
+  if (passnbr < 0)
+    passnbr = 10 * nodesiz;
+
+  if ((nodetab = malloc (nodesiz * sizeof (TestGain))) == NULL) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+
+  for (tablnum = 0; tablnum < 2; tablnum ++) {    /* Test linear, then logarithmic tables */
+    GainTabl *          tablptr;
+    INT                 gainmax;
+
+    gainmax = (tablnum == 0) ? (GAIN_LINMAX - 24) : 1000000; /* Keep away from last entry, skipped by gainTablNext() */
+    if ((tablptr = gainTablInit ((tablnum == 0) ? 0 : GAINMAX, 4)) == NULL) {
+      SCOTCH_errorPrint ("main: cannot initialize gain table");
+      exit (EXIT_FAILURE);
+    }
+
+    for (nodenum = 0; nodenum < nodesiz; nodenum ++) /* Initialize node array */
+      nodetab[nodenum].gainval = GAINMAX;
+
+    nodenbr = 0;                                  /* Table is empty */
+    for (passnum = 0; passnum < passnbr; passnum ++) {
+      GainLink *          linkptr;
+
+      switch (intRandVal (&intranddat, 8)) {
+        case 0 :                                  /* Add node */
+        case 1 :
+        case 2 :                                  /* More additions than deletions on average */
+          if (nodenbr >= nodesiz)
+            break;
+          for (nodenum = 0; nodetab[nodenum].gainval != GAINMAX; nodenum ++) ; /* Search for a free slot */
+          nodetab[nodenum].gainval = (INT) intRandVal (&intranddat, 2 * gainmax + 1) - gainmax;
+          gainTablAdd (tablptr, &nodetab[nodenum].linkdat, nodetab[nodenum].gainval);
+          nodenbr ++;
+          break;
+        case 3 :                                  /* Remove arbitrary node */
+          if (nodenbr <= 0)
+            break;
+          do
+            nodenum = (int) intRandVal (&intranddat, nodesiz);
+          while (nodetab[nodenum].gainval == GAINMAX);
+          gainTablDel (tablptr, &nodetab[nodenum].linkdat);
+          nodetab[nodenum].gainval = GAINMAX;
+          nodenbr --;
+          break;
+        case 4 :                                  /* Remove first node, as done by FM algorithms */
+        case 5 :
+          if ((linkptr = gainTablFrst (tablptr)) == NULL)
+            break;
+          gainTablDel (tablptr, linkptr);
+          ((TestGain *) linkptr)->gainval = GAINMAX;
+          nodenbr --;
+          break;
+        case 6 :                                  /* Check table consistency */
+          if (testGainCheck (tablptr, nodetab, nodesiz, nodenbr) != 0)
+            exit (EXIT_FAILURE);
+          break;
+        case 7 :                                  /* Flush table from time to time */
+          if (intRandVal (&intranddat, nodesiz) != 0)
+            break;
+          gainTablFree (tablptr);
+          for (nodenum = 0; nodenum < nodesiz; nodenum ++)
+            nodetab[nodenum].gainval = GAINMAX;
+          nodenbr = 0;
+          break;
+      }
+    }
+    if (testGainCheck (tablptr, nodetab, nodesiz, nodenbr) != 0)
+      exit (EXIT_FAILURE);
+
+    gainTablExit (tablptr);
+  }
+
+  free (nodetab);
+
+  exit (EXIT_SUCCESS);
+}
@@ -0,0 +1,338 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_mesh_coarsen.c                     **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the mesh coarsening   **/
+/**                routine, by comparing the coarse meshes **/
+/**                built by the sequential and threaded    **/
+/**                paths to the coarse mesh defined by     **/
+/**                their multinode arrays.                 **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+#include "../libscotch/context.h"
+#include "../libscotch/graph.h"
+#include "../libscotch/mesh.h"
+#include "../libscotch/mesh_coarsen.h"
+
+#define LEVLNBR                     3             /* Number of coarsening levels */
+
+/*************************/
+/*                       */
+/* The checking routine. */
+/*                       */
+/*************************/
+
+/* This routine checks that the given coarse
+** mesh is the one defined by the fine mesh and
+** the multinode array: coarse vertex loads are
+** the sums of the loads of their fine vertices,
+** and the neighbors of every coarse element are
+** exactly the coarse nodes of the fine nodes of
+** its fine elements. Node adjacencies must be
+** sorted by increasing element number, as done
+** by the sequential building routine.
+** It returns:
+** - 0   : if coarse mesh is consistent.
+** - !0  : on error.
+*/
+
+static
+int
+testMeshCoarsenCheck (
+const Mesh * const          finemeshptr,
+const Mesh * const          coarmeshptr,
+const Gnum * const          finecoartax)
+{
+  Gnum *              coarflagtax;                /* Flag array for coarse vertices     */
+  Gnum *              coarlodetax;                /* Expected loads of coarse vertices  */
+  Gnum *              coarcnttax;                 /* Number of fine vertices per vertex */
+  Gnum *              coarpairtax;                /* Fine elements of coarse elements   */
+  Gnum                coarvertnbr;
+  Gnum                coarvertnum;
+  Gnum                coarveisnbr;
+  Gnum                coardegrmax;
+  Gnum                finevertnum;
+  int                 o;
+
+  if (meshCheck (coarmeshptr) != 0) {
+    SCOTCH_errorPrint ("testMeshCoarsenCheck: invalid coarse mesh");
+    return (1);
+  }
+  if ((coarmeshptr->velosum != finemeshptr->velosum) ||
+      (coarmeshptr->vnlosum != finemeshptr->vnlosum)) {
+    SCOTCH_errorPrint ("testMeshCoarsenCheck: invalid load sums");
+    return (1);
+  }
+
+  coarvertnbr = coarmeshptr->velmnbr + coarmeshptr->vnodnbr;
+  if (memAllocGroup ((void **) (void *)
+                     &coarflagtax, (size_t) (coarvertnbr * sizeof (Gnum)),
+                     &coarlodetax, (size_t) (coarvertnbr * sizeof (Gnum)),
+                     &coarcnttax,  (size_t) (coarvertnbr * sizeof (Gnum)),
+                     &coarpairtax, (size_t) (coarmeshptr->velmnbr * 2 * sizeof (Gnum)), NULL) == NULL) {
+    SCOTCH_errorPrint ("testMeshCoarsenCheck: out of memory");
+    return (1);
+  }
+  memSet (coarflagtax, ~0, coarvertnbr * sizeof (Gnum));
+  memSet (coarlodetax,  0, coarvertnbr * sizeof (Gnum));
+  memSet (coarcnttax,   0, coarvertnbr * sizeof (Gnum));
+  memSet (coarpairtax, ~0, coarmeshptr->velmnbr * 2 * sizeof (Gnum));
+  coarflagtax -= coarmeshptr->baseval;
+  coarlodetax -= coarmeshptr->baseval;
+  coarcnttax  -= coarmeshptr->baseval;
+  coarpairtax -= 2 * coarmeshptr->velmbas;
+
+  o = 1;                                          /* Assume an error */
+  for (finevertnum = finemeshptr->velmbas; finevertnum < finemeshptr->velmnnd; finevertnum ++) {
+    coarvertnum = finecoartax[finevertnum];
+    if ((coarvertnum < coarmeshptr->velmbas) || (coarvertnum >= coarmeshptr->velmnnd)) {
+      SCOTCH_errorPrint ("testMeshCoarsenCheck: invalid element multinode array");
+      goto abort;
+    }
+    coarlodetax[coarvertnum] += (finemeshptr->velotax != NULL) ? finemeshptr->velotax[finevertnum] : 1;
+    coarcnttax[coarvertnum] ++;
+  }
+  for (finevertnum = finemeshptr->vnodbas; finevertnum < finemeshptr->vnodnnd; finevertnum ++) {
+    coarvertnum = finecoartax[finevertnum];
+    if ((coarvertnum < coarmeshptr->vnodbas) || (coarvertnum >= coarmeshptr->vnodnnd)) {
+      SCOTCH_errorPrint ("testMeshCoarsenCheck: invalid node multinode array");
+      goto abort;
+    }
+    coarlodetax[coarvertnum] += (finemeshptr->vnlotax != NULL) ? finemeshptr->vnlotax[finevertnum] : 1;
+    coarcnttax[coarvertnum] ++;
+  }
+
+  for (coarvertnum = coarmeshptr->velmbas; coarvertnum < coarmeshptr->velmnnd; coarvertnum ++) {
+    if ((coarcnttax[coarvertnum] < 1) || (coarcnttax[coarvertnum] > 2)) {
+      SCOTCH_errorPrint ("testMeshCoarsenCheck: invalid number of fine elements");
+      goto abort;
+    }
+    if (coarlodetax[coarvertnum] != ((coarmeshptr->velotax != NULL) ? coarmeshptr->velotax[coarvertnum] : 1)) {
+      SCOTCH_errorPrint ("testMeshCoarsenCheck: invalid element load");
+      goto abort;
+    }
+  }
+  for (coarvertnum = coarmeshptr->vnodbas; coarvertnum < coarmeshptr->vnodnnd; coarvertnum ++) {
+    if (coarcnttax[coarvertnum] < 1) {
+      SCOTCH_errorPrint ("testMeshCoarsenCheck: coarse node without fine node");
+      goto abort;
+    }
+    if (coarlodetax[coarvertnum] != ((coarmeshptr->vnlotax != NULL) ? coarmeshptr->vnlotax[coarvertnum] : 1)) {
+      SCOTCH_errorPrint ("testMeshCoarsenCheck: invalid node load");
+      goto abort;
+    }
+  }
+
+  for (finevertnum = finemeshptr->velmbas; finevertnum < finemeshptr->velmnnd; finevertnum ++) { /* Link fine elements of each coarse element */
+    coarvertnum = finecoartax[finevertnum];
+    coarpairtax[2 * coarvertnum + ((coarpairtax[2 * coarvertnum] == ~0) ? 0 : 1)] = finevertnum;
+  }
+
+  for (coarvertnum = coarmeshptr->velmbas, coarveisnbr = coardegrmax = 0;
+       coarvertnum < coarmeshptr->velmnnd; coarvertnum ++) {
+    Gnum                coaredgenum;
+    Gnum                coardegrval;
+    int                 i;
+
+    for (i = 0, coardegrval = 0; i < coarcnttax[coarvertnum]; i ++) { /* Flag expected neighbors of coarse element */
+      Gnum                finevelmnum;
+      Gnum                fineedgenum;
+
+      finevelmnum = coarpairtax[2 * coarvertnum + i];
+      for (fineedgenum = finemeshptr->verttax[finevelmnum];
+           fineedgenum < finemeshptr->vendtax[finevelmnum]; fineedgenum ++) {
+        Gnum                coarvnodnum;
+
+        coarvnodnum = finecoartax[finemeshptr->edgetax[fineedgenum]];
+        if (coarflagtax[coarvnodnum] != coarvertnum) {
+          coarflagtax[coarvnodnum] = coarvertnum;
+          coardegrval ++;
+        }
+      }
+    }
+    if (coardegrval != (coarmeshptr->vendtax[coarvertnum] - coarmeshptr->verttax[coarvertnum])) {
+      SCOTCH_errorPrint ("testMeshCoarsenCheck: invalid element degree");
+      goto abort;
+    }
+    for (coaredgenum = coarmeshptr->verttax[coarvertnum];
+         coaredgenum < coarmeshptr->vendtax[coarvertnum]; coaredgenum ++) {
+      Gnum                coarvnodnum;
+
+      coarvnodnum = coarmeshptr->edgetax[coaredgenum];
+      if (coarflagtax[coarvnodnum] != coarvertnum) { /* If neighbor not expected or already seen */
+        SCOTCH_errorPrint ("testMeshCoarsenCheck: invalid element neighbor");
+        goto abort;
+      }
+      coarflagtax[coarvnodnum] = ~coarvertnum;
+    }
+    if (coardegrval == 0)
+      coarveisnbr ++;
+    if (coardegrmax < coardegrval)
+      coardegrmax = coardegrval;
+  }
+  for (coarvertnum = coarmeshptr->vnodbas; coarvertnum < coarmeshptr->vnodnnd; coarvertnum ++) {
+    Gnum                coaredgenum;
+
+    for (coaredgenum = coarmeshptr->verttax[coarvertnum] + 1;
+         coaredgenum < coarmeshptr->vendtax[coarvertnum]; coaredgenum ++) {
+      if (coarmeshptr->edgetax[coaredgenum - 1] >= coarmeshptr->edgetax[coaredgenum]) {
+        SCOTCH_errorPrint ("testMeshCoarsenCheck: node neighbors not sorted");
+        goto abort;
+      }
+    }
+    if (coardegrmax < (coarmeshptr->vendtax[coarvertnum] - coarmeshptr->verttax[coarvertnum]))
+      coardegrmax = coarmeshptr->vendtax[coarvertnum] - coarmeshptr->verttax[coarvertnum];
+  }
+  if ((coarveisnbr != coarmeshptr->veisnbr) ||
+      (coardegrmax != coarmeshptr->degrmax)) {
+    SCOTCH_errorPrint ("testMeshCoarsenCheck: invalid mesh parameters");
+    goto abort;
+  }
+
+  o = 0;                                          /* Coarse mesh is consistent */
+abort :
+  memFree (coarflagtax + coarmeshptr->baseval);
+
+  return (o);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  Mesh                meshtab[2][LEVLNBR + 1];    /* Coarse mesh hierarchies of both runs */
+  Gnum                velmtab[2][LEVLNBR + 1];    /* Number of coarse elements per level  */
+  int                 levltab[2];                 /* Number of levels of both runs        */
+  FILE *              fileptr;
+  int                 runnum;
+  int                 levlnbr;
+  int                 levlnum;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if (argc != 2) {
+    SCOTCH_errorPrint ("usage: %s mesh_file", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  if ((fileptr = fopen (argv[1], "r")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open file");
+    exit (EXIT_FAILURE);
+  }
+  meshInit (&meshtab[0][0]);
+  if (meshLoad (&meshtab[0][0], fileptr, -1) != 0) {
+    SCOTCH_errorPrint ("main: cannot load mesh");
+    exit (EXIT_FAILURE);
+  }
+  fclose (fileptr);
+  if (meshtab[0][0].velmbas > meshtab[0][0].vnodbas) { /* Coarsening routine expects elements first */
+    SCOTCH_errorPrint ("main: elements must be numbered before nodes");
+    exit (EXIT_FAILURE);
+  }
+  meshtab[1][0] = meshtab[0][0];                  /* Both runs share the original mesh */
+
+  for (runnum = 0; runnum < 2; runnum ++) { /* Sequential run, then threaded run */
+    Context             contdat;
+
+    contextInit (&contdat);
+    if ((contextOptionsInit  (&contdat) != 0) ||
+        (contextThreadInit2  (&contdat, (runnum == 0) ? 1 : 4, NULL) != 0) ||
+        (contextValuesSetInt (&contdat, CONTEXTOPTIONNUMDETERMINISTIC, 0) != 0) ||
+        (contextCommit       (&contdat) != 0)) {
+      SCOTCH_errorPrint ("main: cannot initialize context");
+      exit (EXIT_FAILURE);
+    }
+
+    velmtab[runnum][0] = meshtab[runnum][0].velmnbr;
+    for (levlnum = 0; levlnum < LEVLNBR; levlnum ++) {
+      Gnum *              finecoartax;
+      int                 o;
+
+      o = meshCoarsen (&meshtab[runnum][levlnum], &meshtab[runnum][levlnum + 1], &finecoartax, 1, 1.0, MESHCOARSENNGB, &contdat);
+      if (o == 1)                                 /* If mesh cannot be coarsened further */
+        break;
+      if (o != 0) {
+        SCOTCH_errorPrint ("main: cannot coarsen mesh");
+        exit (EXIT_FAILURE);
+      }
+      if (testMeshCoarsenCheck (&meshtab[runnum][levlnum], &meshtab[runnum][levlnum + 1], finecoartax) != 0) {
+        SCOTCH_errorPrint ("main: invalid coarse mesh (%d, %d)", runnum, levlnum);
+        exit (EXIT_FAILURE);
+      }
+      velmtab[runnum][levlnum + 1] = meshtab[runnum][levlnum + 1].velmnbr;
+      memFree (finecoartax + meshtab[runnum][levlnum].baseval);
+    }
+
+    levltab[runnum] = levlnum;
+
+    contextExit (&contdat);
+  }
+
+  for (levlnum = 1, levlnbr = MIN (levltab[0], levltab[1]); levlnum <= levlnbr; levlnum ++) { /* Both runs must have comparable coarsening rates */
+    printf ("Level %d: %ld / %ld elements\n", levlnum, (long) velmtab[0][levlnum], (long) velmtab[1][levlnum]);
+    if ((velmtab[1][levlnum] * 4) > (velmtab[0][levlnum] * 5)) {
+      SCOTCH_errorPrint ("main: threaded coarsening too weak");
+      exit (EXIT_FAILURE);
+    }
+  }
+
+  for (runnum = 0; runnum < 2; runnum ++) {
+    for (levlnum = 1; levlnum <= levltab[runnum]; levlnum ++)
+      meshExit (&meshtab[runnum][levlnum]);
+  }
+  meshExit (&meshtab[0][0]);
+
+  exit (EXIT_SUCCESS);
+}
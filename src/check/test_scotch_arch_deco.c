@@ -40,6 +40,8 @@
 /**                                                        **/
 /**   DATES      : # Version 6.0  : from : 28 dec 2015     **/
 /**                                 to   : 25 sep 2019     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /**   DATES      : # This code derives from that of        **/
 /**                  test_scotch_arch.c                    **/
@@ -76,7 +78,7 @@ char *              argv[])
   SCOTCH_Num          vertnbr;
   SCOTCH_Graph        grafdat;
   SCOTCH_Strat        stradat;
-  SCOTCH_Arch         archtab[ARCHNBR];
+  SCOTCH_Arch         archtab[2 * ARCHNBR];      /* Room for textual and binary copies */
   int                 archnbr = 0;
   int                 i;
   SCOTCH_Num          listnbr = 5;
@@ -151,7 +153,8 @@ char *              argv[])
     }
 
     for (j = 0; j < (1 + i); j ++) {
-      if (SCOTCH_archSave (&archtab[archnbr + j], fileptr) != 0) {
+      if ((SCOTCH_archSave    (&archtab[archnbr + j], fileptr) != 0) ||
+          (SCOTCH_archSaveBin (&archtab[archnbr + j], fileptr) != 0)) { /* Also save in binary form, if possible */
         SCOTCH_errorPrint ("main: cannot save architecture (%d)", archnbr + 1 + j);
         exit (EXIT_FAILURE);
       }
@@ -174,7 +177,7 @@ char *              argv[])
     exit (EXIT_FAILURE);
   }
 
-  for (i = 0; i < archnbr; i ++) {
+  for (i = 0; i < (2 * archnbr); i ++) {
     if ((SCOTCH_archInit (&archtab[i])          != 0) ||
         (SCOTCH_archLoad (&archtab[i], fileptr) != 0)) {
       SCOTCH_errorPrint ("main: cannot load architecture (%d)", 1 + i);
@@ -184,7 +187,36 @@ char *              argv[])
 
   fclose (fileptr);
 
-  for (i = 0; i < archnbr; i ++)                  /* Destroy architectures in any order, as they are now all autonomous from each other */
+  for (i = 0; i < (2 * archnbr); i += 2) {        /* Check that both copies of each architecture match */
+    SCOTCH_ArchDom      domntab[2];
+    SCOTCH_Num          termnbr;
+    SCOTCH_Num          termnum0;
+    SCOTCH_Num          termnum1;
+
+    termnbr = SCOTCH_archSize (&archtab[i]);
+    if ((strcmp (SCOTCH_archName (&archtab[i]), SCOTCH_archName (&archtab[i + 1])) != 0) ||
+        (SCOTCH_archSize (&archtab[i + 1]) != termnbr)) {
+      SCOTCH_errorPrint ("main: architecture copies differ (1)");
+      exit (EXIT_FAILURE);
+    }
+    for (termnum0 = 0; termnum0 < termnbr; termnum0 ++) {
+      for (termnum1 = 0; termnum1 < termnbr; termnum1 ++) {
+        SCOTCH_Num          distval;
+
+        SCOTCH_archDomTerm (&archtab[i], &domntab[0], termnum0);
+        SCOTCH_archDomTerm (&archtab[i], &domntab[1], termnum1);
+        distval = SCOTCH_archDomDist (&archtab[i], &domntab[0], &domntab[1]);
+        SCOTCH_archDomTerm (&archtab[i + 1], &domntab[0], termnum0);
+        SCOTCH_archDomTerm (&archtab[i + 1], &domntab[1], termnum1);
+        if (SCOTCH_archDomDist (&archtab[i + 1], &domntab[0], &domntab[1]) != distval) {
+          SCOTCH_errorPrint ("main: architecture copies differ (2)");
+          exit (EXIT_FAILURE);
+        }
+      }
+    }
+  }
+
+  for (i = 0; i < (2 * archnbr); i ++)            /* Destroy architectures in any order, as they are now all autonomous from each other */
     SCOTCH_archExit (&archtab[i]);
 
   exit (EXIT_SUCCESS);
@@ -40,6 +40,8 @@
 /**                                                        **/
 /**   DATES      : # Version 6.0  : from : 06 jan 2012     **/
 /**                                 to   : 22 may 2018     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -56,6 +58,140 @@
 
 #include "scotch.h"
 
+/*********************************/
+/*                               */
+/* The coloring check routine.   */
+/*                               */
+/*********************************/
+
+/* This routine checks that the given color
+** array is a valid coloring of the given
+** graph, and prints its color histogram.
+** It returns:
+** - 0   : if the coloring is valid.
+** - !0  : else.
+*/
+
+static
+int
+testGraphColorCheck (
+SCOTCH_Graph * const        grafptr,
+const SCOTCH_Num * const    colotab,
+const SCOTCH_Num            colonbr)
+{
+  SCOTCH_Num          baseval;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num          vertnum;
+  SCOTCH_Num *        verttab;
+  SCOTCH_Num *        vendtab;
+  SCOTCH_Num *        edgetab;
+  SCOTCH_Num *        cnbrtab;
+  SCOTCH_Num          colonum;
+
+  SCOTCH_graphData (grafptr, &baseval, &vertnbr, &verttab, &vendtab, NULL, NULL, NULL, &edgetab, NULL);
+
+  if ((cnbrtab = malloc ((colonbr + 1) * sizeof (SCOTCH_Num))) == NULL) {
+    SCOTCH_errorPrint ("testGraphColorCheck: out of memory");
+    return (1);
+  }
+  memset (cnbrtab, 0, colonbr * sizeof (SCOTCH_Num));
+
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++) {
+    SCOTCH_Num          edgenum;
+
+    if ((colotab[vertnum] < 0) || (colotab[vertnum] >= colonbr)) {
+      SCOTCH_errorPrint ("testGraphColorCheck: invalid color value");
+      free (cnbrtab);
+      return (1);
+    }
+    cnbrtab[colotab[vertnum]] ++;                 /* Sum-up color histogram */
+
+    for (edgenum = verttab[vertnum]; edgenum < vendtab[vertnum]; edgenum ++) {
+      if (colotab[edgetab[edgenum - baseval] - baseval] == colotab[vertnum]) {
+        SCOTCH_errorPrint ("testGraphColorCheck: neighbors have same color");
+        free (cnbrtab);
+        return (1);
+      }
+    }
+  }
+
+  for (colonum = 0; colonum < colonbr; colonum ++) {
+    if (cnbrtab[colonum] == 0) {
+      SCOTCH_errorPrint ("testGraphColorCheck: unused color");
+      free (cnbrtab);
+      return (1);
+    }
+    printf ("Color %5ld: %ld\n",
+            (long) colonum,
+            (long) cnbrtab[colonum]);
+  }
+
+  free (cnbrtab);
+  return (0);
+}
+
+/* This routine computes the degeneracy of
+** the given graph, that is, the largest
+** degree of a vertex at the time of its
+** removal when vertices of smallest remaining
+** degree are removed one after the other.
+** Smallest-last colorings must not use more
+** than this value plus one colors.
+** It returns:
+** - >=0 : degeneracy of the graph.
+** - <0  : on error.
+*/
+
+static
+SCOTCH_Num
+testGraphColorDegen (
+SCOTCH_Graph * const        grafptr)
+{
+  SCOTCH_Num          baseval;
+  SCOTCH_Num          vertnbr;
+  SCOTCH_Num          vertnum;
+  SCOTCH_Num *        verttab;
+  SCOTCH_Num *        vendtab;
+  SCOTCH_Num *        edgetab;
+  SCOTCH_Num *        degrtab;
+  SCOTCH_Num          degrmax;
+  SCOTCH_Num          remvnum;
+
+  SCOTCH_graphData (grafptr, &baseval, &vertnbr, &verttab, &vendtab, NULL, NULL, NULL, &edgetab, NULL);
+
+  if ((degrtab = malloc ((vertnbr + 1) * sizeof (SCOTCH_Num))) == NULL) {
+    SCOTCH_errorPrint ("testGraphColorDegen: out of memory");
+    return (-1);
+  }
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++)
+    degrtab[vertnum] = vendtab[vertnum] - verttab[vertnum];
+
+  for (remvnum = 0, degrmax = 0; remvnum < vertnbr; remvnum ++) { /* Naive removal of vertices of smallest degree */
+    SCOTCH_Num          vertbst;
+    SCOTCH_Num          edgenum;
+
+    for (vertnum = 0, vertbst = -1; vertnum < vertnbr; vertnum ++) {
+      if ((degrtab[vertnum] >= 0) &&
+          ((vertbst < 0) || (degrtab[vertnum] < degrtab[vertbst])))
+        vertbst = vertnum;
+    }
+    if (degrtab[vertbst] > degrmax)
+      degrmax = degrtab[vertbst];
+    degrtab[vertbst] = -1;                        /* Flag vertex as removed */
+
+    for (edgenum = verttab[vertbst]; edgenum < vendtab[vertbst]; edgenum ++) {
+      SCOTCH_Num          vertend;
+
+      vertend = edgetab[edgenum - baseval] - baseval;
+      if (degrtab[vertend] >= 0)
+        degrtab[vertend] --;
+    }
+  }
+
+  free (degrtab);
+  return (degrmax);
+}
+
 /*********************/
 /*                   */
 /* The main routine. */
@@ -69,12 +205,17 @@ char *              argv[])
 {
   FILE *              fileptr;
   SCOTCH_Graph        grafdat;
+  SCOTCH_Context      conttab[2];                 /* Single-threaded and multi-threaded contexts */
+  SCOTCH_Graph        cgrftab[2];                 /* Context graphs                              */
   SCOTCH_Num          vertnbr;
-  SCOTCH_Num          vertnum;
-  SCOTCH_Num          colonbr;
-  SCOTCH_Num          colonum;
-  SCOTCH_Num *        colotab;
-  SCOTCH_Num *        cnbrtab;
+  SCOTCH_Num          degnval;
+  SCOTCH_Num          colonbr[2];
+  SCOTCH_Num *        colotab[2];
+  int                 flagnum;
+  int                 i;
+
+  static const SCOTCH_Num   flagtab[] = { SCOTCH_COLORNONE, SCOTCH_COLORDEGREE, SCOTCH_COLORSMALLEST };
+  static const char * const flagnam[] = { "random", "degree", "smallest-last" };
 
   SCOTCH_errorProg (argv[0]);
 
@@ -102,34 +243,61 @@ char *              argv[])
 
   SCOTCH_graphSize (&grafdat, &vertnbr, NULL);
 
-  if ((colotab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) {
-    SCOTCH_errorPrint ("main: out of memory (1)");
+  if ((degnval = testGraphColorDegen (&grafdat)) < 0) {
+    SCOTCH_errorPrint ("main: cannot compute degeneracy");
     exit (EXIT_FAILURE);
   }
 
-  if ((cnbrtab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) {
-    SCOTCH_errorPrint ("main: out of memory (1)");
-    exit (EXIT_FAILURE);
-  }
-  memset (cnbrtab, 0, vertnbr * sizeof (SCOTCH_Num));
+  for (i = 0; i < 2; i ++) {
+    if ((colotab[i] = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) {
+      SCOTCH_errorPrint ("main: out of memory");
+      exit (EXIT_FAILURE);
+    }
 
-  if (SCOTCH_graphColor (&grafdat, colotab, &colonbr, 0) != 0) {
-    SCOTCH_errorPrint ("main: cannot color graph");
-    exit (EXIT_FAILURE);
+    SCOTCH_contextInit (&conttab[i]);
+    SCOTCH_contextThreadSpawn (&conttab[i], (i == 0) ? 1 : 4, NULL);
+    SCOTCH_graphInit (&cgrftab[i]);
+    if (SCOTCH_contextBindGraph (&conttab[i], &grafdat, &cgrftab[i]) != 0) {
+      SCOTCH_errorPrint ("main: cannot bind context");
+      exit (EXIT_FAILURE);
+    }
   }
 
-  printf ("Number of colors: %ld\n", (long) colonbr);
+  for (flagnum = 0; flagnum < (int) (sizeof (flagtab) / sizeof (flagtab[0])); flagnum ++) {
+    for (i = 0; i < 2; i ++) {
+      SCOTCH_randomReset ();                      /* Use same priorities in both contexts */
+      if (SCOTCH_graphColor (&cgrftab[i], colotab[i], &colonbr[i], flagtab[flagnum]) != 0) {
+        SCOTCH_errorPrint ("main: cannot color graph");
+        exit (EXIT_FAILURE);
+      }
 
-  for (vertnum = 0; vertnum < vertnbr; vertnum ++) /* Sum-up color histogram */
-    cnbrtab[colotab[vertnum]] ++;
+      printf ("Method %s, %d thread(s), number of colors: %ld\n",
+              flagnam[flagnum], (i == 0) ? 1 : 4, (long) colonbr[i]);
 
-  for (colonum = 0; colonum < colonbr; colonum ++)
-    printf ("Color %5ld: %ld\n",
-            (long) colonum,
-            (long) cnbrtab[colonum]);
+      if (testGraphColorCheck (&grafdat, colotab[i], colonbr[i]) != 0) {
+        SCOTCH_errorPrint ("main: invalid coloring");
+        exit (EXIT_FAILURE);
+      }
 
-  free (cnbrtab);
-  free (colotab);
+      if ((flagtab[flagnum] == SCOTCH_COLORSMALLEST) && /* Smallest-last ordering bounds number of colors */
+          (colonbr[i] > (degnval + 1))) {
+        SCOTCH_errorPrint ("main: too many colors for smallest-last ordering");
+        exit (EXIT_FAILURE);
+      }
+    }
+
+    if ((colonbr[0] != colonbr[1]) ||             /* Colorings must not depend on number of threads */
+        (memcmp (colotab[0], colotab[1], vertnbr * sizeof (SCOTCH_Num)) != 0)) {
+      SCOTCH_errorPrint ("main: colorings differ");
+      exit (EXIT_FAILURE);
+    }
+  }
+
+  for (i = 0; i < 2; i ++) {
+    SCOTCH_graphExit   (&cgrftab[i]);             /* Free the context graph before its bound context */
+    SCOTCH_contextExit (&conttab[i]);
+    free (colotab[i]);
+  }
   SCOTCH_graphExit (&grafdat);
 
   exit (EXIT_SUCCESS);
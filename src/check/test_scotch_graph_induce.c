@@ -43,7 +43,7 @@
 /**   DATES      : # Version 6.0  : from : 15 apr 2019     **/
 /**                                 to   : 16 apr 2019     **/
 /**                # Version 7.0  : from : 13 sep 2019     **/
-/**                                 to   : 13 sep 2019     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -60,6 +60,64 @@
 
 #include "scotch.h"
 
+/*********************************/
+/*                               */
+/* The graph comparison routine. */
+/*                               */
+/*********************************/
+
+/* This routine checks that two graphs
+** have the same structure and loads.
+** It returns:
+** - 0   : if graphs are identical.
+** - !0  : else.
+*/
+
+static
+int
+testGraphCompare (
+SCOTCH_Graph * const        grf0ptr,
+SCOTCH_Graph * const        grf1ptr)
+{
+  SCOTCH_Num          baseval[2];
+  SCOTCH_Num          vertnbr[2];
+  SCOTCH_Num *        verttab[2];
+  SCOTCH_Num *        vendtab[2];
+  SCOTCH_Num *        velotab[2];
+  SCOTCH_Num *        vlbltab[2];
+  SCOTCH_Num          edgenbr[2];
+  SCOTCH_Num *        edgetab[2];
+  SCOTCH_Num *        edlotab[2];
+  SCOTCH_Num          vertnum;
+  SCOTCH_Num          edgenum;
+
+  SCOTCH_graphData (grf0ptr, &baseval[0], &vertnbr[0], &verttab[0], &vendtab[0], &velotab[0], &vlbltab[0], &edgenbr[0], &edgetab[0], &edlotab[0]);
+  SCOTCH_graphData (grf1ptr, &baseval[1], &vertnbr[1], &verttab[1], &vendtab[1], &velotab[1], &vlbltab[1], &edgenbr[1], &edgetab[1], &edlotab[1]);
+
+  if ((baseval[0] != baseval[1]) ||
+      (vertnbr[0] != vertnbr[1]) ||
+      (edgenbr[0] != edgenbr[1]) ||
+      ((velotab[0] == NULL) != (velotab[1] == NULL)) ||
+      ((edlotab[0] == NULL) != (edlotab[1] == NULL)))
+    return (1);
+
+  for (vertnum = 0; vertnum < vertnbr[0]; vertnum ++) {
+    if ((verttab[0][vertnum] != verttab[1][vertnum]) ||
+        (vendtab[0][vertnum] != vendtab[1][vertnum]))
+      return (1);
+    if ((velotab[0] != NULL) && (velotab[0][vertnum] != velotab[1][vertnum]))
+      return (1);
+  }
+  for (edgenum = 0; edgenum < edgenbr[0]; edgenum ++) {
+    if (edgetab[0][edgenum] != edgetab[1][edgenum])
+      return (1);
+    if ((edlotab[0] != NULL) && (edlotab[0][edgenum] != edlotab[1][edgenum]))
+      return (1);
+  }
+
+  return (0);
+}
+
 /*********************/
 /*                   */
 /* The main routine. */
@@ -81,6 +139,10 @@ char *              argv[])
   SCOTCH_Num *        indlisttab;
   SCOTCH_Num          indvertnbr;
   SCOTCH_Num          indvertnum;
+  SCOTCH_Context      conttab[2];                 /* Single-threaded and multi-threaded contexts */
+  SCOTCH_Graph        cgrftab[2];                 /* Context graphs                              */
+  SCOTCH_Graph        indgraftab[2][2];           /* Graphs induced in each context              */
+  int                 i;
 
   if (argc != 2) {
     SCOTCH_errorPrint ("usage: %s graph_file", argv[0]);
@@ -163,6 +225,46 @@ char *              argv[])
   }
   SCOTCH_graphExit (&indgrafdat);
 
+  for (i = 0; i < 2; i ++) {                      /* Induce graphs with one and several threads */
+    SCOTCH_contextInit (&conttab[i]);
+    SCOTCH_contextThreadSpawn (&conttab[i], (i == 0) ? 1 : 4, NULL);
+
+    SCOTCH_graphInit (&cgrftab[i]);
+    if (SCOTCH_contextBindGraph (&conttab[i], &orggrafdat, &cgrftab[i]) != 0) {
+      SCOTCH_errorPrint ("main: cannot bind context");
+      exit (EXIT_FAILURE);
+    }
+
+    SCOTCH_graphInit (&indgraftab[i][0]);
+    SCOTCH_graphInit (&indgraftab[i][1]);
+    if (SCOTCH_graphInduceList (&cgrftab[i], indvertnbr, indlisttab, &indgraftab[i][0]) != 0) {
+      SCOTCH_errorPrint ("main: cannot induce graph (3)");
+      exit (EXIT_FAILURE);
+    }
+    if (SCOTCH_graphInducePart (&cgrftab[i], indvertnbr, orgparttab, 1, &indgraftab[i][1]) != 0) {
+      SCOTCH_errorPrint ("main: cannot induce graph (4)");
+      exit (EXIT_FAILURE);
+    }
+    if ((SCOTCH_graphCheck (&indgraftab[i][0]) != 0) ||
+        (SCOTCH_graphCheck (&indgraftab[i][1]) != 0)) {
+      SCOTCH_errorPrint ("main: invalid induced graph (3)");
+      exit (EXIT_FAILURE);
+    }
+  }
+
+  if ((testGraphCompare (&indgraftab[0][0], &indgraftab[1][0]) != 0) ||
+      (testGraphCompare (&indgraftab[0][1], &indgraftab[1][1]) != 0)) {
+    SCOTCH_errorPrint ("main: multi-threaded induced graph differs from sequential one");
+    exit (EXIT_FAILURE);
+  }
+
+  for (i = 0; i < 2; i ++) {
+    SCOTCH_graphExit   (&indgraftab[i][0]);
+    SCOTCH_graphExit   (&indgraftab[i][1]);
+    SCOTCH_graphExit   (&cgrftab[i]);             /* Free the context graph before its bound context */
+    SCOTCH_contextExit (&conttab[i]);
+  }
+
   free (indlisttab);
   free (orgparttab);
 
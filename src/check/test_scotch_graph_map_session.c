@@ -0,0 +1,312 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_scotch_graph_map_session.c         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the operation of      **/
+/**                the SCOTCH_graphMapSession*() routines, **/
+/**                by remapping a graph the vertex loads   **/
+/**                of which vary across time steps, and by **/
+/**                checking that the coarsening hierarchy  **/
+/**                is re-used across these steps.          **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+#include "../libscotch/context.h"
+#include "../libscotch/parser.h"
+#include "../libscotch/graph.h"
+#include "../libscotch/arch.h"
+#include "../libscotch/mapping.h"
+#include "../libscotch/graph_coarsen.h"
+#include "../libscotch/kgraph.h"
+#include "../libscotch/kgraph_map_ml.h"
+#include "../libscotch/library_mapping.h"
+#include "scotch.h"
+
+#define PARTNBR                     8
+#define STEPNBR                     6
+
+/* This routine checks that the given
+** partition is valid and reasonably
+** balanced.
+** It returns:
+** - 0   : if partition is valid.
+** - !0  : on error.
+*/
+
+static
+int
+checkPart (
+const SCOTCH_Num            vertnbr,
+const SCOTCH_Num * const    velotab,
+const SCOTCH_Num * const    parttab)
+{
+  SCOTCH_Num          loadtab[PARTNBR];
+  SCOTCH_Num          loadsum;
+  SCOTCH_Num          loadmax;
+  SCOTCH_Num          vertnum;
+  SCOTCH_Num          partnum;
+
+  memset (loadtab, 0, PARTNBR * sizeof (SCOTCH_Num));
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++) {
+    if ((parttab[vertnum] < 0) || (parttab[vertnum] >= PARTNBR)) {
+      SCOTCH_errorPrint ("checkPart: invalid part");
+      return (1);
+    }
+    loadtab[parttab[vertnum]] += velotab[vertnum];
+  }
+
+  for (partnum = 0, loadsum = loadmax = 0; partnum < PARTNBR; partnum ++) {
+    loadsum += loadtab[partnum];
+    if (loadmax < loadtab[partnum])
+      loadmax = loadtab[partnum];
+  }
+  printf ("Imbalance: %lf\n", ((double) loadmax * (double) PARTNBR) / (double) loadsum - 1.0);
+  if (((double) loadmax * (double) PARTNBR) > ((double) loadsum * 1.2)) {
+    SCOTCH_errorPrint ("checkPart: partition too imbalanced");
+    return (1);
+  }
+
+  return (0);
+}
+
+/* This routine checks that the hierarchy
+** cache of the given mapping session is
+** complete, and that it has been built
+** during the last mapping computation
+** only if it was expected to. It then
+** resets the coarsening counter of the
+** cache, so that the next check only
+** accounts for the next computation.
+** It returns:
+** - 0   : if cache is in expected state.
+** - !0  : on error.
+*/
+
+static
+int
+checkCache (
+SCOTCH_Mapping * const      mappptr,
+const int                   buldval,              /*+ Set if hierarchy must have been built +*/
+INT * const                 levlptr)              /*+ Number of levels of built hierarchy   +*/
+{
+  KgraphMapMlCache * restrict const cachptr = ((LibMapping *) mappptr)->cachptr;
+
+  if ((cachptr == NULL) ||
+      ((cachptr->flagval & KGRAPHMAPMLCACHEFULL) == 0) ||
+      (cachptr->levlnbr <= 0)) {
+    SCOTCH_errorPrint ("checkCache: hierarchy not cached");
+    return (1);
+  }
+  if (buldval != 0) {
+    if (cachptr->coarcnt != cachptr->levlnbr) {
+      SCOTCH_errorPrint ("checkCache: hierarchy not built");
+      return (1);
+    }
+    *levlptr = cachptr->levlnbr;
+  }
+  else {
+    if (cachptr->coarcnt != 0) {
+      SCOTCH_errorPrint ("checkCache: hierarchy not re-used");
+      return (1);
+    }
+    if (cachptr->levlnbr != *levlptr) {
+      SCOTCH_errorPrint ("checkCache: hierarchy changed");
+      return (1);
+    }
+  }
+  printf ("Levels: %d, coarsenings: %d\n", (int) cachptr->levlnbr, (int) cachptr->coarcnt);
+  cachptr->coarcnt = 0;
+
+  return (0);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  SCOTCH_Mapping          mappdat;                /* Mapping session       */
+  SCOTCH_Mapping          mapodat;                /* Old mapping           */
+  FILE *                  fileptr;
+  SCOTCH_Graph            srcgrafdat;             /* Graph read from file  */
+  SCOTCH_Graph            grafdat;                /* Graph with user loads */
+  SCOTCH_Arch             archdat;
+  SCOTCH_Strat            stradat;
+  SCOTCH_Num              baseval;
+  SCOTCH_Num              vertnbr;
+  SCOTCH_Num              vertnum;
+  SCOTCH_Num              edgenbr;
+  SCOTCH_Num *            verttab;
+  SCOTCH_Num *            vendtab;
+  SCOTCH_Num *            edgetab;
+  SCOTCH_Num *            edlotab;
+  SCOTCH_Num *            velotab;
+  SCOTCH_Num *            parttab;
+  SCOTCH_Num *            parotab;
+  INT                     levlnbr;
+  int                     stepnum;
+
+  SCOTCH_errorProg (argv[0]);
+
+  if (argc != 2) {
+    SCOTCH_errorPrint ("usage: %s graph_file", argv[0]);
+    exit (EXIT_FAILURE);
+  }
+
+  if ((SCOTCH_graphInit (&srcgrafdat) != 0) ||
+      (SCOTCH_graphInit (&grafdat)    != 0)) {
+    SCOTCH_errorPrint ("main: cannot initialize graphs");
+    exit (EXIT_FAILURE);
+  }
+
+  if ((fileptr = fopen (argv[1], "r")) == NULL) {
+    SCOTCH_errorPrint ("main: cannot open file");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphLoad (&srcgrafdat, fileptr, -1, 0) != 0) { /* Read source graph */
+    SCOTCH_errorPrint ("main: cannot load graph");
+    exit (EXIT_FAILURE);
+  }
+
+  fclose (fileptr);
+
+  SCOTCH_graphData (&srcgrafdat, &baseval, &vertnbr, &verttab, &vendtab, NULL, NULL, &edgenbr, &edgetab, &edlotab);
+
+  if (((velotab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) ||
+      ((parttab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL) ||
+      ((parotab = malloc (vertnbr * sizeof (SCOTCH_Num))) == NULL)) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+
+  for (vertnum = 0; vertnum < vertnbr; vertnum ++)
+    velotab[vertnum] = 1;
+
+  if (SCOTCH_graphBuild (&grafdat, baseval, vertnbr, verttab, vendtab, velotab, NULL, edgenbr, edgetab, edlotab) != 0) {
+    SCOTCH_errorPrint ("main: cannot build graph (1)");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_stratInit (&stradat) != 0) {
+    SCOTCH_errorPrint ("main: cannot initialize strategy");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_stratGraphMap (&stradat, "m{vert=200,low=r{job=t,map=t,poli=S,bal=0.05,sep=m{vert=120,low=h{pass=10}f{bal=0.05,move=120},asc=b{bnd=f{bal=0.05,move=120},org=f{bal=0.05,move=120}}}},asc=b{bnd=f{bal=0.05,move=80},org=f{bal=0.05,move=80}}}") != 0) {
+    SCOTCH_errorPrint ("main: cannot build strategy");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_archInit (&archdat) != 0) {
+    SCOTCH_errorPrint ("main: cannot initialize architecture");
+    exit (EXIT_FAILURE);
+  }
+  SCOTCH_archCmplt (&archdat, PARTNBR);
+
+  if ((SCOTCH_graphMapInit (&grafdat, &mappdat, &archdat, parttab) != 0) ||
+      (SCOTCH_graphMapInit (&grafdat, &mapodat, &archdat, parotab) != 0)) {
+    SCOTCH_errorPrint ("main: cannot initialize mappings");
+    exit (EXIT_FAILURE);
+  }
+  if (SCOTCH_graphMapSessionInit (&grafdat, &mappdat) != 0) {
+    SCOTCH_errorPrint ("main: cannot initialize mapping session");
+    exit (EXIT_FAILURE);
+  }
+
+  if (SCOTCH_graphMapCompute (&grafdat, &mappdat, &stradat) != 0) { /* Initial mapping builds hierarchy */
+    SCOTCH_errorPrint ("main: cannot compute mapping");
+    exit (EXIT_FAILURE);
+  }
+  if ((checkPart  (vertnbr, velotab, parttab) != 0) ||
+      (checkCache (&mappdat, 1, &levlnbr)     != 0))
+    exit (EXIT_FAILURE);
+
+  for (stepnum = 0; stepnum < STEPNBR; stepnum ++) {
+    printf ("Step %d\n", stepnum);
+
+    for (vertnum = 0; vertnum < vertnbr; vertnum ++) /* Move heavy region across graph */
+      velotab[vertnum] = ((vertnum / (vertnbr / STEPNBR)) == stepnum) ? 4 : 1;
+
+    SCOTCH_graphFree (&grafdat);                  /* Re-build graph to account for new vertex loads */
+    if (SCOTCH_graphBuild (&grafdat, baseval, vertnbr, verttab, vendtab, velotab, NULL, edgenbr, edgetab, edlotab) != 0) {
+      SCOTCH_errorPrint ("main: cannot build graph (2)");
+      exit (EXIT_FAILURE);
+    }
+
+    if (stepnum == (STEPNBR / 2))                 /* Check that hierarchy can be discarded */
+      SCOTCH_graphMapSessionReset (&grafdat, &mappdat);
+
+    memcpy (parotab, parttab, vertnbr * sizeof (SCOTCH_Num)); /* Current mapping becomes old mapping */
+    if (SCOTCH_graphRemapCompute (&grafdat, &mappdat, &mapodat, 0.2, ((stepnum & 1) != 0) ? velotab : NULL, &stradat) != 0) {
+      SCOTCH_errorPrint ("main: cannot compute remapping");
+      exit (EXIT_FAILURE);
+    }
+    if ((checkPart  (vertnbr, velotab, parttab) != 0) ||
+        (checkCache (&mappdat, (stepnum == (STEPNBR / 2)), &levlnbr) != 0))
+      exit (EXIT_FAILURE);
+  }
+
+  SCOTCH_graphMapExit (&grafdat, &mapodat);
+  SCOTCH_graphMapExit (&grafdat, &mappdat);       /* Also frees hierarchy */
+
+  SCOTCH_archExit  (&archdat);
+  SCOTCH_stratExit (&stradat);
+  SCOTCH_graphExit (&grafdat);
+  SCOTCH_graphExit (&srcgrafdat);
+
+  free (parotab);
+  free (parttab);
+  free (velotab);
+
+  exit (EXIT_SUCCESS);
+}
@@ -0,0 +1,488 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : test_vgraph_separate_es.c               **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module tests the minimum vertex    **/
+/**                cover routine of the edge-separation    **/
+/**                vertex separator method. By Koenig's    **/
+/**                theorem, the size of a minimum vertex   **/
+/**                cover of a bipartite graph is equal to  **/
+/**                the size of its maximum matchings.      **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#include <stdio.h>
+
+#include "../libscotch/module.h"
+#include "../libscotch/common.h"
+#include "../libscotch/parser.h"
+#include "../libscotch/graph.h"
+#include "../libscotch/vgraph.h"
+#include "../libscotch/vgraph_separate_es.h"
+
+#define CHAINNBR                    100000        /* Length of longest augmenting path chain */
+
+/*
+**  The type and structure definitions.
+*/
+
+/* The bipartite test graph structure. */
+
+typedef struct TestEsGraph_ {
+  Graph                     grafdat;              /* Bipartite graph, columns first */
+  Gnum                      colnbr;               /* Number of column vertices      */
+  Gnum                      rownbr;               /* Number of row vertices         */
+  Gnum                      pairnbr;              /* Number of edges                */
+  Gnum *                    pairtab;              /* Array of (column, row) pairs   */
+} TestEsGraph;
+
+/*************************/
+/*                       */
+/* The building routine. */
+/*                       */
+/*************************/
+
+/* This routine builds the bipartite graph
+** defined by the given array of (column, row)
+** pairs. Adjacency lists are filled in pair
+** order, so that the edge order seen by the
+** greedy initial matching can be controlled.
+** It returns:
+** - 0   : if graph could be built.
+** - !0  : on error.
+*/
+
+static
+int
+testEsBuild (
+TestEsGraph * const         tgrfptr,
+const int                   veloflg)              /* Set if vertices are to be weighted */
+{
+  Gnum *              verttab;
+  Gnum *              velotab;
+  Gnum *              edgetab;
+  Gnum                vertnbr;
+  Gnum                vertnum;
+  Gnum                pairnum;
+  Gnum                degrmax;
+  Gnum                velosum;
+
+  vertnbr = tgrfptr->colnbr + tgrfptr->rownbr;
+  if (((verttab = malloc ((vertnbr + 1)        * sizeof (Gnum))) == NULL) ||
+      ((velotab = malloc ((vertnbr + 1)        * sizeof (Gnum))) == NULL) || /* "+1" as vertnbr may be 0 */
+      ((edgetab = malloc ((tgrfptr->pairnbr * 2 + 1) * sizeof (Gnum))) == NULL)) {
+    SCOTCH_errorPrint ("testEsBuild: out of memory");
+    return (1);
+  }
+
+  memSet (verttab, 0, (vertnbr + 1) * sizeof (Gnum));
+  for (pairnum = 0; pairnum < tgrfptr->pairnbr; pairnum ++) { /* Count degrees, shifted by one */
+    verttab[tgrfptr->pairtab[2 * pairnum] + 1] ++;
+    verttab[tgrfptr->colnbr + tgrfptr->pairtab[2 * pairnum + 1] + 1] ++;
+  }
+  for (vertnum = 0, degrmax = 0; vertnum < vertnbr; vertnum ++) { /* Turn degrees into start indices, still shifted */
+    if (degrmax < verttab[vertnum + 1])
+      degrmax = verttab[vertnum + 1];
+    verttab[vertnum + 1] += verttab[vertnum];
+  }
+  for (pairnum = 0; pairnum < tgrfptr->pairnbr; pairnum ++) { /* Fill adjacency in pair order and un-shift indices */
+    Gnum                colnum;
+    Gnum                rownum;
+
+    colnum = tgrfptr->pairtab[2 * pairnum];
+    rownum = tgrfptr->pairtab[2 * pairnum + 1] + tgrfptr->colnbr;
+    edgetab[verttab[colnum] ++] = rownum;
+    edgetab[verttab[rownum] ++] = colnum;
+  }
+  memMov (verttab + 1, verttab, vertnbr * sizeof (Gnum));
+  verttab[0] = 0;
+
+  for (vertnum = 0, velosum = 0; vertnum < vertnbr; vertnum ++) {
+    velotab[vertnum] = (veloflg != 0) ? (1 + intRandVal (&intranddat, 9)) : 1;
+    velosum += velotab[vertnum];
+  }
+
+  graphInit (&tgrfptr->grafdat);
+  tgrfptr->grafdat.flagval = GRAPHNONE;           /* Arrays freed by testEsFree() */
+  tgrfptr->grafdat.baseval = 0;
+  tgrfptr->grafdat.vertnbr =
+  tgrfptr->grafdat.vertnnd = vertnbr;
+  tgrfptr->grafdat.verttax = verttab;
+  tgrfptr->grafdat.vendtax = verttab + 1;
+  tgrfptr->grafdat.velotax = (veloflg != 0) ? velotab : NULL;
+  tgrfptr->grafdat.velosum = velosum;
+  tgrfptr->grafdat.edgenbr = tgrfptr->pairnbr * 2;
+  tgrfptr->grafdat.edgetax = edgetab;
+  tgrfptr->grafdat.edlosum = tgrfptr->grafdat.edgenbr;
+  tgrfptr->grafdat.degrmax = degrmax;
+
+  if (veloflg == 0)
+    free (velotab);
+
+  if (graphCheck (&tgrfptr->grafdat) != 0) {
+    SCOTCH_errorPrint ("testEsBuild: invalid graph");
+    return (1);
+  }
+
+  return (0);
+}
+
+/* This routine frees the arrays of
+** the given bipartite graph.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+static
+void
+testEsFree (
+TestEsGraph * const         tgrfptr)
+{
+  if (tgrfptr->grafdat.velotax != NULL)
+    free (tgrfptr->grafdat.velotax);
+  free (tgrfptr->grafdat.edgetax);
+  free (tgrfptr->grafdat.verttax);
+}
+
+/**************************/
+/*                        */
+/* The reference matcher. */
+/*                        */
+/**************************/
+
+/* This routine searches for an augmenting
+** path starting from the given column vertex,
+** by plain recursive depth-first search. It
+** is only used on graphs small enough for the
+** recursion not to overflow the stack.
+** It returns:
+** - 0   : if no augmenting path found.
+** - 1   : if matching has been augmented.
+*/
+
+static
+int
+testEsMatch2 (
+const Graph * const         grafptr,
+Gnum * const                matetab,
+Gnum * const                flagtab,
+const Gnum                  flagval,
+const Gnum                  colnum)
+{
+  Gnum                edgenum;
+
+  for (edgenum = grafptr->verttax[colnum]; edgenum < grafptr->vendtax[colnum]; edgenum ++) {
+    Gnum                rownum;
+
+    rownum = grafptr->edgetax[edgenum];
+    if (flagtab[rownum] == flagval)
+      continue;
+    flagtab[rownum] = flagval;
+
+    if ((matetab[rownum] == -1) ||
+        (testEsMatch2 (grafptr, matetab, flagtab, flagval, matetab[rownum]) != 0)) {
+      matetab[rownum] = colnum;
+      return (1);
+    }
+  }
+
+  return (0);
+}
+
+/* This routine computes the size of
+** a maximum matching of the given
+** bipartite graph, by Kuhn's method.
+** It returns:
+** - >=0 : size of maximum matching.
+** - <0  : on error.
+*/
+
+static
+Gnum
+testEsMatch (
+const TestEsGraph * const   tgrfptr)
+{
+  Gnum *              matetab;
+  Gnum *              flagtab;
+  Gnum                colnum;
+  Gnum                matcnbr;
+
+  if (((matetab = malloc ((tgrfptr->grafdat.vertnbr + 1) * sizeof (Gnum))) == NULL) ||
+      ((flagtab = malloc ((tgrfptr->grafdat.vertnbr + 1) * sizeof (Gnum))) == NULL)) {
+    SCOTCH_errorPrint ("testEsMatch: out of memory");
+    return (-1);
+  }
+  memSet (matetab, ~0, tgrfptr->grafdat.vertnbr * sizeof (Gnum));
+  memSet (flagtab, ~0, tgrfptr->grafdat.vertnbr * sizeof (Gnum));
+
+  for (colnum = 0, matcnbr = 0; colnum < tgrfptr->colnbr; colnum ++)
+    matcnbr += testEsMatch2 (&tgrfptr->grafdat, matetab, flagtab, colnum, colnum);
+
+  free (flagtab);
+  free (matetab);
+
+  return (matcnbr);
+}
+
+/*************************/
+/*                       */
+/* The checking routine. */
+/*                       */
+/*************************/
+
+/* This routine computes a minimum vertex
+** cover of the given bipartite graph, and
+** checks that it covers all edges and that
+** its size is equal to the given maximum
+** matching size.
+** It returns:
+** - 0   : if cover is valid and minimum.
+** - !0  : on error.
+*/
+
+static
+int
+testEsCheck (
+const TestEsGraph * const   tgrfptr,
+const Gnum                  matcnbr)
+{
+  Gnum *              sepatab;
+  Gnum                sepanbr;
+  Gnum                sepanum;
+  Gnum *              flagtab;
+  Gnum                pairnum;
+  int                 o;
+
+  if (((sepatab = malloc ((tgrfptr->grafdat.vertnbr + 1) * sizeof (Gnum))) == NULL) ||
+      ((flagtab = malloc ((tgrfptr->grafdat.vertnbr + 1) * sizeof (Gnum))) == NULL)) {
+    SCOTCH_errorPrint ("testEsCheck: out of memory");
+    return (1);
+  }
+
+  o = 1;
+  if (vgraphSeparateEsCover (&tgrfptr->grafdat, tgrfptr->colnbr, sepatab, &sepanbr) != 0) {
+    SCOTCH_errorPrint ("testEsCheck: cannot compute vertex cover");
+    goto abort;
+  }
+  if (sepanbr != matcnbr) {
+    SCOTCH_errorPrint ("testEsCheck: cover size (" GNUMSTRING ") is not maximum matching size (" GNUMSTRING ")",
+                       (Gnum) sepanbr, (Gnum) matcnbr);
+    goto abort;
+  }
+
+  memSet (flagtab, 0, tgrfptr->grafdat.vertnbr * sizeof (Gnum));
+  for (sepanum = 0; sepanum < sepanbr; sepanum ++) {
+    Gnum                vertnum;
+
+    vertnum = sepatab[sepanum];
+    if ((vertnum < 0) || (vertnum >= tgrfptr->grafdat.vertnbr)) {
+      SCOTCH_errorPrint ("testEsCheck: invalid cover vertex");
+      goto abort;
+    }
+    if (flagtab[vertnum] != 0) {
+      SCOTCH_errorPrint ("testEsCheck: duplicate cover vertex");
+      goto abort;
+    }
+    flagtab[vertnum] = 1;
+  }
+  for (pairnum = 0; pairnum < tgrfptr->pairnbr; pairnum ++) {
+    if ((flagtab[tgrfptr->pairtab[2 * pairnum]] == 0) &&
+        (flagtab[tgrfptr->pairtab[2 * pairnum + 1] + tgrfptr->colnbr] == 0)) {
+      SCOTCH_errorPrint ("testEsCheck: edge not covered");
+      goto abort;
+    }
+  }
+
+  o = 0;
+abort:
+  free (flagtab);
+  free (sepatab);
+
+  return (o);
+}
+
+/*********************/
+/*                   */
+/* The main routine. */
+/*                   */
+/*********************/
+
+int
+main (
+int                 argc,
+char *              argv[])
+{
+  TestEsGraph         tgrfdat;
+  Gnum *              pairtab;
+  Gnum                pairmax;
+  Gnum *              flagtab;
+  Gnum                matcnbr;
+  int                 passnbr;
+  int                 passnum;
+  Gnum                channbr;
+
+  SCOTCH_errorProg (argv[0]);
+
+  intRandInit (&intranddat);                      /* Initialize random generator */
+
+  passnbr = 1000;
+  switch (argc) {
+    case 3 :
+      intRandSeed (&intranddat, MAX (0, atoi (argv[2])));
+    case 2 :
+      passnbr = MAX (1, atoi (argv[1]));
+    case 1 :
+      break;
+    default :
+      SCOTCH_errorPrint ("usage: %s [passnbr [seed]]", argv[0]);
+      exit (EXIT_FAILURE);
+  }
+
+  pairmax = 2 * (CHAINNBR + 1);                   /* Large enough for all test graphs */
+  if (((pairtab = malloc (pairmax * 2 * sizeof (Gnum))) == NULL) ||
+      ((flagtab = malloc (64 * sizeof (Gnum)))       == NULL)) {
+    SCOTCH_errorPrint ("main: out of memory");
+    exit (EXIT_FAILURE);
+  }
+  tgrfdat.pairtab = pairtab;
+
+  for (passnum = 0; passnum < passnbr; passnum ++) { /* Random bipartite graphs */
+    Gnum                colnum;
+    Gnum                degrmax;
+
+    tgrfdat.colnbr  = 1 + intRandVal (&intranddat, 40);
+    tgrfdat.rownbr  = 1 + intRandVal (&intranddat, 40);
+    tgrfdat.pairnbr = 0;
+    degrmax = 1 + intRandVal (&intranddat, 6);
+    for (colnum = 0; colnum < tgrfdat.colnbr; colnum ++) {
+      Gnum                degrnbr;
+      Gnum                degrnum;
+
+      memSet (flagtab, 0, tgrfdat.rownbr * sizeof (Gnum));
+      degrnbr = intRandVal (&intranddat, MIN (degrmax, tgrfdat.rownbr) + 1);
+      for (degrnum = 0; degrnum < degrnbr; degrnum ++) {
+        Gnum                rownum;
+
+        rownum = intRandVal (&intranddat, tgrfdat.rownbr);
+        if (flagtab[rownum] != 0)                 /* Do not create multiple edges */
+          continue;
+        flagtab[rownum] = 1;
+        pairtab[2 * tgrfdat.pairnbr]     = colnum;
+        pairtab[2 * tgrfdat.pairnbr + 1] = rownum;
+        tgrfdat.pairnbr ++;
+      }
+    }
+
+    if ((testEsBuild (&tgrfdat, passnum & 1) != 0) ||
+        ((matcnbr = testEsMatch (&tgrfdat)) < 0)   ||
+        (testEsCheck (&tgrfdat, matcnbr) != 0)) {
+      SCOTCH_errorPrint ("main: error in random graph (%d)", passnum);
+      exit (EXIT_FAILURE);
+    }
+    testEsFree (&tgrfdat);
+  }
+
+  for (passnum = 1; passnum <= 8; passnum ++) {   /* Complete bipartite graphs */
+    Gnum                colnum;
+    Gnum                rownum;
+
+    tgrfdat.colnbr  = passnum;
+    tgrfdat.rownbr  = 9 - passnum;
+    tgrfdat.pairnbr = 0;
+    for (colnum = 0; colnum < tgrfdat.colnbr; colnum ++) {
+      for (rownum = 0; rownum < tgrfdat.rownbr; rownum ++) {
+        pairtab[2 * tgrfdat.pairnbr]     = colnum;
+        pairtab[2 * tgrfdat.pairnbr + 1] = rownum;
+        tgrfdat.pairnbr ++;
+      }
+    }
+
+    if ((testEsBuild (&tgrfdat, 0) != 0) ||
+        (testEsCheck (&tgrfdat, MIN (tgrfdat.colnbr, tgrfdat.rownbr)) != 0)) {
+      SCOTCH_errorPrint ("main: error in complete graph (%d)", passnum);
+      exit (EXIT_FAILURE);
+    }
+    testEsFree (&tgrfdat);
+  }
+
+  for (channbr = 1; channbr <= CHAINNBR; channbr *= 10) { /* Staircase graphs */
+    Gnum                colnum;
+
+    tgrfdat.colnbr  =                             /* Column c_i is linked to rows r_(i+1) and r_i, in this order */
+    tgrfdat.rownbr  = channbr + 1;
+    tgrfdat.pairnbr = 0;
+    for (colnum = 0; colnum < channbr; colnum ++) {
+      pairtab[2 * tgrfdat.pairnbr]     = colnum;
+      pairtab[2 * tgrfdat.pairnbr + 1] = colnum + 1;
+      tgrfdat.pairnbr ++;
+      pairtab[2 * tgrfdat.pairnbr]     = colnum;
+      pairtab[2 * tgrfdat.pairnbr + 1] = colnum;
+      tgrfdat.pairnbr ++;
+    }
+    pairtab[2 * tgrfdat.pairnbr]     = channbr;   /* Last column is only linked to last row */
+    pairtab[2 * tgrfdat.pairnbr + 1] = channbr;
+    tgrfdat.pairnbr ++;
+
+    if (testEsBuild (&tgrfdat, 0) != 0) {
+      SCOTCH_errorPrint ("main: cannot build staircase graph");
+      exit (EXIT_FAILURE);
+    }
+    if (channbr <= 1000) {                        /* Reference matcher is recursive */
+      if ((matcnbr = testEsMatch (&tgrfdat)) != (channbr + 1)) {
+        SCOTCH_errorPrint ("main: invalid reference matching");
+        exit (EXIT_FAILURE);
+      }
+    }
+
+    if (testEsCheck (&tgrfdat, channbr + 1) != 0) { /* Greedy matching leaves an augmenting path of length 2 * channbr */
+      SCOTCH_errorPrint ("main: error in staircase graph (" GNUMSTRING ")", (Gnum) channbr);
+      exit (EXIT_FAILURE);
+    }
+    testEsFree (&tgrfdat);
+  }
+
+  free (flagtab);
+  free (pairtab);
+
+  exit (EXIT_SUCCESS);
+}
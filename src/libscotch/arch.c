@@ -67,6 +67,8 @@
 /**                                 to   : 24 aug 2020     **/
 /**                # Version 6.1  : from : 05 apr 2021     **/
 /**                                 to   : 05 apr 2021     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -244,6 +246,34 @@ FILE * restrict const       stream)
   return (o);
 }
 
+/* This routine saves the given architecture
+** in binary form when its class supports it,
+** that is, for compiled decomposition-defined
+** architectures, and in textual form else.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+archSaveBin (
+const Arch * restrict const archptr,
+FILE * restrict const       stream)
+{
+  int                 o;
+
+  if (archptr->class != archClass ("deco"))       /* If not a type-1 decomposition-defined architecture */
+    return (archSave (archptr, stream));          /* Only textual form is available                     */
+
+  o = (fprintf (stream, "%s\n",                   /* Write architecture class */
+                archptr->class->archname) == EOF);
+  o |= archDecoArchSaveBin ((const ArchDeco * const) (void *) &archptr->data, stream);
+  if (o != 0)
+    errorPrint ("archSaveBin: bad output");
+
+  return (o);
+}
+
 /* This routine returns the pointer to
 ** the class of a given architecture
 ** name.
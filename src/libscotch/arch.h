@@ -66,6 +66,8 @@
 /**                                 to   : 11 aug 2010     **/
 /**                # Version 6.0  : from : 14 feb 2011     **/
 /**                                 to   : 28 may 2018     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -228,6 +230,7 @@ int                         archExit            (Arch * restrict const);
 int                         archFree            (Arch * restrict const);
 int                         archLoad            (Arch * restrict const, FILE * const);
 int                         archSave            (const Arch * const, FILE * const);
+int                         archSaveBin         (const Arch * const, FILE * const);
 char *                      archName            (const Arch * const);
 const ArchClass *           archClass           (const char * const);
 const ArchClass *           archClass2          (const char * const, const int);
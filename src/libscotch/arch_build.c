@@ -54,7 +54,7 @@
 /**                # Version 6.0  : from : 28 jun 2011     **/
 /**                                 to   : 15 may 2018     **/
 /**                # Version 7.0  : from : 21 aug 2019     **/
-/**                                 to   : 12 sep 2019     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -102,6 +102,99 @@ ArchDecoBuildJob * const    jobtab)
   } while (jobptr != NULL);
 }
 
+/**********************************/
+/*                                */
+/* Terminal distance computation. */
+/*                                */
+/**********************************/
+
+/* This routine computes the distances from
+** the source terminals assigned to the current
+** thread to all the terminals of lower index,
+** by means of breadth-first searches. Source
+** terminals are interleaved across threads, so
+** that the workload remains balanced although
+** searches stop as soon as all the terminals
+** of lower index have been reached.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+archDecoBuildDistThr (
+ThreadDescriptor * restrict const   descptr,
+ArchDecoBuildData * restrict const  dataptr)
+{
+  Gnum                termdomnum;
+  Gnum                vertnum;
+
+  const int                                     thrdnbr     = threadNbr (descptr);
+  const int                                     thrdnum     = threadNum (descptr);
+  const Graph * restrict const                  grafptr     = dataptr->grafptr;
+  const Gnum                                    baseval     = grafptr->baseval;
+  const Gnum * restrict const                   verttax     = grafptr->verttax;
+  const Gnum * restrict const                   vendtax     = grafptr->vendtax;
+  const Gnum * restrict const                   edgetax     = grafptr->edgetax;
+  const Gnum * restrict const                   edlotax     = grafptr->edlotax;
+  const ArchDecoTermVert * restrict const       termverttab = dataptr->termverttab;
+  const Gnum * restrict const                   termnumtax  = dataptr->termnumtax;
+  const Gnum                                    termdomnbr  = dataptr->termdomnbr;
+  Anum * restrict const                         termdisttab = dataptr->termdisttab;
+  ArchDecoBuildDistElem * restrict const        disttax     = dataptr->disttab + thrdnum * grafptr->vertnbr - baseval;
+  ArchDecoBuildQueuElem * restrict const        queutab     = dataptr->queutab + thrdnum * grafptr->vertnbr;
+
+  for (vertnum = baseval; vertnum < grafptr->vertnnd; vertnum ++) {
+    disttax[vertnum].queued  = 0;                 /* Vertex not queued yet; source terminals start from 1 */
+    disttax[vertnum].distval = INTVALMAX;         /* Assume maximum distance                               */
+  }
+
+  for (termdomnum = 1 + thrdnum; termdomnum < termdomnbr; termdomnum += thrdnbr) { /* For all local source terminals */
+    Gnum                termdomend;
+    Gnum                termleft;                 /* Number of terminals of lower index not yet reached */
+    Gnum                queuhead;                 /* Head-of-queue index                               */
+    Gnum                queutail;                 /* Tail-of-queue index                               */
+
+    queuhead =                                    /* Reset the queue */
+    queutail = 0;
+    vertnum  = termverttab[termdomnum].labl;
+    queutab[queutail].vertnum    = vertnum;       /* Insert root vertex */
+    queutab[queutail ++].distval = 0;
+    disttax[vertnum].queued  = termdomnum;        /* Mark vertex as queued for this source terminal */
+    disttax[vertnum].distval = 0;
+
+    for (termleft = termdomnum; (queuhead < queutail) && (termleft > 0); ) { /* As long as useful vertices in queue */
+      Gnum                vertdist;               /* Current distance value */
+      Gnum                edgenum;
+
+      vertnum  = queutab[queuhead].vertnum;       /* Retrieve vertex from queue */
+      vertdist = queutab[queuhead ++].distval;
+
+      for (edgenum = verttax[vertnum];            /* For all vertex edges */
+           edgenum < vendtax[vertnum]; edgenum ++) {
+        Gnum                vertend;
+
+        vertend = edgetax[edgenum];
+        if (disttax[vertend].queued != termdomnum) { /* If end vertex not queued */
+          queutab[queutail].vertnum    = vertend; /* Queue the vertex            */
+          queutab[queutail ++].distval =
+          disttax[vertend].distval = vertdist + ((edlotax != NULL) ? edlotax[edgenum] : 1);
+          disttax[vertend].queued  = termdomnum;  /* Mark vertex as queued */
+          if ((termnumtax[vertend] >= 0) &&       /* If terminal of lower index reached */
+              (termnumtax[vertend] < termdomnum))
+            termleft --;
+        }
+      }
+    }
+
+    for (termdomend = 0; termdomend < termdomnum; termdomend ++) { /* For all previous terminal domains */
+      vertnum = termverttab[termdomend].labl;
+      termdisttab[((termdomnum * (termdomnum - 1)) / 2) + termdomend] = /* Retrieve distance           */
+        (disttax[vertnum].queued == termdomnum) ? disttax[vertnum].distval : INTVALMAX;
+    }
+  }
+}
+
 /********************************************/
 /*                                          */
 /* The main routine, which computes the     */
@@ -132,10 +225,10 @@ Context * const             contptr)              /*+ Execution context
   Gnum                              termdommax;   /* Maximum terminal number                        */
   ArchDecoTermVert * restrict       termverttab;  /* Terminal vertex table                          */
   Anum * restrict                   termdisttab;  /* Vertex distance table                          */
-  ArchDecoBuildDistElem * restrict  disttax;      /* Distance table                                 */
-  ArchDecoBuildQueuElem * restrict  queutab;      /* Distance queue table                           */
-  Gnum                              queuhead;     /* Head-of-queue index                            */
-  Gnum                              queutail;     /* Tail-of-queue index                            */
+  Anum                              termdistnbr;  /* Number of cells of vertex distance table       */
+  Gnum * restrict                   termnumtax;   /* Terminal index of target vertices              */
+  ArchDecoBuildData                 distdat;      /* Data for distance computation threads          */
+  int                               thrdnbr;      /* Number of threads                              */
   Mapping                           mappdat;      /* Partial and final mapping data                 */
   ArchDecoBuildJob * restrict       jobtab;       /* Job array                                      */
   ArchDecoBuildJob *                joblink;      /* Linked list of jobs to process                 */
@@ -149,10 +242,8 @@ Context * const             contptr)              /*+ Execution context
   GraphPart                         actpartval;   /* Part value to put to subjob                    */
   Gnum                              actpartnbr;   /* Size of part value to put to subjob            */
   Gnum                              termdomnum;
+  int                               o;
 
-  const Gnum * restrict const tgtverttax = tgtgrafptr->verttax;
-  const Gnum * restrict const tgtvendtax = tgtgrafptr->vendtax;
-  const Gnum * restrict const tgtedgetax = tgtgrafptr->edgetax;
   const Gnum * restrict const tgtedlotax = tgtgrafptr->edlotax;
 
   archInit (tgtarchptr);                          /* Initialize architecture body */
@@ -161,6 +252,10 @@ Context * const             contptr)              /*+ Execution context
   termdomnbr = (tgtlistptr != NULL) ? tgtlistptr->vnumnbr : tgtgrafptr->vertnbr;
   if (termdomnbr == 0)                            /* If nothing to do */
     return (0);
+  if (archDecoArchDistNbr ((Anum) termdomnbr, &termdistnbr) != 0) {
+    errorPrint ("archDecoBuild: too many terminals");
+    return     (1);
+  }
 
   invedlosiz = (tgtedlotax != NULL) ? tgtgrafptr->edgenbr : 0;
   if ((memAllocGroup ((void **) (void *)
@@ -193,7 +288,7 @@ Context * const             contptr)              /*+ Execution context
 
   jobtab[0].domnum = 0;                           /* All vertices mapped to first domain  */
   if ((tgtlistptr != NULL) && (tgtlistptr->vnumtab != NULL)) /* If vertex list given      */
-    graphInduceList (tgtgrafptr, tgtlistptr->vnumnbr, tgtlistptr->vnumtab, &jobtab[0].grafdat); /* Restrict initial job */
+    graphInduceList (tgtgrafptr, tgtlistptr->vnumnbr, tgtlistptr->vnumtab, &jobtab[0].grafdat, contptr); /* Restrict initial job */
   else {                                          /* If no vertex list given              */
     memCpy (&jobtab[0].grafdat, tgtgrafptr, sizeof (Graph)); /* Job takes whole graph     */
     jobtab[0].grafdat.flagval &= ~GRAPHFREETABS;  /* Graph is a clone                     */
@@ -274,13 +369,13 @@ Context * const             contptr)              /*+ Execution context
 
     if (actpartnbr < (actgrafdat.s.vertnbr - 1)) { /* If part 1 splittable */
       graphInducePart (&actgrafdat.s, actgrafdat.parttax, actgrafdat.s.vertnbr - actpartnbr,
-                       1 - actpartval, &jobsubptr->grafdat);
+                       1 - actpartval, &jobsubptr->grafdat, contptr);
       jobsubptr->joblink = joblink;               /* Link subjobs in list */
       joblink            = jobsubptr;
     }
     if (actpartnbr > 1) {                         /* If part 0 splittable */
       graphInducePart (&actgrafdat.s, actgrafdat.parttax, actpartnbr,
-                       actpartval, &joborgptr->grafdat);
+                       actpartval, &joborgptr->grafdat, contptr);
       joborgptr->joblink = joblink;               /* Link subjobs in list */
       joblink            = joborgptr;
     }
@@ -289,17 +384,22 @@ Context * const             contptr)              /*+ Execution context
 
   memFree (jobtab);                               /* Free group leader */
 
+  thrdnbr = contextThreadNbr (contptr);
   if (memAllocGroup ((void **) (void *)
-                     &termverttab, (size_t) (termdomnbr                            * sizeof (ArchDecoTermVert)),
-                     &termdisttab, (size_t) (((termdomnbr * (termdomnbr - 1)) / 2) * sizeof (Anum)),
-                     &disttax,     (size_t) (tgtgrafptr->vertnbr                   * sizeof (ArchDecoBuildDistElem)),
-                     &queutab,     (size_t) (tgtgrafptr->vertnbr                   * sizeof (ArchDecoBuildQueuElem)), NULL) == NULL) {
+                     &termverttab,     (size_t) (termdomnbr                            * sizeof (ArchDecoTermVert)),
+                     &termdisttab,     (size_t) (termdistnbr                           * sizeof (Anum)),
+                     &termnumtax,      (size_t) (tgtgrafptr->vertnbr                   * sizeof (Gnum)),
+                     &distdat.disttab, (size_t) (thrdnbr * tgtgrafptr->vertnbr         * sizeof (ArchDecoBuildDistElem)),
+                     &distdat.queutab, (size_t) (thrdnbr * tgtgrafptr->vertnbr         * sizeof (ArchDecoBuildQueuElem)), NULL) == NULL) {
     errorPrint ("archDecoBuild: out of memory (2)");
     mapExit    (&mappdat);
     archExit   (&archdat);
     return     (1);
   }
 
+  memSet (termnumtax, ~0, tgtgrafptr->vertnbr * sizeof (Gnum)); /* Assume no vertex is a terminal */
+  termnumtax -= tgtgrafptr->baseval;
+
   for (termdomnum = 0, termdommax = 0; termdomnum < termdomnbr; termdomnum ++) { /* Set terminal vertex array */
     Gnum                tgtvertnum;
 
@@ -307,60 +407,23 @@ Context * const             contptr)              /*+ Execution context
     termverttab[termdomnum].labl = tgtvertnum;
     termverttab[termdomnum].wght = (tgtgrafptr->velotax != NULL) ? tgtgrafptr->velotax[tgtvertnum] : 1;
     termverttab[termdomnum].num  = archDomNum (&archdat, mapDomain (&mappdat, tgtvertnum - tgtgrafptr->baseval));
+    termnumtax[tgtvertnum]       = termdomnum;
     if (termverttab[termdomnum].num > termdommax) /* Find maximum terminal number */
       termdommax = termverttab[termdomnum].num;
   }
 
-  disttax -= tgtgrafptr->baseval;
-  for (termdomnum = 1; termdomnum < termdomnbr; termdomnum ++) { /* For all active terminal vertices except the first */
-    Gnum                termdomend;
-    Gnum                tgtvertnum;
-
-    for (tgtvertnum = tgtgrafptr->baseval; tgtvertnum < (tgtgrafptr->vertnbr + tgtgrafptr->baseval); tgtvertnum ++) {
-      disttax[tgtvertnum].queued  = 0;            /* Vertex not queued       */
-      disttax[tgtvertnum].distval = INTVALMAX;    /* Assume maximum distance */
-    }
-
-    queuhead =                                    /* Reset the queue */
-    queutail = 0;
-    tgtvertnum = termverttab[termdomnum].labl;
-    queutab[queutail].vertnum    = tgtvertnum;    /* Insert root vertex */
-    queutab[queutail ++].distval = 0;
-    disttax[tgtvertnum].queued  = 1;              /* Mark vertex as queued */
-    disttax[tgtvertnum].distval = 0;
-
-    while (queuhead < queutail) {                 /* As long as there are vertices in queue */
-      Gnum                vertnum;                /* Number of current vertex               */
-      Gnum                vertdist;               /* Current distance value                 */
-      Gnum                edgenum;
-
-      vertnum  = queutab[queuhead].vertnum;       /* Retrieve vertex from queue */
-      vertdist = queutab[queuhead ++].distval;
-
-      for (edgenum = tgtverttax[vertnum];         /* For all vertex edges */
-           edgenum < tgtvendtax[vertnum]; edgenum ++) {
-        Gnum                vertend;
-
-        vertend = tgtedgetax[edgenum];
-        if (disttax[vertend].queued == 0) {       /* If end vertex not queued */
-          queutab[queutail].vertnum    = vertend; /* Queue the vertex         */
-          queutab[queutail ++].distval =
-          disttax[vertend].distval = vertdist + ((tgtedlotax != NULL) ? tgtedlotax[edgenum] : 1);
-          disttax[vertend].queued  = 1;           /* Mark vertex as queued */
-        }
-      }
-    }
-
-    for (termdomend = 0; termdomend < termdomnum; termdomend ++) /* For all previous terminal domains */
-      termdisttab[((termdomnum * (termdomnum - 1)) / 2) + termdomend] = /* Retrieve distance          */
-        disttax[termverttab[termdomend].labl].distval;
-  }
+  distdat.grafptr     = tgtgrafptr;
+  distdat.termverttab = termverttab;
+  distdat.termnumtax  = termnumtax;
+  distdat.termdomnbr  = termdomnbr;
+  distdat.termdisttab = termdisttab;
+  contextThreadLaunch (contptr, (ThreadFunc) archDecoBuildDistThr, (void *) &distdat); /* Compute terminal distances */
 
-  archDecoArchBuild2 ((ArchDeco *) (void *) &tgtarchptr->data, termdomnbr, termdommax, termverttab, termdisttab);
+  o = archDecoArchBuild2 ((ArchDeco *) (void *) &tgtarchptr->data, termdomnbr, termdommax, termverttab, termdisttab);
 
   memFree  (termverttab);                         /* Free group leader */
   mapExit  (&mappdat);
   archExit (&archdat);
 
-  return (0);
+  return (o);
 }
@@ -47,7 +47,7 @@
 /**                # Version 6.0  : from : 14 mar 2016     **/
 /**                                 to   : 31 may 2018     **/
 /**                # Version 7.0  : from : 21 aug 2019     **/
-/**                                 to   : 21 aug 2019     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # This file contains pieces of code     **/
 /**                  extracted from release 3.1 of         **/
@@ -70,8 +70,8 @@ typedef struct ArchDecoBuildJob_ {
 /*+ Vertex distance information. +*/
 
 typedef struct ArchDecoBuildDistElem_ {
-  int                       queued;               /*+ Flag set if vertex queued  +*/
-  Anum                      distval;              /*+ Distance to initial vertex +*/
+  Gnum                      queued;               /*+ Index of last source terminal which queued vertex +*/
+  Anum                      distval;              /*+ Distance to initial vertex                        +*/
 } ArchDecoBuildDistElem;
 
 /*+ Queue element. +*/
@@ -81,12 +81,27 @@ typedef struct ArchDecoBuildQueuElem_ {
   Anum                      distval;              /*+ Distance reached              +*/
 } ArchDecoBuildQueuElem;
 
+/*+ The distance computation parameter
+    structure. It contains the thread-
+    independent data.                   +*/
+
+typedef struct ArchDecoBuildData_ {
+  const Graph *             grafptr;              /*+ Target graph                                     +*/
+  const ArchDecoTermVert *  termverttab;          /*+ Terminal vertex table                            +*/
+  const Gnum *              termnumtax;           /*+ Terminal index of target vertices, or -1         +*/
+  Gnum                      termdomnbr;           /*+ Number of terminal domains                       +*/
+  Anum *                    termdisttab;          /*+ Terminal distance triangle                       +*/
+  ArchDecoBuildDistElem *   disttab;              /*+ Per-thread distance arrays                       +*/
+  ArchDecoBuildQueuElem *   queutab;              /*+ Per-thread distance queues                       +*/
+} ArchDecoBuildData;
+
 /*
 **  The function prototypes.
 */
 
 #ifdef ARCH_BUILD
 static void                 archDecoBuildJobExit (ArchDecoBuildJob *);
+static void                 archDecoBuildDistThr (ThreadDescriptor * restrict const, ArchDecoBuildData * restrict const);
 #endif /* ARCH_BUILD */
 
 int                         archDecoArchBuild   (Arch * const, const Graph * const, const VertList * const, const Strat * const, Context * restrict const);
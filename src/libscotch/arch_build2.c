@@ -42,7 +42,7 @@
 /**   DATES      : # Version 6.0  : from : 02 may 2015     **/
 /**                                 to   : 22 feb 2018     **/
 /**                # Version 7.0  : from : 22 aug 2019     **/
-/**                                 to   : 12 sep 2019     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # The code of the main routine derives  **/
 /**                  from that of archSubArchBuild().      **/
@@ -742,5 +742,7 @@ Context * const             contptr)              /*+ Execution context
 
   archDeco2BuildMatchExit (&matcdat);             /* Free data structures used for matching */
 
+  archDeco2ArchDist (decoptr);                    /* Set up distance tables and landmarks */
+
   return (0);
 }
@@ -65,6 +65,8 @@
 /**                                 to   : 11 aug 2010     **/
 /**                # Version 6.0  : from : 14 feb 2011     **/
 /**                                 to   : 28 apr 2019     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -87,6 +89,171 @@
 /*                                     */
 /***************************************/
 
+/* This routine returns the size of the
+** smallest unsigned integer type which
+** can hold the given distance value.
+** It returns:
+** - size  : in all cases.
+*/
+
+static
+int
+archDecoArchDistSiz (
+const Anum                  distmax)
+{
+  return ((distmax <= (Anum) ((byte) ~0))
+          ? sizeof (byte)
+          : ((distmax <= (Anum) ((unsigned short) ~0)) ? sizeof (unsigned short) : sizeof (Anum)));
+}
+
+/* These routines read the distance value
+** of given index in the distance triangle,
+** according to the type in which distances
+** are stored.
+** They return:
+** - distance  : in all cases.
+*/
+
+static
+Anum
+archDecoArchDistByte (
+const void * const          disttab,
+const Anum                  distnum)
+{
+  return ((Anum) ((const byte *) disttab)[distnum]);
+}
+
+static
+Anum
+archDecoArchDistShrt (
+const void * const          disttab,
+const Anum                  distnum)
+{
+  return ((Anum) ((const unsigned short *) disttab)[distnum]);
+}
+
+static
+Anum
+archDecoArchDistAnum (
+const void * const          disttab,
+const Anum                  distnum)
+{
+  return (((const Anum *) disttab)[distnum]);
+}
+
+/* This routine records the size of the
+** distance values of the given architecture,
+** and selects once for all the routine
+** which reads them.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+static
+void
+archDecoArchDistSet (
+ArchDeco * restrict const   archptr,
+const int                   distsiz)
+{
+  archptr->domdistsiz  = distsiz;
+  archptr->domdistfunc = (distsiz == sizeof (byte))
+                         ? archDecoArchDistByte
+                         : ((distsiz == sizeof (unsigned short)) ? archDecoArchDistShrt : archDecoArchDistAnum);
+}
+
+/* This routine computes the number of
+** cells of the distance triangle for the
+** given number of domains. Since distance
+** indices are computed from the product
+** of domain numbers, domain counts for
+** which this product overflows an Anum,
+** or for which the table size overflows
+** a size_t, are rejected. With 32-bit
+** Anum's, this bounds the number of
+** domains to 46340.
+** It returns:
+** - 0   : if the triangle can be represented.
+** - !0  : if there are too many domains.
+*/
+
+int
+archDecoArchDistNbr (
+const Anum                  domvertnbr,
+Anum * const                distptr)
+{
+  Anum                distnbr;
+
+  if ((domvertnbr > 1) &&                         /* If product of domain numbers overflows */
+      ((domvertnbr - 1) > (ANUMMAX / domvertnbr)))
+    return (1);
+
+  distnbr = (domvertnbr * (domvertnbr - 1)) / 2;
+  if ((size_t) distnbr >= (((size_t) ~0) / sizeof (Anum))) /* If byte size of table overflows */
+    return (1);
+
+  *distptr = distnbr;
+  return (0);
+}
+
+/* This routine stores the domain distances
+** of the given architecture, which are held
+** as Anum values, in the smallest integer
+** type which can hold them all. Since the
+** packed table is built aside of the former
+** one, the architecture is left unchanged
+** if memory is lacking.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+static
+void
+archDecoArchPack (
+ArchDeco * restrict const   archptr)
+{
+  const Anum * restrict disttab;
+  ArchDecoVert *        verttab;
+  void *                disttmp;
+  Anum                  distnbr;
+  Anum                  distnum;
+  Anum                  distmax;
+  int                   distsiz;
+
+  disttab = (const Anum *) archptr->domdisttab;
+  distnbr = (archptr->domvertnbr * (archptr->domvertnbr - 1)) / 2;
+  for (distnum = 0, distmax = 0; distnum < distnbr; distnum ++) {
+    if (disttab[distnum] < 0)                     /* Negative distances cannot be packed */
+      return;
+    if (disttab[distnum] > distmax)
+      distmax = disttab[distnum];
+  }
+
+  distsiz = archDecoArchDistSiz (distmax);
+  if ((distsiz >= sizeof (Anum)) ||               /* If no space to save */
+      ((archptr->flagval & ARCHDECOFREE) == 0))   /* Or arrays not owned */
+    return;
+
+  if (memAllocGroup ((void **) (void *)
+                     &verttab, (size_t) (archptr->domvertnbr * sizeof (ArchDecoVert)),
+                     &disttmp, (size_t) ((distnbr + 1) * distsiz), NULL) == NULL)
+    return;                                       /* Keep unpacked table */
+
+  memCpy (verttab, archptr->domverttab, archptr->domvertnbr * sizeof (ArchDecoVert));
+  if (distsiz == sizeof (byte)) {
+    for (distnum = 0; distnum < distnbr; distnum ++)
+      ((byte *) disttmp)[distnum] = (byte) disttab[distnum];
+  }
+  else {
+    for (distnum = 0; distnum < distnbr; distnum ++)
+      ((unsigned short *) disttmp)[distnum] = (unsigned short) disttab[distnum];
+  }
+
+  memFree (archptr->domverttab);                  /* Free former group leader */
+  archDecoArchDistSet (archptr, distsiz);
+  archptr->domverttab = verttab;
+  archptr->domdisttab = disttmp;
+}
+
 /* This routine builds a compiled
 ** decomposition-defined architecture
 ** from the raw terminal tables that are
@@ -104,6 +271,8 @@ const Anum                      termdommax,       /*+ Maximum domain number give
 const ArchDecoTermVert * const  termverttab,      /*+ Terminal vertex array                            +*/
 const Anum * const              termdisttab)      /*+ Terminal distance map                            +*/
 {
+  Anum * restrict     disttab;                    /* Domain distance table, as Anum values until packed */
+  Anum                distnbr;
   Anum                i, j, k;
 
 #ifdef SCOTCH_DEBUG_ARCH1
@@ -117,13 +286,19 @@ const Anum * const              termdisttab)      /*+ Terminal distance map
 
 /* ,finegrafptr, &coargrafdat, &coarmulttab, 0, 1.0, NULL, NULL, 0, NULL) != 0) { */
 
+  if (archDecoArchDistNbr (termdommax, &distnbr) != 0) {
+    errorPrint ("archDecoArchBuild2: too many domains");
+    return     (1);
+  }
   if (memAllocGroup ((void **) (void *)
                      &archptr->domverttab, (size_t) (termdommax * sizeof (ArchDecoVert)),
-                     &archptr->domdisttab, (size_t) ((((termdommax * (termdommax - 1)) / 2) + 1) * sizeof (Anum)), NULL) == NULL) {
+                     &disttab,             (size_t) ((distnbr + 1) * sizeof (Anum)), NULL) == NULL) {
     errorPrint ("archDecoArchBuild2: out of memory");
     return     (1);
   }
   archptr->flagval    = ARCHDECOFREE;
+  archDecoArchDistSet (archptr, sizeof (Anum));
+  archptr->domdisttab = disttab;
   archptr->domtermnbr = termdomnbr;
   archptr->domvertnbr = termdommax;
 
@@ -164,11 +339,11 @@ const Anum * const              termdisttab)      /*+ Terminal distance map
   }
 #endif /* SCOTCH_DEBUG_ARCH1 */
 
-  memSet (archptr->domdisttab, 0, termdommax * (termdommax - 1) * sizeof (Anum) / 2);
+  memSet (disttab, 0, distnbr * sizeof (Anum));
                                                   /* Assume distance is not known   */
   for (i = 1, k = 0; i < termdomnbr; i ++) {      /* Read the terminal distance map */
     for (j = 0; j < i; j ++, k ++)
-      archDecoArchDist (archptr, termverttab[i].num, termverttab[j].num) = termdisttab[k];
+      disttab[archDecoArchDistIdx (termverttab[i].num, termverttab[j].num)] = termdisttab[k];
   }
 
   for (j = termdommax; j > 0; j --) {             /* Loop on domains              */
@@ -179,21 +354,21 @@ const Anum * const              termdisttab)      /*+ Terminal distance map
         continue;
       if (archDecoArchSize (archptr, i) > 1) {    /* If domain i has subdomains */
         if (archDecoArchSize (archptr, j) > 1)    /* If domain j has subdomains */
-          archDecoArchDist (archptr, i, j) = (archDecoArchDistE (archptr, 2 * i,     2 * j)     +
-                                              archDecoArchDistE (archptr, 2 * i,     2 * j + 1) +
-                                              archDecoArchDistE (archptr, 2 * i + 1, 2 * j)     +
-                                              archDecoArchDistE (archptr, 2 * i + 1, 2 * j + 1) + 2) / 4;
+          disttab[archDecoArchDistIdx (i, j)] = (archDecoArchDistE (archptr, 2 * i,     2 * j)     +
+                                                 archDecoArchDistE (archptr, 2 * i,     2 * j + 1) +
+                                                 archDecoArchDistE (archptr, 2 * i + 1, 2 * j)     +
+                                                 archDecoArchDistE (archptr, 2 * i + 1, 2 * j + 1) + 2) / 4;
         else                                      /* If domain j is a terminal */
-          archDecoArchDist (archptr, i, j) = (archDecoArchDistE (archptr, 2 * i,     j) +
-                                              archDecoArchDistE (archptr, 2 * i + 1, j) + 1) / 2;
+          disttab[archDecoArchDistIdx (i, j)] = (archDecoArchDistE (archptr, 2 * i,     j) +
+                                                 archDecoArchDistE (archptr, 2 * i + 1, j) + 1) / 2;
       }
       else {                                      /* If domain i is a terminal  */
         if (archDecoArchSize (archptr, j) > 1)    /* If domain j has subdomains */
-          archDecoArchDist (archptr, i, j) = (archDecoArchDistE (archptr, i, 2 * j)     +
-                                              archDecoArchDistE (archptr, i, 2 * j + 1) + 1) / 2;
+          disttab[archDecoArchDistIdx (i, j)] = (archDecoArchDistE (archptr, i, 2 * j)     +
+                                                 archDecoArchDistE (archptr, i, 2 * j + 1) + 1) / 2;
 #ifdef SCOTCH_DEBUG_ARCH1
         else {                                    /* If both domain are terminals                  */
-          if (archDecoArchDist (archptr, i, j) == 0) { /* Distance value must be greater than zero */
+          if (disttab[archDecoArchDistIdx (i, j)] == 0) { /* Distance value must be greater than zero */
             errorPrint       ("archDecoArchBuild2: invalid null distance");
             archDecoArchFree (archptr);
             return           (1);
@@ -204,6 +379,78 @@ const Anum * const              termdisttab)      /*+ Terminal distance map
     }
   }
 
+  archDecoArchPack (archptr);                     /* Store distances in smallest possible type */
+
+  return (0);
+}
+
+/* This routine loads a compiled
+** decomposition-defined architecture
+** in binary form, the type number of
+** which has just been read.
+** It returns:
+** - 0   : if the decomposition has been successfully read.
+** - !0  : on error.
+*/
+
+static
+int
+archDecoArchLoadBin (
+ArchDeco * restrict const   archptr,
+FILE * restrict const       stream)
+{
+  ArchDecoBinHead     headdat;
+  Anum                distnbr;
+  int                 distsiz;
+
+  if ((getc (stream) != '\n') ||                  /* Binary data starts after end of type line */
+      (fread (&headdat, sizeof (ArchDecoBinHead), 1, stream) != 1)) {
+    errorPrint ("archDecoArchLoadBin: bad input (1)");
+    return     (1);
+  }
+  if ((headdat.endival != ARCHDECOBINENDIVAL) ||
+      (headdat.versval != ARCHDECOBINVERSION) ||
+      (headdat.anumsiz != sizeof (Anum))) {
+    errorPrint ("archDecoArchLoadBin: incompatible binary file");
+    return     (1);
+  }
+  if ((headdat.domtermnbr < 1)                  ||
+      (headdat.domvertnbr < headdat.domtermnbr) ||
+      (headdat.domvertnbr > (UINT64) ANUMMAX)   ||
+      (headdat.domdistmax > (UINT64) ANUMMAX)) {
+    errorPrint ("archDecoArchLoadBin: bad input (2)");
+    return     (1);
+  }
+
+  if (archDecoArchDistNbr ((Anum) headdat.domvertnbr, &distnbr) != 0) {
+    errorPrint ("archDecoArchLoadBin: too many domains");
+    return     (1);
+  }
+
+  distsiz = archDecoArchDistSiz ((Anum) headdat.domdistmax);
+  if (memAllocGroup ((void **) (void *)
+                     &archptr->domverttab, (size_t) (headdat.domvertnbr * sizeof (ArchDecoVert)),
+                     &archptr->domdisttab, (size_t) ((distnbr + 1) * distsiz), NULL) == NULL) {
+    errorPrint ("archDecoArchLoadBin: out of memory");
+    return     (1);
+  }
+  archptr->flagval    = ARCHDECOFREE;
+  archDecoArchDistSet (archptr, distsiz);
+  archptr->domtermnbr = (Anum) headdat.domtermnbr;
+  archptr->domvertnbr = (Anum) headdat.domvertnbr;
+
+  if (fread (archptr->domverttab, sizeof (ArchDecoVert), archptr->domvertnbr, stream) != (size_t) archptr->domvertnbr) {
+    errorPrint       ("archDecoArchLoadBin: bad input (3)");
+    archDecoArchFree (archptr);
+    return           (1);
+  }
+
+  if (fread (archptr->domdisttab, distsiz, distnbr, stream) != (size_t) distnbr) {
+    errorPrint       ("archDecoArchLoadBin: bad input (4)");
+    archDecoArchFree (archptr);
+    return           (1);
+  }
+
   return (0);
 }
 
@@ -225,6 +472,7 @@ FILE * restrict const       stream)
   INT                         termdommax;         /* Maximum domain number given to a terminal domain */
   ArchDecoTermVert * restrict termverttab;        /* Table of terminal vertex data                    */
   Anum * restrict             termdisttab;        /* Table of terminal-to-terminal distances          */
+  Anum                        distnbr;            /* Number of cells of domain distance triangle      */
   INT                         i, j;
 
 #ifdef SCOTCH_DEBUG_ARCH1
@@ -237,7 +485,7 @@ FILE * restrict const       stream)
 
   if ((intLoad (stream, &typeval) != 1) ||        /* Read decomposition type */
       (typeval  < 0)                    ||
-      (typeval  > 2)) {
+      (typeval  > 3)) {
     errorPrint ("archDecoArchLoad: bad input (1)");
     return     (1);
   }
@@ -246,6 +494,8 @@ FILE * restrict const       stream)
     archArch (archptr)->class = archClass2 ("deco", 1); /* Switch class for future routines       */
     return (archDeco2ArchLoad2 ((ArchDeco2 *) archptr, stream)); /* Call subclass loading routine */
   }
+  if (typeval == 3)                               /* If binary compiled decomposition */
+    return (archDecoArchLoadBin (archptr, stream));
 
   if ((intLoad (stream, &termdomnbr) != 1) ||     /* Proceed with type-0 and type-1 architectures */
       (intLoad (stream, &termdommax) != 1) ||
@@ -254,11 +504,15 @@ FILE * restrict const       stream)
     errorPrint ("archDecoArchLoad: bad input (2)");
     return     (1);
   }
+  if (archDecoArchDistNbr ((Anum) termdommax, &distnbr) != 0) { /* Terminal triangle is not bigger than domain one */
+    errorPrint ("archDecoArchLoad: too many domains");
+    return     (1);
+  }
 
   if (typeval == 0) {                             /* If raw decomposition */
     if (memAllocGroup ((void **) (void *)
                        &termverttab, (size_t) (termdomnbr * sizeof (ArchDecoTermVert)),
-                       &termdisttab, (size_t) ((((termdommax * (termdommax - 1)) / 2) + 1) * sizeof (Anum)), NULL) == NULL) {
+                       &termdisttab, (size_t) ((distnbr + 1) * sizeof (Anum)), NULL) == NULL) {
       errorPrint ("archDecoArchLoad: out of memory (1)");
       return     (1);
     }
@@ -299,13 +553,17 @@ FILE * restrict const       stream)
     memFree (termverttab);                        /* Free group leader */
   }
   else {                                          /* If it is a compiled decomposition */
+    Anum * restrict     disttab;
+
     if (memAllocGroup ((void **) (void *)
                        &archptr->domverttab, (size_t) (termdommax * sizeof (ArchDecoVert)),
-                       &archptr->domdisttab, (size_t) ((((termdommax * (termdommax - 1)) / 2) + 1) * sizeof (Anum)), NULL) == NULL) {
+                       &disttab,             (size_t) ((distnbr + 1) * sizeof (Anum)), NULL) == NULL) {
       errorPrint       ("archDecoArchLoad: out of memory (2)");
       return           (1);
     }
     archptr->flagval    = ARCHDECOFREE;
+    archDecoArchDistSet (archptr, sizeof (Anum));
+    archptr->domdisttab = disttab;
     archptr->domtermnbr = (Anum) termdomnbr;
     archptr->domvertnbr = (Anum) termdommax;
 
@@ -326,7 +584,7 @@ FILE * restrict const       stream)
       archptr->domverttab[i].wght = (Anum)       domvertwght;
     }
 
-    for (i = 0; i < (termdommax * (termdommax - 1)) / 2; i ++) { /* Read distance array */
+    for (i = 0; i < distnbr; i ++) {              /* Read distance array */
       INT                 domdistval;
 
       if (intLoad (stream, &domdistval) != 1) {
@@ -334,8 +592,10 @@ FILE * restrict const       stream)
         archDecoArchFree (archptr);
         return           (1);
       }
-      archptr->domdisttab[i] = domdistval;
+      disttab[i] = domdistval;
     }
+
+    archDecoArchPack (archptr);                   /* Store distances in smallest possible type */
   }
 
   return (0);
@@ -414,7 +674,7 @@ FILE * restrict const       stream)
   j = (archptr->domvertnbr * (archptr->domvertnbr - 1)) / 2;
   for (i = 0; i < j; i ++) {                      /* Write distance array */
     if (fprintf (stream, ANUMSTRING "%c",
-                 (Anum) archptr->domdisttab[i],
+                 (Anum) archDecoArchDistVal (archptr, i),
                  (((i % 8) == 7) && (i != (j - 1))) ? '\n' : '\t') == EOF) {
       errorPrint ("archDecoArchSave: bad output (3)");
       return     (1);
@@ -429,6 +689,101 @@ FILE * restrict const       stream)
   return (0);
 }
 
+/* This routine saves the given target architecture
+** as compiled decomposition tables, in binary form.
+** Distances are written in the smallest unsigned
+** integer type which can hold them all, so that
+** they can be read back directly into memory.
+** It returns:
+** - 0   : if the decomposition has been successfully written.
+** - !0  : on error.
+*/
+
+int
+archDecoArchSaveBin (
+const ArchDeco * const      archptr,
+FILE * restrict const       stream)
+{
+  ArchDecoBinHead     headdat;
+  Anum                distnbr;
+  Anum                distnum;
+  Anum                distmax;
+  int                 distsiz;
+  int                 o;
+
+#ifdef SCOTCH_DEBUG_ARCH1
+  if ((sizeof (ArchDeco)    > sizeof (ArchDummy)) ||
+      (sizeof (ArchDecoDom) > sizeof (ArchDomDummy))) {
+    errorPrint ("archDecoArchSaveBin: invalid type specification");
+    return     (1);
+  }
+#endif /* SCOTCH_DEBUG_ARCH1 */
+
+  distnbr = (archptr->domvertnbr * (archptr->domvertnbr - 1)) / 2;
+  for (distnum = 0, distmax = 0; distnum < distnbr; distnum ++) {
+    Anum                distval;
+
+    distval = archDecoArchDistVal (archptr, distnum);
+    if (distval < 0) {
+      errorPrint ("archDecoArchSaveBin: negative distances not supported");
+      return     (1);
+    }
+    if (distval > distmax)
+      distmax = distval;
+  }
+  distsiz = archDecoArchDistSiz (distmax);
+
+  memSet (&headdat, 0, sizeof (ArchDecoBinHead));
+  headdat.endival    = ARCHDECOBINENDIVAL;
+  headdat.versval    = ARCHDECOBINVERSION;
+  headdat.anumsiz    = sizeof (Anum);
+  headdat.domtermnbr = (UINT64) archptr->domtermnbr;
+  headdat.domvertnbr = (UINT64) archptr->domvertnbr;
+  headdat.domdistmax = (UINT64) distmax;
+
+  if ((fprintf (stream, "3\n") == EOF) ||         /* Write type of binary decomposition */
+      (fwrite (&headdat, sizeof (ArchDecoBinHead), 1, stream) != 1) ||
+      (fwrite (archptr->domverttab, sizeof (ArchDecoVert), archptr->domvertnbr, stream) != (size_t) archptr->domvertnbr)) {
+    errorPrint ("archDecoArchSaveBin: bad output (1)");
+    return     (1);
+  }
+
+  o = 0;
+  if (distsiz == archptr->domdistsiz)             /* If distances already packed, write them as is */
+    o = (fwrite (archptr->domdisttab, distsiz, distnbr, stream) != (size_t) distnbr);
+  else {                                          /* Else pack distances on the fly */
+    byte *              bufftab;
+    Anum                buffmax;
+    Anum                buffnbr;
+
+    buffmax = ARCHDECOBINBUFSIZ / distsiz;
+    if ((bufftab = memAlloc (ARCHDECOBINBUFSIZ * sizeof (byte))) == NULL) {
+      errorPrint ("archDecoArchSaveBin: out of memory");
+      return     (1);
+    }
+    for (distnum = 0; distnum < distnbr; distnum += buffnbr) {
+      Anum                buffnum;
+
+      buffnbr = MIN (buffmax, distnbr - distnum);
+      for (buffnum = 0; buffnum < buffnbr; buffnum ++) {
+        if (distsiz == sizeof (byte))
+          bufftab[buffnum] = (byte) archDecoArchDistVal (archptr, distnum + buffnum);
+        else
+          ((unsigned short *) bufftab)[buffnum] = (unsigned short) archDecoArchDistVal (archptr, distnum + buffnum);
+      }
+      if (fwrite (bufftab, distsiz, buffnbr, stream) != (size_t) buffnbr) {
+        o = 1;
+        break;
+      }
+    }
+    memFree (bufftab);
+  }
+  if (o != 0)
+    errorPrint ("archDecoArchSaveBin: bad output (2)");
+
+  return (o);
+}
+
 /* This function returns the smallest number
 ** of terminal domain included in the given
 ** domain.
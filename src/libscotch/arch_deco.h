@@ -62,6 +62,8 @@
 /**                                 to   : 27 sep 2008     **/
 /**                # Version 6.0  : from : 14 feb 2011     **/
 /**                                 to   : 28 may 2018     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -78,6 +80,19 @@
 
 #define ARCHDECOFREE                0x0001        /*+ Free arrays    +*/
 
+/*+ Version number of the binary format. +*/
+
+#define ARCHDECOBINVERSION          0
+
+/*+ Endianness test value. +*/
+
+#define ARCHDECOBINENDIVAL          ((UINT64) 0x0102030405060708ULL)
+
+/*+ Size of buffer for packing distances
+    before writing them in binary form.  +*/
+
+#define ARCHDECOBINBUFSIZ           65536
+
 /*
 **  The type and structure definitions.
 */
@@ -98,14 +113,44 @@ typedef struct ArchDecoVert_ {
   Anum                      wght;                 /*+ Weight of the domain (processor load) +*/
 } ArchDecoVert;
 
+/*+ Domain distances are stored in the
+    smallest unsigned integer type which
+    can hold all of them: byte, unsigned
+    short or Anum, as recorded in domdistsiz.
+    The routine which reads them is selected
+    once, when the table is set, so that
+    distance computations do not have to
+    test domdistsiz.                          +*/
+
+typedef Anum (* ArchDecoDistFunc) (const void * const, const Anum);
+
 typedef struct ArchDeco_ {
-  int                       flagval;              /*+ Flag value                 +*/
-  Anum                      domtermnbr;           /*+ Number of terminal domains +*/
-  Anum                      domvertnbr;           /*+ Number of domains          +*/
-  ArchDecoVert *            domverttab;           /*+ Table of domain "vertices" +*/
-  Anum *                    domdisttab;           /*+ Table of domain distances  +*/
+  int                       flagval;              /*+ Flag value                           +*/
+  int                       domdistsiz;           /*+ Size in bytes of distance values     +*/
+  ArchDecoDistFunc          domdistfunc;          /*+ Routine reading distance values      +*/
+  Anum                      domtermnbr;           /*+ Number of terminal domains           +*/
+  Anum                      domvertnbr;           /*+ Number of domains                    +*/
+  ArchDecoVert *            domverttab;           /*+ Table of domain "vertices"           +*/
+  void *                    domdisttab;           /*+ Table of domain distances            +*/
 } ArchDeco;
 
+/*+ The binary file header. It follows the
+    textual class name and type number "3".
+    It is followed by the domain array, as
+    native Anum triplets, and by the distance
+    triangle, as native unsigned integers of
+    the smallest size which can hold the
+    maximum distance value.                   +*/
+
+typedef struct ArchDecoBinHead_ {
+  UINT64                    endival;              /*+ Endianness test value                +*/
+  UINT64                    versval;              /*+ Format version                       +*/
+  UINT64                    anumsiz;              /*+ Size of Anum values in file          +*/
+  UINT64                    domtermnbr;           /*+ Number of terminal domains           +*/
+  UINT64                    domvertnbr;           /*+ Number of domains                    +*/
+  UINT64                    domdistmax;           /*+ Maximum distance value               +*/
+} ArchDecoBinHead;
+
 typedef struct ArchDecoDom_ {
   Anum                      num;                  /*+ Domain number in the decomposition +*/
 } ArchDecoDom;
@@ -125,8 +170,10 @@ typedef struct ArchDecoMatch_ {
 #define ARCH_DECO_H_PROTO
 
 int                         archDecoArchBuild2  (ArchDeco * const, const Anum, const Anum, const ArchDecoTermVert * const, const Anum  * const);
+int                         archDecoArchDistNbr (const Anum, Anum * const);
 int                         archDecoArchLoad    (ArchDeco * const, FILE * restrict const);
 int                         archDecoArchSave    (const ArchDeco * const, FILE * restrict const);
+int                         archDecoArchSaveBin (const ArchDeco * const, FILE * restrict const);
 int                         archDecoArchFree    (ArchDeco * const);
 
 #define archDecoMatchInit           NULL
@@ -155,8 +202,10 @@ int                         archDecoDomMpiType  (const ArchDeco * const, MPI_Dat
 */
 
 #define archDecoArchSize(d,i)       ((d)->domverttab[(i) - 1].size)
-#define archDecoArchDist(d,i,j)     ((d)->domdisttab[((i) >= (j)) ? (((i) - 1) * ((i) - 2)) / 2 + (j) - 1 \
-                                                                  : (((j) - 1) * ((j) - 2)) / 2 + (i) - 1])
+#define archDecoArchDistIdx(i,j)    (((i) >= (j)) ? (((i) - 1) * ((i) - 2)) / 2 + (j) - 1 \
+                                                  : (((j) - 1) * ((j) - 2)) / 2 + (i) - 1)
+#define archDecoArchDistVal(d,k)    ((d)->domdistfunc ((d)->domdisttab, (k)))
+#define archDecoArchDist(d,i,j)     archDecoArchDistVal ((d), archDecoArchDistIdx ((i), (j)))
 #define archDecoArchDistE(d,i,j)    (((i) == (j)) ? 0 : archDecoArchDist ((d), (i), (j)))
 
 #endif /* ARCH_DECO_H_PROTO */
@@ -41,6 +41,8 @@
 /**                                                        **/
 /**   DATES      : # Version 6.0  : from : 30 apr 2015     **/
 /**                                 to   : 15 may 2018     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -83,8 +85,13 @@ ArchDeco2 * const           archptr)
   if ((levltab = archptr->levltab) != NULL) {
     ArchDeco2Levl *     levlptr;
 
-    for (levlptr = levltab + archptr->levlmax; levlptr >= levltab; levlptr --)
+    for (levlptr = levltab + archptr->levlmax; levlptr >= levltab; levlptr --) {
+      if (levlptr->disttab != NULL)
+        memFree (levlptr->disttab);
+      if (levlptr->landtab != NULL)
+        memFree (levlptr->landtab);
       graphExit (&levlptr->grafdat);
+    }
 
     memFree (levltab);
   }
@@ -208,6 +215,8 @@ FILE * restrict const       stream)
   archptr->levltab = levltab;
 
   for (levlnum = 0; levlnum < levlnbr; levlnum ++) {
+    levltab[levlnum].disttab = NULL;              /* Distance tables computed afterwards */
+    levltab[levlnum].landtab = NULL;
     if (graphLoad (&levltab[levlnum].grafdat, stream, -1, 0) != 0) {
       errorPrint ("archDeco2ArchLoad2: bad input (4)");
       archptr->levlmax = levlnum - 1;             /* Only free existing levels */
@@ -253,6 +262,8 @@ FILE * restrict const       stream)
   }
 #endif /* SCOTCH_DEBUG_ARCH1 */
 
+  archDeco2ArchDist (archptr);                    /* Set up distance tables and landmarks */
+
   return (0);
 
 abort:
@@ -477,6 +488,424 @@ const ArchDeco2Dom * const  domnptr)
   return (archptr->domntab[domnptr->domnidx].domnwgt);
 }
 
+/* These routines handle the work arrays
+** of local searches. Their size only
+** depends on the extent of the searched
+** neighborhood, so that no array of the
+** size of the level graph has to be set
+** up for every distance query.
+** They return:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+archDeco2DistWorkInit (
+ArchDeco2DistWork * restrict const  workptr)
+{
+  workptr->queumax = ARCHDECO2QUEUSIZE;
+  workptr->hashmax = ARCHDECO2HASHSIZE;
+  workptr->hashnbr = 0;
+  workptr->hashtab = NULL;                        /* In case of error */
+  if (((workptr->queutab = memAlloc (workptr->queumax * sizeof (Gnum)))              == NULL) ||
+      ((workptr->hashtab = memAlloc (workptr->hashmax * sizeof (ArchDeco2DistHash))) == NULL)) {
+    errorPrint ("archDeco2DistWorkInit: out of memory");
+    if (workptr->queutab != NULL)
+      memFree (workptr->queutab);
+    return (1);
+  }
+
+  return (0);
+}
+
+static
+void
+archDeco2DistWorkExit (
+ArchDeco2DistWork * restrict const  workptr)
+{
+  memFree (workptr->hashtab);
+  memFree (workptr->queutab);
+}
+
+/* This routine returns the slot of the
+** distance hash table which holds the given
+** vertex, or the empty slot where it should
+** be inserted.
+** It returns:
+** - slot  : in all cases.
+*/
+
+static
+ArchDeco2DistHash *
+archDeco2DistHashFind (
+const ArchDeco2DistWork * restrict const  workptr,
+const Gnum                                vertnum)
+{
+  ArchDeco2DistHash * restrict  hashtab;
+  Gnum                          hashmsk;
+  Gnum                          hashnum;
+
+  hashtab = workptr->hashtab;
+  hashmsk = workptr->hashmax - 1;
+  for (hashnum = (vertnum * ARCHDECO2HASHPRIME) & hashmsk; ; hashnum = (hashnum + 1) & hashmsk) {
+    if ((hashtab[hashnum].vertnum == vertnum) || (hashtab[hashnum].vertnum == ~0))
+      return (&hashtab[hashnum]);
+  }
+}
+
+/* This routine doubles the size of the
+** distance hash table, and re-hashes its
+** contents.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+archDeco2DistHashGrow (
+ArchDeco2DistWork * restrict const  workptr)
+{
+  ArchDeco2DistHash * restrict  hashold;
+  ArchDeco2DistHash * restrict  hashnew;
+  Gnum                          hashnum;
+  Gnum                          hashnnd;
+
+  hashold = workptr->hashtab;
+  hashnnd = workptr->hashmax;
+  if ((hashnew = memAlloc (2 * hashnnd * sizeof (ArchDeco2DistHash))) == NULL) {
+    errorPrint ("archDeco2DistHashGrow: out of memory");
+    return (1);
+  }
+  memSet (hashnew, ~0, 2 * hashnnd * sizeof (ArchDeco2DistHash));
+  workptr->hashtab = hashnew;
+  workptr->hashmax = 2 * hashnnd;
+
+  for (hashnum = 0; hashnum < hashnnd; hashnum ++) {
+    if (hashold[hashnum].vertnum != ~0)
+      *archDeco2DistHashFind (workptr, hashold[hashnum].vertnum) = hashold[hashnum];
+  }
+  memFree (hashold);
+
+  return (0);
+}
+
+/* This routine tells whether the hop
+** distances of the given vertices to the
+** landmarks of their level prove that no
+** local search can link them.
+** It returns:
+** - 0   : if a path may be found.
+** - !0  : if no path can be found.
+*/
+
+static
+int
+archDeco2DistLand (
+const ArchDeco2Levl * restrict const  levlptr,
+const Gnum                            vertnum0,
+const Gnum                            vertnum1)
+{
+  const byte * restrict landptr0;
+  const byte * restrict landptr1;
+  int                   landnum;
+
+  landptr0 = levlptr->landtab + (vertnum0 - levlptr->grafdat.baseval) * ARCHDECO2LANDNBR;
+  landptr1 = levlptr->landtab + (vertnum1 - levlptr->grafdat.baseval) * ARCHDECO2LANDNBR;
+  for (landnum = 0; landnum < ARCHDECO2LANDNBR; landnum ++) {
+    int                 hopsval;
+
+    hopsval = (int) landptr0[landnum] - (int) landptr1[landnum];
+    if ((hopsval > (ARCHDECO2PASSNBR + 1)) ||     /* Search explores ARCHDECO2PASSNBR + 1 hops at most */
+        (hopsval < - (ARCHDECO2PASSNBR + 1)))
+      return (1);
+  }
+
+  return (0);
+}
+
+/* This routine performs a local search,
+** limited to ARCHDECO2PASSNBR passes, from
+** the first to the second given vertex in
+** the graph of the given level.
+** It returns:
+** - >= 0  : distance found at this level.
+** - -1    : if path not found at this level.
+** - -2    : on error.
+*/
+
+static
+Anum
+archDeco2DistLevl (
+const ArchDeco2Levl * restrict const  levlptr,
+const Gnum                            vertnum0,
+const Gnum                            vertnum1,
+ArchDeco2DistWork * restrict const    workptr)
+{
+  ArchDeco2DistHash * restrict  hashptr;
+  Gnum                          queuheadidx;
+  Gnum                          queutailidx;
+  Anum                          distmin;
+  int                           passnbr;
+  int                           flagval;
+
+  const Gnum * restrict const   verttax = levlptr->grafdat.verttax;
+  const Gnum * restrict const   vendtax = levlptr->grafdat.vendtax;
+  const Gnum * restrict const   velotax = levlptr->grafdat.velotax;
+  const Gnum * restrict const   edgetax = levlptr->grafdat.edgetax;
+  const Gnum * restrict const   edlotax = levlptr->grafdat.edlotax;
+
+  distmin = GNUMMAX;
+  flagval = 1;
+
+  memSet (workptr->hashtab, ~0, workptr->hashmax * sizeof (ArchDeco2DistHash)); /* Set all slots as empty */
+  workptr->hashnbr = 1;
+  hashptr = archDeco2DistHashFind (workptr, vertnum0);
+  hashptr->vertnum = vertnum0;
+  hashptr->distval = (velotax != NULL)
+                     ? ((velotax[vertnum0] + velotax[vertnum1]) / 2) /* Account for half of traversal costs of end vertices */
+                     : 0;
+
+  passnbr     = ARCHDECO2PASSNBR;
+  workptr->queutab[0] = vertnum0;
+  workptr->queutab[1] = -1;                       /* Enqueue pass marker as end of pass 0 */
+  queutailidx = 0;
+  queuheadidx = 2;
+  while (queutailidx != queuheadidx) {
+    Gnum                vertnum;
+    Gnum                edgenum;
+    Gnum                edgennd;
+    Gnum                distval;
+
+loop: vertnum = workptr->queutab[queutailidx ++]; /* Get vertex number from queue        */
+    if (vertnum < 0) {                            /* If vertex is pass marker            */
+      if (passnbr == 0)                           /* If vertex found or passes exhausted */
+        break;
+      workptr->queutab[queuheadidx ++] = vertnum; /* Re-enqueue pass marker  */
+      passnbr --;                                 /* One more pass completed */
+
+      goto loop;                                  /* Get another vertex number from queue */
+    }
+
+    distval = archDeco2DistHashFind (workptr, vertnum)->distval;
+    for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum];
+         edgenum < edgennd; edgenum ++) {
+      Gnum                vertend;
+      Gnum                disttmp;
+
+      vertend = edgetax[edgenum];
+      disttmp = distval + ((edlotax != NULL) ? edlotax[edgenum] : 1);
+
+      if (vertend == vertnum1) {                  /* If path to end vertex found */
+        if (disttmp < distmin)
+          distmin = disttmp;
+        passnbr = 0;                              /* Abort at end of this pass       */
+        flagval = 0;                              /* Record path found for this pass */
+        continue;
+      }
+
+      disttmp += (velotax != NULL) ? velotax[vertend] : 0; /* Vertex will have to be traversed fully */
+
+      hashptr = archDeco2DistHashFind (workptr, vertend);
+      if (hashptr->vertnum == ~0) {               /* If vertex not already considered */
+        if (queuheadidx >= (workptr->queumax - ARCHDECO2PASSNBR - 1)) { /* If no room left for vertex and pass markers */
+          Gnum *              queutmp;
+
+          if ((queutmp = memRealloc (workptr->queutab, 2 * workptr->queumax * sizeof (Gnum))) == NULL) {
+            errorPrint ("archDeco2DistLevl: out of memory");
+            return (-2);
+          }
+          workptr->queutab  = queutmp;
+          workptr->queumax *= 2;
+        }
+        workptr->queutab[queuheadidx ++] = vertend; /* Enqueue new vertex */
+
+        if ((2 * (workptr->hashnbr + 1)) > workptr->hashmax) { /* Keep hash table at most half full */
+          if (archDeco2DistHashGrow (workptr) != 0)
+            return (-2);
+          hashptr = archDeco2DistHashFind (workptr, vertend);
+        }
+        hashptr->vertnum = vertend;
+        hashptr->distval = disttmp;
+        workptr->hashnbr ++;
+      }
+      else if (hashptr->distval > disttmp)        /* If path improves distance at this pass */
+        hashptr->distval = disttmp;
+    }
+  }
+
+  return ((flagval == 0) ? distmin : -1);
+}
+
+/* This routine computes the hop distances
+** between all the vertices of the given level
+** and ARCHDECO2LANDNBR landmark vertices, each
+** new landmark being the vertex farthest from
+** all previous ones. Hop distances are capped
+** to ARCHDECO2LANDMAX, which also stands for
+** unreachable vertices. Since capping preserves
+** the triangle inequality, the difference of
+** the hop distances of two vertices to any
+** landmark is a lower bound of the number of
+** hops between them.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+archDeco2ArchDistLand (
+ArchDeco2Levl * restrict const  levlptr)
+{
+  byte * restrict     landtab;
+  byte * restrict     landtax;
+  Gnum * restrict     queutab;
+  Gnum * restrict     hmintax;                    /* Minimum hop distance to already chosen landmarks */
+  Gnum                landnum;
+  Gnum                vertnum;
+  Gnum                vertlnd;                    /* Current landmark vertex */
+
+  const Gnum                  baseval = levlptr->grafdat.baseval;
+  const Gnum                  vertnbr = levlptr->grafdat.vertnbr;
+  const Gnum                  vertnnd = levlptr->grafdat.vertnnd;
+  const Gnum * restrict const verttax = levlptr->grafdat.verttax;
+  const Gnum * restrict const vendtax = levlptr->grafdat.vendtax;
+  const Gnum * restrict const edgetax = levlptr->grafdat.edgetax;
+
+  if ((landtab = memAlloc (vertnbr * ARCHDECO2LANDNBR * sizeof (byte))) == NULL)
+    return (1);
+  if (memAllocGroup ((void **) (void *)
+                     &queutab, (size_t) (vertnbr * sizeof (Gnum)),
+                     &hmintax, (size_t) (vertnbr * sizeof (Gnum)), NULL) == NULL) {
+    memFree (landtab);
+    return (1);
+  }
+  landtax  = landtab - baseval * ARCHDECO2LANDNBR;
+  hmintax -= baseval;
+
+  for (vertnum = baseval; vertnum < vertnnd; vertnum ++)
+    hmintax[vertnum] = GNUMMAX;
+
+  for (landnum = 0, vertlnd = baseval; landnum < ARCHDECO2LANDNBR; landnum ++) {
+    Gnum                queuheadidx;
+    Gnum                queutailidx;
+
+    for (vertnum = baseval; vertnum < vertnnd; vertnum ++) /* Set all vertices as unreachable */
+      landtax[vertnum * ARCHDECO2LANDNBR + landnum] = ARCHDECO2LANDMAX;
+
+    landtax[vertlnd * ARCHDECO2LANDNBR + landnum] = 0;
+    hmintax[vertlnd] = 0;
+    queutab[0]  = vertlnd;
+    queutailidx = 0;
+    queuheadidx = 1;
+    while (queutailidx < queuheadidx) {           /* Breadth-first search from landmark */
+      Gnum                edgenum;
+      Gnum                hopsval;
+
+      vertnum = queutab[queutailidx ++];
+      hopsval = (Gnum) landtax[vertnum * ARCHDECO2LANDNBR + landnum] + 1;
+      if (hopsval >= ARCHDECO2LANDMAX)            /* Do not explore beyond capped distance */
+        continue;
+
+      for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++) {
+        Gnum                vertend;
+
+        vertend = edgetax[edgenum];
+        if (landtax[vertend * ARCHDECO2LANDNBR + landnum] == ARCHDECO2LANDMAX) { /* If vertex not yet reached */
+          landtax[vertend * ARCHDECO2LANDNBR + landnum] = (byte) hopsval;
+          if (hmintax[vertend] > hopsval)
+            hmintax[vertend] = hopsval;
+          queutab[queuheadidx ++] = vertend;
+        }
+      }
+    }
+
+    for (vertnum = baseval, vertlnd = baseval; vertnum < vertnnd; vertnum ++) { /* Find farthest vertex for next landmark */
+      if (hmintax[vertnum] > hmintax[vertlnd])
+        vertlnd = vertnum;
+    }
+  }
+
+  memFree (queutab);                              /* Free group leader */
+
+  levlptr->landtab = landtab;
+
+  return (0);
+}
+
+/* This routine tabulates, for all the levels
+** that are small enough, the results of the
+** local searches between all pairs of level
+** vertices. As tables only speed up distance
+** computations, levels for which tables cannot
+** be allocated keep being searched locally.
+** Bigger levels are provided with landmark hop
+** distances, which allow one to skip local
+** searches that are bound to fail.
+** Tables are read-only once computed, and can
+** be shared by concurrent distance queries.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+void
+archDeco2ArchDist (
+ArchDeco2 * const           archptr)
+{
+  ArchDeco2DistWork   workdat;
+  Anum                levlnum;
+
+  for (levlnum = 0; levlnum <= archptr->levlmax; levlnum ++) {
+    archptr->levltab[levlnum].disttab = NULL;
+    archptr->levltab[levlnum].landtab = NULL;
+  }
+
+  if (archDeco2DistWorkInit (&workdat) != 0)
+    return;
+
+  for (levlnum = 0; levlnum <= archptr->levlmax; levlnum ++) {
+    ArchDeco2Levl * restrict  levlptr;
+    Anum * restrict           disttab;
+    Gnum                      vertnum0;
+    Gnum                      vertnum1;
+    Gnum                      vertnnd;
+    Gnum                      vertnbr;
+
+    levlptr = &archptr->levltab[levlnum];
+    vertnbr = levlptr->grafdat.vertnbr;
+    if (vertnbr > ARCHDECO2DISTTABMAX) {          /* If level too big to be tabulated */
+      archDeco2ArchDistLand (levlptr);            /* Landmarks are optional too       */
+      continue;
+    }
+
+    if ((disttab = memAlloc (vertnbr * vertnbr * sizeof (Anum))) == NULL)
+      continue;
+
+    for (vertnum0 = levlptr->grafdat.baseval, vertnnd = levlptr->grafdat.vertnnd;
+         vertnum0 < vertnnd; vertnum0 ++) {
+      for (vertnum1 = levlptr->grafdat.baseval; vertnum1 < vertnnd; vertnum1 ++) {
+        Anum                distval;
+
+        if ((distval = archDeco2DistLevl (levlptr, vertnum0, vertnum1, &workdat)) < -1)
+          break;
+        disttab[(vertnum0 - levlptr->grafdat.baseval) * vertnbr + (vertnum1 - levlptr->grafdat.baseval)] = distval;
+      }
+      if (vertnum1 < vertnnd)                     /* If search failed */
+        break;
+    }
+    if (vertnum0 < vertnnd) {                     /* If table could not be filled */
+      memFree (disttab);
+      continue;
+    }
+
+    levlptr->disttab = disttab;
+  }
+
+  archDeco2DistWorkExit (&workdat);
+}
+
 /* This function returns the average distance
 ** between two domains, which is extracted
 ** from the table.
@@ -494,10 +923,8 @@ const ArchDeco2Dom * const  dom1ptr)
   Anum                  domnidx0;
   Anum                  domnidx1;
   const ArchDeco2Levl * levlptr;
-  Gnum * restrict       queutab;
-  Gnum * restrict       disttax;
+  ArchDeco2DistWork     workdat;
   Anum                  distmin;
-  Gnum                  baseval;
   Gnum                  vertnbr;
 #ifdef SCOTCH_DEBUG_ARCH2
   Anum                  domnnum0;
@@ -578,29 +1005,13 @@ const ArchDeco2Dom * const  dom1ptr)
   if (domnidx0 == domnidx1)                       /* If same domains after leveling, half distance of largest domain */
     return (levlptr->grafdat.velotax[vnumtab[domnidx0]]);
 
-  if (memAllocGroup ((void **) (void *)
-                     &queutab, (size_t) ((vertnbr + ARCHDECO2PASSNBR + 1) * sizeof (Anum)), /* Room for pass markers */
-                     &disttax, (size_t) (vertnbr * sizeof (Anum)), NULL) == NULL) {
-    errorPrint ("archDeco2DomDist: out of memory");
-    return     (0);                               /* Nothing to free because group allocation failed */
-  }
-  baseval  = levlptr->grafdat.baseval;
-  disttax -= baseval;
+  workdat.queutab = NULL;                         /* Work arrays only allocated if needed */
 
   while (1) {                                     /* As long as coarsest graph not hit */
-    const Gnum * restrict         verttax;
-    const Gnum * restrict         vendtax;
-    const Gnum * restrict         velotax;
-    const Gnum * restrict         edgetax;
-    const Gnum * restrict         edlotax;
     Gnum                          vertnum0;
     Gnum                          vertnum1;
     Anum                          domntmp0;
     Anum                          domntmp1;
-    Gnum                          queuheadidx;
-    Gnum                          queutailidx;
-    int                           passnbr;
-    int                           flagval;
 
     vertnum0 = vnumtab[doextab[domnidx0].vnumidx - (levlnum - levlnum0)]; /* Find vertices at proper level for domain indices */
     vertnum1 = vnumtab[doextab[domnidx1].vnumidx - (levlnum - levlnum1)];
@@ -612,75 +1023,31 @@ const ArchDeco2Dom * const  dom1ptr)
     }
 #endif /* SCOTCH_DEBUG_ARCH2 */
 
-    distmin = GNUMMAX;
-    flagval = 1;
-
-    verttax = levlptr->grafdat.verttax;
-    vendtax = levlptr->grafdat.vendtax;
-    velotax = levlptr->grafdat.velotax;
-    edgetax = levlptr->grafdat.edgetax;
-    edlotax = levlptr->grafdat.edlotax;
+    if (levlptr->disttab != NULL) {               /* If distances of this level are tabulated */
+      Gnum                baseval;
 
-    memSet (disttax + baseval, ~0, vertnbr * sizeof (Gnum)); /* Set flag and distance array to -1 */
-    disttax[vertnum0] = (velotax != NULL)
-                        ? ((velotax[vertnum0] + velotax[vertnum1]) / 2) /* Account for half of traversal costs of end vertices */
-                        : 0;
-
-    passnbr     = ARCHDECO2PASSNBR;
-    queutab[0]  = vertnum0;
-    queutab[1]  = -1;                             /* Enqueue pass marker as end of pass 0 */
-    queutailidx = 0;
-    queuheadidx = 2;
-    while (queutailidx != queuheadidx) {
-      Gnum                vertnum;
-      Gnum                edgenum;
-      Gnum                edgennd;
-      Gnum                distval;
-
-loop: vertnum = queutab[queutailidx ++];          /* Get vertex number from queue        */
-      if (vertnum < 0) {                          /* If vertex is pass marker            */
-        if (passnbr == 0)                         /* If vertex found or passes exhausted */
-          break;
-        queutab[queuheadidx ++] = vertnum;        /* Re-enqueue pass marker  */
-        passnbr --;                               /* One more pass completed */
-
-        goto loop;                                /* Get another vertex number from queue */
-      }
-
-      distval = disttax[vertnum];
-      for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum];
-           edgenum < edgennd; edgenum ++) {
-        Gnum                vertend;
-        Gnum                disttmp;
-
-        vertend = edgetax[edgenum];
-        disttmp = distval + ((edlotax != NULL) ? edlotax[edgenum] : 1);
-
-        if (vertend == vertnum1) {                /* If path to end vertex found */
-          if (disttmp < distmin)
-            distmin = disttmp;
-          passnbr = 0;                            /* Abort at end of this pass       */
-          flagval = 0;                            /* Record path found for this pass */
-        }
-        else {
-          disttmp += (velotax != NULL) ? velotax[vertend] : 0; /* Vertex will have to be traversed fully */
-
-          if (disttax[vertend] < 0) {             /* If vertex not already considered */
-            queutab[queuheadidx ++] = vertend;    /* Enqueue new vertex               */
-            disttax[vertend] = disttmp;
-          }
-          else if (disttax[vertend] > disttmp)    /* If path improves distance at this pass */
-            disttax[vertend] = disttmp;
-        }
+      baseval = levlptr->grafdat.baseval;
+      distmin = levlptr->disttab[(vertnum0 - baseval) * vertnbr + (vertnum1 - baseval)];
+    }
+    else if ((levlptr->landtab != NULL) &&        /* If end vertices too far apart for local search */
+             (archDeco2DistLand (levlptr, vertnum0, vertnum1) != 0))
+      distmin = -1;
+    else {
+      if ((workdat.queutab == NULL) &&            /* If work arrays not yet allocated */
+          (archDeco2DistWorkInit (&workdat) != 0))
+        return (0);
+      if ((distmin = archDeco2DistLevl (levlptr, vertnum0, vertnum1, &workdat)) < -1) {
+        archDeco2DistWorkExit (&workdat);
+        return (0);
       }
     }
 
-    if (flagval == 0)                             /* If path found, don't search in coarser graphs */
+    if (distmin >= 0)                             /* If path found, don't search in coarser graphs */
       break;
 
     levlnum ++;
-    levlptr ++;                                   /* Consider coarser level     */
-    vertnbr = levlptr->grafdat.vertnbr;           /* Reduce size of work arrays */
+    levlptr ++;                                   /* Consider coarser level */
+    vertnbr = levlptr->grafdat.vertnbr;
 
     domntmp0 = domntab[domnidx0].dfatidx;         /* For both subdomains independently    */
     if (doextab[domntmp0].levlnum <= levlnum) {   /* If father domain is at proper level  */
@@ -721,7 +1088,8 @@ loop: vertnum = queutab[queutailidx ++];          /* Get vertex number from queu
 #endif /* SCOTCH_DEBUG_ARCH2 */
   }
 
-  memFree (queutab);                              /* Free group leader */
+  if (workdat.queutab != NULL)
+    archDeco2DistWorkExit (&workdat);
 
   return (distmin);
 }
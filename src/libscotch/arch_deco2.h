@@ -41,6 +41,8 @@
 /**                                                        **/
 /**   DATES      : # Version 6.0  : from : 01 may 2015     **/
 /**                                 to   : 28 may 2018     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # The internals of the "deco2"          **/
 /**                  architecture derive from those of     **/
@@ -71,6 +73,26 @@
 
 #define ARCHDECO2PASSNBR            3
 
+/*+ Maximum number of vertices of levels for
+    which local distances are tabulated.     +*/
+
+#define ARCHDECO2DISTTABMAX         256
+
+/*+ Number of landmark vertices of levels
+    which are too big to be tabulated, and
+    hop distance value for unreachable
+    vertices.                               +*/
+
+#define ARCHDECO2LANDNBR            8
+#define ARCHDECO2LANDMAX            255
+
+/*+ Prime number and initial sizes for
+    local search work arrays.          +*/
+
+#define ARCHDECO2HASHPRIME          17
+#define ARCHDECO2HASHSIZE           256
+#define ARCHDECO2QUEUSIZE           128
+
 /*+ Decomposition architecture flags. +*/
 
 #define ARCHDECONONE                0x0000        /*+ No options set +*/
@@ -84,10 +106,34 @@
 #ifdef ARCH_DECO2
 
 typedef struct ArchDeco2Levl_ {
-  Graph                     grafdat;              /*+ Graph at this level     +*/
-  Gnum                      wdiaval;              /*+ Graph weighted diameter +*/
+  Graph                     grafdat;              /*+ Graph at this level                         +*/
+  Gnum                      wdiaval;              /*+ Graph weighted diameter                     +*/
+  Anum *                    disttab;              /*+ Table of local distances for small levels   +*/
+  byte *                    landtab;              /*+ Hop distances to landmarks for big levels   +*/
 } ArchDeco2Levl;
 
+/*+ Vertex distance hash table slot,
+    used by local searches on levels
+    which are too big to be tabulated. +*/
+
+typedef struct ArchDeco2DistHash_ {
+  Gnum                      vertnum;              /*+ Vertex number, or ~0 if slot empty +*/
+  Gnum                      distval;              /*+ Current distance to vertex         +*/
+} ArchDeco2DistHash;
+
+/*+ Work arrays for local searches. Their
+    size is bound by the extent of the
+    searched neighborhood, not by the size
+    of the level graph.                    +*/
+
+typedef struct ArchDeco2DistWork_ {
+  Gnum *                    queutab;              /*+ Vertex queue, with pass markers +*/
+  Gnum                      queumax;              /*+ Size of queue array             +*/
+  ArchDeco2DistHash *       hashtab;              /*+ Distance hash table             +*/
+  Gnum                      hashmax;              /*+ Size of hash table              +*/
+  Gnum                      hashnbr;              /*+ Number of used slots            +*/
+} ArchDeco2DistWork;
+
 /*+ Data related to each architecture domain.
     This structure extends ArchSubData in order
     to record vertex numbers associated with
@@ -140,6 +186,7 @@ typedef struct ArchDeco2Dom_ {
 int                         archDeco2ArchLoad2  (ArchDeco2 * const, FILE * restrict const);
 int                         archDeco2ArchSave   (const ArchDeco2 * const, FILE * restrict const);
 int                         archDeco2ArchFree   (ArchDeco2 * const);
+void                        archDeco2ArchDist   (ArchDeco2 * const);
 
 int                         archDeco2MatchInit  (struct ArchSubMatch_ * restrict const, const ArchDeco2 * restrict const); /* Use "sub" matching routines */
 #define archDeco2MatchExit          archSubMatchExit
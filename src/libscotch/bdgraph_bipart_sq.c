@@ -48,6 +48,8 @@
 /**                                 to   : 14 apr 2011     **/
 /**                # Version 6.0  : from : 27 dec 2007     **/
 /**                                 to   : 31 aug 2014     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -66,6 +68,7 @@
 #include "bgraph.h"
 #include "bgraph_bipart_st.h"
 #include "dgraph.h"
+#include "dgraph_sq.h"
 #include "bdgraph.h"
 #include "bdgraph_bipart_sq.h"
 
@@ -116,6 +119,104 @@ const MPI_Datatype * const  typedat)              /* MPI datatype; not used
   }
 }
 
+/* This routine computes the quality criteria
+** of the given centralized bipartition, in the
+** order used by the reduction operator.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+bdgraphBipartSqCost (
+const Bgraph * const        grafptr,              /*+ Centralized bipartition graph +*/
+Gnum * const                costtab)              /*+ Array of criteria to fill     +*/
+{
+  costtab[0] = ((grafptr->fronnbr != 0) || ((grafptr->compsize0 != 0) && ((grafptr->s.vertnbr - grafptr->compsize0) != 0)))
+               ? grafptr->commload
+               : GNUMMAX;                         /* Partitions with empty bipartitions unwanted if they are completely unbalanced */
+  costtab[1] = grafptr->compload0dlt;
+}
+
+/* This routine runs the sequential strategy
+** on the given centralized graph, within the
+** given (sub-)context.
+** It returns:
+** - 0   : if the bipartition could be computed.
+** - !0  : on error.
+*/
+
+static
+int
+bdgraphBipartSq3 (
+Bgraph * restrict const       grafptr,            /*+ Centralized bipartition graph +*/
+Context * const               contptr,            /*+ (Sub-)context                 +*/
+const Strat * restrict const  stratptr)           /*+ Sequential strategy           +*/
+{
+  Context * const     contold = grafptr->contptr;
+  int                 o;
+
+  grafptr->contptr = contptr;                     /* Run strategy in sub-context */
+  o = bgraphBipartSt (grafptr, stratptr);
+  grafptr->contptr = contold;
+
+  return (o);
+}
+
+/* This routine bipartitions the centralized
+** graph. When the execution context holds
+** several threads, two runs of the sequential
+** strategy are performed concurrently, and
+** the best bipartition is kept.
+** It returns:
+** - 0   : if the bipartition could be computed.
+** - !0  : on error.
+*/
+
+static
+int
+bdgraphBipartSq2 (
+Bgraph * restrict const       grafptr,            /*+ Centralized bipartition graph +*/
+const Strat * restrict const  stratptr)           /*+ Sequential strategy           +*/
+{
+#ifndef BDGRAPHBIPARTSQNOTHREAD
+  if (contextThreadNbr (grafptr->contptr) > 1) {  /* If two runs can be performed concurrently */
+    BgraphStore             savedat;              /* Save area hosting bipartition arrays of second run */
+    Bgraph                  seltgrafdat;          /* Graph for second run                               */
+    int                     o;
+
+    if (bgraphStoreInit (grafptr, &savedat) != 0) {
+      errorPrint ("bdgraphBipartSq2: out of memory");
+      return     (1);
+    }
+
+    seltgrafdat         = *grafptr;               /* Share graph structure but not bipartition data */
+    seltgrafdat.frontab = (Gnum *) savedat.datatab;
+    seltgrafdat.parttax = (GraphPart *) (seltgrafdat.frontab + grafptr->s.vertnbr) - grafptr->s.baseval;
+    memCpy (seltgrafdat.frontab, grafptr->frontab, grafptr->fronnbr * sizeof (Gnum));
+    memCpy (seltgrafdat.parttax + grafptr->s.baseval, grafptr->parttax + grafptr->s.baseval, grafptr->s.vertnbr * sizeof (GraphPart));
+
+    o = dgraphSqBest (grafptr->contptr, grafptr, &seltgrafdat, (DgraphSqFunc) bdgraphBipartSq3, (DgraphSqCost) bdgraphBipartSqCost, stratptr);
+    if (o == 1) {                                 /* If second result is better, copy it back */
+      grafptr->fronnbr      = seltgrafdat.fronnbr;
+      grafptr->compload0    = seltgrafdat.compload0;
+      grafptr->compload0dlt = seltgrafdat.compload0dlt;
+      grafptr->compsize0    = seltgrafdat.compsize0;
+      grafptr->commload     = seltgrafdat.commload;
+      grafptr->commgainextn = seltgrafdat.commgainextn;
+      grafptr->bbalval      = seltgrafdat.bbalval;
+      memCpy (grafptr->frontab, seltgrafdat.frontab, seltgrafdat.fronnbr * sizeof (Gnum));
+      memCpy (grafptr->parttax + grafptr->s.baseval, seltgrafdat.parttax + grafptr->s.baseval, grafptr->s.vertnbr * sizeof (GraphPart));
+    }
+
+    bgraphStoreExit (&savedat);
+    return ((o == 2) ? 1 : 0);
+  }
+#endif /* BDGRAPHBIPARTSQNOTHREAD */
+
+  return (bgraphBipartSt (grafptr, stratptr));
+}
+
 /* This routine computes a partition of the
 ** given distributed graph by gathering as many
 ** copies of the graph as there are processes
@@ -168,17 +269,13 @@ const BdgraphBipartSqParam * const  paraptr)      /*+ Method parameters +*/
     return     (1);
   }
 
-  if (bgraphBipartSt (&cgrfdat, paraptr->strat) != 0) { /* Bipartition centralized graph */
+  if (bdgraphBipartSq2 (&cgrfdat, paraptr->strat) != 0) { /* Bipartition centralized graph */
     errorPrint ("bdgraphBipartSq: cannot bipartition centralized graph");
     reduloctab[3] =
     reduloctab[4] = 1;
   }
-  else {                                          /* Fill local array with local bipartition data */
-    reduloctab[0] = ((cgrfdat.fronnbr != 0) || ((cgrfdat.compsize0 != 0) && ((cgrfdat.s.vertnbr - cgrfdat.compsize0) != 0)))
-                    ? cgrfdat.commload
-                    : GNUMMAX; /* Partitions with empty bipartitions unwanted if they are completely unbalanced */
-    reduloctab[1] = cgrfdat.compload0dlt;
-  }
+  else                                            /* Fill local array with local bipartition data */
+    bdgraphBipartSqCost (&cgrfdat, reduloctab);
 
   if (dgrfptr->partgsttax == NULL) {
     if (dgraphGhst (&dgrfptr->s) != 0) {          /* Compute ghost edge array if not already present, before copying graph fields */
@@ -43,6 +43,8 @@
 /**                                 to   : 20 nov 2007     **/
 /**                # Version 6.0  : from : 07 jun 2018     **/
 /**                                 to   : 07 jun 2018     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -62,6 +64,9 @@ typedef struct BdgraphBipartSqParam_ {
 
 #ifdef BDGRAPH_BIPART_SQ
 static void                 bdgraphBipartSqOpBest (const Gnum * const, Gnum * const, const int * const, const MPI_Datatype * const);
+static void                 bdgraphBipartSqCost (const Bgraph * const, Gnum * const);
+static int                  bdgraphBipartSq2    (Bgraph * const, const Strat * const);
+static int                  bdgraphBipartSq3    (Bgraph * const, Context * const, const Strat * const);
 #endif /* BDGRAPH_BIPART_SQ */
 
 int                         bdgraphBipartSq     (Bdgraph * const, const BdgraphBipartSqParam * const);
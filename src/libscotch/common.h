@@ -57,7 +57,7 @@
 /**                # Version 6.1  : from : 02 apr 2021     **/
 /**                                 to   : 24 jun 2021     **/
 /**                # Version 7.0  : from : 03 jun 2018     **/
-/**                                 to   : 12 feb 2022     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -434,6 +434,9 @@ void                        intSort2asc2        (void * const, const INT);
 void                        intSort3asc1        (void * const, const INT);
 void                        intSort3asc2        (void * const, const INT);
 void                        intPsort2asc1       (void * const, const INT, const int);
+void                        intRsort1asc1       (void * const, const INT, Context * const);
+void                        intRsort2asc1       (void * const, const INT, Context * const);
+void                        intRsort2asc2       (void * const, const INT, Context * const);
 INT                         intSearchDicho      (const INT * const, const INT, const INT, const INT);
 INT                         intGcd              (INT, INT);
 
@@ -481,6 +484,22 @@ int                         contextValuesSetInt (Context * const, const int, con
 #define fileBlockMode(b,i)          ((b)[i].modeptr)
 #define fileBlockName(b,i)          ((b)[i].nameptr)
 
+#ifdef COMMON_OS_WINDOWS
+#define fileStreamGetc(s)           _getc_nolock (s)
+#define fileStreamLock(s)           _lock_file (s)
+#define fileStreamUnlock(s)         _unlock_file (s)
+#else /* COMMON_OS_WINDOWS */
+#ifdef HAVE_NOT_GETC_UNLOCKED
+#define fileStreamGetc(s)           getc (s)
+#define fileStreamLock(s)
+#define fileStreamUnlock(s)
+#else /* HAVE_NOT_GETC_UNLOCKED */
+#define fileStreamGetc(s)           getc_unlocked (s) /* Stream must have been locked by caller */
+#define fileStreamLock(s)           flockfile (s)
+#define fileStreamUnlock(s)         funlockfile (s)
+#endif /* HAVE_NOT_GETC_UNLOCKED */
+#endif /* COMMON_OS_WINDOWS */
+
 #define threadBarrier(t)            threadContextBarrier ((t)->contptr)
 #define threadNbr(t)                threadContextNbr ((t)->contptr)
 #define threadNum(t)                ((t)->thrdnum)
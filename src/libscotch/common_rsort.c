@@ -0,0 +1,238 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : common_rsort.c                          **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module is the template of the      **/
+/**                LSD radix sorting routines of INT       **/
+/**                arrays, which can be multi-threaded.    **/
+/**                It is included several times by         **/
+/**                common_integer.c, once per sort kind.   **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/* To be defined :
+** INTSORTNAME : Name of function
+** INTSORTTHRD : Name of per-thread routine
+** INTSORTQSRT : Name of the sequential quicksort routine
+** INTSORTSIZE : Number of INT values per item
+** INTSORTKEYS : Number of leading INT values used as keys
+*/
+
+#ifndef INTRSORT_DEFINED
+#define INTRSORT_DEFINED
+
+#define INTRSORTBITS                8             /* Number of bits per digit      */
+#define INTRSORTBUCK                (1 << INTRSORTBITS) /* Number of buckets per pass */
+#define INTRSORTMIN                 1024          /* Minimum array size for radix  */
+
+/*+ The data structure shared by
+    all the sorting threads.     +*/
+
+typedef struct IntRsortData_ {
+  INT *                     sorttab;              /*+ Array to sort                      +*/
+  INT *                     temptab;              /*+ Temporary array of same size       +*/
+  INT                       sortnbr;              /*+ Number of items to sort            +*/
+  INT *                     histtab;              /*+ Per-thread bucket counters         +*/
+  INT *                     minmtab;              /*+ Per-thread and per-key key extrema +*/
+  int                       thrdnbr;              /*+ Number of sorting threads          +*/
+} IntRsortData;
+
+#endif /* INTRSORT_DEFINED */
+
+/* This routine performs the radix sort on
+** the slice of the array owned by the given
+** thread. Since all threads compute the same
+** key ranges, they all perform the same
+** number of passes, and synchronize between
+** each phase of each pass. Only the passes
+** that cover the actual range of each key
+** are performed, so that arrays of keys
+** spanning a small range are sorted with
+** few passes.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+INTSORTTHRD (
+ThreadDescriptor * restrict const descptr,
+IntRsortData * restrict const     dataptr)
+{
+  INT * restrict      srctab;
+  INT * restrict      dsttab;
+  INT                 sortbas;
+  INT                 sortnnd;
+  INT                 sortnum;
+  int                 keynum;
+  INT                 offstab[INTRSORTBUCK];      /* Per-thread start index of each bucket */
+
+  const int             thrdnbr = dataptr->thrdnbr;
+  const int             thrdnum = (thrdnbr > 1) ? threadNum (descptr) : 0;
+  INT * restrict const  histtab = dataptr->histtab;
+  INT * restrict const  hithtab = histtab + thrdnum * INTRSORTBUCK; /* Counters of this thread */
+
+  sortbas = DATASCAN (dataptr->sortnbr, thrdnbr, thrdnum);
+  sortnnd = DATASCAN (dataptr->sortnbr, thrdnbr, thrdnum + 1);
+  srctab  = dataptr->sorttab;
+  dsttab  = dataptr->temptab;
+
+  for (keynum = INTSORTKEYS - 1; keynum >= 0; keynum --) { /* Sort by least significant key first */
+    INT * restrict      minmtab;
+    INT                 keymin;
+    INT                 keymax;
+    UINT                keyrng;
+    unsigned int        bitnum;
+    int                 thrdtmp;
+
+    for (sortnum = sortbas, keymin = INTVALMAX, keymax = - INTVALMAX; /* Compute local key extrema */
+         sortnum < sortnnd; sortnum ++) {
+      INT                 keyval;
+
+      keyval = srctab[sortnum * INTSORTSIZE + keynum];
+      if (keyval < keymin)
+        keymin = keyval;
+      if (keyval > keymax)
+        keymax = keyval;
+    }
+    minmtab = dataptr->minmtab + keynum * 2 * thrdnbr; /* Each key has its own area, to spare a barrier */
+    minmtab[2 * thrdnum]     = keymin;
+    minmtab[2 * thrdnum + 1] = keymax;
+    if (thrdnbr > 1)
+      threadBarrier (descptr);
+    for (thrdtmp = 0; thrdtmp < thrdnbr; thrdtmp ++) { /* Compute global key extrema */
+      if ((minmtab[2 * thrdtmp] <= minmtab[2 * thrdtmp + 1]) && /* If thread slice not empty */
+          (minmtab[2 * thrdtmp] < keymin))
+        keymin = minmtab[2 * thrdtmp];
+      if (minmtab[2 * thrdtmp + 1] > keymax)
+        keymax = minmtab[2 * thrdtmp + 1];
+    }
+    keyrng = (UINT) keymax - (UINT) keymin;       /* Keys are sorted as unsigned offsets from minimum */
+
+    for (bitnum = 0; (bitnum < INTSIZEBITS) && ((keyrng >> bitnum) != 0); bitnum += INTRSORTBITS) {
+      INT * restrict      tmpptr;
+      INT                 buckval;
+      int                 bucknum;
+
+      memSet (hithtab, 0, INTRSORTBUCK * sizeof (INT));
+      for (sortnum = sortbas; sortnum < sortnnd; sortnum ++) /* Count items of slice in each bucket */
+        hithtab[(((UINT) srctab[sortnum * INTSORTSIZE + keynum] - (UINT) keymin) >> bitnum) & (INTRSORTBUCK - 1)] ++;
+
+      if (thrdnbr > 1)
+        threadBarrier (descptr);
+
+      for (bucknum = 0, buckval = 0; bucknum < INTRSORTBUCK; bucknum ++) { /* Items of lower buckets, then of lower threads */
+        for (thrdtmp = 0; thrdtmp < thrdnbr; thrdtmp ++) {
+          if (thrdtmp == thrdnum)
+            offstab[bucknum] = buckval;
+          buckval += histtab[thrdtmp * INTRSORTBUCK + bucknum];
+        }
+      }
+
+      for (sortnum = sortbas; sortnum < sortnnd; sortnum ++) { /* Scatter items of slice, in stable order */
+        INT * restrict      srcptr;
+        INT * restrict      dstptr;
+        int                 valnum;
+
+        srcptr = srctab + sortnum * INTSORTSIZE;
+        dstptr = dsttab + (offstab[(((UINT) srcptr[keynum] - (UINT) keymin) >> bitnum) & (INTRSORTBUCK - 1)] ++) * INTSORTSIZE;
+        for (valnum = 0; valnum < INTSORTSIZE; valnum ++)
+          dstptr[valnum] = srcptr[valnum];
+      }
+
+      if (thrdnbr > 1)
+        threadBarrier (descptr);
+
+      tmpptr = srctab;                            /* Swap source and destination arrays */
+      srctab = dsttab;
+      dsttab = tmpptr;
+    }
+  }
+
+  if (srctab != dataptr->sorttab)                 /* If sorted data ended in temporary array, copy back slice */
+    memCpy (dataptr->sorttab + sortbas * INTSORTSIZE, srctab + sortbas * INTSORTSIZE, (sortnnd - sortbas) * INTSORTSIZE * sizeof (INT));
+}
+
+/* This routine sorts the given array using
+** an LSD radix sort. When a context is
+** provided, all of its threads take part
+** in the sort. Small arrays are sorted
+** using the sequential quicksort, as well
+** as when the temporary memory cannot be
+** allocated. Hence, callers must not rely
+** on the relative order of items having
+** equal keys.
+** It returns:
+** - void  : in all cases.
+*/
+
+void
+INTSORTNAME (
+void * const                sorttab,              /*+ Array to sort                   +*/
+const INT                   sortnbr,              /*+ Number of entries to sort       +*/
+Context * const             contptr)              /*+ Execution context, or NULL      +*/
+{
+  IntRsortData        datadat;
+  int                 thrdnbr;
+
+  if (sortnbr < INTRSORTMIN) {                    /* Quicksort is faster on small arrays */
+    INTSORTQSRT (sorttab, sortnbr);
+    return;
+  }
+
+  thrdnbr = (contptr != NULL) ? contextThreadNbr (contptr) : 1;
+
+  if (memAllocGroup ((void **) (void *)
+                     &datadat.temptab, (size_t) (sortnbr * INTSORTSIZE * sizeof (INT)),
+                     &datadat.histtab, (size_t) (thrdnbr * INTRSORTBUCK * sizeof (INT)),
+                     &datadat.minmtab, (size_t) (thrdnbr * 2 * INTSORTKEYS * sizeof (INT)), NULL) == NULL) {
+    INTSORTQSRT (sorttab, sortnbr);               /* Fall back to in-place sorting */
+    return;
+  }
+  datadat.sorttab = (INT *) sorttab;
+  datadat.sortnbr = sortnbr;
+  datadat.thrdnbr = thrdnbr;
+
+  if (thrdnbr > 1)
+    contextThreadLaunch (contptr, (ThreadFunc) INTSORTTHRD, (void *) &datadat);
+  else
+    INTSORTTHRD (NULL, &datadat);
+
+  memFree (datadat.temptab);                      /* Free group leader */
+}
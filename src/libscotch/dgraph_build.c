@@ -53,6 +53,8 @@
 /**                                 to   : 03 nov 2010     **/
 /**                # Version 6.0  : from : 23 dec 2013     **/
 /**                                 to   : 03 jun 2018     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -373,7 +375,7 @@ const Gnum                  degrlocmax)
       vesongbptr->vlblglbnum = *vlbllocptr;       /* Build vertex sort array  */
       vesongbptr->vertlocnum =  vertlocnum;       /* Local index is not based */
     }
-    intSort2asc1 (vesongbtab[0], vertlocnbr);
+    intRsort2asc1 (vesongbtab[0], vertlocnbr, NULL);
     vesongbnbr[0] = vertlocnbr;                   /* Set array size */
 
     cheklocval = 0;
@@ -401,7 +403,7 @@ const Gnum                  degrlocmax)
       edsolocptr->vlblglbnum = edgeloctax[edgelocnum];
       edsolocptr->edgelocnum = edgelocnum;
     }
-    intSort2asc2 (edsoloctab, grafptr->edgelocnbr);
+    intRsort2asc2 (edsoloctab, grafptr->edgelocnbr, NULL);
 
     procrcvnum = (grafptr->proclocnum + 1) % procglbnbr; /* Compute indices of neighbors */
     procsndnum = (grafptr->proclocnum - 1 + procglbnbr) % procglbnbr;
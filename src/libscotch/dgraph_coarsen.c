@@ -52,7 +52,7 @@
 /**                # Version 6.1  : from : 17 jun 2021     **/
 /**                                 to   : 27 dec 2021     **/
 /**                # Version 7.0  : from : 14 jan 2020     **/
-/**                                 to   : 29 dec 2021     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -108,6 +108,9 @@ Dgraph * restrict const             coargrafptr)  /*+ Coarse graph to build
   coarptr->nsndidxtab = NULL;
   coarptr->nrcvidxtab = NULL;
   coarptr->thrdtab    = NULL;
+#ifdef SCOTCH_MPI_ASYNC_COLL
+  coarptr->vertdattype = MPI_DATATYPE_NULL;
+#endif /* SCOTCH_MPI_ASYNC_COLL */
 
   if ((coarptr->coarprvptr = memAllocGroup ((void **) (void *) /* Allocate distributed coarse graph private data */
                                             &coargrafptr->procdsptab, (size_t) ((procglbnbr + 1) * sizeof (Gnum)),
@@ -207,6 +210,15 @@ Dgraph * restrict const             coargrafptr)  /*+ Coarse graph to build
 
   coarptr->edgekptnbr = 0;
 
+#ifdef SCOTCH_MPI_ASYNC_COLL
+  MPI_Type_contiguous (2, GNUM_MPI, &coarptr->vertdattype); /* Type of whole vertex exchange cells */
+  if (MPI_Type_commit (&coarptr->vertdattype) != MPI_SUCCESS) {
+    errorPrint        ("dgraphCoarsenInit: communication error");
+    dgraphCoarsenExit (coarptr);
+    return (1);
+  }
+#endif /* SCOTCH_MPI_ASYNC_COLL */
+
   return (0);
 }
 
@@ -225,6 +237,10 @@ DgraphCoarsenData * restrict const    coarptr)    /*+ Coarsening data structure
     memFree (coarptr->coarprvptr);
   if (coarptr->thrdtab != NULL)
     memFree (coarptr->thrdtab);
+#ifdef SCOTCH_MPI_ASYNC_COLL
+  if (coarptr->vertdattype != MPI_DATATYPE_NULL)
+    MPI_Type_free (&coarptr->vertdattype);
+#endif /* SCOTCH_MPI_ASYNC_COLL */
 }
 
 /*************************************/
@@ -233,6 +249,7 @@ DgraphCoarsenData * restrict const    coarptr)    /*+ Coarsening data structure
 /*                                   */
 /*************************************/
 
+#ifndef SCOTCH_MPI_ASYNC_COLL
 static
 int
 dgraphCoarsenBuildColl (
@@ -308,6 +325,103 @@ DgraphCoarsenData * restrict const  coarptr)
   return (0);
 }
 
+#else /* SCOTCH_MPI_ASYNC_COLL */
+
+/* These routines exchange multinode data with
+** neighbor processes by means of a single
+** non-blocking collective communication, such
+** that local processing of multinodes can be
+** performed while data is in flight. Whole
+** halo-sized blocks are exchanged, the end of
+** data in each non-full block being marked by
+** a negative value.
+** They return:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+dgraphCoarsenBuildCollAsync (
+DgraphCoarsenData * restrict const  coarptr)
+{
+  int                 procngbnum;
+
+  Dgraph * restrict const       grafptr    = coarptr->finegrafptr;
+  const int                     procngbnbr = grafptr->procngbnbr;
+  const int * restrict const    procngbtab = grafptr->procngbtab;
+  const int * restrict const    nsndidxtab = coarptr->nsndidxtab;
+
+  for (procngbnum = 0; procngbnum < procngbnbr; procngbnum ++) { /* Mark end of data in non-full blocks */
+    if (nsndidxtab[procngbnum] < coarptr->vsnddsptab[procngbtab[procngbnum] + 1])
+      coarptr->vsnddattab[nsndidxtab[procngbnum]].datatab[0] = -1;
+  }
+
+  if (MPI_Ialltoallv (coarptr->vsnddattab, grafptr->procsndtab, coarptr->vsnddsptab, coarptr->vertdattype,
+                      coarptr->vrcvdattab, grafptr->procrcvtab, coarptr->vrcvdsptab, coarptr->vertdattype,
+                      grafptr->proccomm, &coarptr->requval) != MPI_SUCCESS) {
+    errorPrint ("dgraphCoarsenBuildCollAsync: communication error");
+    return (1);
+  }
+
+  return (0);
+}
+
+static
+int
+dgraphCoarsenBuildCollWait (
+DgraphCoarsenData * restrict const  coarptr)
+{
+  int                 procngbnum;
+
+  Dgraph * restrict const       grafptr    = coarptr->finegrafptr;
+  const Gnum                    vertlocadj = grafptr->procvrttab[grafptr->proclocnum] - grafptr->baseval;
+  const int                     procngbnbr = grafptr->procngbnbr;
+  const int * restrict const    procngbtab = grafptr->procngbtab;
+  Gnum * restrict const         coargsttax = coarptr->coargsttax;
+  int * restrict const          nrcvidxtab = coarptr->nrcvidxtab;
+
+  if (MPI_Wait (&coarptr->requval, MPI_STATUS_IGNORE) != MPI_SUCCESS) {
+    errorPrint ("dgraphCoarsenBuildCollWait: communication error");
+    return (1);
+  }
+
+  for (procngbnum = 0; procngbnum < procngbnbr; procngbnum ++) { /* For all received data chunks */
+    int                 vrcvidxnnd;
+    int                 vrcvidxnum;
+    int                 procglbnum;
+
+    const DgraphCoarsenVert * restrict const  vrcvdattab = coarptr->vrcvdattab; /* After data is received */
+
+    procglbnum = procngbtab[procngbnum];
+    for (vrcvidxnum = coarptr->vrcvdsptab[procglbnum], vrcvidxnnd = coarptr->vrcvdsptab[procglbnum + 1];
+         vrcvidxnum < vrcvidxnnd; vrcvidxnum ++) {
+      Gnum                vertglbnum;             /* Our global number (the one seen as mate by sender) */
+      Gnum                vertlocnum;             /* Our local number (the one seen as mate by sender)  */
+      Gnum                multglbnum;             /* Global number of coarse vertex                     */
+
+      vertglbnum = vrcvdattab[vrcvidxnum].datatab[0];
+      if (vertglbnum == -1)                       /* If end of useful data reached */
+        break;
+      multglbnum = vrcvdattab[vrcvidxnum].datatab[1];
+      vertlocnum = vertglbnum - vertlocadj;
+#ifdef SCOTCH_DEBUG_DGRAPH2
+      if ((vertlocnum <  grafptr->baseval) ||     /* If matching request is not directed towards our process */
+          (vertlocnum >= grafptr->vertlocnnd)) {
+        errorPrint ("dgraphCoarsenBuildCollWait: internal error");
+        return (1);
+      }
+#endif /* SCOTCH_DEBUG_DGRAPH2 */
+      coargsttax[vertlocnum] = multglbnum;
+    }
+    nrcvidxtab[procngbnum] = vrcvidxnum;          /* Keep receive end index for preparing edge arrays */
+  }
+
+  return (0);
+}
+
+#endif /* SCOTCH_MPI_ASYNC_COLL */
+
 static
 int
 dgraphCoarsenBuildPtop (
@@ -871,6 +985,54 @@ DgraphCoarsenData * restrict const  coarptr)
   for (procngbnum = 0; procngbnum < procngbnbr; procngbnum ++) /* Reset indices for sending messages */
     nsndidxtab[procngbnum] = coarptr->vsnddsptab[procngbtab[procngbnum]];
 
+  for (multlocnum = 0; multlocnum < coarptr->multlocnbr; multlocnum ++) { /* Fill send array with data of remote multinodes */
+    Gnum                ver1locnum;
+    Gnum                edgelocnum;               /* Fine edge number to remote fine vertex */
+    Gnum                ver1glbnum;               /* Global number of fine end vertex       */
+    Gnum                ver1gstnum;               /* Local ghost number of fine end vertex  */
+    int                 coarsndidx;               /* Index in request send array            */
+    int                 procngbnum;               /* Number of target process               */
+
+    ver1locnum = multloctab[multlocnum].vertglbnum[1];
+    if (ver1locnum >= 0)                          /* If second vertex is local, nothing to send */
+      continue;
+
+    edgelocnum = -2 - ver1locnum;
+#ifdef SCOTCH_DEBUG_DGRAPH2
+    if ((edgelocnum <   finegrafptr->baseval) ||
+        (edgelocnum >= (finegrafptr->baseval + finegrafptr->edgelocsiz))) {
+      errorPrint ("dgraphCoarsenBuild: internal error (3)");
+      return (1);
+    }
+#endif /* SCOTCH_DEBUG_DGRAPH2 */
+    ver1glbnum = edgeloctax[edgelocnum];
+    ver1gstnum = edgegsttax[edgelocnum];
+
+    procngbnum = procgsttax[ver1gstnum];          /* Find neighbor owner process */
+#ifdef SCOTCH_DEBUG_DGRAPH2
+    if (procngbnum < 0) {                         /* If neighbor had not been computed */
+      errorPrint ("dgraphCoarsenBuild: internal error (4)");
+      return (1);
+    }
+#endif /* SCOTCH_DEBUG_DGRAPH2 */
+
+    coarsndidx = nsndidxtab[procngbnum] ++;       /* Get position of message in send array */
+#ifdef SCOTCH_DEBUG_DGRAPH2
+    if (coarsndidx >= coarptr->vsnddsptab[procngbtab[procngbnum] + 1]) {
+      errorPrint ("dgraphCoarsenBuild: internal error (5)");
+      return (1);
+    }
+#endif /* SCOTCH_DEBUG_DGRAPH2 */
+    vsnddattab[coarsndidx].datatab[0] = ver1glbnum; /* Send fine global remote vertex number                                    */
+    vsnddattab[coarsndidx].datatab[1] = multlocnum + multlocadj; /* Send coarse global multinode value; TRICK: sorted ascending */
+  }
+
+#ifdef SCOTCH_MPI_ASYNC_COLL
+  if (((finegrafptr->flagval & DGRAPHCOMMPTOP) == 0) && /* If collective communication, overlap it with local processing */
+      (dgraphCoarsenBuildCollAsync (coarptr) != 0))
+    return (1);
+#endif /* SCOTCH_MPI_ASYNC_COLL */
+
 #if (defined SCOTCH_PTHREAD) && (! defined DGRAPHCOARSENNOTHREAD)
   if ((coarptr->thrdtab = memAlloc (thrdnbr * sizeof (DgraphCoarsenThread))) == NULL) {
     errorPrint ("dgraphCoarsenBuild: out of memory (1)");
@@ -930,53 +1092,23 @@ DgraphCoarsenData * restrict const  coarptr)
       }
 #endif /* (defined SCOTCH_PTHREAD) && (! defined DGRAPHCOARSENNOTHREAD) */
     }
-    else {                                        /* Second vertex is not local             */
-      Gnum                edgelocnum;             /* Fine edge number to remote fine vertex */
-      Gnum                ver1glbnum;             /* Global number of fine end vertex       */
-      Gnum                ver1gstnum;             /* Local ghost number of fine end vertex  */
-      int                 coarsndidx;             /* Index in request send array            */
-      int                 procngbnum;             /* Number of target process               */
-
 #if (defined SCOTCH_PTHREAD) && (! defined DGRAPHCOARSENNOTHREAD)
+    else                                          /* Second vertex is not local  */
       edgelocsum --;                              /* Remove collapsed ghost edge */
 #endif /* (defined SCOTCH_PTHREAD) && (! defined DGRAPHCOARSENNOTHREAD) */
-      edgelocnum = -2 - ver1locnum;
-#ifdef SCOTCH_DEBUG_DGRAPH2
-      if ((edgelocnum <   finegrafptr->baseval) ||
-          (edgelocnum >= (finegrafptr->baseval + finegrafptr->edgelocsiz))) {
-        errorPrint ("dgraphCoarsenBuild: internal error (3)");
-        return (1);
-      }
-#endif /* SCOTCH_DEBUG_DGRAPH2 */
-      ver1glbnum = edgeloctax[edgelocnum];
-      ver1gstnum = edgegsttax[edgelocnum];
-
-      procngbnum = procgsttax[ver1gstnum];        /* Find neighbor owner process */
-#ifdef SCOTCH_DEBUG_DGRAPH2
-      if (procngbnum < 0) {                       /* If neighbor had not been computed */
-        errorPrint ("dgraphCoarsenBuild: internal error (4)");
-        return (1);
-      }
-#endif /* SCOTCH_DEBUG_DGRAPH2 */
-
-      coarsndidx = nsndidxtab[procngbnum] ++;     /* Get position of message in send array */
-#ifdef SCOTCH_DEBUG_DGRAPH2
-      if (coarsndidx >= coarptr->vsnddsptab[procngbtab[procngbnum] + 1]) {
-        errorPrint ("dgraphCoarsenBuild: internal error (5)");
-        return (1);
-      }
-#endif /* SCOTCH_DEBUG_DGRAPH2 */
-      vsnddattab[coarsndidx].datatab[0] = ver1glbnum; /* Send fine global remote vertex number                                    */
-      vsnddattab[coarsndidx].datatab[1] = multlocnum + multlocadj; /* Send coarse global multinode value; TRICK: sorted ascending */
-    }
   }
 #if (defined SCOTCH_PTHREAD) && (! defined DGRAPHCOARSENNOTHREAD)
   for ( ; thrdnum < thrdnbr; thrdnum ++)          /* Fill remaining thread slots            */
     coarptr->thrdtab[thrdnum].edgelocsum = edgelocsum; /* Record sum of local edges to date */
 #endif /* (defined SCOTCH_PTHREAD) && (! defined DGRAPHCOARSENNOTHREAD) */
 
+#ifdef SCOTCH_MPI_ASYNC_COLL
+  if ((((finegrafptr->flagval & DGRAPHCOMMPTOP) != 0) ? dgraphCoarsenBuildPtop : dgraphCoarsenBuildCollWait) (coarptr) != 0)
+    return (1);
+#else /* SCOTCH_MPI_ASYNC_COLL */
   if ((((finegrafptr->flagval & DGRAPHCOMMPTOP) != 0) ? dgraphCoarsenBuildPtop : dgraphCoarsenBuildColl) (coarptr) != 0)
     return (1);
+#endif /* SCOTCH_MPI_ASYNC_COLL */
 #ifdef SCOTCH_DEBUG_DGRAPH2
   if (MPI_Barrier (proccomm) != MPI_SUCCESS) {    /* Make sure all-to-all communication did complete */
     errorPrint ("dgraphCoarsenBuild: communication error (1)");
@@ -1360,6 +1492,28 @@ Context * restrict const              contptr)    /*+ Execution context
     return (2);
 
   for (passnum = 0; passnum < passnbr; passnum ++) {
+#ifdef SCOTCH_MPI_ASYNC_COLL
+    if ((finegrafptr->flagval & DGRAPHCOMMPTOP) == 0) { /* If collective communication, pipeline matching */
+      matedat.scanval = DGRAPHMATCHSCANFRNT;      /* Frontier vertices send their requests first      */
+      ((passnum == 0) ? dgraphMatchHl : dgraphMatchHy) (&matedat);
+      if (dgraphMatchSyncCollAsync (&matedat) != 0) {
+        errorPrint        ("dgraphCoarsen: cannot perform matching (1)");
+        dgraphMatchExit   (&matedat);
+        dgraphCoarsenExit (&matedat.c);
+        return (2);
+      }
+      matedat.scanval = DGRAPHMATCHSCANINTR;      /* Interior vertices are matched while requests are in flight */
+      ((passnum == 0) ? dgraphMatchHl : dgraphMatchHy) (&matedat);
+      matedat.scanval = DGRAPHMATCHSCANALL;
+      if (dgraphMatchSyncCollWait (&matedat) != 0) {
+        errorPrint        ("dgraphCoarsen: cannot perform matching (2)");
+        dgraphMatchExit   (&matedat);
+        dgraphCoarsenExit (&matedat.c);
+        return (2);
+      }
+      continue;
+    }
+#endif /* SCOTCH_MPI_ASYNC_COLL */
     ((passnum == 0) ? dgraphMatchHl : dgraphMatchHy) (&matedat); /* If first pass, process lightest vertices first */
 
     if ((((finegrafptr->flagval & DGRAPHCOMMPTOP) != 0) ? dgraphMatchSyncPtop : dgraphMatchSyncColl) (&matedat) != 0) {
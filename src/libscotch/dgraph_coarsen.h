@@ -48,7 +48,7 @@
 /**                # Version 6.1  : from : 17 jun 2021     **/
 /**                                 to   : 17 jun 2021     **/
 /**                # Version 7.0  : from : 14 jan 2020     **/
-/**                                 to   : 29 dec 2021     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -164,6 +164,10 @@ typedef struct DgraphCoarsenData_ {
   Gnum                      coarhashmsk;          /*+ Mask value of adjacency hash table (TRICK: size - 1)         +*/
   DgraphCoarsenThread *     thrdtab;              /*+ Optional array for adjacency splitting across threads        +*/
   Context *                 contptr;              /*+ Execution context                                            +*/
+#ifdef SCOTCH_MPI_ASYNC_COLL
+  MPI_Datatype              vertdattype;          /*+ Datatype of vertex exchange cells, for whole-halo exchanges  +*/
+  MPI_Request               requval;              /*+ Request of pending asynchronous collective communication     +*/
+#endif /* SCOTCH_MPI_ASYNC_COLL */
 } DgraphCoarsenData;
 
 /*
@@ -47,7 +47,7 @@
 /**                # Version 6.1  : from : 18 jun 2021     **/
 /**                                 to   : 19 jun 2021     **/
 /**                # Version 7.0  : from : 14 sep 2021     **/
-/**                                 to   : 14 sep 2021     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -72,7 +72,10 @@
 
 /* This routine builds a folded graph by merging graph
 ** data to the processes of the first half or to the
-** second half of the communicator.
+** second half of the communicator. When node-aware
+** folding is enabled, these halves are made of the
+** processes of lowest and highest folding ranks, such
+** that each node hosts processes of both halves.
 ** The key value of the folded communicator is not
 ** changed as it is not relevant.
 ** It returns:
@@ -93,10 +96,16 @@ MPI_Datatype                  datatype)
   int               fldprocnum;                   /* Index of local process in folded communicator   */
   int               fldproccol;                   /* Color of receiver or not wanted in communicator */
   MPI_Comm          fldproccomm;                  /* Communicator of folded part                     */
+  const int *       procnodtab;                   /* Node data for node-aware folding                */
   int               o;
 
+  if (dgraphFoldCommNode (orggrafptr, &procnodtab) != 0) { /* Get node data cached on communicator, if any */
+    errorPrint ("dgraphFold: cannot compute node data");
+    return (1);
+  }
+
   fldprocnbr = (orggrafptr->procglbnbr + 1) / 2;
-  fldprocnum = orggrafptr->proclocnum;
+  fldprocnum = (procnodtab != NULL) ? procnodtab[orggrafptr->procglbnbr + orggrafptr->proclocnum] : orggrafptr->proclocnum;
   if (partval == 1) {
     fldprocnum = fldprocnum - fldprocnbr;
     fldprocnbr = orggrafptr->procglbnbr - fldprocnbr;
@@ -108,7 +117,7 @@ MPI_Datatype                  datatype)
     return (1);
   }
 
-  o = dgraphFold2 (orggrafptr, partval, fldgrafptr, fldproccomm, orgdataptr, flddataptr, datatype);
+  o = dgraphFold2 (orggrafptr, partval, procnodtab, fldgrafptr, fldproccomm, orgdataptr, flddataptr, datatype);
   fldgrafptr->prockeyval = fldproccol;            /* Key of folded communicator is always zero if no duplication occurs */
 
   return (o);
@@ -118,6 +127,7 @@ int
 dgraphFold2 (
 const Dgraph * restrict const orggrafptr,
 const int                     partval,            /*+ 0 for first half, 1 for second half                          +*/
+const int * restrict const    procnodtab,         /*+ Node data for node-aware folding, or NULL                    +*/
 Dgraph * const                fldgrafptr,         /*+ Folded graph structure to fill [norestrict:async]            +*/
 MPI_Comm                      fldproccomm,
 const void * restrict const   orgdataptr,         /*+ Un-based array of data which must be kept, e.g. coarmulttab  +*/
@@ -165,12 +175,11 @@ MPI_Datatype                  datatype)
   }
 
   fldprocglbnbr = (orggrafptr->procglbnbr + 1) / 2;
+  fldproclocnum = (procnodtab != NULL) ? procnodtab[orggrafptr->procglbnbr + orggrafptr->proclocnum] : orggrafptr->proclocnum;
   if (partval == 1) {
-    fldproclocnum = orggrafptr->proclocnum - fldprocglbnbr;
-    fldprocglbnbr = orggrafptr->procglbnbr - fldprocglbnbr;
+    fldproclocnum -= fldprocglbnbr;
+    fldprocglbnbr  = orggrafptr->procglbnbr - fldprocglbnbr;
   }
-  else
-    fldproclocnum = orggrafptr->proclocnum;
 
   fldcommtypval = ((fldproclocnum >= 0) && (fldproclocnum < fldprocglbnbr)) ? DGRAPHFOLDCOMMRECV : DGRAPHFOLDCOMMSEND;
   if (orgdataptr != NULL)
@@ -207,7 +216,7 @@ MPI_Datatype                  datatype)
       errorPrint ("dgraphFold2: out of memory (1)");
       cheklocval = 1;
     }
-    else if (dgraphFoldComm (orggrafptr, partval, &commmax, &fldcommtypval, &fldcommdattab, &fldcommvrttab, /* Process can become a sender receiver */
+    else if (dgraphFoldComm (orggrafptr, partval, procnodtab, &commmax, &fldcommtypval, &fldcommdattab, &fldcommvrttab, /* Process can become a sender receiver */
                              fldgrafptr->proccnttab, &fldvertadjnbr, &fldvertadjtab, &fldvertdlttab) != 0) {
       errorPrint ("dgraphFold2: cannot compute folding communications (1)");
       cheklocval = 1;
@@ -273,7 +282,7 @@ MPI_Datatype                  datatype)
     }
 #endif /* SCOTCH_DEBUG_HDGRAPH2 */
 
-    if (dgraphFoldComm (orggrafptr, partval, &commmax, &fldcommtypval, &fldcommdattab, &fldcommvrttab, NULL, NULL, NULL, NULL) != 0) {
+    if (dgraphFoldComm (orggrafptr, partval, procnodtab, &commmax, &fldcommtypval, &fldcommdattab, &fldcommvrttab, NULL, NULL, NULL, NULL) != 0) {
       errorPrint ("dgraphFold2: cannot compute folding communications (2)");
       cheklocval = 1;
     }
@@ -43,6 +43,8 @@
 /**                                 to   : 10 sep 2007     **/
 /**                # Version 5.1  : from : 18 jan 2009     **/
 /**                                 to   : 10 sep 2011     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -51,11 +53,24 @@
 #include "dgraph.h"
 #include "dgraph_fold_comm.h"
 
+/*
+**  The static variables.
+*/
+
+static int                  dgraphfoldcommnodekey = MPI_KEYVAL_INVALID; /*+ Key of node data cached on communicators +*/
+#ifdef COMMON_PTHREAD
+static pthread_mutex_t      dgraphfoldcommnodemutedat = PTHREAD_MUTEX_INITIALIZER; /*+ Mutex for key creation +*/
+#endif /* COMMON_PTHREAD */
+
 /* This routine computes an optimized communication
 ** scheme for folding the data of a distributed graph.
 ** It is currently based on a maximum fixed number of
 ** communications per process. If this maximum is reached,
 ** the algorithm will fail.
+** When node data is provided, processes are assigned
+** to folding halves according to their folding rank,
+** and communications are preferably performed between
+** processes of the same node.
 ** It returns:
 ** - 0   : on success.
 ** - !0  : on error.
@@ -65,6 +80,7 @@ int
 dgraphFoldComm (
 const Dgraph * restrict const                 grafptr,
 const int                                     partval, /* 0 for first half, 1 for second half                        */
+const int * restrict const                    procnodtab, /* Node data computed by dgraphFoldCommNode(), or NULL     */
 int * restrict const                          commptr, /* Pointer to maximum number of communications per process    */
 int * restrict const                          commtypval, /* Process will be sender or receiver                      */
 DgraphFoldCommData *restrict * restrict const commdatptr, /* Slots for communication                                 */
@@ -89,6 +105,8 @@ Gnum * restrict * restrict const              vertdltptr) /* Pointer to global d
   Gnum * restrict               vertadjtab;
   Gnum * restrict               vertdlttab;
   int * restrict                vertprmtab;       /* Permutation array for adjustment range computations */
+  const int * restrict          procfldtab;       /* Folding rank of each process, if node-aware folding */
+  int                           procfldnum;
   int                           i;
 #ifdef SCOTCH_DEBUG_DGRAPH2
   DgraphFoldCommData * restrict procchktab;
@@ -101,19 +119,54 @@ Gnum * restrict * restrict const              vertdltptr) /* Pointer to global d
   }
 #endif /* SCOTCH_DEBUG_DGRAPH2 */
 
-  if ((procsrttab = memAlloc (grafptr->procglbnbr * sizeof (DgraphFoldCommData))) == NULL) {
+  if ((procsrttab = memAlloc (grafptr->procglbnbr * ((procnodtab != NULL) ? (3 * sizeof (Gnum)) : sizeof (DgraphFoldCommData)))) == NULL) {
     errorPrint ("dgraphFoldComm: out of memory (1)");
     return     (1);
   }
 
-  for (procnum = 0; procnum < grafptr->procglbnbr; procnum ++) {
-    procsrttab[procnum].procnum = procnum;
-    procsrttab[procnum].vertnbr = grafptr->proccnttab[procnum];
-  }
   fldprocnbr = (grafptr->procglbnbr + 1) / 2;     /* Get number of processes in part 0 (always more than in part 1) */
 
-  intSort2asc1 (procsrttab, fldprocnbr);          /* Sort both parts of processor array */
-  intSort2asc1 (procsrttab + fldprocnbr, grafptr->procglbnbr - fldprocnbr);
+  if (procnodtab == NULL) {                       /* If processes are folded in rank order */
+    procfldtab = NULL;
+    for (procnum = 0; procnum < grafptr->procglbnbr; procnum ++) {
+      procsrttab[procnum].procnum = procnum;
+      procsrttab[procnum].vertnbr = grafptr->proccnttab[procnum];
+    }
+
+    intSort2asc1 (procsrttab, fldprocnbr);        /* Sort both parts of processor array */
+    intSort2asc1 (procsrttab + fldprocnbr, grafptr->procglbnbr - fldprocnbr);
+  }
+  else {                                          /* Node-aware folding                            */
+    Gnum * restrict     procsrtptr;               /* Sort array of (node key, load, process) triplets */
+    int                 nodemax;
+
+    procfldtab = procnodtab + grafptr->procglbnbr;
+    procsrtptr = (Gnum *) procsrttab;
+    for (procnum = 0, nodemax = 0; procnum < grafptr->procglbnbr; procnum ++) {
+      if (nodemax < procnodtab[procnum])
+        nodemax = procnodtab[procnum];
+    }
+    for (procnum = 0; procnum < grafptr->procglbnbr; procnum ++) {
+      procfldnum = procfldtab[procnum];
+      procsrtptr[3 * procfldnum]     = ((procfldnum < fldprocnbr) == (partval == 0)) /* Receivers by ascending node index; senders, */
+                                       ? procnodtab[procnum] : (nodemax - procnodtab[procnum]); /* which are taken from the end, by descending one */
+      procsrtptr[3 * procfldnum + 1] = grafptr->proccnttab[procnum];
+      procsrtptr[3 * procfldnum + 2] = procnum;
+    }
+
+    intSort3asc2 (procsrtptr, fldprocnbr);        /* Sort both parts by node, then by load */
+    intSort3asc2 (procsrtptr + 3 * fldprocnbr, grafptr->procglbnbr - fldprocnbr);
+
+    for (procnum = 0; procnum < grafptr->procglbnbr; procnum ++) { /* Compact triplets into sort array; TRICK: no overlap */
+      Gnum                vertnbr;
+      Gnum                procval;
+
+      vertnbr = procsrtptr[3 * procnum + 1];
+      procval = procsrtptr[3 * procnum + 2];
+      procsrttab[procnum].vertnbr = vertnbr;
+      procsrttab[procnum].procnum = procval;
+    }
+  }
 
   if (partval == 0) {                             /* If part 0 will receive the data                 */
     procrcvbas = 0;                               /* Receive by ascending weight order in first part */
@@ -128,7 +181,8 @@ Gnum * restrict * restrict const              vertdltptr) /* Pointer to global d
     procsndmnd = 0;
     fldprocnbr = grafptr->procglbnbr - fldprocnbr;
   }
-  *commtypval = ((grafptr->proclocnum >= procrcvbas) && (grafptr->proclocnum < procrcvnnd)) ? DGRAPHFOLDCOMMRECV : DGRAPHFOLDCOMMSEND;
+  procfldnum  = (procfldtab != NULL) ? procfldtab[grafptr->proclocnum] : grafptr->proclocnum;
+  *commtypval = ((procfldnum >= procrcvbas) && (procfldnum < procrcvnnd)) ? DGRAPHFOLDCOMMRECV : DGRAPHFOLDCOMMSEND;
 #ifdef SCOTCH_DEBUG_DGRAPH2
   if ((*commtypval == DGRAPHFOLDCOMMRECV) &&
       ((proccnttab == NULL) || (vertadjptr == NULL) || (vertdltptr == NULL))) {
@@ -177,11 +231,15 @@ Gnum * restrict * restrict const              vertdltptr) /* Pointer to global d
       memSet (vertprmtab, ~0, (commmax + 1) * fldprocnbr * sizeof (int)); /* Reset adjustment index arrays */
       memSet (vertadjtab, ~0, commmax * grafptr->procglbnbr * sizeof (Gnum));
 
-      for (procrcvtmp = procrcvbas; procrcvtmp < procrcvnnd; procrcvtmp ++) { /* Fill count and adjustment arrays for receiver processes slots */
-        vertadjtab[procrcvtmp * commmax]    = grafptr->procvrttab[procrcvtmp];
-        vertdlttab[procrcvtmp * commmax]    =
-        proccnttab[procrcvtmp - procrcvbas] = grafptr->proccnttab[procrcvtmp];
-        vertprmtab[(procrcvtmp - procrcvbas) * (commmax + 1)] = procrcvtmp * commmax;
+      for (procrcvtmp = 0; procrcvtmp < grafptr->procglbnbr; procrcvtmp ++) { /* Fill count and adjustment arrays for receiver processes slots */
+        procfldnum = ((procfldtab != NULL) ? procfldtab[procrcvtmp] : procrcvtmp) - procrcvbas;
+        if ((procfldnum < 0) || (procfldnum >= fldprocnbr)) /* If not a receiver process */
+          continue;
+
+        vertadjtab[procrcvtmp * commmax] = grafptr->procvrttab[procrcvtmp];
+        vertdlttab[procrcvtmp * commmax] =
+        proccnttab[procfldnum]           = grafptr->proccnttab[procrcvtmp];
+        vertprmtab[procfldnum * (commmax + 1)] = procrcvtmp * commmax;
       }
     }
 
@@ -198,12 +256,13 @@ Gnum * restrict * restrict const              vertdltptr) /* Pointer to global d
 
       procsrttab[procrcvidx].vertnbr = - (procsrttab[procrcvidx].vertnbr + vertsndnbr); /* Flag as having had a communication */
       if (proccnttab != NULL) {                   /* If we are a receiver process, fill count and adjustment arrays           */
-        proccnttab[procrcvnum - procrcvbas] += vertsndnbr;
-        proccnttab[procsndnum - procrcvbas] -= vertsndnbr; /* Vertices are transferred between receiver processes */
+        procfldnum = ((procfldtab != NULL) ? procfldtab[procrcvnum] : procrcvnum) - procrcvbas;
+        proccnttab[procfldnum] += vertsndnbr;
+        proccnttab[((procfldtab != NULL) ? procfldtab[procsndnum] : procsndnum) - procrcvbas] -= vertsndnbr; /* Vertices are transferred between receiver processes */
         vertadjtab[procsndnum * commmax + 1] = grafptr->procvrttab[procsndnum] + grafptr->proccnttab[procsndnum] - vertsndnbr;
         vertdlttab[procsndnum * commmax + 1] = vertsndnbr;
         vertdlttab[procsndnum * commmax]    -= vertsndnbr;
-        vertprmtab[(procrcvnum - procrcvbas) * (commmax + 1) + 1] = procsndnum * commmax + 1;
+        vertprmtab[procfldnum * (commmax + 1) + 1] = procsndnum * commmax + 1;
 
         if (procsndnum == grafptr->proclocnum) {  /* If we are the sender receiver process */
           *commtypval = DGRAPHFOLDCOMMSEND | DGRAPHFOLDCOMMRECV; /* Indicate it            */
@@ -263,7 +322,9 @@ Gnum * restrict * restrict const              vertdltptr) /* Pointer to global d
             (flagrcvval < mesgrcvrmn)) ||         /* And receiver has space for larger messages to come        */
            ((flagrcvval == 0) &&                  /* Or if receiver has not received anything yet              */
             (flagsndval < (commmax - 2)))) &&     /* And sender has enough slots to send                       */
-          (vertrcvrmn >= procsrttab[procsndmnd].vertnbr)) { /* And if receiver can hold small message entirely */
+          (vertrcvrmn >= procsrttab[procsndmnd].vertnbr) && /* And if receiver can hold small message entirely  */
+          ((procnodtab == NULL) ||                /* And if small message does not cross node boundaries */
+           (procnodtab[procsrttab[procsndmnd].procnum] == procnodtab[procrcvnum]))) {
         procsndnxt = procsndidx;                  /* Current large message will be processed next time         */
         procsndidx = procsndmnd;                  /* Process smallest message available to date                */
         flagsndnxt = flagsndval;                  /* Record location of next message to send                   */
@@ -285,10 +346,11 @@ Gnum * restrict * restrict const              vertdltptr) /* Pointer to global d
 
       if (vertsndnbr > 0) {                       /* If useful communication can take place                         */
         if (proccnttab != NULL) {                 /* If we are a receiver process, fill count and adjustment arrays */
-          proccnttab[procrcvnum - procrcvbas] += vertsndnbr;
+          procfldnum = ((procfldtab != NULL) ? procfldtab[procrcvnum] : procrcvnum) - procrcvbas;
+          proccnttab[procfldnum] += vertsndnbr;
           vertadjtab[procsndnum * commmax + flagsndval] = grafptr->procvrttab[procsndnum] + grafptr->proccnttab[procsndnum] - vertsndrmn;
           vertdlttab[procsndnum * commmax + flagsndval] = vertsndnbr;
-          vertprmtab[(procrcvnum - procrcvbas) * (commmax + 1) + 1 + flagrcvval] = procsndnum * commmax + flagsndval;
+          vertprmtab[procfldnum * (commmax + 1) + 1 + flagrcvval] = procsndnum * commmax + flagsndval;
 
           if (procrcvnum == grafptr->proclocnum) { /* If we are the receiver process */
             commdattab[flagrcvval].procnum = procsndnum; /* Record communication     */
@@ -436,3 +498,205 @@ Gnum * restrict * restrict const              vertdltptr) /* Pointer to global d
 
   return (0);
 }
+
+/* This routine frees the node data cached
+** on a communicator, when the latter is freed.
+** It returns:
+** - MPI_SUCCESS  : in all cases.
+*/
+
+static
+int
+dgraphFoldCommNodeFree (
+MPI_Comm                    proccomm,             /*+ Communicator being freed; not used +*/
+int                         keyval,               /*+ Attribute key; not used            +*/
+void *                      attrptr,              /*+ Cached node data                   +*/
+void *                      extrptr)              /*+ Extra state; not used              +*/
+{
+  memFree (attrptr);
+
+  return (MPI_SUCCESS);
+}
+
+/* This routine computes the node data used for
+** node-aware folding, from the rank of the node
+** leader of each process, that is, the lowest
+** rank of the processes which belong to the same
+** node, and caches it on the communicator of the
+** graph, so that it is computed only once for all
+** the graphs which share this communicator. For
+** each process, the node data gives the index of
+** the node to which it belongs, in the first half
+** of the array, and its folding rank, in the second
+** half. Processes of folded part 0 have folding
+** ranks in the range [0, fldprocnbr[, and processes
+** of part 1 in the range [fldprocnbr, procglbnbr[.
+** The processes of each node are spread evenly
+** across both parts, in rank order, so that most
+** folding messages can remain within nodes. When
+** all processes belong to the same node, processes
+** are folded in rank order and no array is returned.
+** This routine is collective.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+dgraphFoldCommNode2 (
+const Dgraph * restrict const   grafptr,
+const int                       procldrnum,       /*+ Rank of node leader of local process +*/
+const int ** restrict const     procnodptr)       /*+ Pointer to cached node data array    +*/
+{
+  DgraphFoldCommNode * restrict nodeptr;
+  int                           procfldnbr;
+  int                           procnum;
+  int                           nodenbr;
+  int                           nodenum;
+  int * restrict                procnodtab;
+  int * restrict                procfldtab;
+  int * restrict                procsrttab;       /* Processes sorted by node index              */
+  int * restrict                nodedsptab;       /* Start index of node processes in sort array */
+  int                           cheklocval;
+  int                           chekglbval;
+
+  const int                     procglbnbr = grafptr->procglbnbr;
+
+  *procnodptr = NULL;                             /* Assume folding in rank order */
+
+  cheklocval = 0;
+#ifdef COMMON_PTHREAD
+  pthread_mutex_lock (&dgraphfoldcommnodemutedat);
+#endif /* COMMON_PTHREAD */
+  if ((dgraphfoldcommnodekey == MPI_KEYVAL_INVALID) && /* Create attribute key on first use */
+      (MPI_Comm_create_keyval (MPI_COMM_NULL_COPY_FN, dgraphFoldCommNodeFree, &dgraphfoldcommnodekey, NULL) != MPI_SUCCESS)) {
+    errorPrint ("dgraphFoldCommNode2: communication error (1)");
+    dgraphfoldcommnodekey = MPI_KEYVAL_INVALID;
+    cheklocval = 1;
+  }
+#ifdef COMMON_PTHREAD
+  pthread_mutex_unlock (&dgraphfoldcommnodemutedat);
+#endif /* COMMON_PTHREAD */
+
+  nodeptr = NULL;
+  if ((cheklocval == 0) &&
+      (memAllocGroup ((void **) (void *)
+                      &nodeptr,    (size_t) (sizeof (DgraphFoldCommNode)),
+                      &procnodtab, (size_t) (2 * procglbnbr * sizeof (int)), /* TRICK: procfldtab is second half of procnodtab */
+                      &procsrttab, (size_t) (procglbnbr       * sizeof (int)),
+                      &nodedsptab, (size_t) ((procglbnbr + 1) * sizeof (int)), NULL) == NULL)) {
+    errorPrint ("dgraphFoldCommNode2: out of memory");
+    cheklocval = 1;
+  }
+  if (MPI_Allreduce (&cheklocval, &chekglbval, 1, MPI_INT, MPI_MAX, grafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphFoldCommNode2: communication error (2)");
+    chekglbval = 1;
+  }
+  if ((chekglbval == 0) &&
+      (MPI_Allgather ((void *) &procldrnum, 1, MPI_INT, procnodtab, 1, MPI_INT, grafptr->proccomm) != MPI_SUCCESS)) {
+    errorPrint ("dgraphFoldCommNode2: communication error (3)");
+    chekglbval = 1;
+  }
+  if (chekglbval != 0) {
+    if (nodeptr != NULL)
+      memFree (nodeptr);                          /* Free group leader */
+    return (1);
+  }
+  procfldtab = procnodtab + procglbnbr;
+
+  memSet (nodedsptab, 0, (procglbnbr + 1) * sizeof (int));
+  for (procnum = nodenbr = 0; procnum < procglbnbr; procnum ++) { /* Compute node indices by ascending leader rank */
+    if (procnodtab[procnum] == procnum)           /* If process is node leader, create new node   */
+      procnodtab[procnum] = nodenbr ++;
+    else                                          /* Else leader of lower rank already processed  */
+      procnodtab[procnum] = procnodtab[procnodtab[procnum]];
+    nodedsptab[procnodtab[procnum] + 1] ++;       /* Count processes in node */
+  }
+
+  if (nodenbr > 1) {                              /* If processes are spread across several nodes */
+    for (nodenum = 1; nodenum <= nodenbr; nodenum ++) /* Accumulate node start indices */
+      nodedsptab[nodenum] += nodedsptab[nodenum - 1];
+    for (procnum = 0; procnum < procglbnbr; procnum ++) /* Sort processes by node index, then by rank */
+      procsrttab[nodedsptab[procnodtab[procnum]] ++] = procnum;
+
+    procfldnbr = (procglbnbr + 1) / 2;            /* Number of processes in part 0 */
+    for (procnum = 0; procnum < procglbnbr; procnum ++) /* Alternate sorted processes between both parts */
+      procfldtab[procsrttab[procnum]] = ((procnum & 1) == 0) ? (procnum / 2) : (procfldnbr + procnum / 2);
+
+    nodeptr->procnodtab = procnodtab;
+  }
+  else                                            /* All processes are on same node: fold in rank order */
+    nodeptr->procnodtab = NULL;
+
+  if (MPI_Comm_set_attr (grafptr->proccomm, dgraphfoldcommnodekey, nodeptr) != MPI_SUCCESS) { /* Replaces and frees any previous node data */
+    errorPrint ("dgraphFoldCommNode2: communication error (4)");
+    memFree    (nodeptr);
+    return     (1);
+  }
+
+  *procnodptr = nodeptr->procnodtab;
+
+  return (0);
+}
+
+/* This routine returns the node data used for
+** node-aware folding, which is cached on the
+** communicator of the graph. When it is not yet
+** present and node-aware folding is enabled,
+** it is computed from the shared-memory nodes
+** of the processes; else, processes are folded
+** in rank order and no array is returned. Since
+** node data is shared by all processes of the
+** communicator, all of them take the same path.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+dgraphFoldCommNode (
+const Dgraph * restrict const grafptr,
+const int ** restrict const   procnodptr)         /*+ Pointer to cached node data array +*/
+{
+  DgraphFoldCommNode *  nodeptr;
+  int                   nodekey;
+  int                   flagval;
+#ifdef SCOTCH_MPI_NODE_FOLD
+  MPI_Comm              nodecomm;                 /* Communicator of processes on same node */
+  int                   procldrnum;               /* Lowest rank of processes on same node  */
+#endif /* SCOTCH_MPI_NODE_FOLD */
+
+  *procnodptr = NULL;                             /* Assume folding in rank order */
+
+#ifdef COMMON_PTHREAD
+  pthread_mutex_lock (&dgraphfoldcommnodemutedat);
+#endif /* COMMON_PTHREAD */
+  nodekey = dgraphfoldcommnodekey;
+#ifdef COMMON_PTHREAD
+  pthread_mutex_unlock (&dgraphfoldcommnodemutedat);
+#endif /* COMMON_PTHREAD */
+
+  if (nodekey != MPI_KEYVAL_INVALID) {            /* If node data may have been cached */
+    if (MPI_Comm_get_attr (grafptr->proccomm, nodekey, &nodeptr, &flagval) != MPI_SUCCESS) {
+      errorPrint ("dgraphFoldCommNode: communication error (1)");
+      return     (1);
+    }
+    if (flagval != 0) {                           /* If node data already computed for this communicator */
+      *procnodptr = nodeptr->procnodtab;
+      return (0);
+    }
+  }
+
+#ifdef SCOTCH_MPI_NODE_FOLD
+  if ((MPI_Comm_split_type (grafptr->proccomm, MPI_COMM_TYPE_SHARED, grafptr->proclocnum, MPI_INFO_NULL, &nodecomm) != MPI_SUCCESS) ||
+      (MPI_Allreduce ((void *) &grafptr->proclocnum, &procldrnum, 1, MPI_INT, MPI_MIN, nodecomm) != MPI_SUCCESS) ||
+      (MPI_Comm_free (&nodecomm) != MPI_SUCCESS)) {
+    errorPrint ("dgraphFoldCommNode: communication error (2)");
+    return     (1);
+  }
+
+  return (dgraphFoldCommNode2 (grafptr, procldrnum, procnodptr));
+#else /* SCOTCH_MPI_NODE_FOLD */
+  return (0);
+#endif /* SCOTCH_MPI_NODE_FOLD */
+}
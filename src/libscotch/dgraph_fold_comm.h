@@ -43,6 +43,8 @@
 /**                                 to   : 19 aug 2006     **/
 /**                # Version 5.1  : from : 30 jul 2010     **/
 /**                                 to   : 03 jan 2011     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -75,8 +77,16 @@ typedef struct DgraphFoldCommData_ {
   Gnum             procnum;                       /* Processor index (Gnum for sorting) */
 } DgraphFoldCommData;
 
+/*+ Node data cached on communicators. +*/
+
+typedef struct DgraphFoldCommNode_ {
+  int *                     procnodtab;           /*+ Node indices and folding ranks, or NULL if rank order +*/
+} DgraphFoldCommNode;
+
 /*
 ** The function prototypes.
 */
 
-int                         dgraphFoldComm      (const Dgraph * restrict const, const int, int * restrict const, int * restrict const, DgraphFoldCommData * restrict * restrict const, Gnum * restrict * restrict const, Gnum * restrict const, int * restrict const, Gnum * restrict * restrict const, Gnum * restrict * restrict const);
+int                         dgraphFoldComm      (const Dgraph * restrict const, const int, const int * restrict const, int * restrict const, int * restrict const, DgraphFoldCommData * restrict * restrict const, Gnum * restrict * restrict const, Gnum * restrict const, int * restrict const, Gnum * restrict * restrict const, Gnum * restrict * restrict const);
+int                         dgraphFoldCommNode  (const Dgraph * restrict const, const int ** restrict const);
+int                         dgraphFoldCommNode2 (const Dgraph * restrict const, const int, const int ** restrict const);
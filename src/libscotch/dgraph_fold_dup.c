@@ -47,7 +47,7 @@
 /**                # Version 6.0  : from : 28 sep 2014     **/
 /**                                 to   : 28 sep 2014     **/
 /**                # Version 7.0  : from : 03 sep 2020     **/
-/**                                 to   : 03 sep 2020     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -57,6 +57,7 @@
 #include "module.h"
 #include "common.h"
 #include "dgraph.h"
+#include "dgraph_fold_comm.h"
 #include "dgraph_fold_dup.h"
 
 /******************************/
@@ -86,7 +87,7 @@ const DgraphFoldDupSplit * const  spltptr)
 {
   int                 o;
 
-  o = dgraphFold2 (spltptr->splttab[spltnum].orggrafptr, spltnum, spltptr->fldgrafptr,
+  o = dgraphFold2 (spltptr->splttab[spltnum].orggrafptr, spltnum, spltptr->procnodtab, spltptr->fldgrafptr,
                    spltptr->splttab[spltnum].fldproccomm, spltptr->orgdataptr, spltptr->flddataptr, spltptr->datatype);
 
   if (o != 0)
@@ -110,17 +111,23 @@ Context * restrict const      contptr)            /*+ Context
   int                 fldproccol;
   MPI_Comm            fldproccommtab[2];
   DgraphFoldDupSplit  fldspltdat;
+  const int *         procnodtab;                 /* Node data for node-aware folding */
   int                 o;
 
+  if (dgraphFoldCommNode (orggrafptr, &procnodtab) != 0) { /* Get node data cached on communicator, if any */
+    errorPrint ("dgraphFoldDup: cannot compute node data");
+    return (1);
+  }
+
   fldprocnbr = (orggrafptr->procglbnbr + 1) / 2;  /* Median cut on number of processors     */
-  if (orggrafptr->proclocnum < fldprocnbr) {      /* Compute color and rank in two subparts */
+  fldprocnum = (procnodtab != NULL) ? procnodtab[orggrafptr->procglbnbr + orggrafptr->proclocnum] : orggrafptr->proclocnum;
+  if (fldprocnum < fldprocnbr) {                  /* Compute color and rank in two subparts */
     fldproccol = 0;
-    fldprocnum = orggrafptr->proclocnum;
     fldproccommtab[1] = MPI_COMM_NULL;
   }
   else {
     fldproccol = 1;
-    fldprocnum = orggrafptr->proclocnum - fldprocnbr;
+    fldprocnum -= fldprocnbr;
     fldproccommtab[0] = MPI_COMM_NULL;
   }
   if (MPI_Comm_split (orggrafptr->proccomm, fldproccol, fldprocnum, &fldproccommtab[fldproccol]) != MPI_SUCCESS) {
@@ -135,6 +142,7 @@ Context * restrict const      contptr)            /*+ Context
   fldspltdat.flddataptr = flddataptr;
   fldspltdat.fldgrafptr = fldgrafptr;
   fldspltdat.datatype   = datatype;
+  fldspltdat.procnodtab = procnodtab;
   fldspltdat.revaptr    = &o;
 
   o = 0;                                          /* Assume splitting will go well */
@@ -46,7 +46,7 @@
 /**                # Version 6.0  : from : 28 sep 2014     **/
 /**                                 to   : 07 jun 2018     **/
 /**                # Version 7.0  : from : 26 sep 2021     **/
-/**                                 to   : 09 oct 2021     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -67,6 +67,7 @@ typedef struct DgraphFoldDupSplit_ {
   Dgraph *                  fldgrafptr;           /*+ Pointer to folded graph                       +*/
   void *                    flddataptr;           /*+ Data associated to vertices, e.g. coarmulttab +*/
   MPI_Datatype              datatype;             /*+ MPI type of associated information            +*/
+  const int *               procnodtab;           /*+ Node data for node-aware folding, or NULL     +*/
   int *                     revaptr;              /*+ Pointer to return value                       +*/
 } DgraphFoldDupSplit;
 
@@ -53,6 +53,8 @@
 /**                                 to   : 20 feb 2011     **/
 /**                # Version 6.0  : from : 21 nov 2011     **/
 /**                                 to   : 21 nov 2011     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -231,7 +233,7 @@ const int                   flagval)              /* Replacement flag */
     Gnum                vertgstbas;               /* Number of current ghost vertex */
     int                 procngbnum;
 
-    intSort2asc1 (sortloctab, sortlocnbr);        /* Sort them by ascending end vertex */
+    intRsort2asc1 (sortloctab, sortlocnbr, NULL); /* Sort them by ascending end vertex */
 
     sortlocnum = 0;                               /* Start adjacency search from beginning               */
     procngbnum = -1;                              /* Start neighbor search from begnning                 */
@@ -0,0 +1,897 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : dgraph_io_bin.c                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module handles the binary distri-  **/
+/**                buted source graph format, the blocks   **/
+/**                of which can be read back on any number **/
+/**                of processes.                           **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define DGRAPH_IO_BIN
+
+#include "module.h"
+#include "common.h"
+#include "graph.h"
+#include "graph_io_bin.h"
+#include "dgraph.h"
+#include "dgraph_io_bin.h"
+
+#include <sys/stat.h>
+
+/*****************************************/
+/*                                       */
+/* These routines handle binary distri-  */
+/* buted source graph loading.           */
+/*                                       */
+/*****************************************/
+
+/* This routine moves forward in the given
+** stream, up to the given offset. Streams
+** which cannot seek, such as pipes, are
+** read through.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+dgraphLoadBinSeek (
+DgraphBinFile * const       fileptr,
+FILE * const                stream,
+const UINT64                fileoft)              /* Offset to reach in stream */
+{
+  if (fileoft < fileptr->fileoft)                 /* Streams are only read forward */
+    return (1);
+
+  if ((fileoft > fileptr->fileoft) &&
+      (fseeko (stream, (off_t) (fileoft - fileptr->fileoft), SEEK_CUR) != 0)) { /* If stream cannot seek, read through it */
+    UINT64              fileoft2;
+
+    for (fileoft2 = fileptr->fileoft; fileoft2 < fileoft; fileoft2 ++) {
+      if (getc (stream) == EOF)
+        return (1);
+    }
+  }
+  fileptr->fileoft = fileoft;
+
+  return (0);
+}
+
+/* This routine reads an array of Gnum
+** values at the given offset of the
+** given stream.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+dgraphLoadBinRead (
+DgraphBinFile * const       fileptr,
+FILE * const                stream,
+const UINT64                fileoft,              /* Offset of array slice in stream */
+Gnum * const                datatab,
+const Gnum                  datanbr)
+{
+  if ((dgraphLoadBinSeek (fileptr, stream, fileoft) != 0) ||
+      (fread (datatab, sizeof (Gnum), (size_t) datanbr, stream) != (size_t) datanbr))
+    return (1);
+
+  fileptr->fileoft += (UINT64) datanbr * sizeof (Gnum);
+
+  return (0);
+}
+
+/* This routine reads the header and the
+** block index of a binary graph file, the
+** magic string of which has not yet been
+** read. Binary centralized graph files are
+** accepted as single-block files. The block
+** index, if not NULL, must be freed by the
+** caller, even on error.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+dgraphLoadBinHead (
+DgraphBinFile * const       fileptr,
+FILE * const                stream)
+{
+  char                magitab[GRAPHBINMAGICSIZ];
+  UINT64              endival;
+  UINT64              versval;
+  UINT64              gnumsiz;
+  UINT64              vertglbnbr;
+  UINT64              edgeglbnbr;
+  UINT64              baseval;
+  UINT64              filesiz;
+  UINT64              blocoft;
+  UINT64              vertsum;
+  UINT64              edgesum;
+  Gnum                blocnum;
+
+  fileptr->bloctab = NULL;
+
+  if (fread (magitab, GRAPHBINMAGICSIZ, 1, stream) != 1) {
+    errorPrint ("dgraphLoadBinHead: bad input (1)");
+    return     (1);
+  }
+  if (memcmp (magitab, GRAPHBINMAGIC, GRAPHBINMAGICSIZ) == 0) { /* If binary centralized graph file */
+    GraphBinHead        headdat;
+
+    if (fread (headdat.magitab + GRAPHBINMAGICSIZ, sizeof (GraphBinHead) - GRAPHBINMAGICSIZ, 1, stream) != 1) {
+      errorPrint ("dgraphLoadBinHead: bad input (2)");
+      return     (1);
+    }
+    endival    = headdat.endival;
+    versval    = (headdat.versval == GRAPHBINVERSION) ? DGRAPHBINVERSION : ~DGRAPHBINVERSION;
+    gnumsiz    = headdat.gnumsiz;
+    vertglbnbr = headdat.vertnbr;
+    edgeglbnbr = headdat.edgenbr;
+    baseval    = headdat.baseval;
+    filesiz    = headdat.filesiz;
+    fileptr->propval = headdat.propval;
+    fileptr->blocnbr = 1;
+    fileptr->fileoft = sizeof (GraphBinHead);
+  }
+  else if (memcmp (magitab, DGRAPHBINMAGIC, GRAPHBINMAGICSIZ) == 0) { /* If binary distributed graph file */
+    DgraphBinHead       headdat;
+
+    if (fread (headdat.magitab + GRAPHBINMAGICSIZ, sizeof (DgraphBinHead) - GRAPHBINMAGICSIZ, 1, stream) != 1) {
+      errorPrint ("dgraphLoadBinHead: bad input (3)");
+      return     (1);
+    }
+    endival    = headdat.endival;
+    versval    = headdat.versval;
+    gnumsiz    = headdat.gnumsiz;
+    vertglbnbr = headdat.vertglbnbr;
+    edgeglbnbr = headdat.edgeglbnbr;
+    baseval    = headdat.baseval;
+    filesiz    = headdat.filesiz;
+    fileptr->propval = headdat.propval;
+    fileptr->blocnbr = ((headdat.blocnbr > 0) && (headdat.blocnbr <= (UINT64) GNUMMAX)) ? (Gnum) headdat.blocnbr : 0;
+    fileptr->fileoft = sizeof (DgraphBinHead);
+  }
+  else {
+    errorPrint ("dgraphLoadBinHead: bad input (4)");
+    return     (1);
+  }
+  if (endival != GRAPHBINENDIVAL) {
+    errorPrint ("dgraphLoadBinHead: invalid byte order");
+    return     (1);
+  }
+  if (versval != DGRAPHBINVERSION) {
+    errorPrint ("dgraphLoadBinHead: unsupported format version");
+    return     (1);
+  }
+  if (gnumsiz != sizeof (Gnum)) {
+    errorPrint ("dgraphLoadBinHead: integer size mismatch");
+    return     (1);
+  }
+  if ((vertglbnbr > (UINT64) GNUMMAX) ||
+      (edgeglbnbr > (UINT64) GNUMMAX) ||
+      (baseval    > (UINT64) GNUMMAX) ||
+      (fileptr->blocnbr == 0)) {
+    errorPrint ("dgraphLoadBinHead: bad input (5)");
+    return     (1);
+  }
+  fileptr->vertglbnbr = (Gnum) vertglbnbr;
+  fileptr->edgeglbnbr = (Gnum) edgeglbnbr;
+  fileptr->baseval    = (Gnum) baseval;
+
+  if ((fileptr->bloctab = memAlloc (fileptr->blocnbr * sizeof (DgraphBinBlock))) == NULL) {
+    errorPrint ("dgraphLoadBinHead: out of memory");
+    return     (1);
+  }
+  if (memcmp (magitab, GRAPHBINMAGIC, GRAPHBINMAGICSIZ) == 0) { /* If centralized file, build single block */
+    fileptr->bloctab[0].vertnbr = vertglbnbr;
+    fileptr->bloctab[0].edgenbr = edgeglbnbr;
+    fileptr->bloctab[0].blocoft = GRAPHBINHEADSIZ;
+  }
+  else {
+    if ((dgraphLoadBinSeek (fileptr, stream, GRAPHBINHEADSIZ) != 0) || /* Read block index */
+        (fread (fileptr->bloctab, sizeof (DgraphBinBlock), (size_t) fileptr->blocnbr, stream) != (size_t) fileptr->blocnbr)) {
+      errorPrint ("dgraphLoadBinHead: bad input (6)");
+      return     (1);
+    }
+    fileptr->fileoft += (UINT64) fileptr->blocnbr * sizeof (DgraphBinBlock);
+  }
+
+  for (blocnum = 0, vertsum = edgesum = 0, blocoft = fileptr->bloctab[0].blocoft; /* Check consistency of block index */
+       blocnum < fileptr->blocnbr; blocnum ++) {
+    const DgraphBinBlock * restrict blocptr;
+    GraphBinLayout                  layodat;
+
+    blocptr = &fileptr->bloctab[blocnum];
+    if ((blocptr->blocoft != blocoft)                  ||
+        (blocptr->vertnbr > (vertglbnbr - vertsum)) ||
+        (blocptr->edgenbr > (edgeglbnbr - edgesum))) {
+      errorPrint ("dgraphLoadBinHead: bad input (7)");
+      return     (1);
+    }
+    vertsum += blocptr->vertnbr;
+    edgesum += blocptr->edgenbr;
+    graphBinLayout (&layodat, blocoft, (Gnum) blocptr->vertnbr, (Gnum) blocptr->edgenbr, fileptr->propval);
+    blocoft = layodat.filesiz;
+  }
+  if ((vertsum != vertglbnbr) ||
+      (edgesum != edgeglbnbr) ||
+      (blocoft != filesiz)    ||
+      (fileptr->bloctab[0].blocoft < fileptr->fileoft)) {
+    errorPrint ("dgraphLoadBinHead: bad input (8)");
+    return     (1);
+  }
+
+  return (0);
+}
+
+/* This routine reads the given range of
+** vertices of a binary graph file, along
+** with their adjacency. The range may span
+** several blocks, which are read in order.
+** Vertex arrays are provided by the caller,
+** while edge arrays are allocated, and must
+** be freed by the caller, even on error.
+** Edge ends and vertex indices are given
+** the requested base value.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+dgraphLoadBinRange (
+DgraphBinFile * const       fileptr,
+FILE * const                stream,
+const Gnum                  vertfrst,             /* Un-based index of first vertex to read    */
+const Gnum                  vertnbr,              /* Number of vertices to read                */
+const Gnum                  baseval,              /* Base value of arrays to fill              */
+Gnum * const                verttab,              /* Un-based vertex array, of size vertnbr + 1 */
+Gnum * const                velotab,              /* Vertex load array, if wanted              */
+Gnum * const                vlbltab,              /* Vertex label array, if wanted             */
+Gnum ** const               edgeptr,              /* Pointer to edge array to allocate         */
+Gnum ** const               edloptr,              /* Pointer to edge load array, if wanted     */
+Gnum * const                edgenbrptr,           /* Pointer to number of arcs read            */
+Gnum * const                degrmaxptr)           /* Pointer to maximum degree of range        */
+{
+  Gnum * restrict     edgetab;
+  Gnum * restrict     edlotab;
+  Gnum                blocnum;
+  Gnum                vertbas;                    /* Un-based index of first vertex of block */
+  Gnum                vertnum;                    /* Number of vertices already read         */
+  Gnum                edgenum;                    /* Number of arcs already read             */
+  Gnum                degrmax;
+
+  edlotab = NULL;
+  if (((edgetab = memAlloc (sizeof (Gnum))) == NULL) || /* Edge arrays will grow block by block */
+      ((edloptr != NULL) && ((edlotab = memAlloc (sizeof (Gnum))) == NULL))) {
+    errorPrint ("dgraphLoadBinRange: out of memory (1)");
+    if (edgetab != NULL)
+      memFree (edgetab);
+    *edgeptr = NULL;
+    return (1);
+  }
+  *edgeptr = edgetab;
+  if (edloptr != NULL)
+    *edloptr = edlotab;
+
+  for (blocnum = vertbas = vertnum = edgenum = degrmax = 0;
+       (vertnum < vertnbr) && (blocnum < fileptr->blocnbr);
+       vertbas += (Gnum) fileptr->bloctab[blocnum ++].vertnbr) {
+    const DgraphBinBlock * restrict blocptr;
+    GraphBinLayout                  layodat;
+    Gnum                            vertoft;      /* Index of first vertex to read in block */
+    Gnum                            vertcnt;      /* Number of vertices to read in block    */
+    Gnum                            vertidx;
+    Gnum                            edgeoft;      /* Index of first arc to read in block    */
+    Gnum                            edgecnt;      /* Number of arcs to read in block        */
+    Gnum                            edgeadj;
+    Gnum                            edgeidx;
+
+    blocptr = &fileptr->bloctab[blocnum];
+    vertoft = vertfrst + vertnum - vertbas;
+    if (vertoft >= (Gnum) blocptr->vertnbr)       /* If block is before range, skip it */
+      continue;
+    vertcnt = MIN ((Gnum) blocptr->vertnbr - vertoft, vertnbr - vertnum);
+
+    graphBinLayout (&layodat, blocptr->blocoft, (Gnum) blocptr->vertnbr, (Gnum) blocptr->edgenbr, fileptr->propval);
+    if (dgraphLoadBinRead (fileptr, stream, layodat.vertoft + (UINT64) vertoft * sizeof (Gnum), verttab + vertnum, vertcnt + 1) != 0) {
+      errorPrint ("dgraphLoadBinRange: bad input (1)");
+      return     (1);
+    }
+    edgeoft = verttab[vertnum] - fileptr->baseval;
+    edgecnt = verttab[vertnum + vertcnt] - verttab[vertnum];
+    if ((edgeoft < 0) || (edgecnt < 0) ||
+        (edgecnt > ((Gnum) blocptr->edgenbr - edgeoft))) {
+      errorPrint ("dgraphLoadBinRange: bad input (2)");
+      return     (1);
+    }
+    edgeadj = edgenum - edgeoft + baseval - fileptr->baseval; /* Turn block indices into range indices */
+    for (vertidx = vertnum; vertidx < (vertnum + vertcnt); vertidx ++) {
+      Gnum                degrval;
+
+      degrval = verttab[vertidx + 1] - verttab[vertidx];
+      if (degrval < 0) {
+        errorPrint ("dgraphLoadBinRange: bad input (3)");
+        return     (1);
+      }
+      if (degrmax < degrval)
+        degrmax = degrval;
+      verttab[vertidx] += edgeadj;
+    }
+
+    if ((velotab != NULL) &&
+        (dgraphLoadBinRead (fileptr, stream, layodat.velooft + (UINT64) vertoft * sizeof (Gnum), velotab + vertnum, vertcnt) != 0)) {
+      errorPrint ("dgraphLoadBinRange: bad input (4)");
+      return     (1);
+    }
+    if ((vlbltab != NULL) &&
+        (dgraphLoadBinRead (fileptr, stream, layodat.vlbloft + (UINT64) vertoft * sizeof (Gnum), vlbltab + vertnum, vertcnt) != 0)) {
+      errorPrint ("dgraphLoadBinRange: bad input (5)");
+      return     (1);
+    }
+
+    if (edgecnt > 0) {
+      Gnum * restrict     edgetmp;
+
+      if ((edgetmp = memRealloc (edgetab, (edgenum + edgecnt) * sizeof (Gnum))) == NULL) {
+        errorPrint ("dgraphLoadBinRange: out of memory (2)");
+        return     (1);
+      }
+      *edgeptr = edgetab = edgetmp;
+      if (dgraphLoadBinRead (fileptr, stream, layodat.edgeoft + (UINT64) edgeoft * sizeof (Gnum), edgetab + edgenum, edgecnt) != 0) {
+        errorPrint ("dgraphLoadBinRange: bad input (6)");
+        return     (1);
+      }
+      for (edgeidx = edgenum; edgeidx < (edgenum + edgecnt); edgeidx ++) {
+        Gnum                vertend;
+
+        vertend = edgetab[edgeidx] - fileptr->baseval;
+        if ((vertend < 0) || (vertend >= fileptr->vertglbnbr)) {
+          errorPrint ("dgraphLoadBinRange: bad input (7)");
+          return     (1);
+        }
+        edgetab[edgeidx] = vertend + baseval;
+      }
+
+      if (edlotab != NULL) {
+        if ((edgetmp = memRealloc (edlotab, (edgenum + edgecnt) * sizeof (Gnum))) == NULL) {
+          errorPrint ("dgraphLoadBinRange: out of memory (3)");
+          return     (1);
+        }
+        *edloptr = edlotab = edgetmp;
+        if (dgraphLoadBinRead (fileptr, stream, layodat.edlooft + (UINT64) edgeoft * sizeof (Gnum), edlotab + edgenum, edgecnt) != 0) {
+          errorPrint ("dgraphLoadBinRange: bad input (8)");
+          return     (1);
+        }
+      }
+    }
+
+    vertnum += vertcnt;
+    edgenum += edgecnt;
+  }
+  if (vertnum < vertnbr) {
+    errorPrint ("dgraphLoadBinRange: bad input (9)");
+    return     (1);
+  }
+  verttab[vertnbr] = edgenum + baseval;           /* Set end of edge array */
+
+  *edgenbrptr = edgenum;
+  *degrmaxptr = degrmax;
+
+  return (0);
+}
+
+/* This routine loads a distributed source
+** graph from a binary graph file, either
+** distributed or centralized. When all
+** processes hold a stream to the file, each
+** of them only reads the blocks which hold
+** its share of vertices, whatever the number
+** of processes which wrote the file. When
+** only the root process holds a stream, it
+** reads the whole graph and scatters it.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+dgraphLoadBin (
+Dgraph * restrict const     grafptr,              /* Distributed graph to load                   */
+FILE * const                stream,               /* Stream, or NULL for non-root processes      */
+Gnum                        baseval,              /* Base value (-1 means keep file base)        */
+const DgraphFlag            flagval,              /* Graph loading flags                         */
+const int                   protnum)              /* Root process number, or -1 if all streams   */
+{
+  DgraphBinFile       filedat;
+  Gnum                vertlocnbr;
+  Gnum * restrict     vertloctab;
+  Gnum * restrict     velotab;
+  Gnum * restrict     vlbltab;
+  Gnum                velosiz;
+  Gnum                vlblsiz;
+  Gnum                velolocsum;
+  Gnum                edgelocnbr;
+  Gnum *              edgeloctab;
+  Gnum *              edloloctab;
+  Gnum                degrlocmax;
+  Gnum                reduloctab[9];
+  Gnum                reduglbtab[9];
+  int                 o;
+
+  velotab    =
+  vlbltab    =
+  vertloctab =
+  edgeloctab =
+  edloloctab = NULL;
+  vertlocnbr =                                    /* Processes without a stream hold no vertices */
+  edgelocnbr =
+  degrlocmax =
+  velolocsum = 0;
+  memSet (reduloctab, 0, 9 * sizeof (Gnum));      /* Assume everything will be fine */
+  if (stream != NULL) {                           /* Non-root processes have nothing to read */
+    Gnum                vertlocbas;
+
+    if (dgraphLoadBinHead (&filedat, stream) != 0)
+      reduloctab[0] = 1;
+    else {
+      reduloctab[1] =   filedat.vertglbnbr;       /* Exchange header values to check they are the same for all */
+      reduloctab[2] = - filedat.vertglbnbr;
+      reduloctab[3] =   filedat.edgeglbnbr;
+      reduloctab[4] = - filedat.edgeglbnbr;
+      reduloctab[5] =   (Gnum) filedat.propval;
+      reduloctab[6] = - (Gnum) filedat.propval;
+      reduloctab[7] =   filedat.baseval;
+      reduloctab[8] = - filedat.baseval;
+
+      if (baseval == -1)                          /* If keep file graph base */
+        baseval = filedat.baseval;
+      if (protnum < 0) {                          /* If all processes read their share of vertices */
+        vertlocnbr = DATASIZE (filedat.vertglbnbr, grafptr->procglbnbr, grafptr->proclocnum);
+        vertlocbas = DATASCAN (filedat.vertglbnbr, grafptr->procglbnbr, grafptr->proclocnum);
+      }
+      else {                                      /* Else root process reads all vertices */
+        vertlocnbr = filedat.vertglbnbr;
+        vertlocbas = 0;
+      }
+
+      velosiz = (((filedat.propval & GRAPHBINHASVELO) != 0) && ((flagval & GRAPHIONOLOADVERT) == 0)) ? vertlocnbr : 0;
+      vlblsiz = ((filedat.propval & GRAPHBINHASVLBL) != 0) ? vertlocnbr : 0;
+      if (memAllocGroup ((void **) (void *)
+                         &vertloctab, (size_t) ((vertlocnbr + 1) * sizeof (Gnum)),
+                         &velotab,    (size_t) (velosiz          * sizeof (Gnum)),
+                         &vlbltab,    (size_t) (vlblsiz          * sizeof (Gnum)), NULL) == NULL) {
+        errorPrint ("dgraphLoadBin: out of memory");
+        reduloctab[0] = 1;
+      }
+      else {
+        if (velosiz == 0)
+          velotab = NULL;
+        if (vlblsiz == 0)
+          vlbltab = NULL;
+        reduloctab[0] = dgraphLoadBinRange (&filedat, stream, vertlocbas, vertlocnbr, baseval,
+                                            vertloctab, velotab, vlbltab, &edgeloctab,
+                                            (((filedat.propval & GRAPHBINHASEDLO) != 0) && ((flagval & GRAPHIONOLOADEDGE) == 0)) ? &edloloctab : NULL,
+                                            &edgelocnbr, &degrlocmax);
+
+        velolocsum = vertlocnbr;
+        if (velotab != NULL) {
+          Gnum                vertlocnum;
+
+          for (vertlocnum = 0, velolocsum = 0; vertlocnum < vertlocnbr; vertlocnum ++)
+            velolocsum += velotab[vertlocnum];
+        }
+      }
+    }
+    if (filedat.bloctab != NULL)
+      memFree (filedat.bloctab);
+  }
+
+  if (protnum < 0) {                              /* If all processes have a stream */
+    if (MPI_Allreduce (reduloctab, reduglbtab, 9, GNUM_MPI, MPI_MAX, grafptr->proccomm) != MPI_SUCCESS) {
+      errorPrint ("dgraphLoadBin: communication error (1)");
+      reduglbtab[0] = 1;
+    }
+    else if ((reduglbtab[0] == 0) &&
+             ((reduglbtab[1] != - reduglbtab[2]) ||
+              (reduglbtab[3] != - reduglbtab[4]) ||
+              (reduglbtab[5] != - reduglbtab[6]) ||
+              (reduglbtab[7] != - reduglbtab[8]))) {
+      errorPrint ("dgraphLoadBin: inconsistent graph files");
+      reduglbtab[0] = 1;
+    }
+  }
+  else {
+    reduglbtab[0] = reduloctab[0];
+    if (MPI_Bcast (reduglbtab, 1, GNUM_MPI, protnum, grafptr->proccomm) != MPI_SUCCESS) {
+      errorPrint ("dgraphLoadBin: communication error (2)");
+      reduglbtab[0] = 1;
+    }
+  }
+  if (reduglbtab[0] != 0) {
+    if (edloloctab != NULL)
+      memFree (edloloctab);
+    if (edgeloctab != NULL)
+      memFree (edgeloctab);
+    if (vertloctab != NULL)
+      memFree (vertloctab);
+    return (1);
+  }
+
+  if (protnum < 0) {                              /* If local share read, build distributed graph */
+    o = dgraphBuild2 (grafptr, baseval,
+                      vertlocnbr, vertlocnbr, vertloctab - baseval, vertloctab + 1 - baseval,
+                      (velotab != NULL) ? (velotab - baseval) : NULL, velolocsum, NULL, NULL,
+                      edgelocnbr, edgelocnbr, edgeloctab - baseval, NULL,
+                      (edloloctab != NULL) ? (edloloctab - baseval) : NULL, degrlocmax);
+    grafptr->flagval   |= DGRAPHFREETABS | DGRAPHVERTGROUP; /* Edge arrays are not grouped                  */
+    grafptr->vlblloctax = (vlbltab != NULL) ? (vlbltab - baseval) : NULL; /* Edge ends are not labels, so add labels afterwards */
+  }
+  else {                                          /* Else scatter graph read by root process */
+    Graph               cgrfdat;
+
+    if (stream != NULL) {
+      Gnum                edgenum;
+
+      cgrfdat.flagval = GRAPHFREETABS | GRAPHVERTGROUP; /* Edge arrays are not grouped */
+      cgrfdat.baseval = baseval;
+      cgrfdat.vertnbr = vertlocnbr;
+      cgrfdat.vertnnd = vertlocnbr + baseval;
+      cgrfdat.verttax = vertloctab - baseval;
+      cgrfdat.vendtax = cgrfdat.verttax + 1;
+      cgrfdat.velotax = (velotab != NULL) ? (velotab - baseval) : NULL;
+      cgrfdat.velosum = velolocsum;
+      cgrfdat.vnumtax = NULL;
+      cgrfdat.vlbltax = (vlbltab != NULL) ? (vlbltab - baseval) : NULL;
+      cgrfdat.edgenbr = edgelocnbr;
+      cgrfdat.edgetax = edgeloctab - baseval;
+      cgrfdat.edlotax = (edloloctab != NULL) ? (edloloctab - baseval) : NULL;
+      cgrfdat.edlosum = edgelocnbr;
+      cgrfdat.degrmax = degrlocmax;
+      if (edloloctab != NULL) {
+        for (edgenum = 0, cgrfdat.edlosum = 0; edgenum < edgelocnbr; edgenum ++)
+          cgrfdat.edlosum += edloloctab[edgenum];
+      }
+    }
+
+    o = dgraphScatter (grafptr, (stream != NULL) ? &cgrfdat : NULL);
+
+    if (stream != NULL)
+      graphExit (&cgrfdat);
+  }
+
+  return (o);
+}
+
+/*****************************************/
+/*                                       */
+/* This routine handles binary distri-   */
+/* buted source graph saving.            */
+/*                                       */
+/*****************************************/
+
+/* This routine writes the header, block
+** index and blocks of a binary distributed
+** graph file, each process writing its own
+** block to the shared file, the header of
+** which is at the given position.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+dgraphSaveBin2 (
+Dgraph * restrict const     grafptr,
+FILE * const                stream,
+const off_t                 headpos)              /* Position of file header in stream */
+{
+  Graph               grafdat;                    /* Centralized view of local block      */
+  GraphBinLayout      layodat;
+  DgraphBinHead       headdat;
+  DgraphBinBlock *    bloctab;                    /* Block index, on all processes        */
+  Gnum *              edgeloctab;                 /* Number of arcs of all blocks         */
+  Gnum *              vnumgsttab;                 /* Global compact numbers of ghost vertices */
+  Gnum * restrict     edgetmptax;                 /* Compact edge array if holes in graph     */
+  UINT64              blocoft;
+  UINT64              dataoft;
+  int                 procnum;
+  int                 cheklocval;
+  int                 chekglbval;
+  int                 o;
+
+  bloctab    = NULL;
+  vnumgsttab =
+  edgetmptax = NULL;
+  cheklocval = 0;
+  if ((grafptr->edgeloctax == NULL) ||            /* If no global index edge array present or */
+      (grafptr->procvrttab[grafptr->procglbnbr] != grafptr->procdsptab[grafptr->procglbnbr])) { /* If graph may have holes in its numbering */
+    if (dgraphGhst (grafptr) != 0) {              /* Compute ghost edge array */
+      errorPrint ("dgraphSaveBin2: cannot compute ghost edge array");
+      cheklocval = 1;
+    }
+    else if (memAllocGroup ((void **) (void *)
+                            &vnumgsttab, (size_t) (grafptr->vertgstnbr * sizeof (Gnum)),
+                            &edgetmptax, (size_t) (grafptr->edgelocsiz * sizeof (Gnum)), NULL) == NULL) {
+      errorPrint ("dgraphSaveBin2: out of memory (1)");
+      cheklocval = 1;
+    }
+  }
+  if (memAllocGroup ((void **) (void *)
+                     &bloctab,    (size_t) (grafptr->procglbnbr * sizeof (DgraphBinBlock)),
+                     &edgeloctab, (size_t) (grafptr->procglbnbr * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("dgraphSaveBin2: out of memory (2)");
+    cheklocval = 1;
+  }
+  if (MPI_Allreduce (&cheklocval, &chekglbval, 1, MPI_INT, MPI_MAX, grafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphSaveBin2: communication error (1)");
+    chekglbval = 1;
+  }
+  if ((chekglbval == 0) && (vnumgsttab != NULL)) { /* Same condition on all processes as for dgraphGhst () */
+    Gnum * restrict     vnumgsttax;
+    Gnum                vertlocnum;
+
+    for (vertlocnum = 0; vertlocnum < grafptr->vertlocnbr; vertlocnum ++)
+      vnumgsttab[vertlocnum] = grafptr->procdsptab[grafptr->proclocnum] + vertlocnum;
+    if (dgraphHaloSync (grafptr, (byte *) vnumgsttab, GNUM_MPI) != 0) {
+      errorPrint ("dgraphSaveBin2: cannot halo vertex numbers");
+      cheklocval = 1;
+    }
+    else {
+      vnumgsttax  = vnumgsttab - grafptr->baseval;
+      edgetmptax -= grafptr->baseval;
+
+      for (vertlocnum = grafptr->baseval; vertlocnum < grafptr->vertlocnnd; vertlocnum ++) {
+        Gnum                edgelocnum;
+
+        for (edgelocnum = grafptr->vertloctax[vertlocnum];
+             edgelocnum < grafptr->vendloctax[vertlocnum]; edgelocnum ++)
+          edgetmptax[edgelocnum] = vnumgsttax[grafptr->edgegsttax[edgelocnum]];
+      }
+    }
+    if (MPI_Allreduce (&cheklocval, &chekglbval, 1, MPI_INT, MPI_MAX, grafptr->proccomm) != MPI_SUCCESS) {
+      errorPrint ("dgraphSaveBin2: communication error (2)");
+      chekglbval = 1;
+    }
+  }
+  if ((chekglbval == 0) &&
+      (MPI_Allgather (&grafptr->edgelocnbr, 1, GNUM_MPI, edgeloctab, 1, GNUM_MPI, grafptr->proccomm) != MPI_SUCCESS)) {
+    errorPrint ("dgraphSaveBin2: communication error (3)");
+    chekglbval = 1;
+  }
+  if (chekglbval != 0) {
+    if (bloctab != NULL)
+      memFree (bloctab);
+    if (vnumgsttab != NULL)
+      memFree (vnumgsttab);
+    return (1);
+  }
+
+  memSet (&headdat, 0, sizeof (DgraphBinHead));   /* Do not output uninitialized padding */
+  memCpy (headdat.magitab, DGRAPHBINMAGIC, GRAPHBINMAGICSIZ);
+  headdat.endival    = GRAPHBINENDIVAL;
+  headdat.versval    = DGRAPHBINVERSION;
+  headdat.gnumsiz    = sizeof (Gnum);
+  headdat.propval    = ((grafptr->vlblloctax != NULL) ? GRAPHBINHASVLBL : 0) |
+                       ((grafptr->edloloctax != NULL) ? GRAPHBINHASEDLO : 0) |
+                       ((grafptr->veloloctax != NULL) ? GRAPHBINHASVELO : 0);
+  headdat.baseval    = (UINT64) grafptr->baseval;
+  headdat.vertglbnbr = (UINT64) grafptr->vertglbnbr;
+  headdat.edgeglbnbr = (UINT64) grafptr->edgeglbnbr;
+  headdat.degrglbmax = (UINT64) grafptr->degrglbmax;
+  headdat.blocnbr    = (UINT64) grafptr->procglbnbr;
+
+  for (procnum = 0, blocoft = GRAPHBINALIGN (GRAPHBINHEADSIZ + grafptr->procglbnbr * sizeof (DgraphBinBlock)); /* Compute block offsets */
+       procnum < grafptr->procglbnbr; procnum ++) {
+    bloctab[procnum].vertnbr = (UINT64) grafptr->proccnttab[procnum];
+    bloctab[procnum].edgenbr = (UINT64) edgeloctab[procnum];
+    bloctab[procnum].blocoft = blocoft;
+    graphBinLayout (&layodat, blocoft, grafptr->proccnttab[procnum], edgeloctab[procnum], headdat.propval);
+    blocoft = layodat.filesiz;
+  }
+  headdat.filesiz = blocoft;
+
+  o = 0;
+  if (grafptr->proclocnum == 0) {                 /* First process writes header and block index */
+    o = (fseeko (stream, headpos, SEEK_SET) != 0) ||
+        (fwrite (&headdat, sizeof (DgraphBinHead), 1, stream) != 1);
+    for (dataoft = sizeof (DgraphBinHead); (o == 0) && (dataoft < GRAPHBINHEADSIZ); dataoft ++)
+      o = (putc (0, stream) == EOF);
+    o |= (fwrite (bloctab, sizeof (DgraphBinBlock), grafptr->procglbnbr, stream) != (size_t) grafptr->procglbnbr);
+    for (dataoft += grafptr->procglbnbr * sizeof (DgraphBinBlock); (o == 0) && (dataoft < bloctab[0].blocoft); dataoft ++)
+      o = (putc (0, stream) == EOF);
+  }
+
+  graphBinLayout (&layodat, bloctab[grafptr->proclocnum].blocoft, grafptr->vertlocnbr, grafptr->edgelocnbr, headdat.propval);
+  grafdat.flagval = GRAPHNONE;                    /* Local block is written as a centralized graph */
+  grafdat.baseval = grafptr->baseval;
+  grafdat.vertnbr = grafptr->vertlocnbr;
+  grafdat.vertnnd = grafptr->vertlocnnd;
+  grafdat.verttax = grafptr->vertloctax;
+  grafdat.vendtax = grafptr->vendloctax;
+  grafdat.velotax = grafptr->veloloctax;
+  grafdat.vlbltax = grafptr->vlblloctax;
+  grafdat.edgenbr = grafptr->edgelocnbr;
+  grafdat.edgetax = (edgetmptax != NULL) ? edgetmptax : grafptr->edgeloctax;
+  grafdat.edlotax = grafptr->edloloctax;
+  if (o == 0)
+    o = (fseeko (stream, headpos + (off_t) layodat.vertoft, SEEK_SET) != 0) ||
+        (graphSaveBin2 (&grafdat, &layodat, stream) != 0);
+  o |= (fflush (stream) != 0);                    /* Make sure data is written before returning */
+  if (o != 0)
+    errorPrint ("dgraphSaveBin2: bad output");
+
+  memFree (bloctab);                              /* Free group leader */
+  if (vnumgsttab != NULL)                         /* Free group leader of compact edge array */
+    memFree (vnumgsttab);
+
+  if (MPI_Allreduce (&o, &chekglbval, 1, MPI_INT, MPI_MAX, grafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphSaveBin2: communication error (4)");
+    return     (1);
+  }
+
+  return (chekglbval);
+}
+
+/* This routine saves a distributed source
+** graph in binary format. When all processes
+** hold a stream, these streams must refer to
+** the same regular file, in which each process
+** writes its own block at its precomputed
+** offset. When only one process holds a
+** stream, the graph is gathered on it and
+** saved as a binary centralized graph file,
+** which can be read back in the same way.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+dgraphSaveBin (
+Dgraph * restrict const     grafptr,              /* Not const since halo may update structure */
+FILE * const                stream)
+{
+  Gnum                reduloctab[4];
+  Gnum *              reduglbtab;
+  Gnum                strmnbr;                    /* Number of processes holding a stream */
+  int                 procnum;
+  int                 cheklocval;
+  int                 chekglbval;
+  int                 o;
+
+#ifdef SCOTCH_DEBUG_DGRAPH2
+  if (MPI_Barrier (grafptr->proccomm) != MPI_SUCCESS) { /* Synchronize for debugging */
+    errorPrint ("dgraphSaveBin: communication error (1)");
+    return     (1);
+  }
+#endif /* SCOTCH_DEBUG_DGRAPH2 */
+
+  reduloctab[0] = (stream != NULL) ? 1 : 0;       /* Flag streams and identify files behind them */
+  reduloctab[1] =
+  reduloctab[2] =
+  reduloctab[3] = -1;
+  if (stream != NULL) {
+    struct stat         statdat;
+    off_t               headpos;
+
+    if (((headpos = ftello (stream)) >= 0)           &&
+        (fstat (fileno (stream), &statdat) == 0) &&
+        (S_ISREG (statdat.st_mode))) {
+      reduloctab[1] = (Gnum) statdat.st_dev;
+      reduloctab[2] = (Gnum) statdat.st_ino;
+      reduloctab[3] = (Gnum) headpos;
+    }
+  }
+
+  cheklocval = 0;
+  if ((reduglbtab = memAlloc (grafptr->procglbnbr * 4 * sizeof (Gnum))) == NULL) {
+    errorPrint ("dgraphSaveBin: out of memory (1)");
+    cheklocval = 1;
+  }
+  if (MPI_Allreduce (&cheklocval, &chekglbval, 1, MPI_INT, MPI_MAX, grafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphSaveBin: communication error (2)");
+    chekglbval = 1;
+  }
+  if (chekglbval != 0) {
+    if (reduglbtab != NULL)
+      memFree (reduglbtab);
+    return (1);
+  }
+  if (MPI_Allgather (reduloctab, 4, GNUM_MPI, reduglbtab, 4, GNUM_MPI, grafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphSaveBin: communication error (3)");
+    memFree    (reduglbtab);
+    return     (1);
+  }
+
+  for (procnum = 0, strmnbr = 0; procnum < grafptr->procglbnbr; procnum ++)
+    strmnbr += reduglbtab[4 * procnum];
+
+  if (strmnbr == 1) {                             /* If single stream, save centralized graph */
+    Graph               cgrfdat;
+
+    memFree (reduglbtab);
+
+    if (stream != NULL)
+      graphInit (&cgrfdat);
+    o = dgraphGather (grafptr, (stream != NULL) ? &cgrfdat : NULL);
+    if (stream != NULL) {
+      if (o == 0)
+        o = graphSaveBin (&cgrfdat, stream);
+      graphExit (&cgrfdat);
+    }
+
+    return (o);
+  }
+
+  if (strmnbr != grafptr->procglbnbr) {
+    errorPrint ((strmnbr == 0)
+                ? "dgraphSaveBin: no output stream provided"
+                : "dgraphSaveBin: invalid number of output streams");
+    memFree    (reduglbtab);
+    return     (1);
+  }
+  for (procnum = 0; procnum < grafptr->procglbnbr; procnum ++) {
+    if ((reduglbtab[4 * procnum + 1] != reduglbtab[1]) ||
+        (reduglbtab[4 * procnum + 2] != reduglbtab[2]) ||
+        (reduglbtab[4 * procnum + 3] != reduglbtab[3]) ||
+        (reduglbtab[4 * procnum + 3] < 0)) {
+      errorPrint ("dgraphSaveBin: streams must refer to the same regular file");
+      memFree    (reduglbtab);
+      return     (1);
+    }
+  }
+  memFree (reduglbtab);
+
+  return (dgraphSaveBin2 (grafptr, stream, (off_t) reduloctab[3]));
+}
@@ -0,0 +1,122 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : dgraph_io_bin.h                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the binary distributed source       **/
+/**                graph I/O routines.                     **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ Magic string of binary distributed graph
+    files. It must differ from GRAPHBINMAGIC
+    only after its first character, by which
+    binary files are recognized.              +*/
+
+#define DGRAPHBINMAGIC              "SCOTCHDB"
+
+/*+ Version number of the binary format. +*/
+
+#define DGRAPHBINVERSION            0
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The binary distributed file header. It
+    is followed, at offset GRAPHBINHEADSIZ,
+    by the block index, then by the blocks
+    themselves, starting at aligned offsets.
+    Each block is laid out as the data block
+    of a binary centralized graph file, with
+    block-local vertex indices and global
+    edge ends, all in file base.              +*/
+
+typedef struct DgraphBinHead_ {
+  char                      magitab[GRAPHBINMAGICSIZ]; /*+ Magic string                +*/
+  UINT64                    endival;              /*+ Endianness test value          +*/
+  UINT64                    versval;              /*+ Format version                 +*/
+  UINT64                    gnumsiz;              /*+ Size of Gnum values in file    +*/
+  UINT64                    propval;              /*+ Property flags                 +*/
+  UINT64                    baseval;              /*+ Base value of arrays           +*/
+  UINT64                    vertglbnbr;           /*+ Global number of vertices      +*/
+  UINT64                    edgeglbnbr;           /*+ Global number of arcs          +*/
+  UINT64                    degrglbmax;           /*+ Maximum degree                 +*/
+  UINT64                    blocnbr;              /*+ Number of blocks in index      +*/
+  UINT64                    filesiz;              /*+ Overall size of graph data     +*/
+} DgraphBinHead;
+
+/*+ The block index entry. Blocks hold
+    consecutive vertex ranges, in order. +*/
+
+typedef struct DgraphBinBlock_ {
+  UINT64                    vertnbr;              /*+ Number of vertices in block +*/
+  UINT64                    edgenbr;              /*+ Number of arcs in block     +*/
+  UINT64                    blocoft;              /*+ Offset of block in file     +*/
+} DgraphBinBlock;
+
+/*+ The file descriptor used when loading.
+    Binary centralized graph files are seen
+    as single-block files.                   +*/
+
+typedef struct DgraphBinFile_ {
+  UINT64                    propval;              /*+ Property flags                  +*/
+  Gnum                      baseval;              /*+ Base value of file arrays       +*/
+  Gnum                      vertglbnbr;           /*+ Global number of vertices       +*/
+  Gnum                      edgeglbnbr;           /*+ Global number of arcs           +*/
+  Gnum                      blocnbr;              /*+ Number of blocks                +*/
+  DgraphBinBlock *          bloctab;              /*+ Block index                     +*/
+  UINT64                    fileoft;              /*+ Current offset in stream        +*/
+} DgraphBinFile;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef DGRAPH_IO_BIN
+static int                  dgraphLoadBinSeek   (DgraphBinFile * const, FILE * const, const UINT64);
+static int                  dgraphLoadBinRead   (DgraphBinFile * const, FILE * const, const UINT64, Gnum * const, const Gnum);
+static int                  dgraphLoadBinHead   (DgraphBinFile * const, FILE * const);
+static int                  dgraphLoadBinRange  (DgraphBinFile * const, FILE * const, const Gnum, const Gnum, const Gnum, Gnum * const, Gnum * const, Gnum * const, Gnum ** const, Gnum ** const, Gnum * const, Gnum * const);
+static int                  dgraphSaveBin2      (Dgraph * restrict const, FILE * const, const off_t);
+#endif /* DGRAPH_IO_BIN */
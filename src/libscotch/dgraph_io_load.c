@@ -46,6 +46,8 @@
 /**                                 to   : 27 jan 2009     **/
 /**                # Version 6.0  : from : 25 aug 2012     **/
 /**                                 to   : 18 nov 2012     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -58,10 +60,13 @@
 #include "module.h"
 #include "common.h"
 #include "graph.h"
+#include "graph_io_bin.h"
 #include "dgraph.h"
 #include "dgraph_allreduce.h"
 #include "dgraph_io_load.h"
 
+#include <sys/stat.h>
+
 /* This routine loads a distributed source
 ** graph from the given stream(s). Either
 ** one processor holds a non-NULL stream
@@ -73,6 +78,7 @@
 ** - !0  : on error.
 */
 
+DGRAPHALLREDUCEMAXSUMOP (1, 2)
 DGRAPHALLREDUCEMAXSUMOP (6, 3)
 DGRAPHALLREDUCEMAXSUMOP (10, 2)
 
@@ -86,6 +92,7 @@ const DgraphFlag            flagval)              /* Graph loading flags
   Gnum                reduloctab[12];
   Gnum                reduglbtab[12];
   Gnum                versval;
+  int                 c;
 
 #ifdef SCOTCH_DEBUG_DGRAPH2
   if (MPI_Barrier (grafptr->proccomm) != MPI_SUCCESS) { /* Synchronize for debugging */
@@ -99,12 +106,16 @@ const DgraphFlag            flagval)              /* Graph loading flags
   reduloctab[2] = flagval;                        /* Exchange flagval to check it is the same for all */
   reduloctab[3] = - flagval;
   reduloctab[4] = 0;                              /* Set uneffective values for versval */
-  reduloctab[5] = -2;
+  reduloctab[5] = - DGRAPHLOADBINVERS;
   reduloctab[6] =                                 /* Assume everything will be fine */
   reduloctab[7] =                                 /* Assume does not have a stream  */
   reduloctab[8] = 0;
   if (stream != NULL) {
-    if (intLoad (stream, &versval) != 1) {        /* Read version number */
+    c = getc (stream);                            /* Peek first character of stream */
+    ungetc (c, stream);
+    if (c == GRAPHBINMAGIC[0])                    /* If graph is in binary format */
+      versval = DGRAPHLOADBINVERS;
+    else if (intLoad (stream, &versval) != 1) {   /* Read version number */
       errorPrint ("dgraphLoad: bad input (1)");
       versval       = 0;
       reduloctab[6] = 1;
@@ -141,7 +152,13 @@ const DgraphFlag            flagval)              /* Graph loading flags
     return     (1);
   }
 
-  if (reduglbtab[4] == 2) {                       /* If distributed graph format             */
+  if (reduglbtab[4] == DGRAPHLOADBINVERS) {       /* If binary graph format */
+    if (reduglbtab[7] == 1)                       /* If only one reader stream */
+      return (dgraphLoadBin (grafptr, stream, baseval, flagval, (int) reduglbtab[8])); /* Scatter graph from known root */
+    else if (reduglbtab[7] == grafptr->procglbnbr)
+      return (dgraphLoadBin (grafptr, stream, baseval, flagval, -1)); /* Read blocks in parallel */
+  }
+  else if (reduglbtab[4] == 2) {                  /* If distributed graph format             */
     if (reduglbtab[7] == grafptr->procglbnbr)     /* If as many input streams as processors  */
       return (dgraphLoadDist (grafptr, stream, baseval, flagval)); /* Read distributed graph */
   }
@@ -886,9 +903,70 @@ const DgraphFlag            flagval)              /* Graph loading flags
   return (o);
 }
 
+/* This routine reads an integer token from
+** the current line of the text of a line
+** range. Tokens must be made of an optional
+** sign followed by digits, and be followed
+** by a whitespace character or by the end
+** of the text.
+** It returns:
+** - 1   : if a token was read.
+** - 0   : if the end of line was reached.
+** - -1  : on syntax error.
+*/
+
+static
+int
+dgraphLoadMultiToken (
+const char ** const         charptr,              /* Pointer to current character pointer */
+const char * const          charnnd,              /* End of text area                     */
+Gnum * const                valuptr)              /* Area where to put value              */
+{
+  const char *        chartmp;
+  Gnum                valutmp;
+  int                 signval;
+
+  for (chartmp = *charptr; (chartmp < charnnd) && (*chartmp != '\n') && isspace ((int) (unsigned char) *chartmp); chartmp ++) ;
+  *charptr = chartmp;
+  if ((chartmp >= charnnd) || (*chartmp == '\n')) /* If end of line reached */
+    return (0);
+
+  signval = 0;
+  if (*chartmp == '-') {
+    signval = 1;
+    chartmp ++;
+  }
+  else if (*chartmp == '+')
+    chartmp ++;
+
+  if ((chartmp >= charnnd) || (*chartmp < '0') || (*chartmp > '9'))
+    return (-1);
+  for (valutmp = 0; (chartmp < charnnd) && (*chartmp >= '0') && (*chartmp <= '9'); chartmp ++)
+    valutmp = valutmp * 10 + (*chartmp - '0');
+  if ((chartmp < charnnd) && (! isspace ((int) (unsigned char) *chartmp))) /* Tokens must be separated by whitespace */
+    return (-1);
+
+  *charptr = chartmp;
+  *valuptr = (signval != 0) ? (- valutmp) : valutmp;
+
+  return (1);
+}
+
 /* This routine loads a distributed source
 ** graph from a centralized source graph
 ** file replicated on all of the streams.
+** When all streams are regular files, the
+** graph body is split into as many byte
+** ranges as there are processes, the bounds
+** of which are moved to the next line start.
+** Every process reads and parses its own
+** range only, and keeps the vertices it
+** contains, so that vertices are distributed
+** according to the size of their adjacency.
+** If some stream is not a regular file, or
+** if the body does not hold exactly one
+** vertex per line, the graph is read and
+** scattered by the first process.
 ** It returns:
 ** - 0   : on success.
 ** - !0  : on error.
@@ -898,10 +976,318 @@ static
 int
 dgraphLoadMulti (
 Dgraph * restrict const     grafptr,              /* Distributed graph to load            */
-FILE * const                stream,               /* One single centralized stream        */
+FILE * const                stream,               /* One of the replicated streams        */
 Gnum                        baseval,              /* Base value (-1 means keep file base) */
 const DgraphFlag            flagval)              /* Graph loading flags                  */
 {
-  errorPrint ("dgraphLoadMulti: not implemented");
-  return     (1);
+  struct stat         statdat;
+  off_t               headpos;                    /* Position of rest of header in stream */
+  off_t               bodypos;                    /* Position of graph body in stream     */
+  off_t               bodysiz;                    /* Size of graph body in stream         */
+  off_t               readbas;                    /* Start of byte range to read          */
+  off_t               readnnd;                    /* End of byte range to read            */
+  char *              chartab;                    /* Text of byte range                   */
+  size_t              charmax;                    /* Size of text array                   */
+  size_t              charnbr;                    /* Number of characters in text array   */
+  const char *        charbas;                    /* Start of local line range            */
+  const char *        charnnd;                    /* End of local line range              */
+  const char *        charptr;
+  Gnum                vertglbnbr;
+  Gnum                vertlocnbr;
+  Gnum                vertlocnum;
+  Gnum * restrict     vertloctax;
+  Gnum *              vertlocptr;
+  Gnum                velolocnbr;
+  Gnum                velolocsum;
+  Gnum * restrict     veloloctax;
+  Gnum                vlbllocnbr;
+  Gnum * restrict     vlblloctax;
+  Gnum                edgeglbnbr;
+  Gnum                edgelocnbr;
+  Gnum                edgelocnum;
+  Gnum * restrict     edgeloctax;
+  Gnum * restrict     edloloctax;
+  Gnum                degrlocmax;
+  Gnum                baseadj;
+  Gnum                tokeval;
+  Gnum                reduloctab[9];
+  Gnum                reduglbtab[9];
+  char                proptab[4];                 /* Property string array */
+  int                 cheklocval;
+  int                 chekglbval;
+  int                 o;
+
+  const int           procglbnbr = grafptr->procglbnbr;
+  const int           proclocnum = grafptr->proclocnum;
+
+#ifdef SCOTCH_DEBUG_DGRAPH2
+  if (stream == NULL) {
+    errorPrint ("dgraphLoadMulti: invalid parameter");
+    return     (1);
+  }
+#endif /* SCOTCH_DEBUG_DGRAPH2 */
+
+  cheklocval = 0;
+  if (((headpos = ftello (stream)) < 0) ||        /* Fails for pipes and compressed streams, which is fine */
+      (fstat (fileno (stream), &statdat) != 0) ||
+      (! S_ISREG (statdat.st_mode)))
+    cheklocval = 1;
+  if (MPI_Allreduce (&cheklocval, &chekglbval, 1, MPI_INT, MPI_MAX, grafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphLoadMulti: communication error (1)");
+    return     (1);
+  }
+  if (chekglbval != 0)                            /* If not all processes can read byte ranges, first process reads whole graph */
+    return (dgraphLoadCent (grafptr, (proclocnum == 0) ? stream : NULL, baseval, flagval, 0));
+
+  bodypos       = 0;                              /* In case header cannot be read  */
+  reduloctab[0] = 0;                              /* Assume everything will be fine */
+  if ((intLoad (stream, &reduloctab[1]) != 1) ||  /* Read rest of header            */
+      (intLoad (stream, &reduloctab[2]) != 1) ||
+      (intLoad (stream, &reduloctab[3]) != 1) ||
+      (intLoad (stream, &reduloctab[4]) != 1) ||
+      (reduloctab[4] < 0)                     ||
+      (reduloctab[4] > 111)                   ||
+      ((bodypos = ftello (stream)) < 0)) {
+    errorPrint ("dgraphLoadMulti: bad input (1)");
+    reduloctab[0] = 1;
+  }
+  reduloctab[5] = - reduloctab[1];
+  reduloctab[6] = - reduloctab[2];
+  reduloctab[7] = - reduloctab[3];
+  reduloctab[8] = - reduloctab[4];
+
+  if (MPI_Allreduce (reduloctab, reduglbtab, 9, GNUM_MPI, MPI_MAX, grafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphLoadMulti: communication error (2)");
+    return     (1);
+  }
+  if (reduglbtab[0] != 0)
+    return (1);
+  if ((reduglbtab[1] != - reduglbtab[5]) ||
+      (reduglbtab[2] != - reduglbtab[6]) ||
+      (reduglbtab[3] != - reduglbtab[7]) ||
+      (reduglbtab[4] != - reduglbtab[8])) {
+    errorPrint ("dgraphLoadMulti: inconsistent graph headers");
+    return     (1);
+  }
+  vertglbnbr = reduglbtab[1];
+  edgeglbnbr = reduglbtab[2];
+
+  if (baseval == -1) {                            /* If keep file graph base     */
+    baseval = reduglbtab[3];                      /* Set graph base as file base */
+    baseadj = 0;                                  /* No base adjustment needed   */
+  }
+  else                                            /* If set graph base  */
+    baseadj = baseval - reduglbtab[3];            /* Update base adjust */
+
+  sprintf (proptab, "%3.3u", (unsigned int) reduglbtab[4] % 1000); /* Compute file properties; bounded to 3 digits */
+  proptab[0] -= '0';                              /* Vertex labels flag       */
+  proptab[1] -= '0';                              /* Edge weights flag        */
+  proptab[2] -= '0';                              /* Vertex loads flag        */
+  if (proptab[0] != 0)                            /* No vertex adjustments if vertex labels */
+    baseadj = 0;
+
+  bodysiz = (off_t) statdat.st_size - bodypos;    /* Compute nominal byte range of process */
+  readbas = bodypos + (bodysiz / procglbnbr) * proclocnum + MIN ((off_t) proclocnum, bodysiz % procglbnbr);
+  readnnd = readbas + (bodysiz / procglbnbr) + ((proclocnum < (bodysiz % procglbnbr)) ? 1 : 0);
+  if (proclocnum > 0)                             /* Also read last character of previous range to find first line start */
+    readbas --;
+
+  charbas =                                       /* Assume empty line range */
+  charnnd = NULL;
+  charnbr = (size_t) (readnnd - readbas);
+  charmax = charnbr + (charnbr >> 4) + 1024;      /* Extra space to complete last line */
+  if ((chartab = (char *) memAlloc (charmax * sizeof (char))) == NULL) {
+    errorPrint ("dgraphLoadMulti: out of memory (1)");
+    cheklocval = 2;
+  }
+  else if ((fseeko (stream, readbas, SEEK_SET) != 0) ||
+           (fread (chartab, sizeof (char), charnbr, stream) != charnbr)) {
+    errorPrint ("dgraphLoadMulti: cannot read graph body");
+    cheklocval = 2;
+  }
+  else {
+    charbas = chartab;                            /* First process starts right after header */
+    if (proclocnum > 0) {                         /* Other processes start at first line start */
+      for ( ; (charbas < (chartab + charnbr)) && (*charbas != '\n'); charbas ++) ;
+      charbas ++;                                 /* Skip end of line; range is empty if no line starts in it */
+    }
+    if ((charbas < (chartab + charnbr)) &&        /* If range is not empty and last line is not complete */
+        (proclocnum < (procglbnbr - 1)) &&
+        (chartab[charnbr - 1] != '\n')) {
+      int                 charval;
+
+      while ((charval = getc (stream)) != EOF) {  /* Complete last line, which ends in range of next process */
+        if (charnbr >= charmax) {
+          size_t              charold;
+          char *              chartmp;
+
+          charold  = charbas - chartab;
+          charmax += (charmax >> 2);
+          if ((chartmp = (char *) memRealloc (chartab, charmax * sizeof (char))) == NULL) {
+            errorPrint ("dgraphLoadMulti: out of memory (2)");
+            cheklocval = 2;
+            break;
+          }
+          chartab = chartmp;
+          charbas = chartab + charold;
+        }
+        chartab[charnbr ++] = (char) charval;
+        if (charval == '\n')
+          break;
+      }
+    }
+    charnnd = chartab + charnbr;
+    if (charbas > charnnd)
+      charbas = charnnd;
+  }
+
+  vertlocnbr =
+  edgelocnbr = 0;
+  if (cheklocval == 0) {
+    for (charptr = charbas; charptr < charnnd; charptr ++) { /* For all lines; skip end of line character */
+      Gnum                degrval;
+      Gnum                tokenbr;
+
+      if ((o = dgraphLoadMultiToken (&charptr, charnnd, &tokeval)) == 0) /* Skip blank lines */
+        continue;
+      if ((o < 0) ||
+          ((proptab[0] != 0) && (dgraphLoadMultiToken (&charptr, charnnd, &tokeval) != 1)) ||
+          ((proptab[2] != 0) && (dgraphLoadMultiToken (&charptr, charnnd, &tokeval) != 1)) ||
+          (tokeval < 0)) {                        /* Last token read is degree */
+        cheklocval = 1;
+        break;
+      }
+      degrval = tokeval;
+
+      for (tokenbr = 0; (o = dgraphLoadMultiToken (&charptr, charnnd, &tokeval)) > 0; tokenbr ++) ;
+      if ((o < 0) || (tokenbr != (degrval << proptab[1]))) { /* If line does not hold exactly one vertex */
+        cheklocval = 1;
+        break;
+      }
+
+      vertlocnbr ++;
+      edgelocnbr += degrval;
+    }
+  }
+
+  reduloctab[0] = cheklocval;
+  reduloctab[1] = vertlocnbr;
+  reduloctab[2] = edgelocnbr;
+  if (dgraphAllreduceMaxSum (reduloctab, reduglbtab, 1, 2, grafptr->proccomm) != 0) {
+    errorPrint ("dgraphLoadMulti: communication error (3)");
+    reduglbtab[0] = 2;
+  }
+  if (reduglbtab[0] >= 2) {                       /* If hard error encountered */
+    if (chartab != NULL)
+      memFree (chartab);
+    return (1);
+  }
+  if ((reduglbtab[0] != 0) ||                     /* If graph body cannot be parsed by line ranges */
+      (reduglbtab[1] != vertglbnbr)   ||
+      (reduglbtab[2] != edgeglbnbr)) {
+    memFree (chartab);
+    if ((proclocnum == 0) &&                      /* First process reads whole graph again */
+        (fseeko (stream, headpos, SEEK_SET) != 0)) {
+      errorPrint ("dgraphLoadMulti: cannot seek stream");
+      cheklocval = 1;
+    }
+    if (MPI_Allreduce (&cheklocval, &chekglbval, 1, MPI_INT, MPI_MAX, grafptr->proccomm) != MPI_SUCCESS) {
+      errorPrint ("dgraphLoadMulti: communication error (4)");
+      return     (1);
+    }
+    if (chekglbval != 0)
+      return (1);
+    return (dgraphLoadCent (grafptr, (proclocnum == 0) ? stream : NULL, baseval, flagval, 0));
+  }
+
+  velolocnbr = ((proptab[2] != 0) && ((flagval & GRAPHIONOLOADVERT) == 0)) ? vertlocnbr : 0;
+  vlbllocnbr = (proptab[0] != 0) ? vertlocnbr : 0;
+  vlblloctax =
+  veloloctax =
+  vertloctax =
+  edgeloctax =
+  edloloctax = NULL;
+  if ((vertlocptr = memAlloc ((vertlocnbr + 1 + velolocnbr + vlbllocnbr) * sizeof (Gnum))) == NULL) {
+    errorPrint ("dgraphLoadMulti: out of memory (3)");
+    cheklocval = 1;
+  }
+  else {
+    Gnum                edlolocnbr;
+
+    vertloctax  =
+    vertlocptr -= baseval;
+    vertlocptr += vertlocnbr + 1;
+    if (velolocnbr != 0) {
+      veloloctax  = vertlocptr;
+      vertlocptr += vertlocnbr;
+    }
+    if (vlbllocnbr != 0)
+      vlblloctax = vertlocptr;
+
+    edlolocnbr = ((proptab[1] != 0) && ((flagval & GRAPHIONOLOADEDGE) == 0)) ? edgelocnbr : 0;
+    if ((edgeloctax = memAlloc ((edgelocnbr + edlolocnbr + 1) * sizeof (Gnum))) == NULL) { /* "+1" in case of empty line range */
+      errorPrint ("dgraphLoadMulti: out of memory (4)");
+      cheklocval = 1;
+    }
+    else {
+      edgeloctax -= baseval;
+      edloloctax  = (edlolocnbr != 0) ? (edgeloctax + edgelocnbr) : NULL;
+    }
+  }
+
+  if (MPI_Allreduce (&cheklocval, &chekglbval, 1, MPI_INT, MPI_MAX, grafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphLoadMulti: communication error (5)");
+    chekglbval = 1;
+  }
+  if (chekglbval != 0) {
+    if (edgeloctax != NULL)
+      memFree (edgeloctax + baseval);
+    if (vertloctax != NULL)
+      memFree (vertloctax + baseval);
+    memFree (chartab);
+    return  (1);
+  }
+
+  degrlocmax = 0;                                 /* No maximum degree yet */
+  velolocsum = (veloloctax != NULL) ? 0 : vertlocnbr;
+  for (charptr = charbas, vertlocnum = edgelocnum = baseval; charptr < charnnd; charptr ++) { /* Second pass on validated lines */
+    Gnum                edgelocnnd;
+
+    if (dgraphLoadMultiToken (&charptr, charnnd, &tokeval) == 0)
+      continue;
+    if (proptab[0] != 0) {
+      vlblloctax[vertlocnum] = tokeval;
+      dgraphLoadMultiToken (&charptr, charnnd, &tokeval);
+    }
+    if (proptab[2] != 0) {
+      if (veloloctax != NULL)
+        velolocsum            +=
+        veloloctax[vertlocnum] = tokeval;
+      dgraphLoadMultiToken (&charptr, charnnd, &tokeval);
+    }
+    if (degrlocmax < tokeval)                     /* Set maximum degree */
+      degrlocmax = tokeval;
+
+    vertloctax[vertlocnum ++] = edgelocnum;       /* Set index in edge array */
+    for (edgelocnnd = edgelocnum + tokeval; edgelocnum < edgelocnnd; edgelocnum ++) {
+      if (proptab[1] != 0) {
+        dgraphLoadMultiToken (&charptr, charnnd, &tokeval);
+        if (edloloctax != NULL)
+          edloloctax[edgelocnum] = tokeval;
+      }
+      dgraphLoadMultiToken (&charptr, charnnd, &tokeval);
+      edgeloctax[edgelocnum] = tokeval + baseadj;
+    }
+    dgraphLoadMultiToken (&charptr, charnnd, &tokeval); /* Move to end of line */
+  }
+  vertloctax[vertlocnum] = edgelocnum;            /* Set end of edge array */
+
+  memFree (chartab);
+
+  o = dgraphBuild2 (grafptr, baseval,             /* Build distributed graph */
+                    vertlocnbr, vertlocnbr, vertloctax, vertloctax + 1, veloloctax, velolocsum, NULL, vlblloctax,
+                    edgelocnbr, edgelocnbr, edgeloctax, NULL, edloloctax, degrlocmax);
+  grafptr->flagval |= DGRAPHFREETABS | DGRAPHVERTGROUP | DGRAPHEDGEGROUP;
+
+  return (o);
 }
@@ -43,9 +43,22 @@
 /**                                 to   : 13 may 2007     **/
 /**                # Version 6.0  : from : 07 jun 2018     **/
 /**                                 to   : 07 jun 2018     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
+/*
+**  The defines.
+*/
+
+/*+ Pseudo-version number given to binary
+    graph files, which are recognized by
+    their magic string. It must be greater
+    than all textual version numbers.       +*/
+
+#define DGRAPHLOADBINVERS           3
+
 /*
 **  The function prototypes.
 */
@@ -53,5 +66,6 @@
 #ifdef DGRAPH_IO_LOAD
 static int                  dgraphLoadCent      (Dgraph * restrict const, FILE * const, Gnum, const GraphFlag, const int);
 static int                  dgraphLoadDist      (Dgraph * restrict const, FILE * const, Gnum, const GraphFlag);
+static int                  dgraphLoadMultiToken (const char ** const, const char * const, Gnum * const);
 static int                  dgraphLoadMulti     (Dgraph * restrict const, FILE * const, Gnum, const GraphFlag);
 #endif /* DGRAPH_IO_LOAD */
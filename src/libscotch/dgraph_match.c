@@ -45,7 +45,7 @@
 /**                # Version 6.0  : from : 03 oct 2012     **/
 /**                                 to   : 10 oct 2013     **/
 /**                # Version 7.0  : from : 12 sep 2019     **/
-/**                                 to   : 14 jan 2020     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -100,16 +100,49 @@ const float                         probval)
 
   if (memAllocGroup ((void **) (void *)
                      &mateptr->procvgbtab, (size_t) ((grafptr->procngbnbr + 1) * sizeof (Gnum)),
-                     &mateptr->queuloctab, (size_t) (vertlocnbr * sizeof (Gnum)), NULL) == NULL) {
+                     &mateptr->queuloctab, (size_t) (vertlocnbr * sizeof (Gnum)),
+#ifdef SCOTCH_MPI_ASYNC_COLL
+                     &mateptr->frnttax,    (size_t) (((grafptr->flagval & DGRAPHCOMMPTOP) != 0) ? 0 : (vertlocnbr * sizeof (byte))),
+#endif /* SCOTCH_MPI_ASYNC_COLL */
+                     NULL) == NULL) {
     errorPrint ("dgraphMatchInit: out of memory");
     return     (1);
   }
 
+#ifdef SCOTCH_MPI_ASYNC_COLL
+  if ((grafptr->flagval & DGRAPHCOMMPTOP) == 0) { /* If pipelined collective matching will be used */
+    const Gnum * restrict const vertloctax = grafptr->vertloctax;
+    const Gnum * restrict const vendloctax = grafptr->vendloctax;
+    const Gnum * restrict const edgegsttax = grafptr->edgegsttax;
+    byte * restrict const       frnttax    = mateptr->frnttax - grafptr->baseval;
+    Gnum                        vertlocnum;
+
+    for (vertlocnum = grafptr->baseval; vertlocnum < grafptr->vertlocnnd; vertlocnum ++) {
+      Gnum                edgelocnum;
+      byte                frntval;
+
+      frntval = (vertloctax[vertlocnum] == vendloctax[vertlocnum]) /* Isolated vertices can only be merged in initial scan */
+                ? DGRAPHMATCHSCANFRNT : DGRAPHMATCHSCANINTR;
+      for (edgelocnum = vertloctax[vertlocnum]; edgelocnum < vendloctax[vertlocnum]; edgelocnum ++) {
+        if (edgegsttax[edgelocnum] >= grafptr->vertlocnnd) { /* If vertex has a ghost neighbor */
+          frntval = DGRAPHMATCHSCANFRNT;
+          break;
+        }
+      }
+      frnttax[vertlocnum] = frntval;
+    }
+    mateptr->frnttax = frnttax;
+  }
+  else
+    mateptr->frnttax = NULL;
+#endif /* SCOTCH_MPI_ASYNC_COLL */
+
   mateptr->c.multlocnbr = 0;
   mateptr->mategsttax = mateptr->c.coargsttax;    /* TRICK: re-use array               */
   mateptr->matelocnbr = 0;                        /* All vertices need to be processed */
   mateptr->queulocnbr = 0;
   mateptr->probval = (grafptr->procngbnbr == 0) ? 1.0F : probval;
+  mateptr->scanval = DGRAPHMATCHSCANALL;
 
   memSet (mateptr->mategsttax + grafptr->vertlocnnd, ~0, (vertgstnbr - vertlocnbr) * sizeof (Gnum)); /* No ghost vertices matched to date */
 
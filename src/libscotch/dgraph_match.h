@@ -46,9 +46,25 @@
 /**                                 to   : 04 apr 2009     **/
 /**                # Version 6.0  : from : 03 oct 2012     **/
 /**                                 to   : 03 oct 2012     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
+/*
+** The defines.
+*/
+
+/*+ Subsets of vertices to consider when scanning.
+    Frontier vertices are scanned before interior
+    vertices in pipelined collective matching, so
+    that the matching of the latter overlaps the
+    communication of mating requests.              +*/
+
+#define DGRAPHMATCHSCANALL          0             /*+ Scan all vertices             +*/
+#define DGRAPHMATCHSCANFRNT         1             /*+ Scan frontier vertices only   +*/
+#define DGRAPHMATCHSCANINTR         2             /*+ Scan interior vertices only   +*/
+
 /*
 ** The type and structure definitions.
 */
@@ -63,6 +79,10 @@ typedef struct DgraphMatchData_ {
   Gnum                      queulocnbr;           /*+ Number of enqueued unmated vertices                         +*/
   Gnum *                    procvgbtab;           /*+ Global vertex number bounds for neighboring processors [+1] +*/
   float                     probval;              /*+ Vertex mating probability (1.0 is certain)                  +*/
+  int                       scanval;              /*+ Subset of vertices to scan                                  +*/
+#ifdef SCOTCH_MPI_ASYNC_COLL
+  byte *                    frnttax;              /*+ Subset to which each local vertex belongs                   +*/
+#endif /* SCOTCH_MPI_ASYNC_COLL */
 } DgraphMatchData;
 
 /*
@@ -73,9 +93,18 @@ int                         dgraphMatchInit     (DgraphMatchData * restrict cons
 void                        dgraphMatchExit     (DgraphMatchData * restrict const);
 int                         dgraphMatchSync     (DgraphMatchData * restrict const);
 int                         dgraphMatchSyncColl (DgraphMatchData * restrict const);
+#ifdef SCOTCH_MPI_ASYNC_COLL
+int                         dgraphMatchSyncCollAsync (DgraphMatchData * restrict const);
+int                         dgraphMatchSyncCollWait (DgraphMatchData * restrict const);
+#endif /* SCOTCH_MPI_ASYNC_COLL */
 int                         dgraphMatchSyncPtop (DgraphMatchData * restrict const);
 int                         dgraphMatchCheck    (DgraphMatchData * restrict const);
 
+#ifdef DGRAPH_MATCH_SYNC_COLL
+static int                  dgraphMatchSyncCollSend (DgraphMatchData * restrict const);
+static int                  dgraphMatchSyncCollReply (DgraphMatchData * restrict const, int * restrict const);
+#endif /* DGRAPH_MATCH_SYNC_COLL */
+
 void                        dgraphMatchHl       (DgraphMatchData * restrict const);
 void                        dgraphMatchSc       (DgraphMatchData * restrict const);
 void                        dgraphMatchHy       (DgraphMatchData * restrict const);
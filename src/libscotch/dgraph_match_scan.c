@@ -44,7 +44,7 @@
 /**                # Version 6.1  : from : 17 jun 2021     **/
 /**                                 to   : 27 dec 2021     **/
 /**                # Version 7.0  : from : 12 sep 2019     **/
-/**                                 to   : 14 jan 2020     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -68,6 +68,12 @@ DgraphMatchData * restrict const  mateptr)
   Gnum * restrict const               queuloctab = mateptr->queuloctab;
   Gnum * restrict const               mategsttax = mateptr->mategsttax;
   DgraphCoarsenMulti * restrict const multloctab = mateptr->c.multloctab;
+#ifdef SCOTCH_MPI_ASYNC_COLL
+  const byte * restrict const         frnttax    = mateptr->frnttax;
+  const int                           scanval    = mateptr->scanval;
+#else /* SCOTCH_MPI_ASYNC_COLL */
+  const int                           scanval    = DGRAPHMATCHSCANALL;
+#endif /* SCOTCH_MPI_ASYNC_COLL */
   DGRAPHMATCHSCANINIT
 
   flagval = mateptr->c.flagval;                   /* Get flag value */
@@ -77,7 +83,8 @@ DgraphMatchData * restrict const  mateptr)
   multlocnbr = mateptr->c.multlocnbr;
   edgekptnbr = mateptr->c.edgekptnbr;
 
-  if (matelocnbr == 0) {                          /* If initial pass or nothing useful done */
+  if ((matelocnbr == 0) &&                        /* If initial pass or nothing useful done       */
+      (scanval != DGRAPHMATCHSCANINTR)) {         /* And no mating requests of this pass in flight */
     Gnum                vertlocnnt;               /* End of useable local vertices          */
     Gnum                vertlocnum;
 
@@ -95,6 +102,13 @@ DgraphMatchData * restrict const  mateptr)
 
       if (mategsttax[vertlocnum] >= 0)            /* If vertex has been matched by one of the previous ones, skip it */
         continue;
+#ifdef SCOTCH_MPI_ASYNC_COLL
+      if ((scanval != DGRAPHMATCHSCANALL) &&      /* If vertex does not belong to scanned subset */
+          (frnttax[vertlocnum] != scanval)) {
+        queuloctab[queulocnbr ++] = vertlocnum;   /* Enqueue it for subsequent scan             */
+        continue;
+      }
+#endif /* SCOTCH_MPI_ASYNC_COLL */
 #ifdef SCOTCH_DEBUG_DGRAPH2
       if (mategsttax[vertlocnum] < -1) {          /* Vertex must not be requesting yet */
         errorPrint (STRINGIFY (DGRAPHMATCHSCANNAME) ": internal error (1)");
@@ -202,19 +216,22 @@ DgraphMatchData * restrict const  mateptr)
     Gnum                queulocnum;
     Gnum                queulocnew;
 
-    for (queulocnum = queulocnew = 0, queulocnbr = mateptr->queulocnbr; queulocnum < queulocnbr; queulocnum ++) { /* For all vertices in queue */
-      Gnum                vertlocnum;
-      Gnum                mategstnum;
-
-      vertlocnum = queuloctab[queulocnum];        /* Get current vertex */
-      mategstnum = mategsttax[vertlocnum];
-      if (mategstnum > -1)                        /* If already mated */
-        continue;                                 /* Find another one */
-      queuloctab[queulocnew ++] = vertlocnum;
-      if (mategstnum < -1)
-        mategsttax[vertlocnum] = -1;
+    queulocnbr = mateptr->queulocnbr;
+    if (scanval != DGRAPHMATCHSCANINTR) {         /* Pending mating requests must not be reset */
+      for (queulocnum = queulocnew = 0; queulocnum < queulocnbr; queulocnum ++) { /* For all vertices in queue */
+        Gnum                vertlocnum;
+        Gnum                mategstnum;
+
+        vertlocnum = queuloctab[queulocnum];      /* Get current vertex */
+        mategstnum = mategsttax[vertlocnum];
+        if (mategstnum > -1)                      /* If already mated */
+          continue;                               /* Find another one */
+        queuloctab[queulocnew ++] = vertlocnum;
+        if (mategstnum < -1)
+          mategsttax[vertlocnum] = -1;
+      }
+      queulocnbr = queulocnew;
     }
-    queulocnbr = queulocnew;
 
     for (queulocnum = 0; queulocnum < queulocnbr; queulocnum ++) { /* For all vertices in queue */
       Gnum                vertlocnum;
@@ -228,6 +245,11 @@ DgraphMatchData * restrict const  mateptr)
       vertlocnum = queuloctab[queulocnum];        /* Get current vertex */
       if (mategsttax[vertlocnum] >= 0)            /* If already mated   */
         continue;                                 /* Find another one   */
+#ifdef SCOTCH_MPI_ASYNC_COLL
+      if ((scanval != DGRAPHMATCHSCANALL) &&      /* If vertex does not belong to scanned subset */
+          (frnttax[vertlocnum] != scanval))
+        continue;                                 /* Keep it enqueued                            */
+#endif /* SCOTCH_MPI_ASYNC_COLL */
 
 #ifdef SCOTCH_DEBUG_DGRAPH2
       if (mategsttax[vertlocnum] < -1) {          /* Vertex must not be requesting yet */
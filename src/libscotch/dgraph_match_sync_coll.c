@@ -43,6 +43,8 @@
 /**                                 to   : 22 apr 2009     **/
 /**                # Version 6.1  : from : 27 dec 2021     **/
 /**                                 to   : 27 dec 2021     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -51,6 +53,7 @@
 */
 
 #define DGRAPH_MATCH
+#define DGRAPH_MATCH_SYNC_COLL
 
 #include "module.h"
 #include "common.h"
@@ -65,43 +68,34 @@
 /*                                   */
 /*************************************/
 
-/* This routine performs a round of communication
-** to synchronize enqueued matching requests across
-** processors.
+/* This routine fills the send array with the
+** mating requests of the enqueued vertices, in
+** the sub-arrays of their respective neighbor
+** processes.
 ** It returns:
 ** - 0   : on success.
 ** - !0  : on error.
 */
 
+static
 int
-dgraphMatchSyncColl (
+dgraphMatchSyncCollSend (
 DgraphMatchData * restrict const  mateptr)
 {
   Gnum                queulocnbr;
   Gnum                queulocnum;
-  Gnum                matelocnbr;
-  Gnum                multlocnbr;
   Gnum                vertlocadj;
-  Gnum                edgekptnbr;
   int                 procngbnbr;
-  int                 procngbidx;
   int                 procngbnum;
-  int * restrict      vsndcnttab;
-  int * restrict      vrcvcnttab;
-  int * restrict      vsnddsptab;
-  int * restrict      vrcvdsptab;
 
   Dgraph * restrict const             grafptr    = mateptr->c.finegrafptr;
   const int * restrict const          procngbtab = grafptr->procngbtab;
   int * restrict const                procgsttax = mateptr->c.procgsttax;
   const Gnum * restrict const         procvgbtab = mateptr->procvgbtab;
-  const Gnum * restrict const         vertloctax = grafptr->vertloctax;
-  const Gnum * restrict const         vendloctax = grafptr->vendloctax;
   const Gnum * restrict const         edgeloctax = grafptr->edgeloctax;
   const Gnum * restrict const         edgegsttax = grafptr->edgegsttax;
   Gnum * restrict const               queuloctab = mateptr->queuloctab;
   Gnum * restrict const               mategsttax = mateptr->mategsttax;
-  DgraphCoarsenMulti * restrict const multloctab = mateptr->c.multloctab;
   int * restrict const                nsndidxtab = mateptr->c.nsndidxtab;
   DgraphCoarsenVert * const           vsnddattab = mateptr->c.vsnddattab; /* [norestrict:async] */
 
@@ -112,20 +106,8 @@ DgraphMatchData * restrict const  mateptr)
     errorPrint ("dgraphMatchSyncColl: not implemented");
     return     (1);
   }
-  if (MPI_Barrier (grafptr->proccomm) != MPI_SUCCESS) {
-    errorPrint ("dgraphMatchSyncColl: communication error (1)");
-    return     (1);
-  }
 #endif /* SCOTCH_DEBUG_DGRAPH2 */
 
-  if ((vsnddsptab = memAlloc (4 * grafptr->procglbnbr * sizeof (int))) == NULL) {
-    errorPrint ("dgraphMatchSyncColl: out of memory");
-    return     (1);
-  }
-  vsndcnttab = vsnddsptab + grafptr->procglbnbr;  /* TRICK: put vsnddsptab, vsndcnttab, vrcvdsptab in order for memSet() */
-  vrcvdsptab = vsndcnttab + grafptr->procglbnbr;
-  vrcvcnttab = vrcvdsptab + grafptr->procglbnbr;
-
   for (procngbnum = 0; procngbnum < procngbnbr; procngbnum ++) /* Reset indices for sending messages */
     nsndidxtab[procngbnum] = mateptr->c.vsnddsptab[procngbtab[procngbnum]];
 
@@ -193,25 +175,50 @@ DgraphMatchData * restrict const  mateptr)
     vsnddattab[vsndidxnum].datatab[1] = mateglbnum;
   }
 
-  memSet (vsnddsptab, 0, 3 * grafptr->procglbnbr * sizeof (int)); /* TRICK: resets vsnddsptab, vsndcnttab, vrcvdsptab */
-  for (procngbnum = 0; procngbnum < procngbnbr; procngbnum ++) {
-    int                 procglbnum;
 
-    procglbnum = procngbtab[procngbnum];
-    vrcvdsptab[procglbnum] = 2 * mateptr->c.vrcvdsptab[procglbnum]; /* Times 2 because a "DgraphCoarsenVert" is two "Gnum"s */
-    vsnddsptab[procglbnum] = 2 * mateptr->c.vsnddsptab[procglbnum];
-    vsndcnttab[procglbnum] = 2 * (nsndidxtab[procngbnum] - mateptr->c.vsnddsptab[procglbnum]);
-  }
+  return (0);
+}
 
-  if (MPI_Alltoall (vsndcnttab, 1, MPI_INT, vrcvcnttab, 1, MPI_INT, grafptr->proccomm) != MPI_SUCCESS) {
-    errorPrint ("dgraphMatchSyncColl: communication error (2)");
-    return     (1);
-  }
-  if (MPI_Alltoallv (vsnddattab,            vsndcnttab, vsnddsptab, GNUM_MPI,
-                     mateptr->c.vrcvdattab, vrcvcnttab, vrcvdsptab, GNUM_MPI, grafptr->proccomm) != MPI_SUCCESS) {
-    errorPrint ("dgraphMatchSyncColl: communication error (3)");
-    return     (1);
-  }
+/* This routine processes the mating requests
+** received from neighbor processes, sends back
+** the replies, and processes the replies to
+** its own requests. The four count and
+** displacement arrays, in Gnum units, are
+** given in the order vsnddsptab, vsndcnttab,
+** vrcvdsptab and vrcvcnttab.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+static
+int
+dgraphMatchSyncCollReply (
+DgraphMatchData * restrict const  mateptr,
+int * restrict const              vsnddsptab)
+{
+  Gnum                matelocnbr;
+  Gnum                multlocnbr;
+  Gnum                vertlocadj;
+  Gnum                edgekptnbr;
+  int                 procngbnbr;
+  int                 procngbidx;
+
+  Dgraph * restrict const             grafptr    = mateptr->c.finegrafptr;
+  const int * restrict const          procngbtab = grafptr->procngbtab;
+  const Gnum * restrict const         vertloctax = grafptr->vertloctax;
+  const Gnum * restrict const         vendloctax = grafptr->vendloctax;
+  const Gnum * restrict const         edgeloctax = grafptr->edgeloctax;
+  const Gnum * restrict const         edgegsttax = grafptr->edgegsttax;
+  Gnum * restrict const               mategsttax = mateptr->mategsttax;
+  DgraphCoarsenMulti * restrict const multloctab = mateptr->c.multloctab;
+  DgraphCoarsenVert * const           vsnddattab = mateptr->c.vsnddattab; /* [norestrict:async] */
+  int * restrict const                vsndcnttab = vsnddsptab + grafptr->procglbnbr;
+  int * restrict const                vrcvdsptab = vsndcnttab + grafptr->procglbnbr;
+  int * restrict const                vrcvcnttab = vrcvdsptab + grafptr->procglbnbr;
+
+  procngbnbr = grafptr->procngbnbr;
+  vertlocadj = grafptr->procvrttab[grafptr->proclocnum] - grafptr->baseval;
 
   matelocnbr = mateptr->matelocnbr;
   multlocnbr = mateptr->c.multlocnbr;
@@ -429,7 +436,196 @@ DgraphMatchData * restrict const  mateptr)
   }
 #endif /* SCOTCH_DEBUG_DGRAPH2 */
 
+  return (0);
+}
+
+/* This routine performs a round of communication
+** to synchronize enqueued matching requests across
+** processors.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+dgraphMatchSyncColl (
+DgraphMatchData * restrict const  mateptr)
+{
+  int                 procngbnbr;
+  int                 procngbnum;
+  int * restrict      vsndcnttab;
+  int * restrict      vrcvcnttab;
+  int * restrict      vsnddsptab;
+  int * restrict      vrcvdsptab;
+
+  Dgraph * restrict const             grafptr    = mateptr->c.finegrafptr;
+  const int * restrict const          procngbtab = grafptr->procngbtab;
+  int * restrict const                nsndidxtab = mateptr->c.nsndidxtab;
+
+  procngbnbr = grafptr->procngbnbr;
+
+#ifdef SCOTCH_DEBUG_DGRAPH2
+  if (MPI_Barrier (grafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphMatchSyncColl: communication error (1)");
+    return     (1);
+  }
+#endif /* SCOTCH_DEBUG_DGRAPH2 */
+
+  if ((vsnddsptab = memAlloc (4 * grafptr->procglbnbr * sizeof (int))) == NULL) {
+    errorPrint ("dgraphMatchSyncColl: out of memory");
+    return     (1);
+  }
+  vsndcnttab = vsnddsptab + grafptr->procglbnbr;  /* TRICK: put vsnddsptab, vsndcnttab, vrcvdsptab in order for memSet() */
+  vrcvdsptab = vsndcnttab + grafptr->procglbnbr;
+  vrcvcnttab = vrcvdsptab + grafptr->procglbnbr;
+
+  if (dgraphMatchSyncCollSend (mateptr) != 0) {
+    memFree (vsnddsptab);
+    return  (1);
+  }
+
+  memSet (vsnddsptab, 0, 3 * grafptr->procglbnbr * sizeof (int)); /* TRICK: resets vsnddsptab, vsndcnttab, vrcvdsptab */
+  for (procngbnum = 0; procngbnum < procngbnbr; procngbnum ++) {
+    int                 procglbnum;
+
+    procglbnum = procngbtab[procngbnum];
+    vrcvdsptab[procglbnum] = 2 * mateptr->c.vrcvdsptab[procglbnum]; /* Times 2 because a "DgraphCoarsenVert" is two "Gnum"s */
+    vsnddsptab[procglbnum] = 2 * mateptr->c.vsnddsptab[procglbnum];
+    vsndcnttab[procglbnum] = 2 * (nsndidxtab[procngbnum] - mateptr->c.vsnddsptab[procglbnum]);
+  }
+
+  if (MPI_Alltoall (vsndcnttab, 1, MPI_INT, vrcvcnttab, 1, MPI_INT, grafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphMatchSyncColl: communication error (2)");
+    memFree    (vsnddsptab);
+    return     (1);
+  }
+  if (MPI_Alltoallv (mateptr->c.vsnddattab, vsndcnttab, vsnddsptab, GNUM_MPI,
+                     mateptr->c.vrcvdattab, vrcvcnttab, vrcvdsptab, GNUM_MPI, grafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphMatchSyncColl: communication error (3)");
+    memFree    (vsnddsptab);
+    return     (1);
+  }
+
+  if (dgraphMatchSyncCollReply (mateptr, vsnddsptab) != 0) {
+    memFree (vsnddsptab);
+    return  (1);
+  }
+
   memFree (vsnddsptab);
 
   return (0);
 }
+
+#ifdef SCOTCH_MPI_ASYNC_COLL
+
+/* These routines perform a round of communication
+** to synchronize enqueued matching requests across
+** processors, in two steps, so that computations
+** can take place while mating requests are in
+** flight. Since only a single non-blocking
+** all-to-all exchange is performed in the first
+** step, no message sizes are known in advance:
+** whole halo-sized blocks are exchanged, the end
+** of requests in each non-full block being marked
+** by a negative value.
+** They return:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+dgraphMatchSyncCollAsync (
+DgraphMatchData * restrict const  mateptr)
+{
+  int                 procngbnbr;
+  int                 procngbnum;
+
+  Dgraph * restrict const             grafptr    = mateptr->c.finegrafptr;
+  const int * restrict const          procngbtab = grafptr->procngbtab;
+  const int * restrict const          nsndidxtab = mateptr->c.nsndidxtab;
+  DgraphCoarsenVert * const           vsnddattab = mateptr->c.vsnddattab; /* [norestrict:async] */
+
+  procngbnbr = grafptr->procngbnbr;
+
+#ifdef SCOTCH_DEBUG_DGRAPH2
+  if (MPI_Barrier (grafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("dgraphMatchSyncCollAsync: communication error (1)");
+    return     (1);
+  }
+#endif /* SCOTCH_DEBUG_DGRAPH2 */
+
+  if (dgraphMatchSyncCollSend (mateptr) != 0)
+    return (1);
+
+  for (procngbnum = 0; procngbnum < procngbnbr; procngbnum ++) { /* Mark end of requests in non-full blocks */
+    if (nsndidxtab[procngbnum] < mateptr->c.vsnddsptab[procngbtab[procngbnum] + 1])
+      vsnddattab[nsndidxtab[procngbnum]].datatab[0] = -1;
+  }
+
+  if (MPI_Ialltoallv (vsnddattab,            grafptr->procsndtab, mateptr->c.vsnddsptab, mateptr->c.vertdattype,
+                      mateptr->c.vrcvdattab, grafptr->procrcvtab, mateptr->c.vrcvdsptab, mateptr->c.vertdattype,
+                      grafptr->proccomm, &mateptr->c.requval) != MPI_SUCCESS) {
+    errorPrint ("dgraphMatchSyncCollAsync: communication error (2)");
+    return     (1);
+  }
+
+  return (0);
+}
+
+int
+dgraphMatchSyncCollWait (
+DgraphMatchData * restrict const  mateptr)
+{
+  int                 procngbnbr;
+  int                 procngbnum;
+  int * restrict      vsndcnttab;
+  int * restrict      vrcvcnttab;
+  int * restrict      vsnddsptab;
+  int * restrict      vrcvdsptab;
+  int                 o;
+
+  Dgraph * restrict const             grafptr    = mateptr->c.finegrafptr;
+  const int * restrict const          procngbtab = grafptr->procngbtab;
+  const int * restrict const          nsndidxtab = mateptr->c.nsndidxtab;
+
+  procngbnbr = grafptr->procngbnbr;
+
+  if (MPI_Wait (&mateptr->c.requval, MPI_STATUS_IGNORE) != MPI_SUCCESS) {
+    errorPrint ("dgraphMatchSyncCollWait: communication error");
+    return     (1);
+  }
+
+  if ((vsnddsptab = memAlloc (4 * grafptr->procglbnbr * sizeof (int))) == NULL) {
+    errorPrint ("dgraphMatchSyncCollWait: out of memory");
+    return     (1);
+  }
+  vsndcnttab = vsnddsptab + grafptr->procglbnbr;
+  vrcvdsptab = vsndcnttab + grafptr->procglbnbr;
+  vrcvcnttab = vrcvdsptab + grafptr->procglbnbr;
+
+  memSet (vsnddsptab, 0, 4 * grafptr->procglbnbr * sizeof (int));
+  for (procngbnum = 0; procngbnum < procngbnbr; procngbnum ++) {
+    int                 procglbnum;
+    int                 vrcvidxnum;
+    int                 vrcvidxnnd;
+
+    const DgraphCoarsenVert * restrict const  vrcvdattab = mateptr->c.vrcvdattab; /* After data is received */
+
+    procglbnum = procngbtab[procngbnum];
+    for (vrcvidxnum = mateptr->c.vrcvdsptab[procglbnum], vrcvidxnnd = mateptr->c.vrcvdsptab[procglbnum + 1]; /* Find end of received requests */
+         (vrcvidxnum < vrcvidxnnd) && (vrcvdattab[vrcvidxnum].datatab[0] != -1); vrcvidxnum ++) ;
+
+    vrcvdsptab[procglbnum] = 2 * mateptr->c.vrcvdsptab[procglbnum]; /* Times 2 because a "DgraphCoarsenVert" is two "Gnum"s */
+    vrcvcnttab[procglbnum] = 2 * (vrcvidxnum - mateptr->c.vrcvdsptab[procglbnum]);
+    vsnddsptab[procglbnum] = 2 * mateptr->c.vsnddsptab[procglbnum];
+    vsndcnttab[procglbnum] = 2 * (nsndidxtab[procngbnum] - mateptr->c.vsnddsptab[procglbnum]);
+  }
+
+  o = dgraphMatchSyncCollReply (mateptr, vsnddsptab);
+
+  memFree (vsnddsptab);
+
+  return (o);
+}
+
+#endif /* SCOTCH_MPI_ASYNC_COLL */
@@ -0,0 +1,127 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : dgraph_sq.c                             **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module runs two concurrent         **/
+/**                attempts of a sequential strategy on    **/
+/**                the centralized copy of a distributed   **/
+/**                graph, on behalf of the sequential      **/
+/**                bipartitioning and separation methods.  **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define DGRAPH_SQ
+
+#include "module.h"
+#include "common.h"
+#include "parser.h"
+#include "graph.h"
+#include "dgraph_sq.h"
+
+/***********************************/
+/*                                 */
+/* These routines run the strategy */
+/* in concurrent sub-contexts.     */
+/*                                 */
+/***********************************/
+
+/* This routine runs the sequential strategy
+** within its own sub-context.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+dgraphSqBest2 (
+Context * restrict const        contptr,          /*+ (Sub-)context                          +*/
+const int                       spltnum,          /*+ Rank of sub-context in initial context +*/
+DgraphSqSplit * restrict const  spltptr)
+{
+  spltptr->splttab[spltnum].o = spltptr->funcptr (spltptr->splttab[spltnum].grafptr, contptr, spltptr->stratptr);
+}
+
+/* This routine runs the sequential strategy
+** on two centralized graphs which hold the same
+** initial data. When the context holds several
+** threads, both runs are performed concurrently,
+** each in its own sub-context with its own
+** pseudo-random generator, and the graph with
+** the lowest criteria, in lexicographic order,
+** is selected. Else, only the first graph is
+** processed.
+** It returns:
+** - 0   : if the first graph holds the best result.
+** - 1   : if the second graph holds the best result.
+** - 2   : on error.
+*/
+
+int
+dgraphSqBest (
+Context * const               contptr,            /*+ Context of both graphs           +*/
+void * const                  grafptr,            /*+ First centralized graph          +*/
+void * const                  seltptr,            /*+ Second centralized graph         +*/
+DgraphSqFunc const            funcptr,            /*+ Routine running the strategy     +*/
+DgraphSqCost const            costptr,            /*+ Routine computing graph criteria +*/
+const Strat * restrict const  stratptr)           /*+ Sequential strategy              +*/
+{
+  DgraphSqSplit       spltdat;
+  Gnum                costtab[2][2];
+
+  spltdat.funcptr            = funcptr;
+  spltdat.stratptr           = stratptr;
+  spltdat.splttab[0].grafptr = grafptr;
+  spltdat.splttab[1].grafptr = seltptr;
+  if (contextThreadLaunchSplit (contptr, (ContextSplitFunc) dgraphSqBest2, &spltdat) != 0) /* If could not split context to run concurrently */
+    return ((funcptr (grafptr, contptr, stratptr) != 0) ? 2 : 0);
+
+  if (spltdat.splttab[1].o != 0)                  /* If second run failed, first result is the only candidate */
+    return ((spltdat.splttab[0].o != 0) ? 2 : 0);
+  if (spltdat.splttab[0].o != 0)                  /* If only first run failed, keep second result */
+    return (1);
+
+  costptr (grafptr, costtab[0]);
+  costptr (seltptr, costtab[1]);
+  return (((costtab[1][0] < costtab[0][0]) ||
+           ((costtab[1][0] == costtab[0][0]) && (costtab[1][1] < costtab[0][1]))) ? 1 : 0);
+}
@@ -0,0 +1,91 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : dgraph_sq.h                             **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the concurrent sequential runs      **/
+/**                shared by the sequential methods of     **/
+/**                distributed graphs.                     **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ This function type runs a sequential
+    strategy on a centralized graph within
+    the given (sub-)context.               +*/
+
+typedef int (* DgraphSqFunc) (void * const, Context * const, const Strat * const);
+
+/*+ This function type fills the array of
+    quality criteria of a centralized graph,
+    most significant first; the lower the
+    better.                                  +*/
+
+typedef void (* DgraphSqCost) (const void * const, Gnum * const);
+
+/*+ This structure holds the data of
+    one of the concurrent sequential
+    runs.                             +*/
+
+typedef struct DgraphSqSplit2_ {
+  void *                    grafptr;              /*+ Centralized graph to process +*/
+  int                       o;                    /*+ Return value of strategy     +*/
+} DgraphSqSplit2;
+
+/*+ This structure holds the data of
+    both concurrent sequential runs.  +*/
+
+typedef struct DgraphSqSplit_ {
+  DgraphSqFunc              funcptr;              /*+ Routine running the strategy +*/
+  const Strat *             stratptr;             /*+ Sequential strategy to apply +*/
+  DgraphSqSplit2            splttab[2];           /*+ Array of run data            +*/
+} DgraphSqSplit;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef DGRAPH_SQ
+static void                 dgraphSqBest2       (Context * restrict const, const int, DgraphSqSplit * const);
+#endif /* DGRAPH_SQ */
+
+int                         dgraphSqBest        (Context * const, void * const, void * const, DgraphSqFunc const, DgraphSqCost const, const Strat * const);
@@ -42,6 +42,8 @@
 /**                                 to   : 09 nov 2008     **/
 /**                # Version 6.0  : from : 03 sep 2013     **/
 /**                                 to   : 03 sep 2013     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -233,7 +235,7 @@ Gnum * restrict const           termloctab)
 
   sortsndtab[vertlocnum].vertnum =                /* Set end marker */
   sortsndtab[vertlocnum].termnum = GNUMMAX;
-  intSort2asc1 (sortsndtab, dmapptr->vertlocnbr); /* Sort mapping array by original vertex numbers, without marker */
+  intRsort2asc1 (sortsndtab, dmapptr->vertlocnbr, NULL); /* Sort mapping array by original vertex numbers, without marker */
 
   for (vertlocnum = 0, procnum = 0; procnum < grafptr->procglbnbr; ) {
     Gnum                  vertsndnbr;
@@ -42,6 +42,8 @@
 /**                                 to   : 21 oct 2007     **/
 /**                # Version 5.1  : from : 26 sep 2008     **/
 /**                                 to   : 26 sep 2008     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -176,7 +178,7 @@ Gnum * restrict const         permloctab)
   }
   sortsndtab[vnodlocnbr].vertnum =                /* Set end marker */
   sortsndtab[vnodlocnbr].permnum = GNUMMAX;
-  intSort2asc1 (sortsndtab, vnodlocnbr);          /* Sort permutation array by original vertex numbers, without marker */
+  intRsort2asc1 (sortsndtab, vnodlocnbr, NULL);   /* Sort permutation array by original vertex numbers, without marker */
 
   for (vnodlocnum = 0, procnum = 0; procnum < grafptr->procglbnbr; ) {
     Gnum                  vnodsndnbr;
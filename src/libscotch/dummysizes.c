@@ -56,7 +56,7 @@
 /**                # Version 6.1  : from : 09 feb 2021     **/
 /**                                 to   : 22 jun 2021     **/
 /**                # Version 7.0  : from : 25 aug 2019     **/
-/**                                 to   : 25 aug 2019     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -285,6 +285,9 @@ char *                      argv[])
     subsSuffix ("SCOTCH_COARSENFOLD");
     subsSuffix ("SCOTCH_COARSENFOLDDUP");
     subsSuffix ("SCOTCH_COARSENNOMERGE");
+    subsSuffix ("SCOTCH_COLORNONE");
+    subsSuffix ("SCOTCH_COLORDEGREE");
+    subsSuffix ("SCOTCH_COLORSMALLEST");
     subsSuffix ("SCOTCH_STRATDEFAULT");
     subsSuffix ("SCOTCH_STRATQUALITY");
     subsSuffix ("SCOTCH_STRATSPEED");
@@ -48,6 +48,8 @@
 /**                                 to   : 24 mar 2008     **/
 /**                # Version 6.0  : from : 20 aug 2020     **/
 /**                                 to   : 26 aug 2020     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # Most of the contents of this module   **/
 /**                  comes from "map_b_fm" of the SCOTCH   **/
@@ -132,6 +134,90 @@ GainEntr * const            entrptr)
 
 #endif /* SCOTCH_DEBUG_GAIN3 */
 
+/* This routine returns the first non-empty
+** entry in the given range, by only looking
+** at entries flagged in the entry bitmap.
+** Flags of entries found empty are cleared
+** on the fly, so that the bitmap always
+** flags all non-empty entries, plus some
+** empty ones which have not been scanned
+** since their last link was removed.
+** It returns:
+** - !NULL  : pointer to the non-empty entry.
+** - NULL   : if all entries in range are empty.
+*/
+
+#ifndef GAIN_NOMAP
+
+#if ! ((defined __GNUC__) || (defined __clang__))
+static
+INT
+gainMapLowFunc (
+UINT                        mapval)               /*+ Non-zero map word +*/
+{
+  INT                 bitnum;
+
+  for (bitnum = 0; (mapval & 1) == 0; mapval >>= 1, bitnum ++) ;
+
+  return (bitnum);
+}
+#endif /* ! ((defined __GNUC__) || (defined __clang__)) */
+
+static
+GainEntr *
+gainTablScan (
+GainTabl * const            tablptr,
+GainEntr *                  entrptr,              /*+ First entry to consider  +*/
+const GainEntr * const      entrend)              /*+ Entry after last to test +*/
+{
+  UINT * const        maptab = tablptr->maptab;
+  INT                 entrnum;
+  INT                 entrnnd;
+  INT                 mapnum;
+  INT                 mapnnd;
+  UINT                mapval;
+
+  if (entrptr >= entrend)
+    return (NULL);
+
+  entrnum = (INT) (entrptr - tablptr->tabk);
+  entrnnd = (INT) (entrend - tablptr->tabk);
+  mapnum  = entrnum / GAINMAPBITS;
+  mapnnd  = (entrnnd + GAINMAPBITS - 1) / GAINMAPBITS;
+  mapval  = maptab[mapnum] & ((~ ((UINT) 0)) << (entrnum % GAINMAPBITS)); /* Skip flags before first entry */
+  entrnum = mapnum * GAINMAPBITS;                 /* Number of first entry in map word */
+
+  while (1) {
+    UINT                mapclr;
+
+    for (mapclr = 0; mapval != 0; mapval &= mapval - 1) { /* For all flags set in current map word */
+      INT                 bitnum;
+
+      bitnum = gainMapLow (mapval);               /* Get index of lowest flag set */
+      if ((entrnum + bitnum) >= entrnnd)          /* If out of range, stop         */
+        break;
+
+      entrptr = tablptr->tabk + entrnum + bitnum;
+      if (entrptr->next != &gainLinkDummy) {      /* If entry is not empty, return it */
+        maptab[mapnum] &= ~ mapclr;
+        return (entrptr);
+      }
+      mapclr |= (UINT) 1 << bitnum;               /* Empty entry: its flag will be cleared */
+    }
+    maptab[mapnum] &= ~ mapclr;
+    if (mapval != 0)                              /* If stopped because out of range */
+      return (NULL);
+
+    if (++ mapnum >= mapnnd)                      /* If all map words scanned */
+      return (NULL);
+
+    mapval  = maptab[mapnum];
+    entrnum = mapnum * GAINMAPBITS;
+  }
+}
+
+#endif /* GAIN_NOMAP */
+
 /* This routine allocates and initializes
 ** a gain table structure with the proper
 ** number of subbits.
@@ -148,23 +234,27 @@ const INT                   subbits)
   GainEntr *          entrptr;
   GainTabl *          tablptr;
   INT                 totsize;
+  INT                 mapsize;
 
-  if (gainmax >= GAIN_LINMAX) {                   /* If logarithmic indexing           */
-    totsize = ((sizeof (INT) << 3) - subbits) << (subbits + 1); /* Allocate gain table */
+  totsize = (gainmax >= GAIN_LINMAX)              /* Compute gain table size */
+            ? ((sizeof (INT) << 3) - subbits) << (subbits + 1)
+            : 2 * GAIN_LINMAX;
+#ifndef GAIN_NOMAP
+  mapsize = (totsize + GAINMAPBITS - 1) / GAINMAPBITS; /* Entry bitmap is placed right after the entry array */
+#else /* GAIN_NOMAP */
+  mapsize = 0;
+#endif /* GAIN_NOMAP */
 
-    if ((tablptr = (GainTabl *) memAlloc (sizeof (GainTabl) + (totsize - 1) * sizeof (GainEntr))) == NULL)
-      return (NULL);
+  if ((tablptr = (GainTabl *) memAlloc (sizeof (GainTabl) + (totsize - 1) * sizeof (GainEntr) + mapsize * sizeof (UINT))) == NULL)
+    return (NULL);
 
+  if (gainmax >= GAIN_LINMAX) {                   /* If logarithmic indexing */
     tablptr->tablAdd = gainTablAddLog;
 
     tablptr->subbits = subbits;                   /* Fill gain table fields                    */
     tablptr->submask = (1 << (subbits + 1)) - 1;  /* Mask with all subbits, plus one, set to 1 */
   }
-  else {                                          /* Linear indexing     */
-    totsize = 2 * GAIN_LINMAX;                    /* Allocate gain table */
-
-    if ((tablptr = (GainTabl *) memAlloc (sizeof (GainTabl) + (totsize - 1) * sizeof (GainEntr))) == NULL)
-      return (NULL);
+  else {                                          /* Linear indexing */
 
     tablptr->tablAdd = gainTablAddLin;
     tablptr->subbits = 0;                         /* Fill gain table fields */
@@ -176,6 +266,12 @@ const INT                   subbits)
   tablptr->tend    = tablptr->tabk + (totsize - 1); /* End of gain entry array */
   tablptr->tmin    = tablptr->tend;               /* Entries of extremal gain  */
   tablptr->tmax    = tablptr->tabk;
+#ifndef GAIN_NOMAP
+  tablptr->maptab  = (UINT *) (tablptr->tabk + totsize);
+  memSet (tablptr->maptab, 0, mapsize * sizeof (UINT)); /* No entry flagged yet */
+#else /* GAIN_NOMAP */
+  tablptr->maptab  = NULL;
+#endif /* GAIN_NOMAP */
 
   for (entrptr  = tablptr->tabk;                  /* Initialize gain table entries */
        entrptr <= tablptr->tend;
@@ -214,6 +310,17 @@ GainTabl * const            tablptr)
        entrptr ++)
     entrptr->next = &gainLinkDummy;               /* Point to dummy link area */
 
+#ifndef GAIN_NOMAP
+  if (tablptr->tmin <= tablptr->tmax) {           /* Flush map words of used area; outside entries are empty */
+    INT                 mapnum;
+    INT                 mapnnd;
+
+    mapnum = (INT) (tablptr->tmin - tablptr->tabk) / GAINMAPBITS;
+    mapnnd = (INT) (tablptr->tmax - tablptr->tabk) / GAINMAPBITS;
+    memSet (tablptr->maptab + mapnum, 0, (mapnnd - mapnum + 1) * sizeof (UINT));
+  }
+#endif /* GAIN_NOMAP */
+
   tablptr->tmin = tablptr->tend;                  /* Entries of extremal gain */
   tablptr->tmax = tablptr->tabk;
 }
@@ -252,6 +359,10 @@ const INT                   gain)                 /*+ Gain value              +*
   if (entrptr > tablptr->tmax)
     tablptr->tmax = entrptr;
 
+#ifndef GAIN_NOMAP
+  tablptr->maptab[(entrptr - tablptr->tabk) / GAINMAPBITS] |= (UINT) 1 << ((entrptr - tablptr->tabk) % GAINMAPBITS); /* Flag entry */
+#endif /* GAIN_NOMAP */
+
   headptr = (GainLink *) entrptr;                 /* TRICK: assume gain entry is a link */
   linkptr->tabl       = entrptr;                  /* Set table position                 */
   headptr->next->prev = linkptr;                  /* Link vertex in gain list: TRICK    */
@@ -308,6 +419,10 @@ const INT                   gain)                 /*+ Gain value              +*
     errorPrint ("gainTablAddLog: bad chaining");
 #endif /* SCOTCH_DEBUG_GAIN3 */
 
+#ifndef GAIN_NOMAP
+  tablptr->maptab[(entrptr - tablptr->tabk) / GAINMAPBITS] |= (UINT) 1 << ((entrptr - tablptr->tabk) % GAINMAPBITS); /* Flag entry */
+#endif /* GAIN_NOMAP */
+
   entrptr->next->prev = linkptr;                  /* Link vertex in gain list: TRICK */
   linkptr->prev       = (GainLink *) entrptr;
   linkptr->next       = entrptr->next;
@@ -369,6 +484,18 @@ GainTabl * const            tablptr)
     return (entrptr->next);
   }
 
+#ifndef GAIN_NOMAP
+  if ((entrptr = gainTablScan (tablptr, entrptr + 1, tablptr->tend + 1)) != NULL) { /* If found non-empty slot */
+    tablptr->tmin = entrptr;                      /* Record its position */
+#ifdef SCOTCH_DEBUG_GAIN3
+    if (gainTablCheck (entrptr) != 0) {
+      errorPrint ("gainTablFrst: bad chaining (2)");
+      return     (NULL);
+    }
+#endif /* SCOTCH_DEBUG_GAIN3 */
+    return (entrptr->next);
+  }
+#else /* GAIN_NOMAP */
   for (entrptr ++; entrptr <= tablptr->tend; entrptr ++) {
     if (entrptr->next != &gainLinkDummy) {        /* If found non-empty slot */
       tablptr->tmin = entrptr;                    /* record its position     */
@@ -381,6 +508,7 @@ GainTabl * const            tablptr)
       return (entrptr->next);
     }
   }
+#endif /* GAIN_NOMAP */
   tablptr->tmin = tablptr->tend;                  /* Set table as empty */
   tablptr->tmax = tablptr->tabk;
 
@@ -411,6 +539,17 @@ const GainLink * const      linkptr)
     return (linkptr->next);
   }
 
+#ifndef GAIN_NOMAP
+  if ((entrptr = gainTablScan (tablptr, linkptr->tabl + 1, tablptr->tend)) != NULL) {
+#ifdef SCOTCH_DEBUG_GAIN3
+    if (gainTablCheck (entrptr) != 0) {
+      errorPrint ("gainTablNext: bad chaining (2)");
+      return     (NULL);
+    }
+#endif /* SCOTCH_DEBUG_GAIN3 */
+    return (entrptr->next);
+  }
+#else /* GAIN_NOMAP */
   for (entrptr = linkptr->tabl + 1;
        entrptr < tablptr->tend;
        entrptr ++) {
@@ -424,6 +563,7 @@ const GainLink * const      linkptr)
       return (entrptr->next);
     }
   }
+#endif /* GAIN_NOMAP */
 
   return (NULL);
 }
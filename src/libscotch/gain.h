@@ -46,6 +46,8 @@
 /**                                 to   : 01 jun 2008     **/
 /**                # Version 6.0  : from : 07 jun 2018     **/
 /**                                 to   : 20 aug 2020     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # Most of the contents of this module   **/
 /**                  comes from "map_b_fm" of the SCOTCH   **/
@@ -61,6 +63,11 @@
 
 #define GAIN_LINMAX              1024
 
+/* Define GAIN_NOMAP to revert to the plain
+   linear scanning of gain table entries.   */
+
+#define GAINMAPBITS              ((INT) (sizeof (UINT) << 3)) /* Number of entries per map word */
+
 /*
 **  The type and structure definitions.
 */
@@ -93,6 +100,7 @@ typedef struct GainTabl_ {
   GainEntr *                tmin;                 /*+ Non-empty entry of minimum gain        +*/
   GainEntr *                tmax;                 /*+ Non-empty entry of maximum gain        +*/
   GainEntr *                tend;                 /*+ Last valid gain entry                  +*/
+  UINT *                    maptab;               /*+ Bitmap of possibly non-empty entries   +*/
   GainEntr *                tabl;                 /*+ Gain table structure is.. [SIZE - ADJ] +*/
   GainEntr                  tabk[1];              /*+ Split in two for relative access [ADJ] +*/
 } GainTabl;
@@ -110,17 +118,28 @@ void                        gainTablDel         (GainTabl * const, GainLink * co
 GainLink *                  gainTablFrst        (GainTabl * const);
 GainLink *                  gainTablNext        (GainTabl * const, const GainLink * const);
 void                        gainTablMove        (GainTabl * const, const ptrdiff_t);
-#ifdef SCOTCH_DEBUG_GAIN3
 #ifdef GAIN
+#ifndef GAIN_NOMAP
+#if ! ((defined __GNUC__) || (defined __clang__))
+static INT                  gainMapLowFunc      (UINT);
+#endif /* ! ((defined __GNUC__) || (defined __clang__)) */
+static GainEntr *           gainTablScan        (GainTabl * const, GainEntr *, const GainEntr * const);
+#endif /* GAIN_NOMAP */
+#ifdef SCOTCH_DEBUG_GAIN3
 static int                  gainTablCheck       (GainEntr * const);
 static int                  gainTablCheck2      (GainEntr * const, GainLink * const);
-#endif /* GAIN */
 #endif /* SCOTCH_DEBUG_GAIN3 */
+#endif /* GAIN */
 
 /*
 **  The marco definitions.
 */
 
+#if ((defined __GNUC__) || (defined __clang__))
+#define gainMapLow(v)               ((INT) ((sizeof (UINT) > sizeof (unsigned int)) ? __builtin_ctzll ((unsigned long long) (v)) : __builtin_ctz ((unsigned int) (v))))
+#else /* ((defined __GNUC__) || (defined __clang__)) */
+#define gainMapLow(v)               gainMapLowFunc (v)
+#endif /* ((defined __GNUC__) || (defined __clang__)) */
 #define gainTablEmpty(tabl)         ((tabl)->tmin == (tabl)->tend)
 #define gainTablAdd(tabl,link,gain) ((tabl)->tablAdd  ((tabl), (link), (gain)))
 #if ((! defined GAIN) && (! defined SCOTCH_DEBUG_GAIN1))
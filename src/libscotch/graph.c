@@ -127,8 +127,12 @@ Graph * const               grafptr)
         (grafptr->vendtax != grafptr->verttax + 1) && /* (if vertex arrays grouped, vendtab not distinct anyway) */
         ((grafptr->flagval & GRAPHVERTGROUP) == 0))
       memFree (grafptr->vendtax + grafptr->baseval); /* Then free vendtax                                 */
-    if (grafptr->verttax != NULL)                 /* Free verttab anyway, as it is the array group leader */
-      memFree (grafptr->verttax + grafptr->baseval);
+    if (grafptr->verttax != NULL) {               /* Free verttab anyway, as it is the array group leader */
+      if ((grafptr->flagval & GRAPHVERTMMAP) != 0) /* If all arrays belong to a memory-mapped file         */
+        graphFreeBin (grafptr);
+      else
+        memFree (grafptr->verttax + grafptr->baseval);
+    }
   }
   if ((grafptr->flagval & GRAPHFREEVNUM) != 0) {  /* If vnumtab must be freed         */
     if ((grafptr->vnumtax != NULL) &&             /* And is not in vertex array group */
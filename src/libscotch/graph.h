@@ -64,7 +64,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 10 may 2019     **/
 /**                # Version 7.0  : from : 08 jun 2018     **/
-/**                                 to   : 12 sep 2019     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -85,9 +85,10 @@
 #define GRAPHFREETABS               0x000F        /*+ Free all graph arrays     +*/
 #define GRAPHVERTGROUP              0x0010        /*+ All vertex arrays grouped +*/
 #define GRAPHEDGEGROUP              0x0020        /*+ All edge arrays grouped   +*/
+#define GRAPHVERTMMAP               0x0040        /*+ Vertex group is mapped    +*/
 
-#define GRAPHBITSUSED               0x003F        /*+ Significant bits for plain graph routines               +*/
-#define GRAPHBITSNOTUSED            0x0040        /*+ Value above which bits not used by plain graph routines +*/
+#define GRAPHBITSUSED               0x007F        /*+ Significant bits for plain graph routines               +*/
+#define GRAPHBITSNOTUSED            0x0080        /*+ Value above which bits not used by plain graph routines +*/
 
 #define GRAPHIONOLOADVERT           1             /*+ Remove vertex loads on loading +*/
 #define GRAPHIONOLOADEDGE           2             /*+ Remove edge loads on loading   +*/
@@ -163,15 +164,22 @@ Gnum                        graphBase           (Graph * const, const Gnum);
 int                         graphBand           (const Graph * restrict const, const Gnum, Gnum * restrict const, const Gnum, Gnum * restrict * restrict const, Gnum * restrict const, Gnum * restrict const, Gnum * restrict const, const Gnum * restrict const, Gnum * restrict const);
 int                         graphCheck          (const Graph *);
 int                         graphClone          (const Graph *, Graph *);
+int                         graphColor          (const Graph * restrict const, Gnum * restrict const, Gnum * restrict const, const int, Context * restrict const);
 Gnum                        graphDiamPV         (const Graph * restrict const, Context * restrict const);
 Gnum                        graphIelo           (const Graph * const, Gnum * const, Gnum * const);
-int                         graphInduceList     (const Graph * restrict const, const Gnum, const Gnum * restrict const, Graph * restrict const);
-int                         graphInducePart     (const Graph * restrict const, const GraphPart * restrict const, const Gnum, const GraphPart, Graph * restrict const);
+int                         graphInduceList     (const Graph * restrict const, const Gnum, const Gnum * restrict const, Graph * restrict const, Context * const);
+int                         graphInducePart     (const Graph * restrict const, const GraphPart * restrict const, const Gnum, const GraphPart, Graph * restrict const, Context * const);
 int                         graphLoad           (Graph * const, FILE * const, const Gnum, const GraphFlag);
 int                         graphLoad2          (const Gnum, const Gnum, const Gnum * const, const Gnum * const, Gnum * restrict const, const Gnum, const Gnum * const);
+int                         graphLoadCont       (Graph * const, FILE * const, const Gnum, const GraphFlag, Context * const);
+int                         graphLoadBin        (Graph * const, FILE * const, const Gnum, const GraphFlag);
+void                        graphFreeBin        (Graph * const);
 int                         graphSave           (const Graph * const, FILE * const);
+int                         graphSaveBin        (const Graph * const, FILE * const);
 
 #ifdef GEOM_H
+int                         graphGeomLoadBin    (Graph * restrict const, Geom * restrict const, FILE * const, FILE * const, const char * const);
+int                         graphGeomSaveBin    (const Graph * restrict const, const Geom * restrict const, FILE * const, FILE * const, const char * const);
 int                         graphGeomLoadChac   (Graph * restrict const, Geom * restrict const, FILE * const, FILE * const, const char * const);
 int                         graphGeomSaveChac   (const Graph * restrict const, const Geom * restrict const, FILE * const, FILE * const, const char * const);
 int                         graphGeomLoadHabo   (Graph * restrict const, Geom * restrict const, FILE * const, FILE * const, const char * const);
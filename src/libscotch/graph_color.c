@@ -0,0 +1,415 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_color.c                           **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module computes colorings of       **/
+/**                source graphs.                          **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/**   NOTES      : # The default method is a variant of    **/
+/**                  the Jones-Plassmann algorithm. At     **/
+/**                  each round, every uncolored vertex    **/
+/**                  whose uncolored neighbors all have    **/
+/**                  lower priorities takes the smallest   **/
+/**                  color not used by its neighbors.      **/
+/**                  Since vertices colored in the same    **/
+/**                  round form an independent set, the    **/
+/**                  result is the same as the one of a    **/
+/**                  sequential greedy coloring in         **/
+/**                  decreasing priority order, whatever   **/
+/**                  the number of threads.                **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define GRAPH
+#define GRAPH_COLOR
+
+#include "module.h"
+#include "common.h"
+#include "graph.h"
+#include "graph_color.h"
+
+/*****************************/
+/*                           */
+/* Jones-Plassmann coloring. */
+/*                           */
+/*****************************/
+
+/* This routine performs the coloring of
+** the vertex range of the current thread.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphColorThr (
+ThreadDescriptor * restrict const descptr,
+GraphColorData * restrict const   dataptr)
+{
+  Gnum                vertbas;
+  Gnum                vertnnd;
+  Gnum                vertnum;
+  Gnum                queunnd;
+  Gnum                colonbr;
+
+  const int                         thrdnbr = threadNbr (descptr);
+  const int                         thrdnum = threadNum (descptr);
+  GraphColorThread * restrict const thrdtab = dataptr->thrdtab;
+  const Graph * restrict const      grafptr = dataptr->grafptr;
+  const Gnum * restrict const       verttax = grafptr->verttax;
+  const Gnum * restrict const       vendtax = grafptr->vendtax;
+  const Gnum * restrict const       edgetax = grafptr->edgetax;
+  const Gnum * restrict const       randtax = dataptr->randtax;
+  Gnum * restrict const             colotax = dataptr->colotax;
+  Gnum * restrict const             queutax = dataptr->queutax;
+  Gnum * restrict const             listtax = dataptr->listtax;
+  Gnum * restrict const             marktab = dataptr->marktab + thrdnum * (grafptr->degrmax + 1);
+  const Gnum                        degrmsk = dataptr->degrmsk;
+
+  vertbas = grafptr->baseval + DATASCAN (grafptr->vertnbr, thrdnbr, thrdnum);
+  vertnnd = grafptr->baseval + DATASCAN (grafptr->vertnbr, thrdnbr, thrdnum + 1);
+  for (vertnum = vertbas; vertnum < vertnnd; vertnum ++) /* Local queue contains all local vertices */
+    queutax[vertnum] = vertnum;
+  memSet (marktab, ~0, (grafptr->degrmax + 1) * sizeof (Gnum));
+
+  for (queunnd = vertnnd, colonbr = 0; ; ) {
+    Gnum                queunum;
+    Gnum                queunew;
+    Gnum                listnnd;
+    Gnum                listnum;
+    Gnum                queusum;
+    int                 thrdtmp;
+
+    for (queunum = queunew = listnnd = vertbas; queunum < queunnd; queunum ++) {
+      Gnum                vertnum;
+      Gnum                edgenum;
+      Gnum                edgennd;
+      Gnum                degrval;
+      Gnum                randval;
+
+      vertnum = queutax[queunum];
+      degrval = (vendtax[vertnum] - verttax[vertnum]) & degrmsk;
+      randval = randtax[vertnum];
+      for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum]; edgenum < edgennd; edgenum ++) {
+        Gnum                vertend;
+        Gnum                degrend;
+        Gnum                randend;
+
+        vertend = edgetax[edgenum];
+        if (colotax[vertend] >= 0)                /* Skip neighbors colored in previous rounds */
+          continue;
+
+        degrend = (vendtax[vertend] - verttax[vertend]) & degrmsk;
+        randend = randtax[vertend];
+        if ((degrend > degrval) ||
+            ((degrend == degrval) &&
+             ((randend > randval) ||
+              ((randend == randval) && (vertend > vertnum))))) /* Tie breaking when same priority */
+          break;
+      }
+      if (edgenum >= edgennd)                     /* If vertex has highest priority among uncolored neighbors */
+        listtax[listnnd ++] = vertnum;
+      else
+        queutax[queunew ++] = vertnum;
+    }
+    queunnd = queunew;
+    thrdtab[thrdnum].queunbr = queunnd - vertbas;
+
+    threadBarrier (descptr);                      /* Colors must not change before all selections are made */
+
+    for (listnum = vertbas; listnum < listnnd; listnum ++) { /* Neighbors of listed vertices cannot be listed */
+      Gnum                vertnum;
+      Gnum                edgenum;
+      Gnum                edgennd;
+      Gnum                coloval;
+
+      vertnum = listtax[listnum];
+      for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum]; edgenum < edgennd; edgenum ++) {
+        Gnum                coloend;
+
+        coloend = colotax[edgetax[edgenum]];
+        if (coloend >= 0)
+          marktab[coloend] = vertnum;             /* Flag color as used by neighbor of vertex */
+      }
+      for (coloval = 0; marktab[coloval] == vertnum; coloval ++) ; /* Find smallest unused color */
+      colotax[vertnum] = coloval;
+      if (coloval >= colonbr)
+        colonbr = coloval + 1;
+    }
+
+    for (thrdtmp = 0, queusum = 0; thrdtmp < thrdnbr; thrdtmp ++) /* Sum queue sizes before they are updated */
+      queusum += thrdtab[thrdtmp].queunbr;
+
+    threadBarrier (descptr);                      /* New colors must be known before next selection round */
+
+    if (queusum <= 0)                             /* All threads take the same decision */
+      break;
+  }
+
+  thrdtab[thrdnum].colonbr = colonbr;
+}
+
+/**************************/
+/*                        */
+/* Smallest-last coloring */
+/*                        */
+/**************************/
+
+/* This routine computes a greedy coloring
+** of the given graph, in the reverse order
+** of its smallest-last vertex ordering,
+** obtained by repeatedly removing a vertex
+** of smallest remaining degree. Vertices
+** are sorted by degree buckets, in linear
+** time.
+** It returns:
+** - 0   : if the coloring has been computed.
+** - !0  : on error.
+*/
+
+static
+int
+graphColorSmallest (
+const Graph * restrict const  grafptr,
+Gnum * restrict const         colotax,
+Gnum * restrict const         coloptr)
+{
+  Gnum                baseval;
+  Gnum                vertnbr;
+  Gnum                vertnnd;
+  Gnum                vertnum;
+  Gnum                degrmax;
+  Gnum                degrnum;
+  Gnum                degrtmp;
+  Gnum                ordenum;
+  Gnum                colonbr;
+  Gnum * restrict     degrtax;                    /* Remaining degree of vertices      */
+  Gnum * restrict     postax;                     /* Position of vertices in order     */
+  Gnum * restrict     ordetab;                    /* Vertices sorted by current degree */
+  Gnum * restrict     bucktab;                    /* Start index of degree buckets     */
+  Gnum * restrict     marktab;                    /* Flag array for used colors        */
+
+  const Gnum * restrict const verttax = grafptr->verttax;
+  const Gnum * restrict const vendtax = grafptr->vendtax;
+  const Gnum * restrict const edgetax = grafptr->edgetax;
+
+  baseval = grafptr->baseval;
+  vertnbr = grafptr->vertnbr;
+  vertnnd = vertnbr + baseval;
+  degrmax = grafptr->degrmax;
+
+  if (memAllocGroup ((void **) (void *)
+                     &degrtax, (size_t) (vertnbr       * sizeof (Gnum)),
+                     &postax,  (size_t) (vertnbr       * sizeof (Gnum)),
+                     &ordetab, (size_t) (vertnbr       * sizeof (Gnum)),
+                     &bucktab, (size_t) ((degrmax + 1) * sizeof (Gnum)),
+                     &marktab, (size_t) ((degrmax + 1) * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("graphColorSmallest: out of memory");
+    return     (1);
+  }
+  degrtax -= baseval;
+  postax  -= baseval;
+
+  memSet (bucktab, 0, (degrmax + 1) * sizeof (Gnum));
+  for (vertnum = baseval; vertnum < vertnnd; vertnum ++) {
+    Gnum                degrval;
+
+    degrval = vendtax[vertnum] - verttax[vertnum];
+    degrtax[vertnum] = degrval;
+    bucktab[degrval] ++;
+  }
+  for (degrnum = degrtmp = 0; degrnum <= degrmax; degrnum ++) { /* Compute start indices of buckets */
+    Gnum                degrsiz;
+
+    degrsiz = bucktab[degrnum];
+    bucktab[degrnum] = degrtmp;
+    degrtmp += degrsiz;
+  }
+  for (vertnum = baseval; vertnum < vertnnd; vertnum ++) {
+    Gnum                ordenum;
+
+    ordenum = bucktab[degrtax[vertnum]] ++;
+    postax[vertnum]  = ordenum;
+    ordetab[ordenum] = vertnum;
+  }
+  for (degrnum = degrmax; degrnum > 0; degrnum --) /* Restore start indices of buckets */
+    bucktab[degrnum] = bucktab[degrnum - 1];
+  bucktab[0] = 0;
+
+  for (ordenum = 0; ordenum < vertnbr; ordenum ++) { /* Remove vertices in increasing remaining degree order */
+    Gnum                vertnum;
+    Gnum                edgenum;
+    Gnum                edgennd;
+
+    vertnum = ordetab[ordenum];
+    degrtax[vertnum] = -1;                        /* Flag vertex as removed */
+    for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum]; edgenum < edgennd; edgenum ++) {
+      Gnum                vertend;
+      Gnum                degrend;
+
+      vertend = edgetax[edgenum];
+      degrend = degrtax[vertend];
+      if (degrend >= 0) {                         /* If neighbor not yet removed, move it to lower bucket */
+        Gnum                posend;
+        Gnum                posfst;
+        Gnum                vertfst;
+
+        posend = postax[vertend];
+        posfst = bucktab[degrend];                /* Swap neighbor with first remaining vertex of its bucket */
+        if (posfst <= ordenum)                    /* Skip removed vertices still accounted in bucket      */
+          posfst = ordenum + 1;
+        vertfst = ordetab[posfst];
+        if (vertfst != vertend) {
+          postax[vertend]  = posfst;
+          ordetab[posfst]  = vertend;
+          postax[vertfst]  = posend;
+          ordetab[posend]  = vertfst;
+        }
+        bucktab[degrend] = posfst + 1;
+        degrtax[vertend] = degrend - 1;
+      }
+    }
+  }
+
+  memSet (marktab, ~0, (degrmax + 1) * sizeof (Gnum));
+  for (ordenum = vertnbr - 1, colonbr = 0; ordenum >= 0; ordenum --) { /* Color vertices in reverse removal order */
+    Gnum                vertnum;
+    Gnum                edgenum;
+    Gnum                edgennd;
+    Gnum                coloval;
+
+    vertnum = ordetab[ordenum];
+    for (edgenum = verttax[vertnum], edgennd = vendtax[vertnum]; edgenum < edgennd; edgenum ++) {
+      Gnum                coloend;
+
+      coloend = colotax[edgetax[edgenum]];
+      if (coloend >= 0)
+        marktab[coloend] = vertnum;
+    }
+    for (coloval = 0; marktab[coloval] == vertnum; coloval ++) ;
+    colotax[vertnum] = coloval;
+    if (coloval >= colonbr)
+      colonbr = coloval + 1;
+  }
+
+  *coloptr = colonbr;
+
+  memFree (degrtax + baseval);
+
+  return (0);
+}
+
+/*************************/
+/*                       */
+/* The coloring routine. */
+/*                       */
+/*************************/
+
+/* This routine computes a coloring of the
+** given graph. Color values are not based.
+** Flag GRAPHCOLORSMALLEST selects a sequential
+** smallest-last greedy coloring; else, vertices
+** are colored in parallel by decreasing random
+** priorities, refined by decreasing degrees
+** if flag GRAPHCOLORDEGREE is set.
+** It returns:
+** - 0   : if the coloring has been computed.
+** - !0  : on error.
+*/
+
+int
+graphColor (
+const Graph * restrict const  grafptr,            /* Graph to color              */
+Gnum * restrict const         colotax,            /* Color array                 */
+Gnum * restrict const         coloptr,            /* Pointer to number of colors */
+const int                     flagval,            /* Coloring flags              */
+Context * restrict const      contptr)            /* Execution context           */
+{
+  GraphColorData      datadat;
+  Gnum                vertnum;
+  Gnum * restrict     randtax;
+  Gnum                colonbr;
+  int                 thrdnbr;
+  int                 thrdnum;
+
+  const Gnum          baseval = grafptr->baseval;
+  const Gnum          vertnbr = grafptr->vertnbr;
+
+  memSet (colotax + baseval, ~0, vertnbr * sizeof (Gnum)); /* No vertex colored yet */
+
+  if ((flagval & GRAPHCOLORSMALLEST) != 0)
+    return (graphColorSmallest (grafptr, colotax, coloptr));
+
+  thrdnbr = contextThreadNbr (contptr);
+  if (memAllocGroup ((void **) (void *)
+                     &datadat.queutax, (size_t) (vertnbr * sizeof (Gnum)),
+                     &datadat.listtax, (size_t) (vertnbr * sizeof (Gnum)),
+                     &randtax,         (size_t) (vertnbr * sizeof (Gnum)),
+                     &datadat.marktab, (size_t) (thrdnbr * (grafptr->degrmax + 1) * sizeof (Gnum)),
+                     &datadat.thrdtab, (size_t) (thrdnbr * sizeof (GraphColorThread)), NULL) == NULL) {
+    errorPrint ("graphColor: out of memory");
+    return     (1);
+  }
+  datadat.queutax -= baseval;
+  datadat.listtax -= baseval;
+  randtax         -= baseval;
+
+  for (vertnum = baseval; vertnum < (vertnbr + baseval); vertnum ++)
+    randtax[vertnum] = contextIntRandVal (contptr, 32768);
+
+  datadat.grafptr = grafptr;
+  datadat.colotax = colotax;
+  datadat.randtax = randtax;
+  datadat.degrmsk = ((flagval & GRAPHCOLORDEGREE) != 0) ? ~0 : 0;
+  contextThreadLaunch (contptr, (ThreadFunc) graphColorThr, (void *) &datadat);
+
+  for (thrdnum = 0, colonbr = 0; thrdnum < thrdnbr; thrdnum ++) {
+    if (colonbr < datadat.thrdtab[thrdnum].colonbr)
+      colonbr = datadat.thrdtab[thrdnum].colonbr;
+  }
+  *coloptr = colonbr;
+
+  memFree (datadat.queutax + baseval);            /* Free group leader */
+
+  return (0);
+}
@@ -0,0 +1,92 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_color.h                           **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the source graph coloring           **/
+/**                routines.                               **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ Graph coloring flags. Their values must be
+    equal to those defined in library.h and
+    library_f.h                                +*/
+
+#define GRAPHCOLORNONE              0x0000        /* Random vertex priorities          */
+#define GRAPHCOLORDEGREE            0x0001        /* Largest-degree-first priorities   */
+#define GRAPHCOLORSMALLEST          0x0002        /* Smallest-last vertex ordering     */
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The thread-specific data block. +*/
+
+typedef struct GraphColorThread_ {
+  Gnum                      queunbr;              /*+ Number of vertices still to color in range +*/
+  Gnum                      colonbr;              /*+ Local number of colors                     +*/
+} GraphColorThread;
+
+/*+ The coloring parameter structure.
+    It contains the thread-independent
+    data.                              +*/
+
+typedef struct GraphColorData_ {
+  const Graph *             grafptr;              /*+ Graph to color                             +*/
+  Gnum *                    colotax;              /*+ Color array                                +*/
+  const Gnum *              randtax;              /*+ Random priority array                      +*/
+  Gnum *                    queutax;              /*+ Queue of vertices still to color           +*/
+  Gnum *                    listtax;              /*+ List of vertices to color in current round +*/
+  Gnum *                    marktab;              /*+ Per-thread color flag arrays               +*/
+  Gnum                      degrmsk;              /*+ Mask applied to degrees before comparison  +*/
+  GraphColorThread *        thrdtab;              /*+ Array of thread-specific data              +*/
+} GraphColorData;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef GRAPH_COLOR
+static void                 graphColorThr       (ThreadDescriptor * restrict const, GraphColorData * restrict const);
+static int                  graphColorSmallest  (const Graph * restrict const, Gnum * restrict const, Gnum * restrict const);
+#endif /* GRAPH_COLOR */
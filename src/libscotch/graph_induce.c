@@ -59,6 +59,8 @@
 /**                                 to   : 01 jan 2009     **/
 /**                # Version 6.0  : from : 29 mar 2011     **/
 /**                                 to   : 05 apr 2018     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # Several algorithms, such as the       **/
 /**                  active graph building routine of      **/
@@ -67,6 +69,12 @@
 /**                  in the same order as in the original  **/
 /**                  graph. This must be enforced.         **/
 /**                                                        **/
+/**                # The multi-threaded routines compute   **/
+/**                  vertex and edge start indices by      **/
+/**                  prefix scans over contiguous vertex   **/
+/**                  ranges, so that the induced graph is  **/
+/**                  identical to the sequential one.      **/
+/**                                                        **/
 /************************************************************/
 
 /*
@@ -81,6 +89,274 @@
 #include "graph.h"
 #include "graph_induce.h"
 
+/****************************/
+/*                          */
+/* Multi-threaded routines. */
+/*                          */
+/****************************/
+
+#ifndef GRAPHINDUCENOTHREAD
+
+/* This routine sums the vertex and
+** edge loads of the induced graph.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphInduceReduce (
+GraphInduceThread * restrict const  tlocptr,      /* Pointer to local thread block  */
+GraphInduceThread * restrict const  tremptr,      /* Pointer to remote thread block */
+const void * const                  globptr)      /* Unused                         */
+{
+  tlocptr->velosum += tremptr->velosum;
+  tlocptr->edlosum += tremptr->edlosum;
+}
+
+/* This routine performs a prefix scan
+** sum operation on a pair of Gnum values,
+** backed by a temporary area.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphInduceScan (
+Gnum * restrict const       tlocptr,              /* Pointer to local area   */
+Gnum * restrict const       tremptr,              /* Pointer to remote area  */
+const int                   srcpval,              /* Source phase value      */
+const int                   dstpval,              /* Destination phase value */
+const void * const          globptr)              /* Unused                  */
+{
+  tlocptr[dstpval]     = tlocptr[srcpval]     + ((tremptr == NULL) ? 0 : tremptr[srcpval]);
+  tlocptr[dstpval + 2] = tlocptr[srcpval + 2] + ((tremptr == NULL) ? 0 : tremptr[srcpval + 2]);
+}
+
+/* This routine marks the vertices of the
+** given list in the index array, and sums
+** their degrees.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphInduceListThr (
+ThreadDescriptor * restrict const descptr,
+GraphInduceData * restrict const  dataptr)
+{
+  Gnum                orgvertnum;
+  Gnum                orgvertnnd;
+  Gnum                indvertnum;
+  Gnum                indvertnnd;
+  Gnum                indedgenbr;
+
+  const int                           thrdnbr = threadNbr (descptr);
+  const int                           thrdnum = threadNum (descptr);
+  GraphInduceThread * restrict const  thrdptr = &dataptr->thrdtab[thrdnum];
+  const Graph * restrict const        orggrafptr = dataptr->orggrafptr;
+  Graph * restrict const              indgrafptr = dataptr->indgrafptr;
+  const Gnum * restrict const         orgverttax = orggrafptr->verttax;
+  const Gnum * restrict const         orgvendtax = orggrafptr->vendtax;
+  const Gnum * restrict const         indvnumtab = dataptr->indvnumtab;
+  Gnum * restrict const               orgindxtax = indgrafptr->edlotax; /* TRICK: use edlotax as return slot for orgindxtax */
+  Gnum * restrict const               indvnumtax = indgrafptr->vnumtax;
+
+  orgvertnum = orggrafptr->baseval + DATASCAN (orggrafptr->vertnbr, thrdnbr, thrdnum);
+  orgvertnnd = orggrafptr->baseval + DATASCAN (orggrafptr->vertnbr, thrdnbr, thrdnum + 1);
+  memSet (orgindxtax + orgvertnum, ~0, (orgvertnnd - orgvertnum) * sizeof (Gnum)); /* Preset local part of index array */
+
+  threadBarrier (descptr);                        /* Index array must be fully preset before marking */
+
+  indvertnum = DATASCAN (dataptr->indvertnbr, thrdnbr, thrdnum);
+  indvertnnd = DATASCAN (dataptr->indvertnbr, thrdnbr, thrdnum + 1);
+  for (indedgenbr = 0; indvertnum < indvertnnd; indvertnum ++) {
+    Gnum                orgvertnum;
+
+    orgvertnum = indvnumtab[indvertnum];
+    indvnumtax[indvertnum + indgrafptr->baseval] = orgvertnum; /* Copy vertex number array from list */
+    orgindxtax[orgvertnum] = indvertnum + indgrafptr->baseval; /* Mark selected vertices             */
+    indedgenbr += orgvendtax[orgvertnum] - orgverttax[orgvertnum];
+  }
+
+  thrdptr->scantab[0] = 0;                        /* Only edge count matters */
+  thrdptr->scantab[2] = indedgenbr;
+  threadScan (descptr, (void *) &thrdptr->scantab[0], sizeof (GraphInduceThread), (ThreadScanFunc) graphInduceScan, NULL);
+  if (thrdnum == (thrdnbr - 1))                   /* Last thread knows overall number of edges */
+    dataptr->indedgenbr = thrdptr->scantab[2];
+}
+
+/* This routine marks the vertices of the
+** given part in the index array, and sums
+** their degrees.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphInducePartThr (
+ThreadDescriptor * restrict const descptr,
+GraphInduceData * restrict const  dataptr)
+{
+  Gnum                orgvertbas;
+  Gnum                orgvertnnd;
+  Gnum                orgvertnum;
+  Gnum                indvertnbr;
+  Gnum                indvertnum;
+  Gnum                indedgenbr;
+
+  const int                           thrdnbr = threadNbr (descptr);
+  const int                           thrdnum = threadNum (descptr);
+  GraphInduceThread * restrict const  thrdptr = &dataptr->thrdtab[thrdnum];
+  const Graph * restrict const        orggrafptr = dataptr->orggrafptr;
+  Graph * restrict const              indgrafptr = dataptr->indgrafptr;
+  const Gnum * restrict const         orgverttax = orggrafptr->verttax;
+  const Gnum * restrict const         orgvendtax = orggrafptr->vendtax;
+  const GraphPart * restrict const    orgparttax = dataptr->orgparttax;
+  const GraphPart                     indpartval = dataptr->indpartval;
+  Gnum * restrict const               orgindxtax = indgrafptr->edlotax; /* TRICK: use edlotax as return slot for orgindxtax */
+  Gnum * restrict const               indvnumtax = indgrafptr->vnumtax;
+
+  orgvertbas = orggrafptr->baseval + DATASCAN (orggrafptr->vertnbr, thrdnbr, thrdnum);
+  orgvertnnd = orggrafptr->baseval + DATASCAN (orggrafptr->vertnbr, thrdnbr, thrdnum + 1);
+  for (orgvertnum = orgvertbas, indvertnbr = indedgenbr = 0; /* Count local selected vertices and their edges */
+       orgvertnum < orgvertnnd; orgvertnum ++) {
+    if (orgparttax[orgvertnum] == indpartval) {
+      indvertnbr ++;
+      indedgenbr += orgvendtax[orgvertnum] - orgverttax[orgvertnum];
+    }
+  }
+
+  thrdptr->scantab[0] = indvertnbr;
+  thrdptr->scantab[2] = indedgenbr;
+  threadScan (descptr, (void *) &thrdptr->scantab[0], sizeof (GraphInduceThread), (ThreadScanFunc) graphInduceScan, NULL);
+
+  for (orgvertnum = orgvertbas, indvertnum = indgrafptr->baseval + thrdptr->scantab[0] - indvertnbr; /* Fill index array */
+       orgvertnum < orgvertnnd; orgvertnum ++) {
+    if (orgparttax[orgvertnum] == indpartval) {   /* If vertex should be kept */
+      orgindxtax[orgvertnum] = indvertnum;        /* Mark selected vertex     */
+      indvnumtax[indvertnum] = orgvertnum;
+      indvertnum ++;                              /* One more induced vertex created */
+    }
+    else
+      orgindxtax[orgvertnum] = ~0;
+  }
+
+  if (thrdnum == (thrdnbr - 1)) {                 /* Last thread knows overall numbers of vertices and edges */
+    dataptr->indvertnbr = thrdptr->scantab[0];
+    dataptr->indedgenbr = thrdptr->scantab[2];
+  }
+}
+
+/* This routine fills the vertex and
+** edge arrays of the induced graph.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphInduce3Thr (
+ThreadDescriptor * restrict const descptr,
+GraphInduceData * restrict const  dataptr)
+{
+  Gnum                indvertbas;
+  Gnum                indvertnnd;
+  Gnum                indvertnum;
+  Gnum                indedgenbr;
+  Gnum                indedgenum;
+  Gnum                indvelosum;
+  Gnum                indedlosum;
+
+  const int                           thrdnbr = threadNbr (descptr);
+  const int                           thrdnum = threadNum (descptr);
+  GraphInduceThread * restrict const  thrdptr = &dataptr->thrdtab[thrdnum];
+  const Graph * restrict const        orggrafptr = dataptr->orggrafptr;
+  Graph * restrict const              indgrafptr = dataptr->indgrafptr;
+  const Gnum * restrict const         orgverttax = orggrafptr->verttax;
+  const Gnum * restrict const         orgvendtax = orggrafptr->vendtax;
+  const Gnum * restrict const         orgvelotax = orggrafptr->velotax;
+  const Gnum * restrict const         orgvnumtax = orggrafptr->vnumtax;
+  const Gnum * restrict const         orgedgetax = orggrafptr->edgetax;
+  const Gnum * restrict const         orgedlotax = orggrafptr->edlotax;
+  const Gnum * restrict const         orgindxtax = indgrafptr->edlotax; /* TRICK: get orgindxtax from edlotax */
+  Gnum * restrict const               indverttax = indgrafptr->verttax;
+  Gnum * restrict const               indvelotax = indgrafptr->velotax;
+  Gnum * restrict const               indvnumtax = indgrafptr->vnumtax;
+  Gnum * restrict const               indedgetax = dataptr->indedgetax;
+  Gnum * restrict const               indedlotax = dataptr->indedlotax;
+
+  indvertbas = indgrafptr->baseval + DATASCAN (dataptr->indvertnbr, thrdnbr, thrdnum);
+  indvertnnd = indgrafptr->baseval + DATASCAN (dataptr->indvertnbr, thrdnbr, thrdnum + 1);
+  for (indvertnum = indvertbas, indedgenbr = 0; indvertnum < indvertnnd; indvertnum ++) { /* Count local induced edges */
+    Gnum                orgvertnum;
+    Gnum                orgedgenum;
+
+    orgvertnum = indvnumtax[indvertnum];
+    for (orgedgenum = orgverttax[orgvertnum];
+         orgedgenum < orgvendtax[orgvertnum]; orgedgenum ++) {
+      if (orgindxtax[orgedgetax[orgedgenum]] != ~0) /* If edge should be kept */
+        indedgenbr ++;
+    }
+  }
+
+  thrdptr->scantab[0] = 0;                        /* Only edge count matters */
+  thrdptr->scantab[2] = indedgenbr;
+  threadScan (descptr, (void *) &thrdptr->scantab[0], sizeof (GraphInduceThread), (ThreadScanFunc) graphInduceScan, NULL);
+
+  indvelosum = 0;
+  indedlosum = 0;
+  for (indvertnum = indvertbas, indedgenum = indgrafptr->baseval + thrdptr->scantab[2] - indedgenbr;
+       indvertnum < indvertnnd; indvertnum ++) {
+    Gnum                orgvertnum;
+    Gnum                orgedgenum;
+
+    orgvertnum = indvnumtax[indvertnum];
+    indverttax[indvertnum] = indedgenum;
+    if (indvelotax != NULL) {                     /* If graph has vertex weights */
+      indvelosum +=                               /* Accumulate vertex loads     */
+      indvelotax[indvertnum] = orgvelotax[orgvertnum];
+    }
+
+    if (indedlotax != NULL) {                     /* If graph has edge weights */
+      for (orgedgenum = orgverttax[orgvertnum];
+           orgedgenum < orgvendtax[orgvertnum]; orgedgenum ++) {
+        if (orgindxtax[orgedgetax[orgedgenum]] != ~0) { /* If edge should be kept */
+          indedlosum            +=
+          indedlotax[indedgenum] = orgedlotax[orgedgenum];
+          indedgetax[indedgenum] = orgindxtax[orgedgetax[orgedgenum]];
+          indedgenum ++;
+        }
+      }
+    }
+    else {
+      for (orgedgenum = orgverttax[orgvertnum];
+           orgedgenum < orgvendtax[orgvertnum]; orgedgenum ++) {
+        if (orgindxtax[orgedgetax[orgedgenum]] != ~0) { /* If edge should be kept */
+          indedgetax[indedgenum] = orgindxtax[orgedgetax[orgedgenum]];
+          indedgenum ++;
+        }
+      }
+    }
+  }
+  if (thrdnum == (thrdnbr - 1))                   /* Last thread marks end of edge array */
+    indverttax[indvertnnd] = indedgenum;
+
+  if (orgvnumtax != NULL) {                       /* Adjust local part of vnumtax */
+    for (indvertnum = indvertbas; indvertnum < indvertnnd; indvertnum ++)
+      indvnumtax[indvertnum] = orgvnumtax[indvnumtax[indvertnum]];
+  }
+
+  thrdptr->velosum = indvelosum;
+  thrdptr->edlosum = indedlosum;
+  threadReduce (descptr, thrdptr, sizeof (GraphInduceThread), (ThreadReduceFunc) graphInduceReduce, 0, NULL);
+}
+
+#endif /* GRAPHINDUCENOTHREAD */
+
 /****************************************/
 /*                                      */
 /* These routines handle source graphs. */
@@ -104,7 +380,8 @@ graphInduceList (
 const Graph * restrict const    orggrafptr,
 const Gnum                      indvnumnbr,
 const Gnum * restrict const     indvnumtab,
-Graph * restrict const          indgrafptr)
+Graph * restrict const          indgrafptr,
+Context * const                 contptr)          /* Execution context, if any */
 {
   Gnum * restrict       orgindxtax;               /* Based access to vertex translation array       */
   Gnum                  indvertnnd;
@@ -120,6 +397,27 @@ Graph * restrict const          indgrafptr)
     return     (1);
   }
 
+#ifndef GRAPHINDUCENOTHREAD
+  if ((contptr != NULL) && (contextThreadNbr (contptr) > 1) && /* If induction can be performed in parallel */
+      (orggrafptr->vertnbr >= GRAPHINDUCETHRDSIZ)) {
+    GraphInduceData     datadat;
+
+    if ((datadat.thrdtab = (GraphInduceThread *) memAlloc (contextThreadNbr (contptr) * sizeof (GraphInduceThread))) == NULL) {
+      errorPrint ("graphInduceList: out of memory");
+      graphExit  (indgrafptr);
+      return     (1);
+    }
+    datadat.orggrafptr = orggrafptr;
+    datadat.indgrafptr = indgrafptr;
+    datadat.indvnumtab = indvnumtab;
+    datadat.indvertnbr = indvnumnbr;
+    contextThreadLaunch (contptr, (ThreadFunc) graphInduceListThr, (void *) &datadat);
+    memFree (datadat.thrdtab);
+
+    return (graphInduce3 (orggrafptr, indgrafptr, indvnumnbr, datadat.indedgenbr, contptr));
+  }
+#endif /* GRAPHINDUCENOTHREAD */
+
   memCpy (indgrafptr->vnumtax + indgrafptr->baseval, /* Copy vertex number array from list */
           indvnumtab, indvnumnbr * sizeof (Gnum));
 
@@ -137,7 +435,7 @@ Graph * restrict const          indgrafptr)
     indedgenbr += orgvendtax[orgvertnum] - orgverttax[orgvertnum];
   }
 
-  return (graphInduce3 (orggrafptr, indgrafptr, indvnumnbr, indedgenbr));
+  return (graphInduce3 (orggrafptr, indgrafptr, indvnumnbr, indedgenbr, contptr));
 }
 
 /* This routine builds the graph induced
@@ -158,7 +456,8 @@ const Graph * restrict const  orggrafptr,         /* Pointer to original graph
 const GraphPart * const       orgparttax,         /* Based array of vertex partition flags */
 const Gnum                    indvnumnbr,         /* Number of vertices in selected part   */
 const GraphPart               indpartval,         /* Partition value of vertices to keep   */
-Graph * restrict const        indgrafptr)         /* Pointer to induced subgraph           */
+Graph * restrict const        indgrafptr,         /* Pointer to induced subgraph           */
+Context * const               contptr)            /* Execution context, if any             */
 {
   Gnum * restrict     orgindxtax;                 /* Based access to vertex translation array       */
   Gnum                orgvertnum;
@@ -174,6 +473,34 @@ Graph * restrict const        indgrafptr)         /* Pointer to induced subgraph
     return     (1);
   }
 
+#ifndef GRAPHINDUCENOTHREAD
+  if ((contptr != NULL) && (contextThreadNbr (contptr) > 1) && /* If induction can be performed in parallel */
+      (orggrafptr->vertnbr >= GRAPHINDUCETHRDSIZ)) {
+    GraphInduceData     datadat;
+
+    if ((datadat.thrdtab = (GraphInduceThread *) memAlloc (contextThreadNbr (contptr) * sizeof (GraphInduceThread))) == NULL) {
+      errorPrint ("graphInducePart: out of memory");
+      graphExit  (indgrafptr);
+      return     (1);
+    }
+    datadat.orggrafptr = orggrafptr;
+    datadat.indgrafptr = indgrafptr;
+    datadat.orgparttax = orgparttax;
+    datadat.indpartval = indpartval;
+    contextThreadLaunch (contptr, (ThreadFunc) graphInducePartThr, (void *) &datadat);
+    memFree (datadat.thrdtab);
+#ifdef SCOTCH_DEBUG_GRAPH2
+    if (datadat.indvertnbr != indvnumnbr) {
+      errorPrint ("graphInducePart: inconsistent data (1)");
+      graphExit  (indgrafptr);
+      return     (1);
+    }
+#endif /* SCOTCH_DEBUG_GRAPH2 */
+
+    return (graphInduce3 (orggrafptr, indgrafptr, indvnumnbr, datadat.indedgenbr, contptr));
+  }
+#endif /* GRAPHINDUCENOTHREAD */
+
   orgindxtax = indgrafptr->edlotax;
   indvnumtax = indgrafptr->vnumtax;
   for (orgvertnum = indvertnum = orggrafptr->baseval, indedgenbr = 0; /* Fill index array */
@@ -189,13 +516,13 @@ Graph * restrict const        indgrafptr)         /* Pointer to induced subgraph
   }
 #ifdef SCOTCH_DEBUG_GRAPH2
   if ((indvertnum - indgrafptr->baseval) != indvnumnbr) {
-    errorPrint ("graphInducePart: inconsistent data");
+    errorPrint ("graphInducePart: inconsistent data (2)");
     graphExit  (indgrafptr);
     return     (1);
   }
 #endif /* SCOTCH_DEBUG_GRAPH2 */
 
-  return (graphInduce3 (orggrafptr, indgrafptr, indvnumnbr, indedgenbr));
+  return (graphInduce3 (orggrafptr, indgrafptr, indvnumnbr, indedgenbr, contptr));
 }
 
 /* This routine initializes the induced
@@ -275,7 +602,8 @@ graphInduce3 (
 const Graph * restrict const  orggrafptr,         /* Pointer to original graph                          */
 Graph * restrict const        indgrafptr,         /* Pointer to induced graph                           */
 const Gnum                    indvertnbr,         /* Number of vertices in induced graph                */
-const Gnum                    indedgenbr)         /* (Upper bound of) number of edges in induced graph  */
+const Gnum                    indedgenbr,         /* (Upper bound of) number of edges in induced graph  */
+Context * const               contptr)            /* Execution context, if any                          */
 {
   Gnum                orgvertnum;
   Gnum                orgedgenum;
@@ -307,39 +635,71 @@ const Gnum                    indedgenbr)         /* (Upper bound of) number of
     indedlotax = NULL;
   }
 
-  indvelosum = (indvelotax == NULL) ? indgrafptr->vertnbr : 0;
-  indedlosum = 0;
-  for (indvertnum = indedgenum = indgrafptr->baseval;
-       indvertnum < indgrafptr->vertnnd; indvertnum ++) {
-    orgvertnum = indvnumtax[indvertnum];
-    indverttax[indvertnum] = indedgenum;
-    if (indvelotax != NULL) {                     /* If graph has vertex weights */
-      indvelosum +=                               /* Accumulate vertex loads     */
-      indvelotax[indvertnum] = orgvelotax[orgvertnum];
+#ifndef GRAPHINDUCENOTHREAD
+  if ((contptr != NULL) && (contextThreadNbr (contptr) > 1) && /* If edge arrays can be filled in parallel */
+      (orggrafptr->vertnbr >= GRAPHINDUCETHRDSIZ)) {
+    GraphInduceData     datadat;
+
+    if ((datadat.thrdtab = (GraphInduceThread *) memAlloc (contextThreadNbr (contptr) * sizeof (GraphInduceThread))) == NULL) {
+      errorPrint ("graphInduce3: out of memory");
+      graphExit  (indgrafptr);
+      return     (1);
     }
+    datadat.orggrafptr = orggrafptr;
+    datadat.indgrafptr = indgrafptr;
+    datadat.indvertnbr = indvertnbr;
+    datadat.indedgetax = indedgetax;
+    datadat.indedlotax = indedlotax;
+    contextThreadLaunch (contptr, (ThreadFunc) graphInduce3Thr, (void *) &datadat);
+
+    indvertnum = indgrafptr->baseval + indvertnbr;
+    indedgenum = indverttax[indvertnum];
+    indvelosum = (indvelotax == NULL) ? indvertnbr : datadat.thrdtab[0].velosum;
+    indedlosum = datadat.thrdtab[0].edlosum;
+    memFree (datadat.thrdtab);
+  }
+  else
+#endif /* GRAPHINDUCENOTHREAD */
+  {
+    indvelosum = (indvelotax == NULL) ? indgrafptr->vertnbr : 0;
+    indedlosum = 0;
+    for (indvertnum = indedgenum = indgrafptr->baseval;
+         indvertnum < indgrafptr->vertnnd; indvertnum ++) {
+      orgvertnum = indvnumtax[indvertnum];
+      indverttax[indvertnum] = indedgenum;
+      if (indvelotax != NULL) {                   /* If graph has vertex weights */
+        indvelosum +=                             /* Accumulate vertex loads     */
+        indvelotax[indvertnum] = orgvelotax[orgvertnum];
+      }
 
-    if (indedlotax != NULL) {                     /* If graph has edge weights */
-      for (orgedgenum = orgverttax[orgvertnum];
-           orgedgenum < orgvendtax[orgvertnum]; orgedgenum ++) {
-        if (orgindxtax[orgedgetax[orgedgenum]] != ~0) { /* If edge should be kept */
-          indedlosum            +=
-          indedlotax[indedgenum] = orgedlotax[orgedgenum];
-          indedgetax[indedgenum] = orgindxtax[orgedgetax[orgedgenum]];
-          indedgenum ++;
+      if (indedlotax != NULL) {                   /* If graph has edge weights */
+        for (orgedgenum = orgverttax[orgvertnum];
+             orgedgenum < orgvendtax[orgvertnum]; orgedgenum ++) {
+          if (orgindxtax[orgedgetax[orgedgenum]] != ~0) { /* If edge should be kept */
+            indedlosum            +=
+            indedlotax[indedgenum] = orgedlotax[orgedgenum];
+            indedgetax[indedgenum] = orgindxtax[orgedgetax[orgedgenum]];
+            indedgenum ++;
+          }
         }
       }
-    }
-    else {
-      for (orgedgenum = orgverttax[orgvertnum];
-           orgedgenum < orgvendtax[orgvertnum]; orgedgenum ++) {
-        if (orgindxtax[orgedgetax[orgedgenum]] != ~0) { /* If edge should be kept */
-          indedgetax[indedgenum] = orgindxtax[orgedgetax[orgedgenum]];
-          indedgenum ++;
+      else {
+        for (orgedgenum = orgverttax[orgvertnum];
+             orgedgenum < orgvendtax[orgvertnum]; orgedgenum ++) {
+          if (orgindxtax[orgedgetax[orgedgenum]] != ~0) { /* If edge should be kept */
+            indedgetax[indedgenum] = orgindxtax[orgedgetax[orgedgenum]];
+            indedgenum ++;
+          }
         }
       }
     }
+    indverttax[indvertnum] = indedgenum;          /* Mark end of edge array */
+
+    if (orggrafptr->vnumtax != NULL) {            /* Adjust vnumtax */
+      for (indvertnum = indgrafptr->baseval; indvertnum < indgrafptr->vertnnd; indvertnum ++)
+        indvnumtax[indvertnum] = orgvnumtax[indvnumtax[indvertnum]];
+    }
   }
-  indverttax[indvertnum] = indedgenum;            /* Mark end of edge array */
 
   indgrafptr->vendtax = indgrafptr->verttax + 1;  /* Use compact representation of vertex arrays */
   indgrafptr->vertnbr = indvertnum - indgrafptr->baseval;
@@ -349,11 +709,6 @@ const Gnum                    indedgenbr)         /* (Upper bound of) number of
   indgrafptr->edlosum = (indedlotax != NULL) ? indedlosum : indgrafptr->edgenbr;
   indgrafptr->degrmax = orggrafptr->degrmax;      /* Induced maximum degree is likely to be that of the original graph */
 
-  if (orggrafptr->vnumtax != NULL) {              /* Adjust vnumtax */
-    for (indvertnum = indgrafptr->baseval; indvertnum < indgrafptr->vertnnd; indvertnum ++)
-      indvnumtax[indvertnum] = orgvnumtax[indvnumtax[indvertnum]];
-  }
-
   if (indedlotax != NULL) {                       /* Re-allocate arrays and delete orgindxtab             */
     size_t              indedlooftval;            /* Offset of edge load array with respect to edge array */
 
@@ -55,14 +55,74 @@
 /**                                 to   : 28 nov 2001     **/
 /**                # Version 6.0  : from : 03 aug 2016     **/
 /**                                 to   : 07 jun 2018     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
+/*
+**  The defines.
+*/
+
+/*+ Threaded induction requires threads. +*/
+
+#if (! defined SCOTCH_PTHREAD) && (! defined GRAPHINDUCENOTHREAD)
+#define GRAPHINDUCENOTHREAD
+#endif /* (! defined SCOTCH_PTHREAD) && (! defined GRAPHINDUCENOTHREAD) */
+
+/*+ Minimum number of vertices of the original
+    graph above which threaded induction is
+    performed. Below it, launching threads and
+    allocating their data costs more than it
+    saves.                                      +*/
+
+#define GRAPHINDUCETHRDSIZ          (1 << 14)
+
+/*
+**  The type and structure definitions.
+*/
+
+#ifndef GRAPHINDUCENOTHREAD
+
+/*+ The thread-specific data block. +*/
+
+typedef struct GraphInduceThread_ {
+  Gnum                      velosum;              /*+ Local sum of induced vertex loads            +*/
+  Gnum                      edlosum;              /*+ Local sum of induced edge loads              +*/
+  Gnum                      scantab[4];           /*+ Scan areas for vertex and edge start indices +*/
+} GraphInduceThread;
+
+/*+ The induction parameter structure.
+    It contains the thread-independent
+    data.                              +*/
+
+typedef struct GraphInduceData_ {
+  const Graph *             orggrafptr;           /*+ Original graph                         +*/
+  Graph *                   indgrafptr;           /*+ Induced graph                          +*/
+  const GraphPart *         orgparttax;           /*+ Part array of original graph, if any   +*/
+  GraphPart                 indpartval;           /*+ Part of vertices to keep               +*/
+  const Gnum *              indvnumtab;           /*+ List of vertices to keep, if any       +*/
+  Gnum                      indvertnbr;           /*+ Number of vertices in induced graph    +*/
+  Gnum                      indedgenbr;           /*+ Upper bound on number of induced edges +*/
+  Gnum *                    indedgetax;           /*+ Induced edge array                     +*/
+  Gnum *                    indedlotax;           /*+ Induced edge load array, if any        +*/
+  GraphInduceThread *       thrdtab;              /*+ Array of thread-specific data          +*/
+} GraphInduceData;
+
+#endif /* GRAPHINDUCENOTHREAD */
+
 /*
 **  The function prototypes.
 */
 
 #ifdef GRAPH_INDUCE
+#ifndef GRAPHINDUCENOTHREAD
+static void                 graphInduceReduce   (GraphInduceThread * restrict const, GraphInduceThread * restrict const, const void * const);
+static void                 graphInduceScan     (Gnum * restrict const, Gnum * restrict const, const int, const int, const void * const);
+static void                 graphInduceListThr  (ThreadDescriptor * restrict const, GraphInduceData * restrict const);
+static void                 graphInducePartThr  (ThreadDescriptor * restrict const, GraphInduceData * restrict const);
+static void                 graphInduce3Thr     (ThreadDescriptor * restrict const, GraphInduceData * restrict const);
+#endif /* GRAPHINDUCENOTHREAD */
 static int                  graphInduce2        (const Graph * const, Graph * const, const Gnum);
-static int                  graphInduce3        (const Graph * const, Graph * const, const Gnum, const Gnum);
+static int                  graphInduce3        (const Graph * const, Graph * const, const Gnum, const Gnum, Context * const);
 #endif /* GRAPH_INDUCE */
@@ -1,4 +1,4 @@
-/* Copyright 2004,2007,2010,2016 IPB, Universite de Bordeaux, INRIA & CNRS
+/* Copyright 2004,2007,2010,2016,2026 IPB, Universite de Bordeaux, INRIA & CNRS
 **
 ** This file is part of the Scotch software package for static mapping,
 ** graph partitioning and sparse matrix ordering.
@@ -58,6 +58,8 @@
 /**                                 to   : 11 aug 2010     **/
 /**                # Version 6.0  : from : 03 aug 2016     **/
 /**                                 to   : 03 aug 2016     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -71,6 +73,12 @@
 #include "common.h"
 #include "graph.h"
 #include "graph_io.h"
+#include "graph_io_bin.h"
+
+#ifndef GRAPHIONOTHREAD
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif /* GRAPHIONOTHREAD */
 
 /*******************************************/
 /*                                         */
@@ -91,6 +99,30 @@ Graph * restrict const      grafptr,              /* Graph structure to fill
 FILE * const                stream,               /* Stream from which to read graph data */
 const Gnum                  baseval,              /* Base value (-1 means keep file base) */
 const GraphFlag             flagval)              /* Graph loading flags                  */
+{
+  return (graphLoadCont (grafptr, stream, baseval, flagval, NULL));
+}
+
+/* This routine loads a source graph from
+** the given stream. When an execution context
+** is provided and the graph body lies in a
+** large enough regular file, the body is
+** parsed concurrently by all the threads of
+** the context; else, or whenever the body does
+** not hold exactly one vertex per line, it is
+** parsed sequentially.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphLoadCont (
+Graph * restrict const      grafptr,              /* Graph structure to fill              */
+FILE * const                stream,               /* Stream from which to read graph data */
+const Gnum                  baseval,              /* Base value (-1 means keep file base) */
+const GraphFlag             flagval,              /* Graph loading flags                  */
+Context * const             contptr)              /* Execution context (may be NULL)      */
 {
   Gnum                edgenum;                    /* Number of edges really allocated */
   Gnum                edgennd;
@@ -107,6 +139,12 @@ const GraphFlag             flagval)              /* Graph loading flags
   Gnum                propval;
   char                proptab[4];
   Gnum                vertnum;
+  int                 c;
+
+  c = getc (stream);                              /* Peek first character of stream */
+  ungetc (c, stream);
+  if (c == GRAPHBINMAGIC[0])                      /* If graph is in binary format */
+    return (graphLoadBin (grafptr, stream, baseval, flagval));
 
   memSet (grafptr, 0, sizeof (Graph));
 
@@ -176,6 +214,26 @@ const GraphFlag             flagval)              /* Graph loading flags
   edgennd = grafptr->edgenbr + grafptr->baseval;
   degrmax = 0;                                    /* No maximum degree yet */
 
+#ifndef GRAPHIONOTHREAD
+  if ((contptr != NULL) && (contextThreadNbr (contptr) > 1)) {
+    GraphLoadData       loaddat;
+
+    loaddat.grafptr  = grafptr;
+    loaddat.baseadj  = baseadj;
+    loaddat.vlblflag = proptab[0];
+    loaddat.veloflag = proptab[2];
+    loaddat.edloflag = proptab[1];
+    switch (graphLoadThr (&loaddat, stream, &vlblmax, contptr)) {
+      case 0 :                                    /* If threaded parsing succeeded */
+        goto relabel;
+      case 2 :
+        errorPrint ("graphLoadCont: cannot parse graph body");
+        graphFree  (grafptr);
+        return     (1);
+    }                                             /* Else parse graph body sequentially */
+  }
+#endif /* GRAPHIONOTHREAD */
+
   for (vertnum = edgenum = grafptr->baseval; vertnum < grafptr->vertnnd; vertnum ++) {
     Gnum                degrval;
 
@@ -250,6 +308,9 @@ const GraphFlag             flagval)              /* Graph loading flags
   grafptr->edlosum = edlosum;
   grafptr->degrmax = degrmax;
 
+#ifndef GRAPHIONOTHREAD
+relabel:
+#endif /* GRAPHIONOTHREAD */
   if (grafptr->vlbltax != NULL) {                 /* If vertex label renaming necessary       */
     if (graphLoad2 (grafptr->baseval, grafptr->vertnnd, grafptr->verttax, /* Rename edge ends */
                     grafptr->vendtax, grafptr->edgetax, vlblmax, grafptr->vlbltax) != 0) {
@@ -320,6 +381,341 @@ const Gnum * const          vlbltax)
   return (0);
 }
 
+#ifndef GRAPHIONOTHREAD
+
+/* This routine reads an integer token from
+** the current line of a memory-resident graph
+** body. Tokens must be made of an optional
+** sign followed by digits, and be followed
+** by a whitespace character or by the end
+** of the body.
+** It returns:
+** - 1   : if a token was read.
+** - 0   : if the end of line was reached.
+** - -1  : on syntax error.
+*/
+
+static
+int
+graphLoadThrToken (
+const char ** const         charptr,              /* Pointer to current character pointer */
+const char * const          charend,              /* End of text area                     */
+Gnum * const                valuptr)              /* Area where to put value              */
+{
+  const char *        chartmp;
+  Gnum                valutmp;
+  int                 signval;
+
+  for (chartmp = *charptr; (chartmp < charend) && (*chartmp != '\n') && isspace ((int) (unsigned char) *chartmp); chartmp ++) ;
+  *charptr = chartmp;
+  if ((chartmp >= charend) || (*chartmp == '\n')) /* If end of line reached */
+    return (0);
+
+  signval = 0;
+  if (*chartmp == '-') {
+    signval = 1;
+    chartmp ++;
+  }
+  else if (*chartmp == '+')
+    chartmp ++;
+
+  if ((chartmp >= charend) || (*chartmp < '0') || (*chartmp > '9'))
+    return (-1);
+  for (valutmp = 0; (chartmp < charend) && (*chartmp >= '0') && (*chartmp <= '9'); chartmp ++)
+    valutmp = valutmp * 10 + (*chartmp - '0');
+  if ((chartmp < charend) && (! isspace ((int) (unsigned char) *chartmp))) /* Tokens must be separated by whitespace */
+    return (-1);
+
+  *charptr = chartmp;
+  *valuptr = (signval != 0) ? (- valutmp) : valutmp;
+
+  return (1);
+}
+
+/* This routine computes the start of the
+** line range of the given thread, that is,
+** the first line start at or after the
+** proportional share of the body.
+** It returns:
+** - the start index of the range.
+*/
+
+static
+size_t
+graphLoadThrBound (
+const char * const          charptr,
+const size_t                charnbr,
+const int                   thrdnum,
+const int                   thrdnbr)
+{
+  size_t              charnum;
+
+  if (thrdnum == 0)
+    return (0);
+  if (thrdnum >= thrdnbr)
+    return (charnbr);
+
+  for (charnum = (size_t) (((double) charnbr * (double) thrdnum) / (double) thrdnbr);
+       (charnum < charnbr) && (charptr[charnum - 1] != '\n'); charnum ++) ;
+
+  return (charnum);
+}
+
+/* This routine performs the reduction of
+** the per-thread graph sums.
+*/
+
+static
+void
+graphLoadThrReduce (
+GraphLoadThread * restrict const  tlocptr,        /* Pointer to local thread block  */
+GraphLoadThread * restrict const  tremptr,        /* Pointer to remote thread block */
+const void * const                globptr)        /* Unused                         */
+{
+  tlocptr->velosum += tremptr->velosum;
+  tlocptr->edlosum += tremptr->edlosum;
+  if (tremptr->degrmax > tlocptr->degrmax)
+    tlocptr->degrmax = tremptr->degrmax;
+  if (tremptr->vlblmax > tlocptr->vlblmax)
+    tlocptr->vlblmax = tremptr->vlblmax;
+}
+
+/* This routine performs a prefix scan
+** sum operation on the vertex and arc
+** counts, backed by a temporary area.
+*/
+
+static
+void
+graphLoadThrScan (
+Gnum * restrict const       tlocptr,              /* Pointer to local area   */
+Gnum * restrict const       tremptr,              /* Pointer to remote area  */
+const int                   srcpval,              /* Source phase value      */
+const int                   dstpval,              /* Destination phase value */
+const void * const          globptr)              /* Unused                  */
+{
+  tlocptr[2 * dstpval]     = tlocptr[2 * srcpval]     + ((tremptr == NULL) ? 0 : tremptr[2 * srcpval]);
+  tlocptr[2 * dstpval + 1] = tlocptr[2 * srcpval + 1] + ((tremptr == NULL) ? 0 : tremptr[2 * srcpval + 1]);
+}
+
+/* This routine is the threaded core of
+** the parsing of the graph body. In a
+** first pass, every thread checks that its
+** line range holds one vertex per line and
+** counts its vertices and arcs. Start indices
+** are then computed by prefix scan, and the
+** arrays are filled in a second pass.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+graphLoadThr2 (
+ThreadDescriptor * restrict const descptr,
+GraphLoadData * restrict const    loadptr)
+{
+  const char *        charptr;
+  const char *        charnnd;
+  Gnum                vertnbr;
+  Gnum                vertnum;
+  Gnum                edgenbr;
+  Gnum                edgenum;
+  Gnum                velosum;
+  Gnum                edlosum;
+  Gnum                degrmax;
+  Gnum                vlblmax;
+  Gnum                tokeval;
+  int                 retuval;
+  int                 thrdtmp;
+
+  Graph * restrict const            grafptr = loadptr->grafptr;
+  const Gnum                        baseadj = loadptr->baseadj;
+  const int                         vlblflag = loadptr->vlblflag;
+  const int                         veloflag = loadptr->veloflag;
+  const int                         edloflag = loadptr->edloflag;
+  Gnum * restrict const             verttax = grafptr->verttax;
+  Gnum * restrict const             velotax = grafptr->velotax;
+  Gnum * restrict const             vlbltax = grafptr->vlbltax;
+  Gnum * restrict const             edgetax = grafptr->edgetax;
+  Gnum * restrict const             edlotax = grafptr->edlotax;
+  const int                         thrdnbr = threadNbr (descptr);
+  const int                         thrdnum = threadNum (descptr);
+  GraphLoadThread * restrict const  thrdptr = &loadptr->thrdtab[thrdnum];
+
+  thrdptr->charbas = graphLoadThrBound (loadptr->charptr, loadptr->charnbr, thrdnum,     thrdnbr);
+  thrdptr->charnnd = graphLoadThrBound (loadptr->charptr, loadptr->charnbr, thrdnum + 1, thrdnbr);
+
+  for (charptr = loadptr->charptr + thrdptr->charbas, charnnd = loadptr->charptr + thrdptr->charnnd,
+       vertnbr = edgenbr = 0, retuval = 0; charptr < charnnd; charptr ++) { /* For all lines; skip end of line character */
+    Gnum                degrval;
+    Gnum                tokenbr;
+    int                 o;
+
+    if ((o = graphLoadThrToken (&charptr, charnnd, &tokeval)) == 0) /* Skip blank lines */
+      continue;
+    if ((o < 0) ||
+        ((vlblflag != 0) && (graphLoadThrToken (&charptr, charnnd, &tokeval) != 1)) ||
+        ((veloflag != 0) && (graphLoadThrToken (&charptr, charnnd, &tokeval) != 1)) ||
+        (tokeval < 0)) {                          /* Last token read is degree */
+      retuval = 1;
+      break;
+    }
+    degrval = tokeval;
+
+    for (tokenbr = 0; (o = graphLoadThrToken (&charptr, charnnd, &tokeval)) > 0; tokenbr ++) ;
+    if ((o < 0) || (tokenbr != (degrval << edloflag))) { /* If line does not hold exactly one vertex */
+      retuval = 1;
+      break;
+    }
+
+    vertnbr ++;
+    edgenbr += degrval;
+  }
+  thrdptr->retuval = retuval;
+
+  thrdptr->vertnbr     =
+  thrdptr->scantab[0]  = vertnbr;
+  thrdptr->edgenbr     =
+  thrdptr->scantab[1]  = edgenbr;
+  threadScan (descptr, (void *) &thrdptr->scantab[0], sizeof (GraphLoadThread), (ThreadScanFunc) graphLoadThrScan, NULL);
+
+  for (thrdtmp = 0; thrdtmp < thrdnbr; thrdtmp ++) { /* All threads see all results after scan barrier */
+    if (loadptr->thrdtab[thrdtmp].retuval != 0)
+      return;
+  }
+  if ((loadptr->thrdtab[thrdnbr - 1].scantab[0] != grafptr->vertnbr) || /* If vertex or arc counts do not match header */
+      (loadptr->thrdtab[thrdnbr - 1].scantab[1] != grafptr->edgenbr))
+    return;
+
+  vertnum = thrdptr->scantab[0] - vertnbr + grafptr->baseval;
+  edgenum = thrdptr->scantab[1] - edgenbr + grafptr->baseval;
+  velosum = (velotax == NULL) ? vertnbr : 0;
+  edlosum = (edlotax == NULL) ? edgenbr : 0;
+  degrmax = 0;
+  vlblmax = grafptr->vertnnd - 1;
+  for (charptr = loadptr->charptr + thrdptr->charbas; charptr < charnnd; charptr ++) { /* Second pass on validated lines */
+    Gnum                edgennd;
+
+    if (graphLoadThrToken (&charptr, charnnd, &tokeval) == 0)
+      continue;
+    if (vlblflag != 0) {
+      vlbltax[vertnum] = tokeval;
+      if (tokeval > vlblmax)
+        vlblmax = tokeval;
+      graphLoadThrToken (&charptr, charnnd, &tokeval);
+    }
+    if (veloflag != 0) {
+      if (velotax != NULL)
+        velosum          +=
+        velotax[vertnum]  = tokeval;
+      graphLoadThrToken (&charptr, charnnd, &tokeval);
+    }
+    if (degrmax < tokeval)
+      degrmax = tokeval;
+
+    verttax[vertnum ++] = edgenum;
+    for (edgennd = edgenum + tokeval; edgenum < edgennd; edgenum ++) {
+      if (edloflag != 0) {
+        graphLoadThrToken (&charptr, charnnd, &tokeval);
+        if (edlotax != NULL)
+          edlosum          +=
+          edlotax[edgenum]  = tokeval;
+      }
+      graphLoadThrToken (&charptr, charnnd, &tokeval);
+      edgetax[edgenum] = tokeval + baseadj;
+    }
+    graphLoadThrToken (&charptr, charnnd, &tokeval); /* Move to end of line */
+  }
+  if (thrdnum == (thrdnbr - 1))                   /* Last thread marks end of edge array */
+    verttax[vertnum] = edgenum;
+
+  thrdptr->velosum = velosum;
+  thrdptr->edlosum = edlosum;
+  thrdptr->degrmax = degrmax;
+  thrdptr->vlblmax = vlblmax;
+  threadReduce (descptr, (void *) thrdptr, sizeof (GraphLoadThread), (ThreadReduceFunc) graphLoadThrReduce, 0, NULL);
+}
+
+/* This routine parses the body of a graph
+** file concurrently, using all the threads
+** of the given context. The stream must
+** be a regular file, which is mapped in
+** memory; on success, the stream is moved
+** past the graph body, else it is left
+** untouched so that the body can be parsed
+** sequentially.
+** It returns:
+** - 0   : on success.
+** - 1   : if threaded parsing is not possible.
+** - 2   : on error.
+*/
+
+static
+int
+graphLoadThr (
+GraphLoadData * restrict const  loadptr,
+FILE * const                    stream,
+Gnum * restrict const           vlblptr,          /* Pointer to maximum vertex label */
+Context * const                 contptr)
+{
+  struct stat         statdat;
+  off_t               bodypos;                    /* Position of graph body in file */
+  size_t              filesiz;
+  byte *              fileptr;
+  size_t              charnum;
+  int                 thrdnum;
+  int                 o;
+
+  const int           thrdnbr = contextThreadNbr (contptr);
+
+  if (((bodypos = ftello (stream)) < 0) ||        /* Fails for pipes, which is fine */
+      (fstat (fileno (stream), &statdat) != 0) ||
+      (! S_ISREG (statdat.st_mode)) ||
+      ((statdat.st_size - bodypos) < GRAPHIOTHRDSIZ))
+    return (1);
+
+  filesiz = (size_t) statdat.st_size;
+  if ((fileptr = (byte *) mmap (NULL, filesiz, PROT_READ, MAP_PRIVATE, fileno (stream), 0)) == (byte *) MAP_FAILED)
+    return (1);
+
+  if ((loadptr->thrdtab = (GraphLoadThread *) memAlloc (thrdnbr * sizeof (GraphLoadThread))) == NULL) {
+    munmap (fileptr, filesiz);
+    return (1);
+  }
+  loadptr->charptr = (const char *) fileptr + bodypos;
+  loadptr->charnbr = filesiz - (size_t) bodypos;
+
+  contextThreadLaunch (contptr, (ThreadFunc) graphLoadThr2, (void *) loadptr);
+
+  o = ((loadptr->thrdtab[thrdnbr - 1].scantab[0] != loadptr->grafptr->vertnbr) || /* Threads did not fill arrays if counts do not match */
+       (loadptr->thrdtab[thrdnbr - 1].scantab[1] != loadptr->grafptr->edgenbr)) ? 1 : 0;
+  for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++)
+    o |= loadptr->thrdtab[thrdnum].retuval;
+
+  if (o == 0) {
+    Graph * restrict const  grafptr = loadptr->grafptr;
+
+    grafptr->velosum = loadptr->thrdtab[0].velosum;
+    grafptr->edlosum = loadptr->thrdtab[0].edlosum;
+    grafptr->degrmax = loadptr->thrdtab[0].degrmax;
+    *vlblptr         = loadptr->thrdtab[0].vlblmax;
+
+    for (charnum = loadptr->charnbr; (charnum > 0) && isspace ((int) (unsigned char) loadptr->charptr[charnum - 1]); charnum --) ;
+    if (fseeko (stream, bodypos + (off_t) charnum, SEEK_SET) != 0) { /* Leave stream just after last token */
+      errorPrint ("graphLoadThr: cannot seek stream");
+      o = 2;
+    }
+  }
+
+  memFree (loadptr->thrdtab);
+  munmap  (fileptr, filesiz);
+
+  return (o);
+}
+
+#endif /* GRAPHIONOTHREAD */
+
 /* This routine saves a source graph to
 ** the given stream, in the new-style
 ** graph format.
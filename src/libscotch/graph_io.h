@@ -55,11 +55,76 @@
 /**                                 to   : 25 nov 2001     **/
 /**                # Version 6.0  : from : 07 jun 2018     **/
 /**                                 to   : 07 jun 2018     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
+/*
+**  The defines.
+*/
+
+/*+ Threaded parsing requires threads and
+    memory mapping of regular files.        +*/
+
+#if ((! defined SCOTCH_PTHREAD) || defined COMMON_OS_WINDOWS || defined HAVE_NOT_SYS_MMAN_H) && (! defined GRAPHIONOTHREAD)
+#define GRAPHIONOTHREAD
+#endif /* ((! defined SCOTCH_PTHREAD) || defined COMMON_OS_WINDOWS || defined HAVE_NOT_SYS_MMAN_H) && (! defined GRAPHIONOTHREAD) */
+
+/*+ Minimum size of graph body, in bytes,
+    above which threaded parsing is tried. +*/
+
+#define GRAPHIOTHRDSIZ              (1 << 18)
+
+/*
+**  The type and structure definitions.
+*/
+
+#ifndef GRAPHIONOTHREAD
+
+/*+ The thread-specific data block. +*/
+
+typedef struct GraphLoadThread_ {
+  size_t                    charbas;              /*+ Start of line range in graph body  +*/
+  size_t                    charnnd;              /*+ End of line range in graph body    +*/
+  Gnum                      vertnbr;              /*+ Number of local vertices           +*/
+  Gnum                      edgenbr;              /*+ Number of local arcs               +*/
+  Gnum                      velosum;              /*+ Local sum of vertex loads          +*/
+  Gnum                      edlosum;              /*+ Local sum of edge loads            +*/
+  Gnum                      degrmax;              /*+ Local maximum degree               +*/
+  Gnum                      vlblmax;              /*+ Local maximum vertex label         +*/
+  int                       retuval;              /*+ Local parsing return value         +*/
+  Gnum                      scantab[4];           /*+ Scan areas for vertex and arc sums +*/
+} GraphLoadThread;
+
+/*+ The threaded parsing data block. +*/
+
+typedef struct GraphLoadData_ {
+  Graph *                   grafptr;              /*+ Graph to fill                    +*/
+  const char *              charptr;              /*+ Graph body text                  +*/
+  size_t                    charnbr;              /*+ Size of graph body               +*/
+  Gnum                      baseadj;              /*+ Base adjustment of edge ends     +*/
+  int                       vlblflag;             /*+ Set if file has vertex labels    +*/
+  int                       veloflag;             /*+ Set if file has vertex loads     +*/
+  int                       edloflag;             /*+ Set if file has edge loads       +*/
+  GraphLoadThread *         thrdtab;              /*+ Array of thread-specific blocks  +*/
+} GraphLoadData;
+
+#endif /* GRAPHIONOTHREAD */
+
 /*
 **  The function prototypes.
 */
 
+#ifdef GRAPH_IO
+#ifndef GRAPHIONOTHREAD
+static int                  graphLoadThr        (GraphLoadData * restrict const, FILE * const, Gnum * restrict const, Context * const);
+static void                 graphLoadThr2       (ThreadDescriptor * restrict const, GraphLoadData * restrict const);
+static size_t               graphLoadThrBound   (const char * const, const size_t, const int, const int);
+static int                  graphLoadThrToken   (const char ** const, const char * const, Gnum * const);
+static void                 graphLoadThrReduce  (GraphLoadThread * restrict const, GraphLoadThread * restrict const, const void * const);
+static void                 graphLoadThrScan    (Gnum * restrict const, Gnum * restrict const, const int, const int, const void * const);
+#endif /* GRAPHIONOTHREAD */
+#endif /* GRAPH_IO */
+
 int                         graphLoad2          (const Gnum, const Gnum, const Gnum * const, const Gnum * const, Gnum * const, const Gnum, const Gnum * const);
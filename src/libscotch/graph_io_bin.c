@@ -0,0 +1,537 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_io_bin.c                          **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module handles the binary source   **/
+/**                graph format, which can be mapped in    **/
+/**                memory without any copy.                **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 16 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define GRAPH_IO_BIN
+
+#include "module.h"
+#include "common.h"
+#include "geom.h"
+#include "graph.h"
+#include "graph_io_bin.h"
+
+#ifdef GRAPHBINMMAP
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif /* GRAPHBINMMAP */
+
+/*****************************************/
+/*                                       */
+/* These routines handle binary source   */
+/* graph I/O.                            */
+/*                                       */
+/*****************************************/
+
+/* This routine computes the offsets of
+** the arrays of a binary graph data block
+** starting at the given aligned offset,
+** which is GRAPHBINHEADSIZ for graph files.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+void
+graphBinLayout (
+GraphBinLayout * const      layoptr,
+const UINT64                dataoft,              /* Offset of start of data block */
+const Gnum                  vertnbr,
+const Gnum                  edgenbr,
+const UINT64                propval)
+{
+  const UINT64        vertsiz = (UINT64) vertnbr * sizeof (Gnum);
+  const UINT64        edgesiz = (UINT64) edgenbr * sizeof (Gnum);
+
+  layoptr->vertoft = dataoft;
+  layoptr->velooft = GRAPHBINALIGN (layoptr->vertoft + vertsiz + sizeof (Gnum));
+  layoptr->vlbloft = GRAPHBINALIGN (layoptr->velooft + (((propval & GRAPHBINHASVELO) != 0) ? vertsiz : 0));
+  layoptr->edgeoft = GRAPHBINALIGN (layoptr->vlbloft + (((propval & GRAPHBINHASVLBL) != 0) ? vertsiz : 0));
+  layoptr->edlooft = GRAPHBINALIGN (layoptr->edgeoft + edgesiz);
+  layoptr->filesiz = GRAPHBINALIGN (layoptr->edlooft + (((propval & GRAPHBINHASEDLO) != 0) ? edgesiz : 0));
+}
+
+/* This routine loads a source graph in
+** binary format from the given stream, the
+** magic string of which has not yet been
+** read. When the stream is a regular file
+** positioned at its beginning, the file is
+** mapped in memory and graph arrays point
+** directly to the mapped area, which is
+** private and thus can be modified without
+** altering the file; else, arrays are read
+** in the usual way.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphLoadBin (
+Graph * restrict const      grafptr,              /* Graph structure to fill              */
+FILE * const                stream,               /* Stream from which to read graph data */
+const Gnum                  baseval,              /* Base value (-1 means keep file base) */
+const GraphFlag             flagval)              /* Graph loading flags                  */
+{
+  GraphBinHead        headdat;
+  GraphBinLayout      layodat;
+  byte *              dataptr;                    /* Pointer to start of data block       */
+  UINT64              dataoft;                    /* Current offset in data block         */
+  Gnum *              velotab;
+  Gnum *              vlbltab;
+  Gnum *              edlotab;
+  Gnum                baseadj;
+  Gnum                vertnum;
+  Gnum                edgenum;
+  Gnum                velosum;
+  Gnum                edlosum;
+  Gnum                degrmax;
+#ifdef GRAPHBINMMAP
+  off_t               headpos;                    /* Position of header in stream         */
+#endif /* GRAPHBINMMAP */
+
+  memSet (grafptr, 0, sizeof (Graph));
+
+#ifdef GRAPHBINMMAP
+  headpos = ftello (stream);                      /* Will fail for pipes, which is fine */
+#endif /* GRAPHBINMMAP */
+  if ((fread (&headdat, sizeof (GraphBinHead), 1, stream) != 1) ||
+      (memcmp (headdat.magitab, GRAPHBINMAGIC, GRAPHBINMAGICSIZ) != 0)) {
+    errorPrint ("graphLoadBin: bad input (1)");
+    return     (1);
+  }
+  if (headdat.endival != GRAPHBINENDIVAL) {
+    errorPrint ("graphLoadBin: invalid byte order");
+    return     (1);
+  }
+  if (headdat.versval != GRAPHBINVERSION) {
+    errorPrint ("graphLoadBin: unsupported format version");
+    return     (1);
+  }
+  if (headdat.gnumsiz != sizeof (Gnum)) {
+    errorPrint ("graphLoadBin: integer size mismatch");
+    return     (1);
+  }
+  if ((headdat.vertnbr > (UINT64) GNUMMAX) ||
+      (headdat.edgenbr > (UINT64) GNUMMAX) ||
+      (headdat.baseval > (UINT64) GNUMMAX)) {
+    errorPrint ("graphLoadBin: bad input (2)");
+    return     (1);
+  }
+  grafptr->vertnbr = (Gnum) headdat.vertnbr;
+  grafptr->edgenbr = (Gnum) headdat.edgenbr;
+  graphBinLayout (&layodat, GRAPHBINHEADSIZ, grafptr->vertnbr, grafptr->edgenbr, headdat.propval);
+  if (layodat.filesiz != headdat.filesiz) {
+    errorPrint ("graphLoadBin: bad input (3)");
+    return     (1);
+  }
+
+  dataptr = NULL;
+#ifdef GRAPHBINMMAP
+  if (headpos == 0) {                             /* Data block can only be mapped if it starts the file */
+    struct stat         statdat;
+
+    if ((fstat (fileno (stream), &statdat) == 0) &&
+        (S_ISREG (statdat.st_mode))              &&
+        ((UINT64) statdat.st_size >= layodat.filesiz)) {
+      dataptr = (byte *) mmap (NULL, (size_t) layodat.filesiz, PROT_READ | PROT_WRITE, MAP_PRIVATE, fileno (stream), 0);
+      if (dataptr == (byte *) MAP_FAILED)         /* If mapping failed, fall back to reading */
+        dataptr = NULL;
+      else if (fseeko (stream, (off_t) layodat.filesiz, SEEK_SET) != 0) { /* Skip graph data in stream */
+        errorPrint ("graphLoadBin: cannot seek stream");
+        munmap     (dataptr, (size_t) layodat.filesiz);
+        return     (1);
+      }
+    }
+  }
+#endif /* GRAPHBINMMAP */
+
+  if (dataptr != NULL) {                          /* If data block mapped in memory */
+    grafptr->flagval = GRAPHFREEVERT | GRAPHVERTGROUP | GRAPHEDGEGROUP | GRAPHVERTMMAP; /* Only unmap block on exit */
+    grafptr->verttax = (Gnum *) (dataptr + layodat.vertoft);
+    velotab          = (Gnum *) (dataptr + layodat.velooft);
+    vlbltab          = (Gnum *) (dataptr + layodat.vlbloft);
+    grafptr->edgetax = (Gnum *) (dataptr + layodat.edgeoft);
+    edlotab          = (Gnum *) (dataptr + layodat.edlooft);
+  }
+  else {
+    Gnum                velosiz;
+    Gnum                vlblsiz;
+    Gnum                edlosiz;
+
+    velosiz = ((headdat.propval & GRAPHBINHASVELO) != 0) ? grafptr->vertnbr : 0;
+    vlblsiz = ((headdat.propval & GRAPHBINHASVLBL) != 0) ? grafptr->vertnbr : 0;
+    edlosiz = ((headdat.propval & GRAPHBINHASEDLO) != 0) ? grafptr->edgenbr : 0;
+    if ((memAllocGroup ((void **) (void *)
+                        &grafptr->verttax, (size_t) ((grafptr->vertnbr + 1) * sizeof (Gnum)),
+                        &velotab,          (size_t) (velosiz                * sizeof (Gnum)),
+                        &vlbltab,          (size_t) (vlblsiz                * sizeof (Gnum)), NULL) == NULL) ||
+        (memAllocGroup ((void **) (void *)
+                        &grafptr->edgetax, (size_t) (grafptr->edgenbr       * sizeof (Gnum)),
+                        &edlotab,          (size_t) (edlosiz                * sizeof (Gnum)), NULL) == NULL)) {
+      if (grafptr->verttax != NULL)
+        memFree (grafptr->verttax);
+      errorPrint ("graphLoadBin: out of memory");
+      return     (1);
+    }
+    grafptr->flagval = GRAPHFREETABS | GRAPHVERTGROUP | GRAPHEDGEGROUP;
+
+    for (dataoft = sizeof (GraphBinHead); dataoft < layodat.filesiz; ) { /* Read all arrays and skip padding */
+      void *              arraptr;
+      size_t              arrasiz;
+
+      if (dataoft == layodat.vertoft) {
+        arraptr = grafptr->verttax;
+        arrasiz = (size_t) (grafptr->vertnbr + 1);
+      }
+      else if ((dataoft == layodat.velooft) && (velosiz != 0)) {
+        arraptr = velotab;
+        arrasiz = (size_t) velosiz;
+      }
+      else if ((dataoft == layodat.vlbloft) && (vlblsiz != 0)) {
+        arraptr = vlbltab;
+        arrasiz = (size_t) vlblsiz;
+      }
+      else if ((dataoft == layodat.edgeoft) && (grafptr->edgenbr != 0)) {
+        arraptr = grafptr->edgetax;
+        arrasiz = (size_t) grafptr->edgenbr;
+      }
+      else if ((dataoft == layodat.edlooft) && (edlosiz != 0)) {
+        arraptr = edlotab;
+        arrasiz = (size_t) edlosiz;
+      }
+      else {                                      /* Padding byte */
+        if (getc (stream) == EOF) {
+          errorPrint ("graphLoadBin: bad input (4)");
+          graphFree  (grafptr);
+          return     (1);
+        }
+        dataoft ++;
+        continue;
+      }
+      if (fread (arraptr, sizeof (Gnum), arrasiz, stream) != arrasiz) {
+        errorPrint ("graphLoadBin: bad input (5)");
+        graphFree  (grafptr);
+        return     (1);
+      }
+      dataoft += (UINT64) arrasiz * sizeof (Gnum);
+    }
+  }
+
+  grafptr->baseval = (Gnum) headdat.baseval;
+  grafptr->vertnnd = grafptr->vertnbr + grafptr->baseval;
+  grafptr->verttax -= grafptr->baseval;
+  grafptr->vendtax  = grafptr->verttax + 1;       /* Use compact vertex array */
+  grafptr->velotax  = (((headdat.propval & GRAPHBINHASVELO) != 0) && ((flagval & GRAPHIONOLOADVERT) == 0)) ? (velotab - grafptr->baseval) : NULL;
+  grafptr->vlbltax  = ((headdat.propval & GRAPHBINHASVLBL) != 0) ? (vlbltab - grafptr->baseval) : NULL;
+  grafptr->edgetax -= grafptr->baseval;
+  grafptr->edlotax  = (((headdat.propval & GRAPHBINHASEDLO) != 0) && ((flagval & GRAPHIONOLOADEDGE) == 0)) ? (edlotab - grafptr->baseval) : NULL;
+
+  if ((grafptr->verttax[grafptr->baseval] != grafptr->baseval) || /* Check bounds of vertex array */
+      (grafptr->verttax[grafptr->vertnnd] != (grafptr->edgenbr + grafptr->baseval))) {
+    errorPrint ("graphLoadBin: invalid arc count");
+    graphFree  (grafptr);
+    return     (1);
+  }
+
+  velosum = (grafptr->velotax == NULL) ? grafptr->vertnbr : 0; /* Do not trust header values: recompute them */
+  edlosum = (grafptr->edlotax == NULL) ? grafptr->edgenbr : 0;
+  degrmax = 0;
+  for (vertnum = grafptr->baseval; vertnum < grafptr->vertnnd; vertnum ++) { /* Check graph arrays in one pass */
+    Gnum                degrval;
+
+    degrval = grafptr->verttax[vertnum + 1] - grafptr->verttax[vertnum];
+    if (degrval < 0) {                            /* Vertex array must be non-decreasing */
+      errorPrint ("graphLoadBin: bad input (6)");
+      graphFree  (grafptr);
+      return     (1);
+    }
+    if (degrmax < degrval)
+      degrmax = degrval;
+    if (grafptr->velotax != NULL)
+      velosum += grafptr->velotax[vertnum];
+  }
+  for (edgenum = grafptr->baseval; edgenum < (grafptr->edgenbr + grafptr->baseval); edgenum ++) {
+    if ((grafptr->edgetax[edgenum] <  grafptr->baseval) || /* Edge ends must be valid vertices */
+        (grafptr->edgetax[edgenum] >= grafptr->vertnnd)) {
+      errorPrint ("graphLoadBin: bad input (7)");
+      graphFree  (grafptr);
+      return     (1);
+    }
+    if (grafptr->edlotax != NULL)
+      edlosum += grafptr->edlotax[edgenum];
+  }
+  grafptr->velosum = velosum;
+  grafptr->edlosum = edlosum;
+  grafptr->degrmax = degrmax;
+
+  if ((baseval != -1) && (baseval != grafptr->baseval)) { /* If base must be changed, arrays will be copied-on-write */
+    baseadj = baseval - grafptr->baseval;
+    for (vertnum = grafptr->baseval; vertnum <= grafptr->vertnnd; vertnum ++)
+      grafptr->verttax[vertnum] += baseadj;
+    for (edgenum = grafptr->baseval; edgenum < (grafptr->edgenbr + grafptr->baseval); edgenum ++)
+      grafptr->edgetax[edgenum] += baseadj;
+
+    grafptr->verttax -= baseadj;                  /* Re-base array pointers */
+    grafptr->vendtax -= baseadj;
+    grafptr->edgetax -= baseadj;
+    if (grafptr->velotax != NULL)
+      grafptr->velotax -= baseadj;
+    if (grafptr->vlbltax != NULL)
+      grafptr->vlbltax -= baseadj;
+    if (grafptr->edlotax != NULL)
+      grafptr->edlotax -= baseadj;
+    grafptr->baseval  = baseval;
+    grafptr->vertnnd += baseadj;
+  }
+
+#ifdef SCOTCH_DEBUG_GRAPH2
+  if (graphCheck (grafptr) != 0) {                /* Check graph consistency */
+    errorPrint ("graphLoadBin: inconsistent graph data");
+    graphFree  (grafptr);
+    return     (1);
+  }
+#endif /* SCOTCH_DEBUG_GRAPH2 */
+
+  return (0);
+}
+
+/* This routine releases the memory-mapped
+** data block of a graph loaded by way of
+** graphLoadBin(). It is called by
+** graphFree() when the GRAPHVERTMMAP flag
+** is set along with GRAPHFREEVERT.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+void
+graphFreeBin (
+Graph * const               grafptr)
+{
+#ifdef GRAPHBINMMAP
+  byte *              dataptr;
+
+  dataptr = ((byte *) (grafptr->verttax + grafptr->baseval)) - GRAPHBINHEADSIZ; /* Data block starts with file header */
+  munmap (dataptr, (size_t) ((GraphBinHead *) dataptr)->filesiz);
+#endif /* GRAPHBINMMAP */
+}
+
+/* This routine writes the data arrays of
+** a source graph to the given stream, which
+** must be positioned at the start of the
+** vertex array of the given layout. Edge
+** ends are written as is, and non-compact
+** graphs are compacted on the fly.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphSaveBin2 (
+const Graph * const           grafptr,
+const GraphBinLayout * const  layoptr,
+FILE * const                  stream)
+{
+  UINT64              dataoft;
+  Gnum                vertnum;
+  Gnum                edgenum;
+  int                 o;
+
+  o = 0;
+  if ((grafptr->vendtax == (grafptr->verttax + 1)) && /* If graph is compact and starts at base, write arrays at once */
+      (grafptr->verttax[grafptr->baseval] == grafptr->baseval)) {
+    o = (fwrite (grafptr->verttax + grafptr->baseval, sizeof (Gnum), grafptr->vertnbr + 1, stream) != (size_t) (grafptr->vertnbr + 1));
+  }
+  else {
+    for (vertnum = grafptr->baseval, edgenum = grafptr->baseval; (o == 0) && (vertnum < grafptr->vertnnd); vertnum ++) {
+      o = (fwrite (&edgenum, sizeof (Gnum), 1, stream) != 1);
+      edgenum += grafptr->vendtax[vertnum] - grafptr->verttax[vertnum];
+    }
+    o |= (fwrite (&edgenum, sizeof (Gnum), 1, stream) != 1);
+  }
+  dataoft = layoptr->vertoft + (UINT64) (grafptr->vertnbr + 1) * sizeof (Gnum);
+  for ( ; (o == 0) && (dataoft < layoptr->velooft); dataoft ++)
+    o = (putc (0, stream) == EOF);
+
+  if ((o == 0) && (grafptr->velotax != NULL)) {
+    o = (fwrite (grafptr->velotax + grafptr->baseval, sizeof (Gnum), grafptr->vertnbr, stream) != (size_t) grafptr->vertnbr);
+    dataoft += (UINT64) grafptr->vertnbr * sizeof (Gnum);
+  }
+  for ( ; (o == 0) && (dataoft < layoptr->vlbloft); dataoft ++)
+    o = (putc (0, stream) == EOF);
+
+  if ((o == 0) && (grafptr->vlbltax != NULL)) {
+    o = (fwrite (grafptr->vlbltax + grafptr->baseval, sizeof (Gnum), grafptr->vertnbr, stream) != (size_t) grafptr->vertnbr);
+    dataoft += (UINT64) grafptr->vertnbr * sizeof (Gnum);
+  }
+  for ( ; (o == 0) && (dataoft < layoptr->edgeoft); dataoft ++)
+    o = (putc (0, stream) == EOF);
+
+  for (vertnum = grafptr->baseval; (o == 0) && (vertnum < grafptr->vertnnd); vertnum ++) {
+    size_t              degrval;
+
+    degrval = (size_t) (grafptr->vendtax[vertnum] - grafptr->verttax[vertnum]);
+    o = (fwrite (grafptr->edgetax + grafptr->verttax[vertnum], sizeof (Gnum), degrval, stream) != degrval);
+  }
+  dataoft += (UINT64) grafptr->edgenbr * sizeof (Gnum);
+  for ( ; (o == 0) && (dataoft < layoptr->edlooft); dataoft ++)
+    o = (putc (0, stream) == EOF);
+
+  if (grafptr->edlotax != NULL) {
+    for (vertnum = grafptr->baseval; (o == 0) && (vertnum < grafptr->vertnnd); vertnum ++) {
+      size_t              degrval;
+
+      degrval = (size_t) (grafptr->vendtax[vertnum] - grafptr->verttax[vertnum]);
+      o = (fwrite (grafptr->edlotax + grafptr->verttax[vertnum], sizeof (Gnum), degrval, stream) != degrval);
+    }
+    dataoft += (UINT64) grafptr->edgenbr * sizeof (Gnum);
+  }
+  for ( ; (o == 0) && (dataoft < layoptr->filesiz); dataoft ++)
+    o = (putc (0, stream) == EOF);
+
+  return (o);
+}
+
+/* This routine saves a source graph to
+** the given stream, in binary format.
+** Non-compact graphs are compacted on
+** the fly.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphSaveBin (
+const Graph * const         grafptr,
+FILE * const                stream)
+{
+  GraphBinHead        headdat;
+  GraphBinLayout      layodat;
+  UINT64              dataoft;
+  int                 o;
+
+  memSet (&headdat, 0, sizeof (GraphBinHead));    /* Do not output uninitialized padding */
+  memCpy (headdat.magitab, GRAPHBINMAGIC, GRAPHBINMAGICSIZ);
+  headdat.endival = GRAPHBINENDIVAL;
+  headdat.versval = GRAPHBINVERSION;
+  headdat.gnumsiz = sizeof (Gnum);
+  headdat.propval = ((grafptr->vlbltax != NULL) ? GRAPHBINHASVLBL : 0) |
+                    ((grafptr->edlotax != NULL) ? GRAPHBINHASEDLO : 0) |
+                    ((grafptr->velotax != NULL) ? GRAPHBINHASVELO : 0);
+  headdat.baseval = (UINT64) grafptr->baseval;
+  headdat.vertnbr = (UINT64) grafptr->vertnbr;
+  headdat.edgenbr = (UINT64) grafptr->edgenbr;
+  headdat.velosum = (UINT64) grafptr->velosum;
+  headdat.edlosum = (UINT64) grafptr->edlosum;
+  headdat.degrmax = (UINT64) grafptr->degrmax;
+  graphBinLayout (&layodat, GRAPHBINHEADSIZ, grafptr->vertnbr, grafptr->edgenbr, headdat.propval);
+  headdat.filesiz = layodat.filesiz;
+
+  o = (fwrite (&headdat, sizeof (GraphBinHead), 1, stream) != 1);
+  for (dataoft = sizeof (GraphBinHead); (o == 0) && (dataoft < layodat.vertoft); dataoft ++)
+    o = (putc (0, stream) == EOF);
+
+  if (o == 0)
+    o = graphSaveBin2 (grafptr, &layodat, stream);
+
+  if (o != 0)
+    errorPrint ("graphSaveBin: bad output");
+
+  return (o);
+}
+
+/* This routine loads a source graph in
+** binary format, along with geometry data
+** in the Scotch format if a geometry stream
+** is provided.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphGeomLoadBin (
+Graph * restrict const      grafptr,              /* Graph to load    */
+Geom * restrict const       geomptr,              /* Geometry to load */
+FILE * const                filesrcptr,           /* Topological data */
+FILE * const                filegeoptr,           /* Geometrical data */
+const char * const          dataptr)              /* No use           */
+{
+  if (filesrcptr != NULL) {
+    if (graphLoadBin (grafptr, filesrcptr, -1, 0) != 0)
+      return (1);
+  }
+
+  return (graphGeomLoadScot (grafptr, geomptr, NULL, filegeoptr, dataptr));
+}
+
+/* This routine saves a source graph in
+** binary format, along with geometry data
+** in the Scotch format.
+** It returns:
+** - 0   : on success.
+** - !0  : on error.
+*/
+
+int
+graphGeomSaveBin (
+const Graph * restrict const  grafptr,            /* Graph to save    */
+const Geom * restrict const   geomptr,            /* Geometry to save */
+FILE * const                  filesrcptr,         /* Topological data */
+FILE * const                  filegeoptr,         /* Geometrical data */
+const char * const            dataptr)            /* No use           */
+{
+  if (filesrcptr != NULL) {
+    if (graphSaveBin (grafptr, filesrcptr) != 0)
+      return (1);
+  }
+
+  return (graphGeomSaveScot (grafptr, geomptr, NULL, filegeoptr, dataptr));
+}
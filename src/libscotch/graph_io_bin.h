@@ -0,0 +1,127 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : graph_io_bin.h                          **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declarations   **/
+/**                for the binary source graph I/O         **/
+/**                routines.                               **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 16 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines.
+*/
+
+/*+ Magic string of binary graph files. Its
+    first character must never start a graph
+    file in the textual Scotch format.        +*/
+
+#define GRAPHBINMAGIC               "SCOTCHGB"
+#define GRAPHBINMAGICSIZ            8
+
+/*+ Version number of the binary format. +*/
+
+#define GRAPHBINVERSION             0
+
+/*+ Endianness test value. +*/
+
+#define GRAPHBINENDIVAL             ((UINT64) 0x0102030405060708ULL)
+
+/*+ Property flags of binary graph files. +*/
+
+#define GRAPHBINHASVLBL             0x0001        /*+ File has vertex labels +*/
+#define GRAPHBINHASEDLO             0x0002        /*+ File has edge loads    +*/
+#define GRAPHBINHASVELO             0x0004        /*+ File has vertex loads  +*/
+
+/*+ Size of the file header, from which data
+    arrays start, and alignment of arrays.    +*/
+
+#define GRAPHBINHEADSIZ             128
+#define GRAPHBINALIGN(s)            (((s) + 7) & ~((UINT64) 7))
+
+/*+ Memory mapping is only available on
+    POSIX systems.                         +*/
+
+#if ((! defined COMMON_OS_WINDOWS) && (! defined HAVE_NOT_SYS_MMAN_H))
+#define GRAPHBINMMAP
+#endif /* ((! defined COMMON_OS_WINDOWS) && (! defined HAVE_NOT_SYS_MMAN_H)) */
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ The binary file header. All arrays are
+    stored as native Gnum values, in file
+    base, in the order: verttab (compact,
+    vertnbr + 1 values), velotab, vlbltab,
+    edgetab and edlotab, each array starting
+    at an offset aligned on 8 bytes.          +*/
+
+typedef struct GraphBinHead_ {
+  char                      magitab[GRAPHBINMAGICSIZ]; /*+ Magic string                  +*/
+  UINT64                    endival;              /*+ Endianness test value            +*/
+  UINT64                    versval;              /*+ Format version                   +*/
+  UINT64                    gnumsiz;              /*+ Size of Gnum values in file      +*/
+  UINT64                    propval;              /*+ Property flags                   +*/
+  UINT64                    baseval;              /*+ Base value of arrays             +*/
+  UINT64                    vertnbr;              /*+ Number of vertices               +*/
+  UINT64                    edgenbr;              /*+ Number of arcs                   +*/
+  UINT64                    velosum;              /*+ Sum of vertex loads              +*/
+  UINT64                    edlosum;              /*+ Sum of edge loads                +*/
+  UINT64                    degrmax;              /*+ Maximum degree                   +*/
+  UINT64                    filesiz;              /*+ Overall size of graph data block +*/
+} GraphBinHead;
+
+/*+ The array layout of a binary file. +*/
+
+typedef struct GraphBinLayout_ {
+  UINT64                    vertoft;              /*+ Offset of vertex array      +*/
+  UINT64                    velooft;              /*+ Offset of vertex load array +*/
+  UINT64                    vlbloft;              /*+ Offset of label array       +*/
+  UINT64                    edgeoft;              /*+ Offset of edge array        +*/
+  UINT64                    edlooft;              /*+ Offset of edge load array   +*/
+  UINT64                    filesiz;              /*+ End of data block           +*/
+} GraphBinLayout;
+
+/*
+**  The function prototypes.
+*/
+
+void                        graphBinLayout      (GraphBinLayout * const, const UINT64, const Gnum, const Gnum, const UINT64);
+int                         graphSaveBin2       (const Graph * const, const GraphBinLayout * const, FILE * const);
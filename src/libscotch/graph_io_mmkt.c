@@ -47,7 +47,7 @@
 /**                # Version 6.0  : from : 04 aug 2016     **/
 /**                                 to   : 04 aug 2016     **/
 /**                # Version 7.0  : from : 27 aug 2019     **/
-/**                                 to   : 27 aug 2019     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -198,7 +198,7 @@ const char * const          dataptr)              /* Fake base value  */
     }
   }
 
-  intSort2asc2 (sorttab, sortnbr);                /* Sort edges by increasing indices */
+  intRsort2asc2 (sorttab, sortnbr, NULL);         /* Sort edges by increasing indices */
 
   edgetax = grafptr->edgetax;                     /* TRICK: point to beginning of sorted edge array for re-use */
   for (sortnum = degrmax = 0, vertnum = verttmp = baseval - 1, edgetmp = edgenum = baseval;
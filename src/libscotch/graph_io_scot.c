@@ -48,6 +48,8 @@
 /**                                 to   : 27 feb 2008     **/
 /**                # Version 5.1  : from : 11 aug 2010     **/
 /**                                 to   : 11 aug 2010     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -91,7 +93,10 @@ const char * const          dataptr)              /* No use           */
   int                           o;
 
   if (filesrcptr != NULL) {
-    if (graphLoad (grafptr, filesrcptr, -1, 0) != 0)
+    fileStreamLock (filesrcptr);                  /* Lock stream once for the whole graph */
+    o = graphLoad (grafptr, filesrcptr, -1, 0);
+    fileStreamUnlock (filesrcptr);
+    if (o != 0)
       return (1);
   }
 
@@ -157,7 +162,7 @@ const char * const          dataptr)              /* No use           */
   }
 
   if (coorsortflag != 1)                          /* If geometry data not sorted        */
-    intSort2asc1 (coorsorttab, coornbr);          /* Sort sort area by ascending labels */
+    intRsort2asc1 (coorsorttab, coornbr, NULL);   /* Sort sort area by ascending labels */
 
   for (coornum = 1; coornum < coornbr; coornum ++) { /* Check geometric data integrity */
     if (coorsorttab[coornum].labl == coorsorttab[coornum - 1].labl) {
@@ -177,7 +182,7 @@ const char * const          dataptr)              /* No use           */
         vertsortflag = 0;                         /* Graph data not sorted */
     }
     if (vertsortflag != 1)                        /* If graph data not sorted             */
-      intSort2asc1 (vertsorttab, grafptr->vertnbr); /* Sort sort area by ascending labels */
+      intRsort2asc1 (vertsorttab, grafptr->vertnbr, NULL); /* Sort sort area by ascending labels */
   }
   else {                                          /* Graph does not have vertex labels */
     for (vertnum = 0; vertnum < grafptr->vertnbr; vertnum ++)
@@ -54,6 +54,8 @@
 /**                                 to   : 10 dec 2001     **/
 /**                # Version 5.1  : from : 11 aug 2010     **/
 /**                                 to   : 11 aug 2010     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -207,7 +209,7 @@ void
 listSort (
 VertList *          listptr)
 {
-  intSort1asc1 (listptr->vnumtab, listptr->vnumnbr);
+  intRsort1asc1 (listptr->vnumtab, listptr->vnumnbr, NULL);
 }
 
 /* This routine saves a vertex number list
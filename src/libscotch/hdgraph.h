@@ -48,7 +48,7 @@
 /**                # Version 6.1  : from : 19 jun 2021     **/
 /**                                 to   : 07 oct 2021     **/
 /**                # Version 7.0  : from : 27 aug 2019     **/
-/**                                 to   : 27 aug 2019     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -104,7 +104,7 @@ int                         hdgraphInit         (Hdgraph * const);
 void                        hdgraphExit         (Hdgraph * const);
 void                        hdgraphFree         (Hdgraph * const);
 int                         hdgraphFold         (const Hdgraph * restrict const, const int, Hdgraph * restrict const);
-int                         hdgraphFold2        (const Hdgraph * restrict const, const int, Hdgraph * const, MPI_Comm);
+int                         hdgraphFold2        (const Hdgraph * restrict const, const int, const int * restrict const, Hdgraph * const, MPI_Comm);
 int                         hdgraphCheck        (const Hdgraph *);
 #ifdef HGRAPH_H
 int                         hdgraphGather       (Hdgraph *, Hgraph *);
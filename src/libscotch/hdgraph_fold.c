@@ -45,7 +45,7 @@
 /**                # Version 6.1  : from : 02 apr 2021     **/
 /**                                 to   : 19 jun 2021     **/
 /**                # Version 7.0  : from : 28 aug 2019     **/
-/**                                 to   : 28 aug 2019     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -72,7 +72,10 @@
 /* This routine builds a folded graph by
 ** merging graph data to the processes of
 ** the first half or to the second half
-** of the communicator.
+** of the communicator. As in dgraphFold(),
+** when node-aware folding is enabled, these
+** halves are made of the processes of lowest
+** and highest folding ranks.
 ** It returns:
 ** - 0   : on success.
 ** - !0  : on error.
@@ -88,14 +91,19 @@ Hdgraph * restrict const        fldgrafptr)
   int               fldproclocnum;                /* Index of local process in folded communicator   */
   int               fldproccol;                   /* Color of receiver or not wanted in communicator */
   MPI_Comm          fldproccomm;                  /* Communicator of folded part                     */
+  const int *       procnodtab;                   /* Node data for node-aware folding                */
+
+  if (dgraphFoldCommNode (&orggrafptr->s, &procnodtab) != 0) { /* Get node data cached on communicator, if any */
+    errorPrint ("hdgraphFold: cannot compute node data");
+    return     (1);
+  }
 
   fldprocglbnbr = (orggrafptr->s.procglbnbr + 1) / 2;
+  fldproclocnum = (procnodtab != NULL) ? procnodtab[orggrafptr->s.procglbnbr + orggrafptr->s.proclocnum] : orggrafptr->s.proclocnum;
   if (partval == 1) {
-    fldproclocnum = orggrafptr->s.proclocnum - fldprocglbnbr;
+    fldproclocnum = fldproclocnum - fldprocglbnbr;
     fldprocglbnbr = orggrafptr->s.procglbnbr - fldprocglbnbr;
   }
-  else
-    fldproclocnum = orggrafptr->s.proclocnum;
 
   fldproccol = ((fldproclocnum >= 0) && (fldproclocnum < fldprocglbnbr)) ? 0 : MPI_UNDEFINED;
 
@@ -104,13 +112,14 @@ Hdgraph * restrict const        fldgrafptr)
     return     (1);
   }
 
-  return (hdgraphFold2 (orggrafptr, partval, fldgrafptr, fldproccomm));
+  return (hdgraphFold2 (orggrafptr, partval, procnodtab, fldgrafptr, fldproccomm));
 }
 
 int
 hdgraphFold2 (
 const Hdgraph * restrict const  orggrafptr,
 const int                       partval,          /*+ 0 for first half, 1 for second half               +*/
+const int * restrict const      procnodtab,       /*+ Node data for node-aware folding, or NULL         +*/
 Hdgraph * const                 fldgrafptr,       /*+ Folded graph structure to fill [norestrict:async] +*/
 MPI_Comm                        fldproccomm)      /*+ Pre-computed communicator                         +*/
 {
@@ -150,12 +159,11 @@ MPI_Comm                        fldproccomm)      /*+ Pre-computed communicator
 #endif /* SCOTCH_DEBUG_HDGRAPH2 */
 
   fldprocglbnbr = (orggrafptr->s.procglbnbr + 1) / 2;
+  fldproclocnum = (procnodtab != NULL) ? procnodtab[orggrafptr->s.procglbnbr + orggrafptr->s.proclocnum] : orggrafptr->s.proclocnum;
   if (partval == 1) {
-    fldproclocnum = orggrafptr->s.proclocnum - fldprocglbnbr;
-    fldprocglbnbr = orggrafptr->s.procglbnbr - fldprocglbnbr;
+    fldproclocnum -= fldprocglbnbr;
+    fldprocglbnbr  = orggrafptr->s.procglbnbr - fldprocglbnbr;
   }
-  else
-    fldproclocnum = orggrafptr->s.proclocnum;
 
   fldcommtypval = ((fldproclocnum >= 0) && (fldproclocnum < fldprocglbnbr)) ? DGRAPHFOLDCOMMRECV : DGRAPHFOLDCOMMSEND;
 
@@ -190,7 +198,7 @@ MPI_Comm                        fldproccomm)      /*+ Pre-computed communicator
       errorPrint ("hdgraphFold2: out of memory (1)");
       cheklocval = 1;
     }
-    else if (dgraphFoldComm (&orggrafptr->s, partval, &commmax, &fldcommtypval, &fldcommdattab, &fldcommvrttab, /* Process can become a sender receiver */
+    else if (dgraphFoldComm (&orggrafptr->s, partval, procnodtab, &commmax, &fldcommtypval, &fldcommdattab, &fldcommvrttab, /* Process can become a sender receiver */
                              fldgrafptr->s.proccnttab, &fldvertadjnbr, &fldvertadjtab, &fldvertdlttab) != 0) {
       errorPrint ("hdgraphFold2: cannot compute folding communications (1)");
       cheklocval = 1;
@@ -247,7 +255,7 @@ MPI_Comm                        fldproccomm)      /*+ Pre-computed communicator
     }
 #endif /* SCOTCH_DEBUG_HDGRAPH2 */
 
-    if (dgraphFoldComm (&orggrafptr->s, partval, &commmax, &fldcommtypval, &fldcommdattab, &fldcommvrttab, NULL, NULL, NULL, NULL) != 0) {
+    if (dgraphFoldComm (&orggrafptr->s, partval, procnodtab, &commmax, &fldcommtypval, &fldcommdattab, &fldcommvrttab, NULL, NULL, NULL, NULL) != 0) {
       errorPrint ("hdgraphFold2: cannot compute folding communications (2)");
       cheklocval = 1;
     }
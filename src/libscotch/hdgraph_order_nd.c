@@ -45,7 +45,7 @@
 /**                # Version 6.0  : from : 12 sep 2012     **/
 /**                                 to   : 01 may 2019     **/
 /**                # Version 7.0  : from : 27 aug 2019     **/
-/**                                 to   : 08 jan 2022     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -63,6 +63,7 @@
 #include "hgraph.h"
 #include "hgraph_order_st.h"
 #include "dgraph.h"
+#include "dgraph_fold_comm.h"
 #include "dorder.h"
 #include "hdgraph.h"
 #include "hdgraph_order_nd.h"
@@ -101,7 +102,7 @@ HdgraphOrderNdData * const  fldthrdptr)           /* Pointer to thread data */
 
   o = 0;
   if (fldthrdptr->fldprocnbr > 1) {               /* If subpart has several processes, fold a distributed graph  */
-    if (hdgraphFold2 (&indgrafdat, fldthrdptr->fldpartval, /* Fold temporary induced subgraph from all processes */
+    if (hdgraphFold2 (&indgrafdat, fldthrdptr->fldpartval, fldthrdptr->procnodtab, /* Fold temporary induced subgraph from all processes */
                       &fldgrafptr->data.dgrfdat, fldthrdptr->fldproccomm) != 0)
       o = 1;
   }
@@ -149,6 +150,7 @@ HdgraphOrderNdGraph * restrict const  fldgrafptr)
   int                       fldprocnum;
   int                       fldproccol;
   int                       fldpartval;
+  const int *               procnodtab;           /* Node data for node-aware folding */
   int                       o;
 
 #ifdef SCOTCH_DEBUG_HDGRAPH2
@@ -158,19 +160,24 @@ HdgraphOrderNdGraph * restrict const  fldgrafptr)
   }
 #endif /* SCOTCH_DEBUG_HDGRAPH2 */
 
+  if (dgraphFoldCommNode (&orggrafptr->s, &procnodtab) != 0) { /* Get node data cached on communicator, if any */
+    errorPrint ("hdgraphOrderNdFold: cannot compute node data");
+    return     (1);
+  }
+
   fldprocnbr = (orggrafptr->s.procglbnbr + 1) / 2; /* Median cut on number of processors */
+  fldprocnum = (procnodtab != NULL) ? procnodtab[orggrafptr->s.procglbnbr + orggrafptr->s.proclocnum] : orggrafptr->s.proclocnum; /* Folding rank */
   fldthrdtab[0].fldprocnbr = fldprocnbr;
   fldthrdtab[1].fldprocnbr = orggrafptr->s.procglbnbr - fldprocnbr;
-  if (orggrafptr->s.proclocnum < fldprocnbr) {    /* Compute color and rank in two subparts */
+  if (fldprocnum < fldprocnbr) {                  /* Compute color and rank in two subparts */
     fldpartval = 0;
-    fldprocnum = orggrafptr->s.proclocnum;
     fldthrdtab[0].fldprocnum  = fldprocnum;
     fldthrdtab[1].fldprocnum  = -1;
     fldthrdtab[1].fldproccomm = MPI_COMM_NULL;
   }
   else {
     fldpartval = 1;
-    fldprocnum = orggrafptr->s.proclocnum - fldprocnbr;
+    fldprocnum = fldprocnum - fldprocnbr;
     fldprocnbr = orggrafptr->s.procglbnbr - fldprocnbr;
     fldthrdtab[0].fldproccomm = MPI_COMM_NULL;
     fldthrdtab[0].fldprocnum  = -1;
@@ -194,10 +201,12 @@ HdgraphOrderNdGraph * restrict const  fldgrafptr)
   fldthrdtab[0].indlisttab  = indlisttab0;
   fldthrdtab[0].fldgrafptr  = fldgrafptr;
   fldthrdtab[0].fldpartval  = 0;
+  fldthrdtab[0].procnodtab  = procnodtab;
   fldthrdtab[1].indlistnbr  = indlistnbr1;
   fldthrdtab[1].indlisttab  = indlisttab1;
   fldthrdtab[1].fldgrafptr  = fldgrafptr;
   fldthrdtab[1].fldpartval  = 1;
+  fldthrdtab[1].procnodtab  = procnodtab;
 
 #ifdef SCOTCH_PTHREAD_MPI
   if (contextThreadNbr (orggrafptr->contptr) > 1) {
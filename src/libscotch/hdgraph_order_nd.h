@@ -46,7 +46,7 @@
 /**                # Version 6.0  : from : 07 jun 2018     **/
 /**                                 to   : 30 apr 2019     **/
 /**                # Version 7.0  : from : 28 aug 2019     **/
-/**                                 to   : 12 feb 2022     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -91,6 +91,7 @@ typedef struct HdgraphOrderNdData_ {
   int                             fldprocnbr;     /*+ Number of processes in folded communicator    +*/
   int                             fldprocnum;     /*+ Rank of process in folded communicator, or -1 +*/
   MPI_Comm                        fldproccomm;    /*+ Communicator for the folded graph, if any     +*/
+  const int *                     procnodtab;     /*+ Node data for node-aware folding, or NULL     +*/
 } HdgraphOrderNdData;
 
 /*
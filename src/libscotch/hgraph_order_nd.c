@@ -253,7 +253,7 @@ const HgraphOrderNdParam * restrict const paraptr)
     cblkptr->cblktab[2].cblknbr = 0;
     cblkptr->cblktab[2].cblktab = NULL;
 
-    if (graphInduceList (&grafptr->s, vsplisttab[2].vnumnbr, vsplisttab[2].vnumtab, &indgrafdat.s) != 0) { /* Perform non-halo induction for separator, as it will get highest numbers */
+    if (graphInduceList (&grafptr->s, vsplisttab[2].vnumnbr, vsplisttab[2].vnumtab, &indgrafdat.s, grafptr->contptr) != 0) { /* Perform non-halo induction for separator, as it will get highest numbers */
       errorPrint ("hgraphOrderNd: cannot build induced subgraph (1)");
       vgraphExit (&vspgrafdat);
       return (1);
@@ -0,0 +1,686 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kdgraph_map_lp.c                        **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module refines a distributed k-way **/
+/**                mapping by applying a label propagation **/
+/**                method to its frontier vertices, in     **/
+/**                place and without any centralization.   **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/**   NOTES      : # As in the sequential label            **/
+/**                  propagation method, each pass is made **/
+/**                  of two rounds, in which vertices can   **/
+/**                  only move to parts of higher, then of **/
+/**                  lower indices, so that two neighbor   **/
+/**                  vertices cannot swap their parts      **/
+/**                  within the same round, even when they **/
+/**                  belong to different processes.        **/
+/**                                                        **/
+/**                # Load balance is enforced collectively.**/
+/**                  The loads of the moves that processes **/
+/**                  wish to perform are summed per part,  **/
+/**                  and every process is granted a share  **/
+/**                  of the room left in each part that is **/
+/**                  proportional to its own request.      **/
+/**                  Moves are then accepted by decreasing **/
+/**                  gain, within these shares. Hence, no  **/
+/**                  part can be overloaded by concurrent  **/
+/**                  moves, and results do not depend on   **/
+/**                  message ordering.                     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define KDGRAPH_MAP_LP
+
+#include "module.h"
+#include "common.h"
+#include "parser.h"
+#include "arch.h"
+#include "dgraph.h"
+#include "dgraph_halo.h"
+#include "dmapping.h"
+#include "kdgraph.h"
+#include "kdgraph_map_lp.h"
+#include "kdgraph_map_rb.h"
+
+/************************************/
+/*                                  */
+/* These routines handle the part   */
+/* array of the current mapping.    */
+/*                                  */
+/************************************/
+
+/* This routine fills the local part of the
+** given ghost part array with the current
+** mapping, and returns a domain array which
+** is the same on all processes. When the
+** mapping is made of a single fragment per
+** process that spans all local vertices in
+** order, and all fragments share the same
+** domain array, as is the case for mappings
+** computed by the multi-level method, this
+** fragment is used in place. Else, terminal
+** domain numbers are computed, and a domain
+** array is built from all of them.
+** It returns:
+** - 0   : if the part array could be built.
+** - !0  : on error.
+*/
+
+static
+int
+kdgraphMapLpInit (
+Kdgraph * restrict const    grafptr,
+Dmapping * restrict const   mappptr,
+Anum * restrict const       partgsttab,           /*+ Un-based ghost part array            +*/
+ArchDom ** const            domnptr,              /*+ Pointer to domain array to set       +*/
+Anum * const                domnnbrptr,           /*+ Pointer to number of domains to set  +*/
+int * const                 flagptr)              /*+ Set if fragment is updated in place  +*/
+{
+  const DmappingFrag * restrict fragptr;
+  Gnum * restrict               termloctab;
+  Gnum * restrict               termsrttab;
+  Gnum * restrict               termglbtab;
+  int * restrict                termcnttab;
+  int * restrict                termdsptab;
+  Gnum                          termlocnbr;
+  Gnum                          termglbnbr;
+  Gnum                          termnum;
+  ArchDom * restrict            domntab;
+  Gnum                          domnnbr;
+  Gnum                          vertlocnum;
+  int                           termcntval;
+  int                           procnum;
+  Gnum                          reduloctab[5];
+  Gnum                          reduglbtab[5];
+
+  Dgraph * restrict const       dgrfptr = &grafptr->s;
+
+  fragptr = mappptr->fragptr;
+  reduloctab[0] = 1;                              /* Assume fragment cannot be used in place */
+  reduloctab[1] =
+  reduloctab[2] =
+  reduloctab[3] =
+  reduloctab[4] = 0;
+  if ((mappptr->fragnbr == 1) && (fragptr->vertnbr == dgrfptr->vertlocnbr)) {
+    const Gnum * restrict fragvnumtab;
+
+    fragvnumtab = fragptr->vnumtab;
+    if (dgrfptr->vnumloctax != NULL) {
+      const Gnum * restrict vnumloctab;
+
+      for (vertlocnum = 0, vnumloctab = dgrfptr->vnumloctax + dgrfptr->baseval;
+           (vertlocnum < dgrfptr->vertlocnbr) && (fragvnumtab[vertlocnum] == vnumloctab[vertlocnum]); vertlocnum ++) ;
+    }
+    else {
+      Gnum                vertlocadj;
+
+      for (vertlocnum = 0, vertlocadj = dgrfptr->procvrttab[dgrfptr->proclocnum];
+           (vertlocnum < dgrfptr->vertlocnbr) && (fragvnumtab[vertlocnum] == (vertlocadj + vertlocnum)); vertlocnum ++) ;
+    }
+
+    if (vertlocnum == dgrfptr->vertlocnbr) {      /* If fragment spans all local vertices in order */
+      const byte * restrict domnbyttab;
+      size_t                domnbytnbr;
+      size_t                domnbytnum;
+      Gnum                  domnsumval;
+
+      domnbyttab = (const byte *) fragptr->domntab; /* Compute checksum of domain array */
+      domnbytnbr = fragptr->domnnbr * sizeof (ArchDom);
+      for (domnbytnum = 0, domnsumval = 0; domnbytnum < domnbytnbr; domnbytnum ++)
+        domnsumval = (domnsumval * 31 + (Gnum) domnbyttab[domnbytnum]) & 0x3FFFFFFF;
+
+      reduloctab[0] = 0;
+      reduloctab[1] =   (Gnum) fragptr->domnnbr;  /* Compute both maximum and minimum values */
+      reduloctab[2] = - (Gnum) fragptr->domnnbr;
+      reduloctab[3] =   domnsumval;
+      reduloctab[4] = - domnsumval;
+    }
+  }
+
+  if (MPI_Allreduce (reduloctab, reduglbtab, 5, GNUM_MPI, MPI_MAX, dgrfptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("kdgraphMapLpInit: communication error (1)");
+    return (1);
+  }
+
+  if ((reduglbtab[0] == 0) &&                     /* If all fragments can be used in place */
+      (reduglbtab[1] == - reduglbtab[2]) &&
+      (reduglbtab[3] == - reduglbtab[4])) {
+    memCpy (partgsttab, fragptr->parttab, dgrfptr->vertlocnbr * sizeof (Anum));
+    *domnptr    = fragptr->domntab;
+    *domnnbrptr = fragptr->domnnbr;
+    *flagptr    = 1;
+    return (0);
+  }
+  *flagptr = 0;
+
+  reduloctab[0] = 0;
+  if (memAllocGroup ((void **) (void *)
+                     &termloctab, (size_t) (dgrfptr->vertlocnbr * sizeof (Gnum)),
+                     &termsrttab, (size_t) (dgrfptr->vertlocnbr * sizeof (Gnum)),
+                     &termcnttab, (size_t) (dgrfptr->procglbnbr * sizeof (int)),
+                     &termdsptab, (size_t) (dgrfptr->procglbnbr * sizeof (int)), NULL) == NULL) {
+    errorPrint ("kdgraphMapLpInit: out of memory (1)");
+    reduloctab[0] = 1;
+  }
+  if (MPI_Allreduce (reduloctab, reduglbtab, 1, GNUM_MPI, MPI_MAX, dgrfptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("kdgraphMapLpInit: communication error (2)");
+    reduglbtab[0] = 1;
+  }
+  if (reduglbtab[0] != 0) {
+    if (termloctab != NULL)
+      memFree (termloctab);
+    return (1);
+  }
+
+  if (dmapTerm (mappptr, dgrfptr, termloctab) != 0) { /* Get terminal domain numbers of local vertices */
+    errorPrint ("kdgraphMapLpInit: cannot compute terminal domains");
+    memFree    (termloctab);                      /* Free group leader */
+    return     (1);
+  }
+
+  memCpy (termsrttab, termloctab, dgrfptr->vertlocnbr * sizeof (Gnum));
+  intRsort1asc1 (termsrttab, dgrfptr->vertlocnbr, grafptr->contptr);
+  for (vertlocnum = termlocnbr = 0; vertlocnum < dgrfptr->vertlocnbr; vertlocnum ++) { /* Keep distinct local terminal numbers */
+    if ((termlocnbr == 0) || (termsrttab[vertlocnum] != termsrttab[termlocnbr - 1]))
+      termsrttab[termlocnbr ++] = termsrttab[vertlocnum];
+  }
+
+  termcntval = (int) termlocnbr;
+  if (MPI_Allgather (&termcntval, 1, MPI_INT, termcnttab, 1, MPI_INT, dgrfptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("kdgraphMapLpInit: communication error (3)");
+    memFree    (termloctab);
+    return     (1);
+  }
+  for (procnum = 0, termglbnbr = 0; procnum < dgrfptr->procglbnbr; procnum ++) {
+    termdsptab[procnum] = (int) termglbnbr;
+    termglbnbr += (Gnum) termcnttab[procnum];
+  }
+
+  reduloctab[0] = 0;
+  domntab = NULL;
+  if (((termglbtab = memAlloc (termglbnbr * sizeof (Gnum)))    == NULL) ||
+      ((domntab    = memAlloc (termglbnbr * sizeof (ArchDom))) == NULL)) { /* Domain array will be reallocated afterwards */
+    errorPrint ("kdgraphMapLpInit: out of memory (2)");
+    reduloctab[0] = 1;
+  }
+#ifdef SCOTCH_DEBUG_KDGRAPH1                      /* Communication cannot be overlapped by a useful one */
+  if (MPI_Allreduce (reduloctab, reduglbtab, 1, GNUM_MPI, MPI_MAX, dgrfptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("kdgraphMapLpInit: communication error (4)");
+    reduglbtab[0] = 1;
+  }
+#else /* SCOTCH_DEBUG_KDGRAPH1 */
+  reduglbtab[0] = reduloctab[0];
+#endif /* SCOTCH_DEBUG_KDGRAPH1 */
+  if (reduglbtab[0] != 0) {
+    if (termglbtab != NULL) {
+      if (domntab != NULL)
+        memFree (domntab);
+      memFree (termglbtab);
+    }
+    memFree (termloctab);
+    return  (1);
+  }
+
+  if (MPI_Allgatherv (termsrttab, termcntval, GNUM_MPI, termglbtab, termcnttab, termdsptab, GNUM_MPI, dgrfptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("kdgraphMapLpInit: communication error (5)");
+    memFree    (domntab);
+    memFree    (termglbtab);
+    memFree    (termloctab);
+    return     (1);
+  }
+
+  intRsort1asc1 (termglbtab, termglbnbr, grafptr->contptr); /* Keep distinct global terminal numbers, in the same order on all processes */
+  for (termnum = domnnbr = 0; termnum < termglbnbr; termnum ++) {
+    if ((domnnbr == 0) || (termglbtab[termnum] != termglbtab[domnnbr - 1]))
+      termglbtab[domnnbr ++] = termglbtab[termnum];
+  }
+
+  reduloctab[0] = 0;
+  for (termnum = 0; termnum < domnnbr; termnum ++) {
+    if (archDomTerm (&mappptr->archdat, &domntab[termnum], (ArchDomNum) termglbtab[termnum]) != 0) {
+      errorPrint ("kdgraphMapLpInit: invalid terminal domain");
+      reduloctab[0] = 1;
+      break;
+    }
+  }
+
+  for (vertlocnum = 0; vertlocnum < dgrfptr->vertlocnbr; vertlocnum ++) { /* Find index of domain of every local vertex */
+    Gnum                termmin;
+    Gnum                termmax;
+
+    for (termmin = 0, termmax = domnnbr; (termmax - termmin) > 1; ) {
+      Gnum                termmed;
+
+      termmed = (termmax + termmin) / 2;
+      if (termglbtab[termmed] > termloctab[vertlocnum])
+        termmax = termmed;
+      else
+        termmin = termmed;
+    }
+    partgsttab[vertlocnum] = (Anum) termmin;
+  }
+
+  memFree (termglbtab);
+  memFree (termloctab);                           /* Free group leader */
+
+  if (reduloctab[0] != 0) {                       /* All processes share the same domain array, hence the same error */
+    memFree (domntab);
+    return  (1);
+  }
+
+  *domnptr    = memRealloc (domntab, domnnbr * sizeof (ArchDom)); /* Shrink domain array */
+  *domnnbrptr = (Anum) domnnbr;
+
+  return (0);
+}
+
+/* This routine updates the current mapping
+** with the refined part array. If the mapping
+** fragment has not been used in place, all
+** fragments are replaced by a single one that
+** spans all of the local vertices.
+** It returns:
+** - 0   : if the mapping could be updated.
+** - !0  : on error.
+*/
+
+static
+int
+kdgraphMapLpExit (
+Kdgraph * restrict const    grafptr,
+Dmapping * restrict const   mappptr,
+const Anum * restrict const partgsttab,           /*+ Un-based ghost part array +*/
+ArchDom * const             domntab,              /*+ Domain array              +*/
+const Anum                  domnnbr,              /*+ Number of domains         +*/
+const int                   flagval)              /*+ Set if done in place      +*/
+{
+  Arch                      archdat;
+  DmappingFrag * restrict   fragptr;
+
+  const Dgraph * restrict const dgrfptr = &grafptr->s;
+
+  if (flagval != 0) {                             /* If fragment used in place, just update it */
+    memCpy (mappptr->fragptr->parttab, partgsttab, dgrfptr->vertlocnbr * sizeof (Anum));
+    return (0);
+  }
+
+  if ((fragptr = kdgraphMapRbAdd2 (dgrfptr->vertlocnbr, domnnbr)) == NULL) {
+    memFree (domntab);
+    return  (1);
+  }
+
+  memCpy  (fragptr->domntab, domntab,    domnnbr            * sizeof (ArchDom));
+  memCpy  (fragptr->parttab, partgsttab, dgrfptr->vertlocnbr * sizeof (Anum));
+  memFree (domntab);
+  if (dgrfptr->vnumloctax != NULL)
+    memCpy (fragptr->vnumtab, dgrfptr->vnumloctax + dgrfptr->baseval, fragptr->vertnbr * sizeof (Gnum));
+  else {
+    Gnum * restrict     fragvnumtab;
+    Gnum                vertlocadj;
+    Gnum                vertlocnum;
+
+    fragvnumtab = fragptr->vnumtab;
+    for (vertlocnum = 0, vertlocadj = dgrfptr->procvrttab[dgrfptr->proclocnum]; vertlocnum < dgrfptr->vertlocnbr; vertlocnum ++)
+      fragvnumtab[vertlocnum] = vertlocadj + vertlocnum;
+  }
+
+  archdat = mappptr->archdat;                     /* Replace all previous fragments */
+  dmapExit (mappptr);
+  dmapInit (mappptr, &archdat);
+  dmapAdd  (mappptr, fragptr);
+
+  return (0);
+}
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine refines the current distributed
+** mapping by label propagation of frontier
+** vertices.
+** It returns:
+** - 0 : if mapping could be refined.
+** - 1 : on error.
+*/
+
+int
+kdgraphMapLp (
+Kdgraph * restrict const          grafptr,        /*+ Active graph      +*/
+Kdmapping * restrict const        mappptr,        /*+ Current mapping   +*/
+const KdgraphMapLpParam * const   paraptr)        /*+ Method parameters +*/
+{
+  Anum * restrict             partgsttax;
+  ArchDom *                   domntab;
+  Anum                        domnnbr;
+  Anum                        domnnum;
+  Gnum * restrict             comploadmax;        /* Maximum load deltas of parts              */
+  Gnum * restrict             comploaddlt;        /* Current load deltas of parts              */
+  Gnum * restrict             reqsloctab;         /* Local requested in and out loads of parts */
+  Gnum * restrict             reqsglbtab;         /* Global requested in and out loads         */
+  Gnum * restrict             dltsloctab;         /* Local load changes, plus number of moves  */
+  Gnum * restrict             dltsglbtab;
+  Gnum * restrict             edlotab;            /* Loads of edges to neighbor parts          */
+  Anum * restrict             domnlst;            /* List of neighbor parts                    */
+  Gnum * restrict             movetab;            /* Array of (vertex, part) moves of round    */
+  KdgraphMapLpSort * restrict sorttab;            /* Moves of round sorted by decreasing gain  */
+  Gnum                        movenbr;
+  Gnum                        movenum;
+  Gnum                        vertlocnum;
+  Gnum                        roundnum;
+  Gnum                        passmov;            /* Number of moves in current pass           */
+  Gnum                        passold;            /* Number of moves in previous pass          */
+  double                      comploadrat;
+  DgraphHaloRequest           requdat;
+  int                         flagval;
+  Gnum                        reduloctab[1];
+  Gnum                        reduglbtab[1];
+
+  Dgraph * restrict const     dgrfptr = &grafptr->s;
+  const Arch * restrict const archptr = &mappptr->mappptr->archdat;
+
+  if ((dgrfptr->vertglbnbr == 0) ||               /* If nothing to do */
+      (paraptr->passnbr == 0))
+    return (0);
+
+  if (dgraphGhst (dgrfptr) != 0) {                /* Compute ghost edge array if not already present */
+    errorPrint ("kdgraphMapLp: cannot compute ghost edge array");
+    return (1);
+  }
+
+  reduloctab[0] = 0;
+  if ((partgsttax = memAlloc (dgrfptr->vertgstnbr * sizeof (Anum))) == NULL) {
+    errorPrint ("kdgraphMapLp: out of memory (1)");
+    reduloctab[0] = 1;
+  }
+  if (MPI_Allreduce (reduloctab, reduglbtab, 1, GNUM_MPI, MPI_MAX, dgrfptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("kdgraphMapLp: communication error (1)");
+    reduglbtab[0] = 1;
+  }
+  if (reduglbtab[0] != 0) {
+    if (partgsttax != NULL)
+      memFree (partgsttax);
+    return (1);
+  }
+
+  if (kdgraphMapLpInit (grafptr, mappptr->mappptr, partgsttax, &domntab, &domnnbr, &flagval) != 0) {
+    memFree (partgsttax);
+    return  (1);
+  }
+  partgsttax -= dgrfptr->baseval;
+
+  reduloctab[0] = 0;
+  if (memAllocGroup ((void **) (void *)
+                     &comploadmax, (size_t) (domnnbr * sizeof (Gnum)),
+                     &comploaddlt, (size_t) (domnnbr * sizeof (Gnum)),
+                     &reqsloctab,  (size_t) (domnnbr * 2 * sizeof (Gnum)),
+                     &reqsglbtab,  (size_t) (domnnbr * 2 * sizeof (Gnum)),
+                     &dltsloctab,  (size_t) ((domnnbr + 1) * sizeof (Gnum)),
+                     &dltsglbtab,  (size_t) ((domnnbr + 1) * sizeof (Gnum)),
+                     &edlotab,     (size_t) (domnnbr * sizeof (Gnum)),
+                     &domnlst,     (size_t) (domnnbr * sizeof (Anum)),
+                     &movetab,     (size_t) (dgrfptr->vertlocnbr * 2 * sizeof (Gnum)),
+                     &sorttab,     (size_t) (dgrfptr->vertlocnbr * sizeof (KdgraphMapLpSort)), NULL) == NULL) {
+    errorPrint ("kdgraphMapLp: out of memory (2)");
+    reduloctab[0] = 1;
+  }
+  if (MPI_Allreduce (reduloctab, reduglbtab, 1, GNUM_MPI, MPI_MAX, dgrfptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("kdgraphMapLp: communication error (2)");
+    reduglbtab[0] = 1;
+  }
+  if (reduglbtab[0] != 0) {
+    if (comploadmax != NULL)
+      memFree (comploadmax);
+    if (flagval == 0)
+      memFree (domntab);
+    memFree (partgsttax + dgrfptr->baseval);
+    return  (1);
+  }
+
+  memSet (dltsloctab, 0, (domnnbr + 1) * sizeof (Gnum)); /* Compute local part loads */
+  for (vertlocnum = dgrfptr->baseval; vertlocnum < dgrfptr->vertlocnnd; vertlocnum ++)
+    dltsloctab[partgsttax[vertlocnum]] += (dgrfptr->veloloctax != NULL) ? dgrfptr->veloloctax[vertlocnum] : 1;
+
+  dgraphHaloAsync (dgrfptr, (byte *) (partgsttax + dgrfptr->baseval), ANUM_MPI, &requdat); /* Share initial part array */
+  if (MPI_Allreduce (dltsloctab, comploaddlt, domnnbr, GNUM_MPI, MPI_SUM, dgrfptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("kdgraphMapLp: communication error (3)");
+    reduloctab[0] = 1;
+  }
+  if (dgraphHaloWait (&requdat) != 0) {
+    errorPrint ("kdgraphMapLp: cannot complete asynchronous halo exchange (1)");
+    reduloctab[0] = 1;
+  }
+  if (reduloctab[0] != 0) {                       /* Communication errors are fatal */
+    memFree (comploadmax);                        /* Free group leader */
+    if (flagval == 0)
+      memFree (domntab);
+    memFree (partgsttax + dgrfptr->baseval);
+    return  (1);
+  }
+
+  comploadrat = (double) dgrfptr->veloglbsum / (double) archDomWght (archptr, &grafptr->m.domnorg);
+  for (domnnum = 0; domnnum < domnnbr; domnnum ++) {
+    Gnum                comploadavg;
+
+    comploadavg          = (Gnum) (comploadrat * (double) archDomWght (archptr, &domntab[domnnum]));
+    comploadmax[domnnum] = (Gnum) ((double) comploadavg * paraptr->deltval);
+    comploaddlt[domnnum] -= comploadavg;          /* Turn part loads into load deltas */
+    edlotab[domnnum]      = -1;                   /* No part recorded yet             */
+  }
+
+  for (roundnum = 0, passmov = 0, passold = GNUMMAX; (paraptr->passnbr < 0) || (roundnum < (2 * (Gnum) paraptr->passnbr)); roundnum ++) {
+    memSet (reqsloctab, 0, domnnbr * 2 * sizeof (Gnum));
+
+    for (vertlocnum = dgrfptr->baseval, movenbr = 0; vertlocnum < dgrfptr->vertlocnnd; vertlocnum ++) { /* Select moves of local frontier vertices */
+      Gnum                edgelocnum;
+      Gnum                veloval;
+      Gnum                commload;               /* Communication load of vertex in current part */
+      Anum                domnend;
+      Anum                domnbst;                /* Best destination part                        */
+      Gnum                gainbst;                /* Gain of best move                            */
+      Anum                domnidx;
+      Anum                dngbnbr;                /* Number of neighbor parts                     */
+      int                 ovldflg;                /* Flag set if part of vertex is overloaded     */
+
+      domnnum = partgsttax[vertlocnum];
+      for (edgelocnum = dgrfptr->vertloctax[vertlocnum], dngbnbr = 0; /* Gather loads of edges to neighbor parts */
+           edgelocnum < dgrfptr->vendloctax[vertlocnum]; edgelocnum ++) {
+        domnend = partgsttax[dgrfptr->edgegsttax[edgelocnum]];
+        if (edlotab[domnend] < 0) {               /* If part not yet recorded */
+          edlotab[domnend] = 0;
+          domnlst[dngbnbr ++] = domnend;
+        }
+        edlotab[domnend] += (dgrfptr->edloloctax != NULL) ? dgrfptr->edloloctax[edgelocnum] : 1;
+      }
+      if ((dngbnbr == 0) ||                       /* If vertex does not belong to the frontier */
+          ((dngbnbr == 1) && (domnlst[0] == domnnum))) {
+        for (domnidx = 0; domnidx < dngbnbr; domnidx ++)
+          edlotab[domnlst[domnidx]] = -1;
+        continue;
+      }
+
+      commload = 0;                               /* Compute cost of vertex in its current part */
+      for (domnidx = 0; domnidx < dngbnbr; domnidx ++) {
+        domnend = domnlst[domnidx];
+        if (domnend != domnnum)
+          commload += edlotab[domnend] * archDomDist (archptr, &domntab[domnnum], &domntab[domnend]);
+      }
+
+      veloval = (dgrfptr->veloloctax != NULL) ? dgrfptr->veloloctax[vertlocnum] : 1;
+      ovldflg = (comploaddlt[domnnum] > comploadmax[domnnum]);
+      domnbst = -1;
+      gainbst = 0;
+      for (domnidx = 0; domnidx < dngbnbr; domnidx ++) { /* For all candidate parts */
+        Gnum                commgain;
+        Anum                domntmp;
+        Anum                domnidt;
+
+        domnend = domnlst[domnidx];
+        if ((domnend == domnnum) ||               /* Only one move direction per round */
+            ((domnend > domnnum) != ((roundnum & 1) == 0)))
+          continue;
+        if (((comploaddlt[domnend] + veloval) > comploadmax[domnend]) || /* If destination part would be overloaded */
+            ((ovldflg == 0) && ((comploaddlt[domnnum] - veloval) < - comploadmax[domnnum]))) /* Or source part underloaded */
+          continue;
+
+        commgain = 0;
+        for (domnidt = 0; domnidt < dngbnbr; domnidt ++) {
+          domntmp = domnlst[domnidt];
+          if (domntmp != domnend)
+            commgain += edlotab[domntmp] * archDomDist (archptr, &domntab[domnend], &domntab[domntmp]);
+        }
+        commgain = commload - commgain;           /* Gain is decrease of communication cost */
+
+        if ((commgain > 0) ||                     /* Accept moves that reduce communication cost   */
+            ((commgain == 0) &&                   /* Or that improve load balance at constant cost */
+             ((comploaddlt[domnend] + veloval) < comploaddlt[domnnum])) ||
+            (ovldflg != 0)) {                     /* Or any move if current part is overloaded     */
+          if ((domnbst == -1) ||
+              (commgain > gainbst) ||
+              ((commgain == gainbst) && (comploaddlt[domnend] < comploaddlt[domnbst]))) {
+            domnbst = domnend;
+            gainbst = commgain;
+          }
+        }
+      }
+      for (domnidx = 0; domnidx < dngbnbr; domnidx ++) /* Reset edge load array for next vertex */
+        edlotab[domnlst[domnidx]] = -1;
+
+      if (domnbst == -1)                          /* If no move found */
+        continue;
+
+      reqsloctab[domnbst]           += veloval;   /* Request load in destination part */
+      reqsloctab[domnnbr + domnnum] += veloval;   /* And from source part             */
+      movetab[2 * movenbr]     = vertlocnum;
+      movetab[2 * movenbr + 1] = (Gnum) domnbst;
+      sorttab[movenbr].gainval = - gainbst;
+      sorttab[movenbr].movenum = movenbr;
+      movenbr ++;
+    }
+
+    if (MPI_Allreduce (reqsloctab, reqsglbtab, domnnbr * 2, GNUM_MPI, MPI_SUM, dgrfptr->proccomm) != MPI_SUCCESS) {
+      errorPrint ("kdgraphMapLp: communication error (4)");
+      reduloctab[0] = 1;
+      break;
+    }
+
+    for (domnnum = 0; domnnum < domnnbr; domnnum ++) { /* Compute local shares of room left in parts */
+      Gnum                roomval;
+
+      roomval = comploadmax[domnnum] - comploaddlt[domnnum]; /* Room left for incoming loads */
+      if (reqsglbtab[domnnum] > roomval)
+        reqsloctab[domnnum] = (roomval <= 0) ? 0
+                              : (Gnum) ((double) roomval * (double) reqsloctab[domnnum] / (double) reqsglbtab[domnnum]);
+      roomval = comploadmax[domnnum] + comploaddlt[domnnum]; /* Room left for outgoing loads */
+      if (reqsglbtab[domnnbr + domnnum] > roomval)
+        reqsloctab[domnnbr + domnnum] = (roomval <= 0) ? 0
+                                        : (Gnum) ((double) roomval * (double) reqsloctab[domnnbr + domnnum] / (double) reqsglbtab[domnnbr + domnnum]);
+    }
+
+    intRsort2asc1 (sorttab, movenbr, grafptr->contptr); /* Process moves by decreasing gain */
+
+    memSet (dltsloctab, 0, (domnnbr + 1) * sizeof (Gnum));
+    for (movenum = 0; movenum < movenbr; movenum ++) { /* Apply moves that fit in local shares */
+      Gnum                moveidx;
+      Gnum                veloval;
+      Anum                domnend;
+
+      moveidx    = sorttab[movenum].movenum;
+      vertlocnum = movetab[2 * moveidx];
+      domnend    = (Anum) movetab[2 * moveidx + 1];
+      domnnum    = partgsttax[vertlocnum];
+      veloval    = (dgrfptr->veloloctax != NULL) ? dgrfptr->veloloctax[vertlocnum] : 1;
+      if ((veloval > reqsloctab[domnend]) ||
+          (veloval > reqsloctab[domnnbr + domnnum]))
+        continue;
+
+      reqsloctab[domnend]           -= veloval;
+      reqsloctab[domnnbr + domnnum] -= veloval;
+      partgsttax[vertlocnum] = domnend;
+      dltsloctab[domnend] += veloval;
+      dltsloctab[domnnum] -= veloval;
+      dltsloctab[domnnbr] ++;                     /* One more move performed */
+    }
+
+    dgraphHaloAsync (dgrfptr, (byte *) (partgsttax + dgrfptr->baseval), ANUM_MPI, &requdat); /* Share moves with neighbors */
+    if (MPI_Allreduce (dltsloctab, dltsglbtab, domnnbr + 1, GNUM_MPI, MPI_SUM, dgrfptr->proccomm) != MPI_SUCCESS) { /* While summing load changes */
+      errorPrint ("kdgraphMapLp: communication error (5)");
+      reduloctab[0] = 1;
+    }
+    if (dgraphHaloWait (&requdat) != 0) {
+      errorPrint ("kdgraphMapLp: cannot complete asynchronous halo exchange (2)");
+      reduloctab[0] = 1;
+    }
+    if (reduloctab[0] != 0)
+      break;
+
+    for (domnnum = 0; domnnum < domnnbr; domnnum ++)
+      comploaddlt[domnnum] += dltsglbtab[domnnum];
+    passmov += dltsglbtab[domnnbr];
+
+    if ((roundnum & 1) != 0) {                    /* At end of pass, with same decision on all processes */
+      if ((passmov == 0) ||                       /* If no move performed during pass, stop               */
+          (passmov >= passold))                   /* Or if moves do not converge, as they may oscillate */
+        break;
+      passold = passmov;
+      passmov = 0;
+    }
+  }
+
+  memFree (comploadmax);                          /* Free group leader */
+
+  if (reduloctab[0] != 0) {
+    if (flagval == 0)
+      memFree (domntab);
+    memFree (partgsttax + dgrfptr->baseval);
+    return  (1);
+  }
+
+  reduloctab[0] = kdgraphMapLpExit (grafptr, mappptr->mappptr, partgsttax + dgrfptr->baseval, domntab, domnnbr, flagval);
+  memFree (partgsttax + dgrfptr->baseval);
+
+  return ((int) reduloctab[0]);
+}
@@ -0,0 +1,77 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kdgraph_map_lp.h                        **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declaration    **/
+/**                for the parallel k-way label            **/
+/**                propagation refinement routine.         **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ Method parameters. +*/
+
+typedef struct KdgraphMapLpParam_ {
+  INT                       passnbr;              /*+ Maximum number of passes to do +*/
+  double                    deltval;              /*+ Maximum weight imbalance ratio +*/
+} KdgraphMapLpParam;
+
+/*+ The sort structure, used to process
+    the moves of a round by decreasing
+    gain. Field gainval is first because
+    of intRsort2asc1.                    +*/
+
+typedef struct KdgraphMapLpSort_ {
+  Gnum                      gainval;              /*+ Opposite of move gain: FIRST +*/
+  Gnum                      movenum;              /*+ Index of move in move array  +*/
+} KdgraphMapLpSort;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef KDGRAPH_MAP_LP
+static int                  kdgraphMapLpInit    (Kdgraph * restrict const, Dmapping * restrict const, Anum * restrict const, ArchDom ** const, Anum * const, int * const);
+static int                  kdgraphMapLpExit    (Kdgraph * restrict const, Dmapping * restrict const, const Anum * restrict const, ArchDom * const, const Anum, const int);
+#endif /* KDGRAPH_MAP_LP */
+
+int                         kdgraphMapLp        (Kdgraph * const, Kdmapping * const, const KdgraphMapLpParam * const);
@@ -0,0 +1,601 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kdgraph_map_ml.c                        **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module maps a distributed graph    **/
+/**                onto a target architecture using a      **/
+/**                direct multi-level k-way scheme.        **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define KDGRAPH_MAP_ML
+
+#include "module.h"
+#include "common.h"
+#include "parser.h"
+#include "graph.h"
+#include "arch.h"
+#include "mapping.h"
+#include "kgraph.h"
+#include "kgraph_map_st.h"
+#include "dgraph.h"
+#include "dgraph_coarsen.h"
+#include "dmapping.h"
+#include "kdgraph.h"
+#include "kdgraph_map_ml.h"
+#include "kdgraph_map_rb.h"
+#include "kdgraph_map_st.h"
+
+/************************************/
+/*                                  */
+/* The mapping fragment routines.   */
+/*                                  */
+/************************************/
+
+/* This routine creates a mapping fragment
+** spanning all of the local vertices of the
+** given distributed graph, with room for
+** the given number of domains.
+** It returns:
+** - !NULL  : pointer to the fragment.
+** - NULL   : on error.
+*/
+
+static
+DmappingFrag *
+kdgraphMapMlFrag (
+const Dgraph * restrict const grafptr,
+const Anum                    domnnbr)
+{
+  DmappingFrag * restrict fragptr;
+
+  if ((fragptr = kdgraphMapRbAdd2 (grafptr->vertlocnbr, domnnbr)) == NULL)
+    return (NULL);
+
+  if (grafptr->vnumloctax != NULL)
+    memCpy (fragptr->vnumtab, grafptr->vnumloctax + grafptr->baseval, fragptr->vertnbr * sizeof (Gnum));
+  else {
+    Gnum * restrict     fragvnumtab;
+    Gnum                vertlocadj;
+    Gnum                vertlocnum;
+
+    fragvnumtab = fragptr->vnumtab;
+    for (vertlocnum = 0, vertlocadj = grafptr->procvrttab[grafptr->proclocnum]; vertlocnum < grafptr->vertlocnbr; vertlocnum ++)
+      fragvnumtab[vertlocnum] = vertlocadj + vertlocnum;
+  }
+
+  return (fragptr);
+}
+
+/* This routine frees a mapping fragment
+** which has not been linked to a mapping.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+kdgraphMapMlFragExit (
+DmappingFrag * const        fragptr)
+{
+  memFree (fragptr->vnumtab);
+  memFree (fragptr->parttab);
+  memFree (fragptr->domntab);
+  memFree (fragptr);
+}
+
+/*************************************/
+/*                                   */
+/* The coarsest level mapping and    */
+/* the uncoarsening routines.        */
+/*                                   */
+/*************************************/
+
+/* This routine centralizes the given coarsest
+** graph on the root process, maps it with the
+** sequential mapping strategy, and distributes
+** back the resulting part array. The domain
+** array is replicated on all processes, so that
+** the mapping fragments of all levels share the
+** same domain numbering.
+** It returns:
+** - 0   : if the mapping could be computed.
+** - !0  : on error.
+*/
+
+static
+int
+kdgraphMapMlSequ (
+Kdgraph * restrict const          grafptr,
+Arch * restrict const             archptr,
+const KdgraphMapMlParam * const   paraptr,
+DmappingFrag ** const             fragptrptr)
+{
+  Graph                     cgrfdat;              /* Centralized graph         */
+  Kgraph                    kgrfdat;              /* Centralized mapping graph */
+  DmappingFrag * restrict   fragptr;
+  int * restrict            vsndcnttab;
+  int * restrict            vsnddsptab;
+  Gnum                      reduloctab[2];
+  Gnum                      reduglbtab[2];
+  int                       procnum;
+
+  Dgraph * restrict const   dgrfptr = &grafptr->s;
+
+  if (dgraphGather (dgrfptr, (dgrfptr->proclocnum == 0) ? &cgrfdat : NULL) != 0) { /* Centralize graph on process 0 */
+    errorPrint ("kdgraphMapMlSequ: cannot centralize graph");
+    return (1);
+  }
+
+  reduloctab[0] =                                 /* No domains yet */
+  reduloctab[1] = 0;                              /* No error yet   */
+  if (dgrfptr->proclocnum == 0) {
+    if (kgraphInit (&kgrfdat, &cgrfdat, archptr, &grafptr->m.domnorg, 0, NULL, 1, 1, NULL) != 0) {
+      errorPrint ("kdgraphMapMlSequ: cannot initialize centralized graph");
+      graphExit  (&cgrfdat);
+      reduloctab[1] = 1;
+    }
+    else {
+      kgrfdat.s.flagval = (kgrfdat.s.flagval & ~GRAPHBITSUSED) | cgrfdat.flagval; /* Free sequential graph along with mapping data */
+      kgrfdat.s.vnumtax = NULL;                   /* Remove index array if any                                                    */
+      kgrfdat.contptr   = grafptr->contptr;
+
+      if (kgraphMapSt (&kgrfdat, paraptr->stratseq) != 0) { /* Compute sequential mapping */
+        errorPrint ("kdgraphMapMlSequ: cannot compute sequential mapping");
+        reduloctab[1] = 1;
+      }
+      else if (kgrfdat.m.parttax == NULL) {       /* If strategy did not create any mapping */
+        errorPrint ("kdgraphMapMlSequ: invalid sequential strategy");
+        reduloctab[1] = 1;
+      }
+      else
+        reduloctab[0] = (Gnum) kgrfdat.m.domnnbr;
+
+      if (reduloctab[1] != 0)
+        kgraphExit (&kgrfdat);
+    }
+  }
+
+  if (MPI_Bcast (reduloctab, 2, GNUM_MPI, 0, dgrfptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("kdgraphMapMlSequ: communication error (1)");
+    return (1);
+  }
+  if (reduloctab[1] != 0)                         /* If mapping failed on root process */
+    return (1);
+
+  vsndcnttab = NULL;
+  if (((fragptr = kdgraphMapMlFrag (dgrfptr, (Anum) reduloctab[0])) == NULL) ||
+      (memAllocGroup ((void **) (void *)
+                      &vsndcnttab, (size_t) (dgrfptr->procglbnbr * sizeof (int)),
+                      &vsnddsptab, (size_t) (dgrfptr->procglbnbr * sizeof (int)), NULL) == NULL)) {
+    errorPrint ("kdgraphMapMlSequ: out of memory");
+    reduloctab[1] = 1;
+  }
+  if (MPI_Allreduce (&reduloctab[1], &reduglbtab[1], 1, GNUM_MPI, MPI_MAX, dgrfptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("kdgraphMapMlSequ: communication error (2)");
+    reduglbtab[1] = 1;
+  }
+  if (reduglbtab[1] != 0) {
+    if (vsndcnttab != NULL)
+      memFree (vsndcnttab);
+    if (fragptr != NULL)
+      kdgraphMapMlFragExit (fragptr);
+    if (dgrfptr->proclocnum == 0)
+      kgraphExit (&kgrfdat);
+    return (1);
+  }
+
+  if (dgrfptr->proclocnum == 0) {
+    memCpy (fragptr->domntab, kgrfdat.m.domntab, fragptr->domnnbr * sizeof (ArchDom));
+
+    for (procnum = 0; procnum < dgrfptr->procglbnbr; procnum ++) {
+      vsndcnttab[procnum] = (int) (dgrfptr->procvrttab[procnum + 1] - dgrfptr->procvrttab[procnum]);
+      vsnddsptab[procnum] = (int) (dgrfptr->procvrttab[procnum]     - dgrfptr->procvrttab[0]);
+    }
+  }
+
+  reduloctab[1] = 0;
+  if ((MPI_Bcast (fragptr->domntab, (int) (fragptr->domnnbr * sizeof (ArchDom)), MPI_BYTE, 0, dgrfptr->proccomm) != MPI_SUCCESS) ||
+      (MPI_Scatterv ((dgrfptr->proclocnum == 0) ? (kgrfdat.m.parttax + kgrfdat.s.baseval) : NULL,
+                     vsndcnttab, vsnddsptab, ANUM_MPI,
+                     fragptr->parttab, (int) dgrfptr->vertlocnbr, ANUM_MPI, 0, dgrfptr->proccomm) != MPI_SUCCESS)) {
+    errorPrint ("kdgraphMapMlSequ: communication error (3)");
+    reduloctab[1] = 1;
+  }
+
+  memFree (vsndcnttab);                           /* Free group leader */
+  if (dgrfptr->proclocnum == 0)
+    kgraphExit (&kgrfdat);                        /* Free centralized graph along with its mapping */
+
+  if (reduloctab[1] != 0) {
+    kdgraphMapMlFragExit (fragptr);
+    return (1);
+  }
+
+  *fragptrptr = fragptr;
+
+  return (0);
+}
+
+/* This routine propagates the mapping of the
+** coarser graph back to the finer graph,
+** according to the multinode table of collapsed
+** vertices. Fine vertices which are not local
+** are sent to their owner processes, sorted by
+** global vertex number.
+** It returns:
+** - 0   : if coarse mapping has been propagated.
+** - !0  : on error.
+*/
+
+static
+int
+kdgraphMapMlUncoarsen (
+const Dgraph * restrict const             finegrafptr, /*+ Finer graph                    +*/
+const Dgraph * restrict const             coargrafptr, /*+ Coarser graph                  +*/
+const DgraphCoarsenMulti * restrict const coarmulttax, /*+ Based multinode array          +*/
+const DmappingFrag * restrict const       coarfragptr, /*+ Mapping of coarser graph       +*/
+DmappingFrag * restrict const             finefragptr, /*+ Mapping of finer graph to fill +*/
+Context * restrict const                  contptr)     /*+ Execution context              +*/
+{
+  Gnum                        baseval;
+  Gnum                        finevertlocadj;     /* Global vertex adjustment */
+  Gnum                        finevertlocnnd;
+  Gnum                        coarvertlocnum;
+  Anum * restrict             fineparttax;
+  const Anum * restrict       coarparttax;
+  int * restrict              vsndcnttab;
+  int * restrict              vsnddsptab;
+  int * restrict              vrcvcnttab;
+  int * restrict              vrcvdsptab;
+  KdgraphMapMlSort * restrict sortsndtab;
+  KdgraphMapMlSort * restrict sortrcvtab;
+  Gnum                        sortsndnbr;
+  Gnum                        sortsndnum;
+  Gnum                        sortrcvnum;
+  int                         vrcvdspnbr;
+  int                         vsnddspnbr;
+  int                         procnum;
+  Gnum                        reduloctab[1];
+  Gnum                        reduglbtab[1];
+
+  const int                   fineprocglbnbr = finegrafptr->procglbnbr;
+  const Gnum * restrict const fineprocvrttab = finegrafptr->procvrttab;
+
+  reduloctab[0] = 0;
+  if (memAllocGroup ((void **) (void *)
+                     &vsndcnttab, (size_t) (fineprocglbnbr * sizeof (int)),
+                     &vsnddsptab, (size_t) (fineprocglbnbr * sizeof (int)),
+                     &vrcvcnttab, (size_t) (fineprocglbnbr * sizeof (int)),
+                     &vrcvdsptab, (size_t) (fineprocglbnbr * sizeof (int)),
+                     &sortsndtab, (size_t) ((2 * coargrafptr->vertlocnbr + 1) * sizeof (KdgraphMapMlSort)), NULL) == NULL) { /* "+1" for end marker */
+    errorPrint ("kdgraphMapMlUncoarsen: out of memory (1)");
+    reduloctab[0] = 1;
+  }
+#ifdef SCOTCH_DEBUG_KDGRAPH1                      /* Communication cannot be overlapped by a useful one */
+  if (MPI_Allreduce (reduloctab, reduglbtab, 1, GNUM_MPI, MPI_MAX, finegrafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("kdgraphMapMlUncoarsen: communication error (1)");
+    return     (1);
+  }
+#else /* SCOTCH_DEBUG_KDGRAPH1 */
+  reduglbtab[0] = reduloctab[0];
+#endif /* SCOTCH_DEBUG_KDGRAPH1 */
+  if (reduglbtab[0] != 0) {
+    if (vsndcnttab != NULL)
+      memFree (vsndcnttab);
+    return (1);
+  }
+
+  baseval        = finegrafptr->baseval;
+  finevertlocnnd = finegrafptr->vertlocnnd;
+  finevertlocadj = fineprocvrttab[finegrafptr->proclocnum] - baseval;
+  fineparttax    = finefragptr->parttab - baseval;
+  coarparttax    = coarfragptr->parttab - baseval;
+
+#ifdef SCOTCH_DEBUG_KDGRAPH2
+  memSet (finefragptr->parttab, ~0, finegrafptr->vertlocnbr * sizeof (Anum)); /* All vertices are unvisited */
+#endif /* SCOTCH_DEBUG_KDGRAPH2 */
+
+  for (coarvertlocnum = baseval, sortsndnbr = 0; coarvertlocnum < coargrafptr->vertlocnnd; coarvertlocnum ++) {
+    Anum                coarpartval;
+    Gnum                finevertglbnum;
+    int                 i;
+
+    coarpartval = coarparttax[coarvertlocnum];
+
+    i = 0;
+    do {
+      Gnum                finevertlocnum;
+
+      finevertglbnum = coarmulttax[coarvertlocnum].vertglbnum[i];
+      finevertlocnum = finevertglbnum - finevertlocadj;
+      if ((finevertlocnum >= baseval) &&          /* If vertex is local */
+          (finevertlocnum <  finevertlocnnd))
+        fineparttax[finevertlocnum] = coarpartval;
+      else {
+        sortsndtab[sortsndnbr].vertnum = finevertglbnum;
+        sortsndtab[sortsndnbr].partval = (Gnum) coarpartval;
+        sortsndnbr ++;
+      }
+
+      i ++;                                       /* Process next multinode vertex                 */
+    } while (finevertglbnum != coarmulttax[coarvertlocnum].vertglbnum[1]); /* If not single node */
+  }
+
+  sortsndtab[sortsndnbr].vertnum =                /* Set end marker */
+  sortsndtab[sortsndnbr].partval = GNUMMAX;
+  intRsort2asc1 (sortsndtab, sortsndnbr, contptr); /* Sort vertices to send by global number, hence by owner process */
+
+  for (sortsndnum = 0, procnum = 0; procnum < fineprocglbnbr; procnum ++) {
+    Gnum                sortsndtmp;
+    Gnum                procvrtval;
+
+    procvrtval = fineprocvrttab[procnum + 1];
+    for (sortsndtmp = sortsndnum; sortsndtab[sortsndnum].vertnum < procvrtval; sortsndnum ++) ;
+    vsndcnttab[procnum] = (int) ((sortsndnum - sortsndtmp) * 2); /* "*2" because a Sort is 2 Gnums */
+  }
+#ifdef SCOTCH_DEBUG_KDGRAPH2
+  if (sortsndnum != sortsndnbr) {
+    errorPrint ("kdgraphMapMlUncoarsen: internal error (1)");
+    return     (1);
+  }
+#endif /* SCOTCH_DEBUG_KDGRAPH2 */
+
+  if (MPI_Alltoall (vsndcnttab, 1, MPI_INT, vrcvcnttab, 1, MPI_INT, finegrafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("kdgraphMapMlUncoarsen: communication error (2)");
+    return     (1);
+  }
+
+  for (procnum = 0, vrcvdspnbr = vsnddspnbr = 0; /* Build communication index arrays */
+       procnum < fineprocglbnbr; procnum ++) {
+    vrcvdsptab[procnum] = vrcvdspnbr;
+    vsnddsptab[procnum] = vsnddspnbr;
+    vrcvdspnbr += vrcvcnttab[procnum];
+    vsnddspnbr += vsndcnttab[procnum];
+  }
+
+  if ((sortrcvtab = memAlloc ((vrcvdspnbr / 2) * sizeof (KdgraphMapMlSort))) == NULL) {
+    errorPrint ("kdgraphMapMlUncoarsen: out of memory (2)");
+    reduloctab[0] = 1;
+  }
+#ifdef SCOTCH_DEBUG_KDGRAPH1                      /* Communication cannot be overlapped by a useful one */
+  if (MPI_Allreduce (reduloctab, reduglbtab, 1, GNUM_MPI, MPI_MAX, finegrafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("kdgraphMapMlUncoarsen: communication error (3)");
+    return     (1);
+  }
+#else /* SCOTCH_DEBUG_KDGRAPH1 */
+  reduglbtab[0] = reduloctab[0];
+#endif /* SCOTCH_DEBUG_KDGRAPH1 */
+  if (reduglbtab[0] != 0) {
+    if (sortrcvtab != NULL)
+      memFree (sortrcvtab);
+    memFree (vsndcnttab);                         /* Free group leader */
+    return  (1);
+  }
+
+  if (MPI_Alltoallv (sortsndtab, vsndcnttab, vsnddsptab, GNUM_MPI,
+                     sortrcvtab, vrcvcnttab, vrcvdsptab, GNUM_MPI, finegrafptr->proccomm) != MPI_SUCCESS) {
+    errorPrint ("kdgraphMapMlUncoarsen: communication error (4)");
+    return     (1);
+  }
+
+  for (sortrcvnum = 0; sortrcvnum < (vrcvdspnbr / 2); sortrcvnum ++) {
+    Gnum                finevertlocnum;
+
+    finevertlocnum = sortrcvtab[sortrcvnum].vertnum - finevertlocadj;
+#ifdef SCOTCH_DEBUG_KDGRAPH2
+    if ((finevertlocnum < baseval) || (finevertlocnum >= finevertlocnnd)) {
+      errorPrint ("kdgraphMapMlUncoarsen: internal error (2)");
+      return     (1);
+    }
+#endif /* SCOTCH_DEBUG_KDGRAPH2 */
+    fineparttax[finevertlocnum] = (Anum) sortrcvtab[sortrcvnum].partval;
+  }
+#ifdef SCOTCH_DEBUG_KDGRAPH2
+  for (sortrcvnum = baseval; sortrcvnum < finevertlocnnd; sortrcvnum ++) {
+    if ((fineparttax[sortrcvnum] < 0) || (fineparttax[sortrcvnum] >= finefragptr->domnnbr)) {
+      errorPrint ("kdgraphMapMlUncoarsen: internal error (3)");
+      return     (1);
+    }
+  }
+#endif /* SCOTCH_DEBUG_KDGRAPH2 */
+
+  memFree (sortrcvtab);
+  memFree (vsndcnttab);                           /* Free group leader */
+
+  return (0);
+}
+
+/* This routine applies the ascending strategy
+** to the mapping fragment of the current level.
+** The fragment is temporarily wrapped into a
+** distributed mapping attached to the current
+** graph, so that any distributed mapping method
+** that improves a mapping in place can be used.
+** It returns:
+** - 0   : if the strategy could be applied.
+** - !0  : on error.
+*/
+
+static
+int
+kdgraphMapMlAsc (
+Kdgraph * restrict const    grafptr,
+Arch * restrict const       archptr,
+const Strat * const         stratptr,
+DmappingFrag ** const       fragptrptr)
+{
+  Dmapping                  mappdat;
+  Kdmapping                 kmapdat;
+  Dmapping *                mappsav;
+  int                       o;
+
+  if (stratptr->type == STRATNODEEMPTY)           /* If nothing to do, keep fragment as is */
+    return (0);
+
+  dmapInit (&mappdat, archptr);
+  dmapAdd  (&mappdat, *fragptrptr);
+  kmapdat.mappptr = &mappdat;
+  kmapdat.domnorg = grafptr->m.domnorg;
+
+  mappsav = grafptr->m.mappptr;                   /* Attach temporary mapping to graph */
+  grafptr->m.mappptr = &mappdat;
+  o = kdgraphMapSt (grafptr, &kmapdat, stratptr);
+  grafptr->m.mappptr = mappsav;
+
+  if ((o == 0) &&
+      ((mappdat.fragnbr != 1) || (mappdat.vertlocnbr != grafptr->s.vertlocnbr))) {
+    errorPrint ("kdgraphMapMlAsc: ascending strategy must only refine the mapping");
+    o = 1;
+  }
+  if (o == 0) {
+    *fragptrptr     = mappdat.fragptr;            /* Unlink fragment so that it is not freed */
+    mappdat.fragptr = NULL;
+  }
+  else
+    *fragptrptr = NULL;
+
+  dmapExit (&mappdat);
+
+  return (o);
+}
+
+/* This routine performs the
+** multi-level mapping recursion.
+** It returns:
+** - 0   : if mapping could be computed.
+** - !0  : on error.
+*/
+
+static
+int
+kdgraphMapMl2 (
+Kdgraph * restrict const        grafptr,          /*+ Active graph                   +*/
+Arch * restrict const           archptr,          /*+ Target architecture            +*/
+const KdgraphMapMlParam * const paraptr,          /*+ Method parameters              +*/
+DmappingFrag ** const           fragptrptr)       /*+ Pointer to fragment to compute +*/
+{
+  Kdgraph                       coargrafdat;
+  DgraphCoarsenMulti * restrict coarmulttax;
+  DmappingFrag *                coarfragptr;
+  DmappingFrag *                finefragptr;
+  int                           o;
+
+  if (grafptr->s.procglbnbr > 1) {                /* Sequential mapping will perform its own coarsening */
+    coarmulttax = NULL;                           /* Let the routine create the multinode array         */
+    dgraphInit (&coargrafdat.s, grafptr->s.proccomm); /* Re-use fine graph communicator                 */
+    if (dgraphCoarsen (&grafptr->s, &coargrafdat.s, &coarmulttax, paraptr->passnbr,
+                       paraptr->coarnbr, paraptr->coarrat, DGRAPHCOARSENNONE, grafptr->contptr) == 0) {
+      coarmulttax -= coargrafdat.s.baseval;       /* Base pointer to multinode array */
+      coargrafdat.m       = grafptr->m;
+      coargrafdat.levlnum = grafptr->levlnum + 1;
+      coargrafdat.contptr = grafptr->contptr;
+
+      finefragptr = NULL;
+      if ((o = kdgraphMapMl2 (&coargrafdat, archptr, paraptr, &coarfragptr)) == 0) {
+        if ((finefragptr = kdgraphMapMlFrag (&grafptr->s, coarfragptr->domnnbr)) == NULL) {
+          errorPrint ("kdgraphMapMl2: out of memory");
+          o = 1;
+        }
+        else {
+          memCpy (finefragptr->domntab, coarfragptr->domntab, coarfragptr->domnnbr * sizeof (ArchDom)); /* Domains remain the same */
+          if ((o = kdgraphMapMlUncoarsen (&grafptr->s, &coargrafdat.s, coarmulttax, coarfragptr, finefragptr, grafptr->contptr)) != 0) {
+            kdgraphMapMlFragExit (finefragptr);
+            finefragptr = NULL;
+          }
+        }
+        kdgraphMapMlFragExit (coarfragptr);
+      }
+
+      dgraphExit (&coargrafdat.s);
+      memFree    (coarmulttax + grafptr->s.baseval); /* Free multinode array */
+
+      if (o != 0)
+        return (o);
+
+      *fragptrptr = finefragptr;
+      return (kdgraphMapMlAsc (grafptr, archptr, paraptr->stratasc, fragptrptr)); /* Refine projected mapping */
+    }
+  }
+
+  return (kdgraphMapMlSequ (grafptr, archptr, paraptr, fragptrptr)); /* Map coarsest graph */
+}
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine performs the multi-level mapping.
+** Contrary to the dual recursive bipartitioning
+** method, coarse graphs are not folded, so that
+** all processes take part in every level.
+** It returns:
+** - 0   : if mapping could be computed.
+** - !0  : on error.
+*/
+
+int
+kdgraphMapMl (
+Kdgraph * restrict const                  grafptr,
+Kdmapping * restrict const                mappptr,
+const KdgraphMapMlParam * restrict const  paraptr)
+{
+  DmappingFrag *      fragptr;
+  INT                 levlnum;                    /* Save value for graph level */
+  int                 o;
+
+  if (grafptr->s.vertglbnbr == 0)                 /* If nothing to do, return immediately */
+    return (0);
+
+  levlnum = grafptr->levlnum;                     /* Save graph level            */
+  grafptr->levlnum = 0;                           /* Initialize coarsening level */
+  o = kdgraphMapMl2 (grafptr, &mappptr->mappptr->archdat, paraptr, &fragptr);
+  grafptr->levlnum = levlnum;                     /* Restore graph level */
+
+  if (o == 0)
+    dmapAdd (mappptr->mappptr, fragptr);          /* Add mapping fragment of finest level */
+
+  return (o);
+}
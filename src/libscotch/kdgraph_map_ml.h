@@ -0,0 +1,85 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kdgraph_map_ml.h                        **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declaration    **/
+/**                for the parallel multi-level k-way      **/
+/**                static mapping routines.                **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ This structure holds the method parameters. +*/
+
+typedef struct KdgraphMapMlParam_ {
+  INT                       passnbr;              /*+ Number of coarsening passes to go +*/
+  INT                       coarnbr;              /*+ Minimum number of vertices        +*/
+  double                    coarrat;              /*+ Coarsening ratio                  +*/
+  Strat *                   stratseq;             /*+ Sequential mapping strategy       +*/
+  Strat *                   stratasc;             /*+ Strategy at ascending levels      +*/
+} KdgraphMapMlParam;
+
+/*+ The sort structure, used to send projected
+    part values to the owners of fine vertices.
+    Field vertnum is first and field partval is
+    a Gnum and not an Anum because of
+    intRsort2asc1.                              +*/
+
+typedef struct KdgraphMapMlSort_ {
+  Gnum                      vertnum;              /*+ Global fine vertex number: FIRST +*/
+  Gnum                      partval;              /*+ Part of fine vertex              +*/
+} KdgraphMapMlSort;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef KDGRAPH_MAP_ML
+static DmappingFrag *       kdgraphMapMlFrag    (const Dgraph * restrict const, const Anum);
+static void                 kdgraphMapMlFragExit (DmappingFrag * const);
+static int                  kdgraphMapMlSequ    (Kdgraph * restrict const, Arch * restrict const, const KdgraphMapMlParam * const, DmappingFrag ** const);
+static int                  kdgraphMapMlUncoarsen (const Dgraph * restrict const, const Dgraph * restrict const, const DgraphCoarsenMulti * restrict const, const DmappingFrag * restrict const, DmappingFrag * restrict const, Context * restrict const);
+static int                  kdgraphMapMlAsc     (Kdgraph * restrict const, Arch * restrict const, const Strat * const, DmappingFrag ** const);
+static int                  kdgraphMapMl2       (Kdgraph * restrict const, Arch * restrict const, const KdgraphMapMlParam * const, DmappingFrag ** const);
+#endif /* KDGRAPH_MAP_ML */
+
+int                         kdgraphMapMl        (Kdgraph * const, Kdmapping * const, const KdgraphMapMlParam * const);
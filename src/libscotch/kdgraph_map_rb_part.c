@@ -49,7 +49,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 03 jun 2018     **/
 /**                # Version 7.0  : from : 27 aug 2019     **/
-/**                                 to   : 08 jan 2022     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -70,6 +70,7 @@
 #include "kgraph.h"
 #include "kgraph_map_st.h"
 #include "dgraph.h"
+#include "dgraph_fold_comm.h"
 #include "dmapping.h"
 #include "bdgraph.h"
 #include "bdgraph_bipart_st.h"
@@ -183,7 +184,7 @@ KdgraphMapRbPartThread * const  fldthrdptr)
     return (1);
 
   if (fldthrdptr->fldprocnbr > 1) {               /* If subpart has several processes, fold a distributed graph */
-    o = dgraphFold2 (&indgrafdat, fldthrdptr->fldpartval, /* Fold temporary induced subgraph from all processes */
+    o = dgraphFold2 (&indgrafdat, fldthrdptr->fldpartval, fldthrdptr->procnodtab, /* Fold temporary induced subgraph from all processes */
                      &fldgrafptr->data.dgrfdat, fldthrdptr->fldproccomm, NULL, NULL, MPI_INT);
     fldgrafptr->data.dgrfdat.flagval |= DGRAPHFREECOMM; /* Split communicator has to be freed */
   }
@@ -230,6 +231,7 @@ KdgraphMapRbPartGraph * restrict const  fldgrafptr)
   Gnum                    indvertlocmax;          /* Local number of vertices in biggest subgraph */
   Gnum                    indflagtab[2];          /* Array of subjob continuation flags           */
   GraphPart               indpartmax;             /* Induced part having most vertices            */
+  const int *             procnodtab;             /* Node data for node-aware folding             */
   int                       o;
 
   indflagtab[0] =                                 /* Assume both jobs will not continue */
@@ -263,6 +265,11 @@ KdgraphMapRbPartGraph * restrict const  fldgrafptr)
     indpartmax    = 1;
     indvertlocmax = actgrafptr->s.vertlocnbr - actgrafptr->complocsize0;
   }
+  if (dgraphFoldCommNode (&actgrafptr->s, &procnodtab) != 0) { /* Get node data cached on communicator, if any */
+    errorPrint ("kdgraphMapRbPartFold: cannot compute node data");
+    return (1);
+  }
+
   fldprocnbr0 = (actgrafptr->s.procglbnbr + 1) / 2;  /* Get number of processes in part 0 (always more than in part 1) */
 
   fldthrdtab[0].mappptr     = mappptr;            /* Load data to pass to the subgraph building routines */
@@ -274,6 +281,7 @@ KdgraphMapRbPartGraph * restrict const  fldgrafptr)
   fldthrdtab[0].fldgrafptr  = fldgrafptr;
   fldthrdtab[0].fldpartval  = 0;
   fldthrdtab[0].fldprocnbr  = indflagtab[indpartmax] & fldprocnbr0; /* Stop if domain limited to one vertex */
+  fldthrdtab[0].procnodtab  = procnodtab;
   fldthrdtab[1].mappptr     = mappptr;
   fldthrdtab[1].orggrafptr  = &actgrafptr->s;     /* Assume jobs won't be run concurrently */
   fldthrdtab[1].inddomnptr  = &domnsubtab[indpartmax ^ 1];
@@ -283,14 +291,14 @@ KdgraphMapRbPartGraph * restrict const  fldgrafptr)
   fldthrdtab[1].fldgrafptr  = fldgrafptr;
   fldthrdtab[1].fldpartval  = 1;
   fldthrdtab[1].fldprocnbr  = indflagtab[indpartmax ^ 1] & (actgrafptr->s.procglbnbr - fldprocnbr0); /* Stop if domain limited to one vertex */
+  fldthrdtab[1].procnodtab  = procnodtab;
 
-  if (actgrafptr->s.proclocnum < fldprocnbr0) {   /* Compute color and rank in our future subpart */
+  fldprocnum = (procnodtab != NULL) ? procnodtab[actgrafptr->s.procglbnbr + actgrafptr->s.proclocnum] : actgrafptr->s.proclocnum; /* Folding rank */
+  if (fldprocnum < fldprocnbr0)                   /* Compute color and rank in our future subpart */
     fldpartval = 0;
-    fldprocnum = actgrafptr->s.proclocnum;
-  }
   else {
     fldpartval = 1;
-    fldprocnum = actgrafptr->s.proclocnum - fldprocnbr0;
+    fldprocnum -= fldprocnbr0;
   }
 
   fldgrafptr->domnorg = *fldthrdtab[fldpartval].inddomnptr; /* Set data of our folded graph */
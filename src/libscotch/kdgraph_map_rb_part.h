@@ -44,7 +44,7 @@
 /**                # Version 6.0  : from : 07 jun 2018     **/
 /**                                 to   : 07 jun 2018     **/
 /**                # Version 7.0  : from : 27 aug 2019     **/
-/**                                 to   : 12 feb 2022     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -78,6 +78,7 @@ typedef struct KdgraphMapRbPartThread_ {
   int                       fldprocnbr;           /*+ Number of processes in folded communicator     +*/
   int                       fldprocnum;           /*+ Rank of process in folded communicator, or -1  +*/
   MPI_Comm                  fldproccomm;          /*+ Communicator for the folded graph, if any      +*/
+  const int *               procnodtab;           /*+ Node data for node-aware folding, or NULL      +*/
 } KdgraphMapRbPartThread;
 
 /*+ This structure holds the data passed to each bipartitioning job. +*/
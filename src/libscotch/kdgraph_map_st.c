@@ -42,6 +42,8 @@
 /**                                                        **/
 /**   DATES      : # Version 5.1  : from : 16 jun 2008     **/
 /**                                 to   : 14 apr 2011     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -65,6 +67,8 @@
 #include "kgraph.h"
 #include "kgraph_map_st.h"
 #include "kdgraph.h"
+#include "kdgraph_map_lp.h"
+#include "kdgraph_map_ml.h"
 #include "kdgraph_map_rb.h"
 #include "kdgraph_map_st.h"
 
@@ -72,16 +76,56 @@
 **  The static and global variables.
 */
 
+static union {
+  KdgraphMapLpParam         param;
+  StratNodeMethodData       padding;
+} kdgraphmapstdefaultlp = { { 10, 0.05 } };
+
+static union {
+  KdgraphMapMlParam         param;
+  StratNodeMethodData       padding;
+} kdgraphmapstdefaultml = { { 5, 10000, 0.8, &stratdummy, &stratdummy } };
+
 static union {
   KdgraphMapRbParam         param;
   StratNodeMethodData       padding;
 } kdgraphmapstdefaultrb = { { &stratdummy, &stratdummy, 0.05 } };
 
 static StratMethodTab       kdgraphmapstmethtab[] = { /* Mapping methods array */
+                              { KDGRAPHMAPSTMETHLP, "l",  kdgraphMapLp, &kdgraphmapstdefaultlp },
+                              { KDGRAPHMAPSTMETHML, "m",  kdgraphMapMl, &kdgraphmapstdefaultml },
                               { KDGRAPHMAPSTMETHRB, "r",  kdgraphMapRb, &kdgraphmapstdefaultrb },
                               { -1,                 NULL, NULL,         NULL } };
 
 static StratParamTab        kdgraphmapstparatab[] = { /* Method parameter list */
+                              { KDGRAPHMAPSTMETHLP,  STRATPARAMDOUBLE, "bal",
+                                (byte *) &kdgraphmapstdefaultlp.param,
+                                (byte *) &kdgraphmapstdefaultlp.param.deltval,
+                                NULL },
+                              { KDGRAPHMAPSTMETHLP,  STRATPARAMINT,    "pass",
+                                (byte *) &kdgraphmapstdefaultlp.param,
+                                (byte *) &kdgraphmapstdefaultlp.param.passnbr,
+                                NULL },
+                              { KDGRAPHMAPSTMETHML,  STRATPARAMSTRAT,  "asc",
+                                (byte *) &kdgraphmapstdefaultml.param,
+                                (byte *) &kdgraphmapstdefaultml.param.stratasc,
+                                (void *) &kdgraphmapststratab },
+                              { KDGRAPHMAPSTMETHML,  STRATPARAMINT,    "pass",
+                                (byte *) &kdgraphmapstdefaultml.param,
+                                (byte *) &kdgraphmapstdefaultml.param.passnbr,
+                                NULL },
+                              { KDGRAPHMAPSTMETHML,  STRATPARAMDOUBLE, "rat",
+                                (byte *) &kdgraphmapstdefaultml.param,
+                                (byte *) &kdgraphmapstdefaultml.param.coarrat,
+                                NULL },
+                              { KDGRAPHMAPSTMETHML,  STRATPARAMSTRAT,  "seq",
+                                (byte *) &kdgraphmapstdefaultml.param,
+                                (byte *) &kdgraphmapstdefaultml.param.stratseq,
+                                (void *) &kgraphmapststratab },
+                              { KDGRAPHMAPSTMETHML,  STRATPARAMINT,    "vert",
+                                (byte *) &kdgraphmapstdefaultml.param,
+                                (byte *) &kdgraphmapstdefaultml.param.coarnbr,
+                                NULL },
                               { KDGRAPHMAPSTMETHRB,  STRATPARAMSTRAT,  "sep",
                                 (byte *) &kdgraphmapstdefaultrb.param,
                                 (byte *) &kdgraphmapstdefaultrb.param.stratsep,
@@ -134,7 +178,9 @@ const Strat * restrict const  strat)              /*+ Mapping strategy +*/
     errorPrint ("kdgraphMapSt: invalid type specification for parser variables");
     return     (1);
   }
-  if ((sizeof (KdgraphMapRbParam) > sizeof (StratNodeMethodData))) {
+  if ((sizeof (KdgraphMapLpParam) > sizeof (StratNodeMethodData)) ||
+      (sizeof (KdgraphMapMlParam) > sizeof (StratNodeMethodData)) ||
+      (sizeof (KdgraphMapRbParam) > sizeof (StratNodeMethodData))) {
     errorPrint ("kdgraphMapSt: invalid type specification");
     return     (1);
   }
@@ -45,6 +45,8 @@
 /**                                 to   : 16 jun 2008     **/
 /**                # Version 6.0  : from : 07 jun 2018     **/
 /**                                 to   : 07 jun 2018     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -55,7 +57,9 @@
 /*+ Method types. +*/
 
 typedef enum KdgraphMapStMethodType_ {
-  KDGRAPHMAPSTMETHRB = 0,                         /*+ Dual Recursive Bipartitioning +*/
+  KDGRAPHMAPSTMETHLP = 0,                         /*+ Label propagation refinement  +*/
+  KDGRAPHMAPSTMETHML,                             /*+ Multi-level k-way             +*/
+  KDGRAPHMAPSTMETHRB,                             /*+ Dual Recursive Bipartitioning +*/
   KDGRAPHMAPSTMETHNBR                             /*+ Number of methods             +*/
 } KdgraphMapStMethodType;
 
@@ -52,7 +52,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 27 aug 2020     **/
 /**                # Version 7.0  : from : 22 jun 2021     **/
-/**                                 to   : 18 jul 2021     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -140,6 +140,7 @@ const Gnum * restrict const     vmlotax)          /*+ Vertex migration cost arra
   actgrafptr->commload       = 0;
   actgrafptr->levlnum        = 0;
   actgrafptr->kbalval        = 1.0;               /* No information on imbalance yet */
+  actgrafptr->mlcaptr        = NULL;              /* No multilevel hierarchy cache   */
 
   return (0);
 }
@@ -56,7 +56,7 @@
 /**                # Version 6.1  : from : 18 jul 2021     **/
 /**                                 to   : 18 jul 2021     **/
 /**                # Version 7.0  : from : 03 aug 2018     **/
-/**                                 to   : 13 jul 2021     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # The comploadavg and comploaddlt       **/
 /**                  should always be allocated together,  **/
@@ -126,6 +126,7 @@ typedef struct Kgraph_ {
   Gnum                      commload;             /*+ Communication load                                +*/
   double                    kbalval;              /*+ Last k-way imbalance ratio                        +*/
   INT                       levlnum;              /*+ Graph coarsening level                            +*/
+  struct KgraphMapMlCache_ * mlcaptr;             /*+ Multilevel hierarchy cache, if any                +*/
   Context *                 contptr;              /*+ Execution context                                 +*/
 } Kgraph;
 
@@ -44,7 +44,7 @@
 /**   DATES      : # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 06 jun 2018     **/
 /**                # Version 7.0  : from : 03 aug 2018     **/
-/**                                 to   : 11 jul 2021     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -498,6 +498,97 @@ Gnum * const                                chektab)
 
 #endif /* SCOTCH_DEBUG_KGRAPH3 */
 
+/*******************************/
+/*                             */
+/* Distance caching routines.  */
+/*                             */
+/*******************************/
+
+/* This routine initializes the domain distance
+** cache for the current mapping. When the number
+** of domains is too large, or when memory is
+** lacking, no cache is built and distances are
+** always recomputed. Only the row flag array is
+** reset here, in linear time.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+kgraphMapFmDistInit (
+KgraphMapFmDist * restrict const  distptr,
+const Kgraph * restrict const     grafptr)
+{
+  Anum                domnnbr;
+
+  domnnbr = grafptr->m.domnnbr;
+  distptr->archptr = grafptr->m.archptr;
+  distptr->domntab = grafptr->m.domntab;
+  distptr->domnnbr = domnnbr;
+  distptr->disttab = NULL;
+  if (domnnbr > KGRAPHMAPFMDISTMAX)
+    return;
+
+  if (memAllocGroup ((void **) (void *)
+                     &distptr->disttab, (size_t) ((size_t) domnnbr * (size_t) domnnbr * sizeof (Anum)),
+                     &distptr->rowftab, (size_t) (domnnbr * sizeof (Anum)), NULL) == NULL) {
+    distptr->disttab = NULL;                      /* Run without cache */
+    return;
+  }
+  memSet (distptr->rowftab, 0, domnnbr * sizeof (Anum)); /* Rows will only be reset when first used */
+}
+
+/* This routine frees the domain distance cache.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+kgraphMapFmDistExit (
+KgraphMapFmDist * restrict const  distptr)
+{
+  if (distptr->disttab != NULL)
+    memFree (distptr->disttab);
+}
+
+/* This routine computes the distance between
+** two domains of the current mapping, and
+** records it in the cache if there is one.
+** It is called by the kgraphMapFmDist() macro
+** when the distance is not yet available.
+** It returns:
+** - the distance between the two domains.
+*/
+
+static
+Anum
+kgraphMapFmDistGet (
+const KgraphMapFmDist * restrict const  distptr,
+const Anum                              domnnum,
+const Anum                              domnend)
+{
+  Anum                distval;
+
+  distval = archDomDist (distptr->archptr, &distptr->domntab[domnnum], &distptr->domntab[domnend]);
+  if (distptr->disttab != NULL) {
+    Anum * restrict const disttab = distptr->disttab;
+    Anum * restrict const rowftab = distptr->rowftab;
+    const Anum            domnnbr = distptr->domnnbr;
+
+    if (rowftab[domnnum] == 0) {                  /* If row not yet reset, mark all of its cells as uncomputed */
+      memSet (disttab + domnnum * domnnbr, ~0, domnnbr * sizeof (Anum));
+      rowftab[domnnum] = 1;
+    }
+    disttab[domnnum * domnnbr + domnend] = distval;
+    if (rowftab[domnend] != 0)                    /* Distances are symmetric; fill other cell if its row is valid */
+      disttab[domnend * domnnbr + domnnum] = distval;
+  }
+
+  return (distval);
+}
+
 /*****************************/
 /*                           */
 /* These routines handle the */
@@ -552,6 +643,7 @@ static
 int
 kgraphMapFmPartAdd2 (
 const Kgraph * restrict const       grafptr,
+const KgraphMapFmDist * const       distptr,      /*+ Domain distance cache              +*/
 KgraphMapFmVertex * restrict const  vexxtab,      /*+ Extended vertex hash table array   +*/
 Gnum                                vexxidx,
 KgraphMapFmEdge * restrict * const  edxxtabptr,
@@ -577,7 +669,7 @@ KgraphMapFmTabl * restrict const    tablptr)
   edxxidx = (*edxxnbrptr) ++;                     /* Allocate new slot */
 
   edxxtab[edxxidx].domnnum = domnend;             /* Set extended edge data */
-  edxxtab[edxxidx].distval = archDomDist (archptr, &domntab[domnnum], &domntab[domnend]);
+  edxxtab[edxxidx].distval = kgraphMapFmDist (distptr, domnnum, domnend);
   edxxtab[edxxidx].edlosum = edloval;
   edxxtab[edxxidx].edgenbr = 1;
   edxxtab[edxxidx].vexxidx = vexxidx;
@@ -586,7 +678,7 @@ KgraphMapFmTabl * restrict const    tablptr)
   commgain = 0;                                   /* Compute commgain */
   for (edxxtmp = vexxtab[vexxidx].edxxidx; edxxtmp != -1; edxxtmp = edxxtab[edxxtmp].edxxidx) {
     commgain += edxxtab[edxxtmp].edlosum *
-                (archDomDist (archptr, &domntab[edxxtab[edxxtmp].domnnum], &domntab[domnend])
+                (kgraphMapFmDist (distptr, edxxtab[edxxtmp].domnnum, domnend)
                 - edxxtab[edxxtmp].distval);
   }
   commgain += (vexxtab[vexxidx].edlosum - edloval) * edxxtab[edxxidx].distval;
@@ -621,6 +713,7 @@ static
 int
 kgraphMapFmPartAdd (
 const Kgraph * restrict const               grafptr,
+const KgraphMapFmDist * const               distptr,  /* Domain distance cache */
 const Gnum                                  vertnum,
 const Gnum                                  vexxidx,  /* Hash value for insertion in vexxtab */
 KgraphMapFmVertex * restrict const          vexxtab,
@@ -682,7 +775,7 @@ KgraphMapFmTabl * restrict const            tablptr)
     domnend = edxxtab[edxxidx].domnnum;
     edxxtab[edxxidx].edlosum = 0;
     edxxtab[edxxidx].edgenbr = 0;
-    edxxtab[edxxidx].distval = archDomDist (archptr, &domntab[domnnum], &domntab[domnend]);
+    edxxtab[edxxidx].distval = kgraphMapFmDist (distptr, domnnum, domnend);
   }
 
   commload = 0;                                   /* Load associated with vertex edges */
@@ -720,7 +813,7 @@ KgraphMapFmTabl * restrict const            tablptr)
       edxxtab[edxxidx].cmiggain = 0;
       edxxtab[edxxidx].cmigmask = (parotax != NULL) ? ~0 : 0;
       edxxtab[edxxidx].domnnum  = domnend;
-      edxxtab[edxxidx].distval  = archDomDist (archptr, &domntab[domnnum], &domntab[domnend]);
+      edxxtab[edxxidx].distval  = kgraphMapFmDist (distptr, domnnum, domnend);
       edxxtab[edxxidx].edlosum  = 0;
       edxxtab[edxxidx].edgenbr  = 0;
       edxxtab[edxxidx].vexxidx  = vexxidx;
@@ -753,7 +846,7 @@ KgraphMapFmTabl * restrict const            tablptr)
 
       domnend = edxxtab[edxxtmp].domnnum;
       commgain += edxxtab[edxxtmp].edlosum *      /* Add edge contribution to target domain */
-                  archDomDist (archptr, &domntab[domncur], &domntab[domnend]);
+                  kgraphMapFmDist (distptr, domncur, domnend);
     }
     commgain += vexxtab[vexxidx].edlosum * edxxtab[edxxidx].distval;
     edxxtab[edxxidx].commgain = commgain * grafptr->r.crloval - commload;
@@ -965,6 +1058,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
   Gnum                            cmigload;
   KgraphMapFmTabl * restrict      tablptr;        /* Pointer to gain table for easy access          */
   KgraphMapFmTabl                 tabldat;        /* Gain table                                     */
+  KgraphMapFmDist                 distdat;        /* Domain distance cache                          */
   KgraphMapFmVertex *             lockptr;
   Gnum                            fronnum;
   Gnum                            fronnbr;
@@ -995,12 +1089,11 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
   const Gnum * restrict const     vendtax = grafptr->s.vendtax;
   const Gnum * restrict const     edgetax = grafptr->s.edgetax;
   const Gnum * restrict const     edlotax = grafptr->s.edlotax;
-  const Arch * restrict const     archptr = grafptr->m.archptr;
   const Gnum                      domnnbr = grafptr->m.domnnbr;
-  const ArchDom * restrict const  domntab = grafptr->m.domntab;
   Anum * restrict const           parttax = grafptr->m.parttax;
   Anum * restrict const           parotax = grafptr->r.m.parttax;
   const Gnum * restrict const     pfixtax = grafptr->pfixtax;
+  KgraphMapFmDist * const         distptr = &distdat;
 
 #ifdef SCOTCH_DEBUG_KGRAPH3                       /* Allocation of extra memory needed for the check routine */
   if ((chektab = memAlloc (domnnbr * 3 * sizeof(Gnum))) == NULL) {
@@ -1078,9 +1171,12 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
   hashmsk = hashsiz - 1;
   hashmax = hashsiz >> 2;
 
+  kgraphMapFmDistInit (distptr, grafptr);         /* Cache distances between domains of current mapping */
+
   if (kgraphMapFmTablInit (tablptr) != 0) {
     errorPrint ("kgraphMapFm: internal error (1)"); /* Unable to do proper initialization */
     kgraphMapFmTablExit (tablptr);
+    kgraphMapFmDistExit (distptr);
     return (1);
   }
   else {
@@ -1089,6 +1185,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
         ((edxxtab = memAlloc ((size_t) edxxsiz * sizeof (KgraphMapFmEdge)))   == NULL)) {
       errorPrint ("kgraphMapFm: out of memory (4)");
       kgraphMapFmTablExit (tablptr);
+      kgraphMapFmDistExit (distptr);
       return (1);
     }
   }
@@ -1101,6 +1198,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
       errorPrint ("kgraphMapFm: out of memory (5)");
       memFree    (vexxtab);                       /* Free group leader */
       kgraphMapFmTablExit (tablptr);
+      kgraphMapFmDistExit (distptr);
       return (1);
     }
   }
@@ -1113,7 +1211,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
     if ((pfixtax == NULL) || (pfixtax[vertnum] == -1)) { /* Add only not fixed vertices */
       for (hashnum = (vertnum * KGRAPHMAPFMHASHPRIME) & hashmsk; vexxtab[hashnum].vertnum != ~0; hashnum = (hashnum + 1) & hashmsk) ;
 
-      kgraphMapFmPartAdd (grafptr, vertnum, hashnum, vexxtab, &edxxtab, &edxxsiz, &edxxnbr, tablptr);
+      kgraphMapFmPartAdd (grafptr, distptr, vertnum, hashnum, vexxtab, &edxxtab, &edxxsiz, &edxxnbr, tablptr);
 
 #ifdef SCOTCH_DEBUG_KGRAPH2
       if (vexxtab[hashnum].edxxidx == -1) {       /* If vertex does not have any neighbor */
@@ -1415,7 +1513,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
         }
         edxxtab[edxxidx].commgain -= edxxptr->commgain;
         edxxtab[edxxidx].cmiggain -= edxxptr->cmiggain;
-        edxxtab[edxxidx].distval = archDomDist (archptr, &domntab[domnend], &domntab[domncur]);
+        edxxtab[edxxidx].distval = kgraphMapFmDist (distptr, domnend, domncur);
       }
       edxxptr->commgain = - edxxptr->commgain;
       edxxptr->cmiggain = - edxxptr->cmiggain;
@@ -1468,6 +1566,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
           if ((saveptr = memRealloc (savetab, savesiz * sizeof (KgraphMapFmSave))) == NULL) {
             errorPrint ("kgraphMapFm: out of memory (6)");
             memFree    (savetab);                 /* Free group leader */
+            kgraphMapFmDistExit (distptr);
             return     (1);
           }
           savetab = saveptr;
@@ -1477,6 +1576,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
             errorPrint ("kgraphMapFm: out of memory (7)");
             memFree    (vexxtab);                 /* Free group leader */
             kgraphMapFmTablExit (tablptr);
+            kgraphMapFmDistExit (distptr);
             return       (1);
           }
         }
@@ -1484,7 +1584,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
              (vexxtab[vexxend].vertnum != vertend) && (vexxtab[vexxend].vertnum != ~0); vexxend = (vexxend + 1) & hashmsk) ;
 
         if (vexxtab[vexxend].vertnum == ~0) {     /* If neighbor vertex not yet inserted, create it */
-          kgraphMapFmPartAdd (grafptr, vertend, vexxend, vexxtab, &edxxtab, &edxxsiz, &edxxnbr, tablptr);
+          kgraphMapFmPartAdd (grafptr, distptr, vertend, vexxend, vexxtab, &edxxtab, &edxxsiz, &edxxnbr, tablptr);
           hashnbr ++;                             /* One more vertex in hash table */
 #ifdef SCOTCH_DEBUG_KGRAPH2
           if (vexxtab[vexxend].edxxidx == -1) {
@@ -1621,7 +1721,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
           Gnum        edxxidx;
 #endif /* SCOTCH_DEBUG_KGRAPH2 */
 
-          kgraphMapFmPartAdd2 (grafptr, vexxtab, vexxend, &edxxtab, &edxxsiz, &edxxnbr, vexxtab[vexxend].domnnum, domnend, edloval, tablptr); /* Add new extended edge */
+          kgraphMapFmPartAdd2 (grafptr, distptr, vexxtab, vexxend, &edxxtab, &edxxsiz, &edxxnbr, vexxtab[vexxend].domnnum, domnend, edloval, tablptr); /* Add new extended edge */
 #ifdef SCOTCH_DEBUG_KGRAPH2
           for (edxxidx = vexxtab[vexxend].edxxidx; (edxxidx != -1) && (edxxtab[edxxidx].domnnum != domnend); edxxidx = edxxtab[edxxidx].edxxidx) ;
           if (edxxidx == -1) {
@@ -1655,8 +1755,8 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
 
         edloval *= grafptr->r.crloval;
         for (edxxend = edxfidx; edxxend != -1; edxxend = edxxtab[edxxend].edxxidx) /* Update vertex links */
-           edxxtab[edxxend].commgain -= edloval * (divnval - archDomDist (archptr, &domntab[edxxtab[edxxend].domnnum], &domntab[domnend])
-                                                 - divoval + archDomDist (archptr, &domntab[edxxtab[edxxend].domnnum], &domntab[domnnum]));
+           edxxtab[edxxend].commgain -= edloval * (divnval - kgraphMapFmDist (distptr, edxxtab[edxxend].domnnum, domnend)
+                                                 - divoval + kgraphMapFmDist (distptr, edxxtab[edxxend].domnnum, domnnum));
         if (vexxtab[vexxend].lockptr == NULL) { /* If vertex is not locked */
           for (edxxend = edxfidx; edxxend != -1; edxxend = edxxtab[edxxend].edxxidx) { /* Relink its extended edges */
             kgraphMapFmTablDel (tablptr, &edxxtab[edxxend]); /* Remove it and re-link it                            */
@@ -1774,7 +1874,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
           Anum              distval;
           Gnum              edloval;
 
-          distval = (domnend != domnlst) ? archDomDist (archptr, &domntab[domnnum], &domntab[domnend]) : distlst;
+          distval = (domnend != domnlst) ? kgraphMapFmDist (distptr, domnnum, domnend) : distlst;
           distlst = distval;
           domnlst = domnend;
           edloval = (edlotax != NULL) ? edlotax[edgenum] : 1;
@@ -1813,7 +1913,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
             Anum              distval;
             Gnum              edloval;
 
-            distval = (domnend != domnlst) ? archDomDist (archptr, &domntab[domnnum], &domntab[domnend]) : distlst;
+            distval = (domnend != domnlst) ? kgraphMapFmDist (distptr, domnnum, domnend) : distlst;
             distlst = distval;
             domnlst = domnend;
             edloval = (edlotax != NULL) ? edlotax[edgenum] : 1;
@@ -1841,6 +1941,7 @@ const KgraphMapFmParam * const    paraptr)        /*+ Method parameters +*/
   memFree (savetab);
   memFree (edxxtab);
   kgraphMapFmTablExit (tablptr);
+  kgraphMapFmDistExit (distptr);
 
 #ifdef SCOTCH_DEBUG_KGRAPH2
   if (kgraphCheck (grafptr) != 0) {
@@ -48,6 +48,8 @@
 /**                                 to   : 12 oct 2006     **/
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 07 jun 2018     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -63,6 +65,15 @@
 
 #define KGRAPHMAPFMEDXXCOMP         5             /*+ Compact if edxunbr > (edxxnbr / KGRAPHMAPFMEDXXCOMP) */
 
+/*+ Maximum number of domains for which
+    domain distances are cached. Setting it
+    to 0 at compile time disables the cache,
+    e.g. to benchmark its effect.           +*/
+
+#ifndef KGRAPHMAPFMDISTMAX
+#define KGRAPHMAPFMDISTMAX          1024          /*+ Cache takes at most KGRAPHMAPFMDISTMAX^2 Anum's +*/
+#endif /* KGRAPHMAPFMDISTMAX */
+
 /*+ Save type identifier +*/
 
 #define KGRAPHMAPPFMSAVEVEXX        0
@@ -83,6 +94,25 @@ typedef struct KgraphMapFmParam_ {
   double                    deltval;              /*+ Maximum weight imbalance ratio                       +*/
 } KgraphMapFmParam;
 
+/*+ The domain distance cache. Distances
+    between domains of the current mapping
+    are computed once, on first use, and
+    stored in a dense matrix. Rows of the
+    matrix are only reset when first used,
+    so that the cost of a run does not grow
+    with the square of the number of domains.
+    When there are too many domains, disttab
+    is NULL and distances are always
+    recomputed.                             +*/
+
+typedef struct KgraphMapFmDist_ {
+  const Arch *              archptr;              /*+ Target architecture                      +*/
+  const ArchDom *           domntab;              /*+ Array of domains of current mapping      +*/
+  Anum                      domnnbr;              /*+ Number of domains                        +*/
+  Anum *                    disttab;              /*+ Distance matrix; -1 for uncomputed cells +*/
+  Anum *                    rowftab;              /*+ Flag array of reset matrix rows          +*/
+} KgraphMapFmDist;
+
 /*+ The extended edge structure. In fact, this
     structure does not represent edges, but
     possible moves in another domain.
@@ -199,6 +229,10 @@ int                         kgraphMapFm         (Kgraph * restrict const, const
 
 #endif /* SCOTCH_TABLE_GAIN */
 
+#define kgraphMapFmDist(d,n,e)      ((((d)->disttab != NULL) && ((d)->rowftab[(n)] != 0) && ((d)->disttab[(n) * (d)->domnnbr + (e)] >= 0)) \
+                                     ? (d)->disttab[(n) * (d)->domnnbr + (e)]                                                              \
+                                     : kgraphMapFmDistGet ((d), (n), (e)))
+
 #define kgraphMapFmLock(l,v)        do {                                        \
                                       (v)->lockptr = (KgraphMapFmVertex *) (l); \
                                       (l) = (v);                                \
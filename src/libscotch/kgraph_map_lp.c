@@ -0,0 +1,466 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kgraph_map_lp.c                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : This module refines a k-way mapping of  **/
+/**                the given mapping graph by applying a   **/
+/**                multi-threaded label propagation        **/
+/**                method to its frontier vertices.        **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/**   NOTES      : # Each pass is made of two rounds. In   **/
+/**                  the first round, vertices can only    **/
+/**                  move to parts of higher indices, and  **/
+/**                  to parts of lower indices in the      **/
+/**                  second one, so that two neighbor      **/
+/**                  vertices cannot swap their parts      **/
+/**                  within the same round. Move gains     **/
+/**                  are computed against the mapping of   **/
+/**                  the beginning of the round, and moves **/
+/**                  are applied once all threads have     **/
+/**                  selected theirs.                      **/
+/**                                                        **/
+/**                # Since gains are computed against a    **/
+/**                  stale mapping, moves may oscillate.   **/
+/**                  Passes therefore stop as soon as the  **/
+/**                  number of moves does not decrease.    **/
+/**                                                        **/
+/**                # Part loads are reserved atomically,   **/
+/**                  so that concurrent moves can never    **/
+/**                  overload any destination part.        **/
+/**                  Consequently, results may vary from   **/
+/**                  one run to another when several      **/
+/**                  threads perform moves. When a         **/
+/**                  deterministic behavior is requested,  **/
+/**                  all moves are selected by the first   **/
+/**                  thread only.                          **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The defines and includes.
+*/
+
+#define KGRAPH_MAP_LP
+
+#include "module.h"
+#include "common.h"
+#include "context.h"
+#include "arch.h"
+#include "graph.h"
+#include "mapping.h"
+#include "kgraph.h"
+#include "kgraph_map_lp.h"
+
+/*************************************/
+/*                                   */
+/* These routines handle the thread  */
+/* reduction and scan operations.    */
+/*                                   */
+/*************************************/
+
+/* This routine sums the numbers of
+** moves performed by all threads.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+kgraphMapLpReduce (
+KgraphMapLpThread * restrict const  tlocptr,      /* Pointer to local thread block  */
+KgraphMapLpThread * restrict const  tremptr,      /* Pointer to remote thread block */
+const void * const                  globptr)      /* Unused                         */
+{
+  tlocptr->movenbr += tremptr->movenbr;
+}
+
+/* This routine performs a prefix scan
+** sum operation on a single Gnum value,
+** backed by a temporary area.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+kgraphMapLpScan (
+Gnum * restrict const       tlocptr,              /* Pointer to local area   */
+Gnum * restrict const       tremptr,              /* Pointer to remote area  */
+const int                   srcpval,              /* Source phase value      */
+const int                   dstpval,              /* Destination phase value */
+const void * const          globptr)              /* Unused                  */
+{
+  tlocptr[dstpval] = tlocptr[srcpval] + ((tremptr == NULL) ? 0 : tremptr[srcpval]);
+}
+
+/********************************/
+/*                              */
+/* This is the refinement loop. */
+/*                              */
+/********************************/
+
+/* This routine performs the label propagation
+** passes, using all available threads.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+kgraphMapLpLoop (
+ThreadDescriptor * restrict const descptr,
+KgraphMapLpData * restrict const  loopptr)
+{
+  Gnum * restrict               edlotab;          /* Loads of edges to neighbor parts          */
+  Anum * restrict               domnlst;          /* List of neighbor parts                    */
+  Gnum * restrict               movetab;          /* Array of (vertex, part) moves of round    */
+  Gnum                          movemax;          /* Maximum number of moves of thread         */
+  Gnum                          movenbr;
+  Gnum                          movenum;
+  Gnum                          vertbas;          /* Range of vertices for frontier rebuilding */
+  Gnum                          vertnnd;
+  Gnum                          vertnum;
+  Gnum                          fronnbr;
+  Gnum                          fronnum;
+  Gnum                          roundnum;         /* Number of current round                   */
+  Gnum                          passmov;          /* Number of moves in current pass           */
+  Gnum                          passold;          /* Number of moves in previous pass          */
+  Anum                          domnnum;
+
+  const int                           thrdnbr = threadNbr (descptr);
+  const int                           thrdnum = threadNum (descptr);
+  const int                           thrdwrk = loopptr->thrdwrk;
+  KgraphMapLpThread * restrict const  thrdptr = &loopptr->thrdtab[thrdnum];
+  Kgraph * restrict const             grafptr = loopptr->grafptr;
+  const Gnum                          baseval = grafptr->s.baseval;
+  const Gnum * restrict const         verttax = grafptr->s.verttax;
+  const Gnum * restrict const         vendtax = grafptr->s.vendtax;
+  const Gnum * restrict const         velotax = grafptr->s.velotax;
+  const Gnum * restrict const         edgetax = grafptr->s.edgetax;
+  const Gnum * restrict const         edlotax = grafptr->s.edlotax;
+  const Gnum * restrict const         vnumtax = grafptr->s.vnumtax;
+  const Arch * restrict const         archptr = grafptr->m.archptr;
+  const ArchDom * restrict const      domntab = grafptr->m.domntab;
+  const Anum                          domnnbr = grafptr->m.domnnbr;
+  Anum * restrict const               parttax = grafptr->m.parttax;
+  const Anum * restrict const         parotax = grafptr->r.m.parttax;
+  const Gnum * restrict const         vmlotax = grafptr->r.vmlotax;
+  const Gnum                          crloval = grafptr->r.crloval;
+  const Gnum                          cmloval = grafptr->r.cmloval;
+  const Anum * restrict const         pfixtax = grafptr->pfixtax;
+  Gnum * restrict const               frontab = grafptr->frontab;
+  Gnum * const                        comploaddlt = grafptr->comploaddlt;
+  const Gnum * restrict const         comploadmax = loopptr->comploadmax;
+  Gnum * restrict const               flagtax = loopptr->flagtax;
+  const Gnum                          vancnnd = ((grafptr->s.flagval & KGRAPHHASANCHORS) != 0) /* End of non-anchor vertices */
+                                                ? grafptr->s.vertnnd - domnnbr : grafptr->s.vertnnd;
+
+  vertbas = baseval + DATASCAN (grafptr->s.vertnbr, thrdnbr, thrdnum);
+  vertnnd = baseval + DATASCAN (grafptr->s.vertnbr, thrdnbr, thrdnum + 1);
+  for (vertnum = vertbas; vertnum < vertnnd; vertnum ++) /* Reset local part of flag array */
+    flagtax[vertnum] = -1;
+
+  movemax = (thrdnum < thrdwrk) ? DATASIZE (grafptr->s.vertnbr, thrdwrk, 0) : 0; /* Size of largest frontier slice */
+  if (memAllocGroup ((void **) (void *)           /* Allocate here for memory affinity as these are private arrays */
+                     &edlotab, (size_t) (domnnbr     * sizeof (Gnum)),
+                     &domnlst, (size_t) (domnnbr     * sizeof (Anum)),
+                     &movetab, (size_t) ((movemax + 1) * 2 * sizeof (Gnum)), NULL) == NULL) {
+    errorPrint ("kgraphMapLpLoop: out of memory");
+    loopptr->abrtval = 1;
+    edlotab = NULL;
+  }
+  else {
+    for (domnnum = 0; domnnum < domnnbr; domnnum ++) /* No part recorded yet */
+      edlotab[domnnum] = -1;
+  }
+
+  threadBarrier (descptr);                        /* Synchronization for abrtval and flag array */
+
+  if (loopptr->abrtval != 0) {                    /* If someone's allocation failed */
+    if (edlotab != NULL)
+      memFree (edlotab);
+    return;
+  }
+
+  for (roundnum = 0, passmov = 0, passold = GNUMMAX; (loopptr->passnbr < 0) || (roundnum < (2 * (Gnum) loopptr->passnbr)); roundnum ++) {
+    Gnum                fronbas;
+    Gnum                fronnnd;
+
+    fronnbr = grafptr->fronnbr;
+    fronbas = (thrdnum < thrdwrk) ? DATASCAN (fronnbr, thrdwrk, thrdnum)     : fronnbr;
+    fronnnd = (thrdnum < thrdwrk) ? DATASCAN (fronnbr, thrdwrk, thrdnum + 1) : fronnbr;
+
+    for (fronnum = fronbas, movenbr = 0; fronnum < fronnnd; fronnum ++) { /* Select moves of local frontier vertices */
+      Gnum                edgenum;
+      Gnum                veloval;
+      Gnum                commload;           /* Communication load of vertex in current part */
+      Gnum                migcoef;            /* Migration cost of vertex                     */
+      const ArchDom *     domoptr;            /* Domain in old mapping                        */
+      Anum                domnend;
+      Anum                domnbst;            /* Best destination part                        */
+      Gnum                gainbst;            /* Gain of best move                            */
+      Anum                domnidx;
+      Anum                dngbnbr;            /* Number of neighbor parts                     */
+      int                 ovldflg;            /* Flag set if part of vertex is overloaded     */
+
+      vertnum = frontab[fronnum];
+      if ((vertnum >= vancnnd) ||               /* Do not move anchor vertices */
+          ((pfixtax != NULL) && (pfixtax[vertnum] != -1))) /* Nor fixed vertices */
+        continue;
+
+      domnnum = parttax[vertnum];
+      for (edgenum = verttax[vertnum], dngbnbr = 0; /* Gather loads of edges to neighbor parts */
+           edgenum < vendtax[vertnum]; edgenum ++) {
+        domnend = parttax[edgetax[edgenum]];
+        if (edlotab[domnend] < 0) {             /* If part not yet recorded */
+          edlotab[domnend] = 0;
+          domnlst[dngbnbr ++] = domnend;
+        }
+        edlotab[domnend] += (edlotax != NULL) ? edlotax[edgenum] : 1;
+      }
+      if ((dngbnbr == 0) ||                     /* If vertex does not belong to the frontier */
+          ((dngbnbr == 1) && (domnlst[0] == domnnum))) {
+        for (domnidx = 0; domnidx < dngbnbr; domnidx ++)
+          edlotab[domnlst[domnidx]] = -1;
+        continue;
+      }
+      flagtax[vertnum] = roundnum;              /* Vertex is still a frontier vertex */
+
+      domoptr = NULL;
+      migcoef = 0;
+      if (parotax != NULL) {                    /* If we are doing a repartitioning */
+        Gnum                vertold;
+
+        vertold = ((vnumtax != NULL) &&         /* Get vertex number in original graph */
+                   ((grafptr->s.flagval & KGRAPHHASANCHORS) == 0))
+                  ? vnumtax[vertnum] : vertnum;
+        if (parotax[vertold] != -1) {           /* If vertex was mapped to an old domain */
+          domoptr = mapDomain (&grafptr->r.m, vertold);
+          migcoef = cmloval * ((vmlotax != NULL) ? vmlotax[vertnum] : 1);
+        }
+      }
+
+      commload = 0;                             /* Compute cost of vertex in its current part */
+      for (domnidx = 0; domnidx < dngbnbr; domnidx ++) {
+        domnend = domnlst[domnidx];
+        if (domnend != domnnum)
+          commload += edlotab[domnend] * archDomDist (archptr, &domntab[domnnum], &domntab[domnend]);
+      }
+      commload *= crloval;
+      if ((domoptr != NULL) && (archDomIncl (archptr, &domntab[domnnum], domoptr) != 1))
+        commload += migcoef * archDomDist (archptr, &domntab[domnnum], domoptr);
+
+      veloval = (velotax != NULL) ? velotax[vertnum] : 1;
+      ovldflg = (comploaddlt[domnnum] > comploadmax[domnnum]);
+      domnbst = -1;
+      gainbst = 0;
+      for (domnidx = 0; domnidx < dngbnbr; domnidx ++) { /* For all candidate parts */
+        Gnum                commgain;
+        Anum                domntmp;
+        Anum                domnidt;
+
+        domnend = domnlst[domnidx];
+        if ((domnend == domnnum) ||             /* Only one move direction per round */
+            ((domnend > domnnum) != ((roundnum & 1) == 0)))
+          continue;
+        if (((comploaddlt[domnend] + veloval) > comploadmax[domnend]) || /* If destination part would be overloaded */
+            ((ovldflg == 0) && ((comploaddlt[domnnum] - veloval) < - comploadmax[domnnum]))) /* Or source part underloaded */
+          continue;
+
+        commgain = 0;
+        for (domnidt = 0; domnidt < dngbnbr; domnidt ++) {
+          domntmp = domnlst[domnidt];
+          if (domntmp != domnend)
+            commgain += edlotab[domntmp] * archDomDist (archptr, &domntab[domnend], &domntab[domntmp]);
+        }
+        commgain *= crloval;
+        if ((domoptr != NULL) && (archDomIncl (archptr, &domntab[domnend], domoptr) != 1))
+          commgain += migcoef * archDomDist (archptr, &domntab[domnend], domoptr);
+        commgain = commload - commgain;         /* Gain is decrease of communication cost */
+
+        if ((commgain > 0) ||                   /* Accept moves that reduce communication cost       */
+            ((commgain == 0) &&                 /* Or that improve load balance at constant cost     */
+             ((comploaddlt[domnend] + veloval) < comploaddlt[domnnum])) ||
+            (ovldflg != 0)) {                   /* Or any move if current part is overloaded         */
+          if ((domnbst == -1) ||
+              (commgain > gainbst) ||
+              ((commgain == gainbst) && (comploaddlt[domnend] < comploaddlt[domnbst]))) {
+            domnbst = domnend;
+            gainbst = commgain;
+          }
+        }
+      }
+      for (domnidx = 0; domnidx < dngbnbr; domnidx ++) /* Reset edge load array for next vertex */
+        edlotab[domnlst[domnidx]] = -1;
+
+      if (domnbst == -1)                        /* If no move found */
+        continue;
+
+      if (__sync_add_and_fetch (&comploaddlt[domnbst], veloval) > comploadmax[domnbst]) { /* Reserve load in destination part */
+        __sync_fetch_and_sub (&comploaddlt[domnbst], veloval); /* Some concurrent move took it first                */
+        continue;
+      }
+      __sync_fetch_and_sub (&comploaddlt[domnnum], veloval);
+
+      movetab[2 * movenbr]     = vertnum;
+      movetab[2 * movenbr + 1] = (Gnum) domnbst;
+      movenbr ++;
+    }
+
+    threadBarrier (descptr);                      /* All moves of round must have been selected */
+
+    for (movenum = 0; movenum < movenbr; movenum ++) { /* Apply local moves and flag their neighbors */
+      Gnum                edgenum;
+
+      vertnum = movetab[2 * movenum];
+      parttax[vertnum] = (Anum) movetab[2 * movenum + 1];
+      flagtax[vertnum] = roundnum;
+      for (edgenum = verttax[vertnum]; edgenum < vendtax[vertnum]; edgenum ++)
+        flagtax[edgetax[edgenum]] = roundnum;     /* Concurrent writes all store the same value */
+    }
+
+    thrdptr->movenbr = movenbr;
+    threadReduce (descptr, (void *) thrdptr, sizeof (KgraphMapLpThread), (ThreadReduceFunc) kgraphMapLpReduce, 0, NULL);
+    if (thrdnum == 0)
+      loopptr->movenbr = thrdptr->movenbr;
+
+    for (vertnum = vertbas, fronnbr = 0; vertnum < vertnnd; vertnum ++) /* Count local flagged vertices */
+      fronnbr += (flagtax[vertnum] == roundnum) ? 1 : 0;
+    thrdptr->fronnbr    = fronnbr;
+    thrdptr->scantab[0] = fronnbr;
+    threadScan (descptr, (void *) &thrdptr->scantab[0], sizeof (KgraphMapLpThread), (ThreadScanFunc) kgraphMapLpScan, NULL); /* Barrier for loopptr->movenbr */
+
+    for (vertnum = vertbas, fronnum = thrdptr->scantab[0] - fronnbr; vertnum < vertnnd; vertnum ++) { /* Rebuild frontier array */
+      if (flagtax[vertnum] == roundnum)
+        frontab[fronnum ++] = vertnum;
+    }
+    passmov += loopptr->movenbr;
+
+    threadBarrier (descptr);                      /* All threads must have read frontier size and move count */
+
+    if (thrdnum == (thrdnbr - 1))                 /* Last thread knows size of new frontier */
+      grafptr->fronnbr = thrdptr->scantab[0];
+
+    threadBarrier (descptr);                      /* New frontier must be complete before next round */
+
+    if ((roundnum & 1) != 0) {                    /* At end of pass */
+      if ((passmov == 0) ||                       /* If no move performed during pass, stop               */
+          (passmov >= passold))                   /* Or if moves do not converge, as they may oscillate */
+        break;
+      passold = passmov;
+      passmov = 0;
+    }
+  }
+
+  memFree (edlotab);                              /* Free group leader */
+}
+
+/*****************************/
+/*                           */
+/* This is the main routine. */
+/*                           */
+/*****************************/
+
+/* This routine refines the current mapping
+** by label propagation of frontier vertices.
+** It returns:
+** - 0 : if k-partition could be computed.
+** - 1 : on error.
+*/
+
+int
+kgraphMapLp (
+Kgraph * restrict const         grafptr,          /*+ Active graph      +*/
+const KgraphMapLpParam * const  paraptr)          /*+ Method parameters +*/
+{
+  KgraphMapLpData     loopdat;
+  Gnum *              comploadmax;
+  Gnum *              flagtab;
+  Anum                domnnum;
+  int                 thrdnbr;
+  INT                 deteval;                    /* Flag set if deterministic behavior */
+
+  const Anum                domnnbr = grafptr->m.domnnbr;
+
+  grafptr->kbalval = paraptr->deltval;            /* Store last k-way imbalance ratio */
+  kgraphCost (grafptr);                           /* Compute accurate part load deltas */
+
+  if ((grafptr->fronnbr == 0) ||                  /* If no frontier, nothing to do */
+      (paraptr->passnbr == 0))
+    return (0);
+
+  thrdnbr = contextThreadNbr (grafptr->contptr);
+  if (memAllocGroup ((void **) (void *)
+                     &comploadmax,     (size_t) (domnnbr * sizeof (Gnum)),
+                     &flagtab,         (size_t) (grafptr->s.vertnbr * sizeof (Gnum)),
+                     &loopdat.thrdtab, (size_t) (thrdnbr * sizeof (KgraphMapLpThread)), NULL) == NULL) {
+    errorPrint ("kgraphMapLp: out of memory");
+    return     (1);
+  }
+  for (domnnum = 0; domnnum < domnnbr; domnnum ++)
+    comploadmax[domnnum] = (Gnum) ((double) grafptr->comploadavg[domnnum] * paraptr->deltval);
+
+  contextValuesGetInt (grafptr->contptr, CONTEXTOPTIONNUMDETERMINISTIC, &deteval);
+
+  loopdat.grafptr     = grafptr;
+  loopdat.comploadmax = comploadmax;
+  loopdat.flagtax     = flagtab - grafptr->s.baseval;
+  loopdat.thrdwrk     = (deteval != 0) ? 1 : thrdnbr; /* Only one thread selects moves if determinism wanted */
+  loopdat.passnbr     = paraptr->passnbr;         /* Negative value means infinite */
+  loopdat.abrtval     = 0;
+
+  contextThreadLaunch (grafptr->contptr, (ThreadFunc) kgraphMapLpLoop, (void *) &loopdat);
+
+  memFree (comploadmax);                          /* Free group leader */
+
+  if (loopdat.abrtval != 0)
+    return (1);
+
+  kgraphFron (grafptr);
+  kgraphCost (grafptr);
+
+#ifdef SCOTCH_DEBUG_KGRAPH2
+  if (kgraphCheck (grafptr) != 0) {
+    errorPrint ("kgraphMapLp: internal error");
+    return     (1);
+  }
+#endif /* SCOTCH_DEBUG_KGRAPH2 */
+
+  return (0);
+}
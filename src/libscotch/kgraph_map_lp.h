@@ -0,0 +1,92 @@
+/* Copyright 2026 IPB, Universite de Bordeaux, INRIA & CNRS
+**
+** This file is part of the Scotch software package for static mapping,
+** graph partitioning and sparse matrix ordering.
+**
+** This software is governed by the CeCILL-C license under French law
+** and abiding by the rules of distribution of free software. You can
+** use, modify and/or redistribute the software under the terms of the
+** CeCILL-C license as circulated by CEA, CNRS and INRIA at the following
+** URL: "http://www.cecill.info".
+**
+** As a counterpart to the access to the source code and rights to copy,
+** modify and redistribute granted by the license, users are provided
+** only with a limited warranty and the software's author, the holder of
+** the economic rights, and the successive licensors have only limited
+** liability.
+**
+** In this respect, the user's attention is drawn to the risks associated
+** with loading, using, modifying and/or developing or reproducing the
+** software by the user in light of its specific status of free software,
+** that may mean that it is complicated to manipulate, and that also
+** therefore means that it is reserved for developers and experienced
+** professionals having in-depth computer knowledge. Users are therefore
+** encouraged to load and test the software's suitability as regards
+** their requirements in conditions enabling the security of their
+** systems and/or data to be ensured and, more generally, to use and
+** operate it in the same conditions as regards security.
+**
+** The fact that you are presently reading this means that you have had
+** knowledge of the CeCILL-C license and that you accept its terms.
+*/
+/************************************************************/
+/**                                                        **/
+/**   NAME       : kgraph_map_lp.h                         **/
+/**                                                        **/
+/**   AUTHOR     : Francois PELLEGRINI                     **/
+/**                                                        **/
+/**   FUNCTION   : These lines are the data declaration    **/
+/**                for the multi-threaded label            **/
+/**                propagation k-way mapping refinement    **/
+/**                algorithm.                              **/
+/**                                                        **/
+/**   DATES      : # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
+/**                                                        **/
+/************************************************************/
+
+/*
+**  The type and structure definitions.
+*/
+
+/*+ Method parameters. +*/
+
+typedef struct KgraphMapLpParam_ {
+  INT                       passnbr;              /*+ Maximum number of passes to do +*/
+  double                    deltval;              /*+ Maximum weight imbalance ratio +*/
+} KgraphMapLpParam;
+
+/*+ The thread-specific data block. +*/
+
+typedef struct KgraphMapLpThread_ {
+  Gnum                      movenbr;              /*+ Number of moves performed in round +*/
+  Gnum                      fronnbr;              /*+ Number of local frontier vertices  +*/
+  Gnum                      scantab[2];           /*+ Scan area for frontier rebuilding  +*/
+} KgraphMapLpThread;
+
+/*+ The loop routine parameter
+    structure. It contains the
+    thread-independent data.   +*/
+
+typedef struct KgraphMapLpData_ {
+  Kgraph *                  grafptr;              /*+ Graph to work on                          +*/
+  Gnum *                    comploadmax;          /*+ Array of maximum imbalances               +*/
+  Gnum *                    flagtax;              /*+ Round number of last frontier flagging    +*/
+  int                       thrdwrk;              /*+ Number of threads which perform moves     +*/
+  INT                       passnbr;              /*+ Maximum number of passes                  +*/
+  Gnum                      movenbr;              /*+ Number of moves performed in current pass +*/
+  volatile int              abrtval;              /*+ Abort value                               +*/
+  KgraphMapLpThread *       thrdtab;              /*+ Array of thread-specific data             +*/
+} KgraphMapLpData;
+
+/*
+**  The function prototypes.
+*/
+
+#ifdef KGRAPH_MAP_LP
+static void                 kgraphMapLpLoop     (ThreadDescriptor * restrict const, KgraphMapLpData * restrict const);
+static void                 kgraphMapLpReduce   (KgraphMapLpThread * restrict const, KgraphMapLpThread * restrict const, const void * const);
+static void                 kgraphMapLpScan     (Gnum * restrict const, Gnum * restrict const, const int, const int, const void * const);
+#endif /* KGRAPH_MAP_LP */
+
+int                         kgraphMapLp         (Kgraph * restrict const, const KgraphMapLpParam * const);
@@ -45,7 +45,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 25 feb 2018     **/
 /**                # Version 7.0  : from : 03 aug 2018     **/
-/**                                 to   : 19 jul 2021     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -88,7 +88,8 @@ kgraphMapMlCoarsen (
 Kgraph * restrict const               finegrafptr, /*+ Finer graph                                  +*/
 Kgraph * restrict const               coargrafptr, /*+ Coarser graph to build                       +*/
 GraphCoarsenMulti * restrict * const  coarmultptr, /*+ Pointer to un-based multinode table to build +*/
-const KgraphMapMlParam * const        paraptr)    /*+ Method parameters                             +*/
+const KgraphMapMlParam * const        paraptr,    /*+ Method parameters                             +*/
+KgraphMapMlCache * const              cachptr)    /*+ Hierarchy cache, if any                       +*/
 {
   const Anum * restrict const finepfixtax = finegrafptr->pfixtax;
 
@@ -100,10 +101,68 @@ const KgraphMapMlParam * const        paraptr)    /*+ Method parameters
   }
 #endif /* SCOTCH_DEBUG_KGRAPH2 */
 
-  *coarmultptr = NULL;                            /* Allocate coarmulttab along with coarse graph */
-  if (graphCoarsen (&finegrafptr->s, &coargrafptr->s, NULL, coarmultptr, paraptr->coarnbr, paraptr->coarval, GRAPHCOARSENNOCOMPACT,
-                    finegrafptr->r.m.parttax, finepfixtax, finegrafptr->vfixnbr, finegrafptr->contptr) != 0)
-    return (1);
+  if ((cachptr != NULL) &&                        /* If coarse graph already in cache */
+      (finegrafptr->levlnum < cachptr->levlnbr)) {
+    KgraphMapMlCacheLevl * restrict levlptr;
+    Gnum * restrict     coarvelotab;
+    Gnum                coarvertnum;
+    Gnum                coarvertnbr;
+
+    const Gnum * restrict const         finevelotax = finegrafptr->s.velotax;
+    const GraphCoarsenMulti * restrict  coarmulttab;
+
+    levlptr     = &cachptr->levltab[finegrafptr->levlnum];
+    coarmulttab = levlptr->multtab;
+    coarvelotab = levlptr->grafdat.velotax + levlptr->grafdat.baseval;
+    coarvertnbr = levlptr->grafdat.vertnbr;
+    for (coarvertnum = 0; coarvertnum < coarvertnbr; coarvertnum ++) { /* Update coarse vertex loads from fine ones */
+      Gnum                finevertnum0;
+      Gnum                finevertnum1;
+
+      finevertnum0 = coarmulttab[coarvertnum].vertnum[0];
+      finevertnum1 = coarmulttab[coarvertnum].vertnum[1];
+      coarvelotab[coarvertnum] = (finevelotax != NULL)
+                                 ? ((finevertnum0 == finevertnum1) ? 0 : finevelotax[finevertnum1]) + finevelotax[finevertnum0]
+                                 : ((finevertnum0 == finevertnum1) ? 1 : 2);
+    }
+    levlptr->grafdat.velosum = finegrafptr->s.velosum;
+
+    coargrafptr->s          = levlptr->grafdat;   /* Clone cached graph, which must not be freed */
+    coargrafptr->s.flagval &= ~GRAPHFREETABS;
+    *coarmultptr = (GraphCoarsenMulti *) coarmulttab;
+  }
+  else {
+    if ((cachptr != NULL) &&                      /* If cached hierarchy is complete, stop there */
+        ((cachptr->flagval & KGRAPHMAPMLCACHEFULL) != 0))
+      return (1);
+
+    *coarmultptr = NULL;                          /* Allocate coarmulttab along with coarse graph */
+    if (graphCoarsen (&finegrafptr->s, &coargrafptr->s, NULL, coarmultptr, paraptr->coarnbr, paraptr->coarval, GRAPHCOARSENNOCOMPACT,
+                      (cachptr != NULL) ? NULL : finegrafptr->r.m.parttax, /* Cached hierarchies do not depend on old parts */
+                      finepfixtax, finegrafptr->vfixnbr, finegrafptr->contptr) != 0)
+      return (1);
+
+    if (cachptr != NULL) {                        /* If coarse graph has to be kept in cache */
+      if (cachptr->levlnbr >= cachptr->levlmax) {
+        KgraphMapMlCacheLevl * levltmp;
+        INT                    levlmax;
+
+        levlmax = cachptr->levlmax + (cachptr->levlmax >> 1) + 8;
+        if ((levltmp = (KgraphMapMlCacheLevl *) memRealloc (cachptr->levltab, levlmax * sizeof (KgraphMapMlCacheLevl))) == NULL) {
+          errorPrint ("kgraphMapMlCoarsen: out of memory (3)");
+          graphExit  (&coargrafptr->s);
+          return (1);
+        }
+        cachptr->levltab = levltmp;
+        cachptr->levlmax = levlmax;
+      }
+      cachptr->levltab[cachptr->levlnbr].grafdat = coargrafptr->s; /* Cache takes ownership of coarse graph */
+      cachptr->levltab[cachptr->levlnbr].multtab = *coarmultptr;
+      cachptr->levlnbr ++;
+      cachptr->coarcnt ++;                        /* Account for actual coarsening */
+      coargrafptr->s.flagval &= ~GRAPHFREETABS;
+    }
+  }
 
   mapInit2 (&coargrafptr->m,   &coargrafptr->s, finegrafptr->m.archptr,   &finegrafptr->m.domnorg,   finegrafptr->m.domnmax,   finegrafptr->m.domnnbr);
   mapInit2 (&coargrafptr->r.m, &coargrafptr->s, finegrafptr->r.m.archptr, &finegrafptr->r.m.domnorg, finegrafptr->r.m.domnmax, finegrafptr->r.m.domnnbr);
@@ -112,6 +171,7 @@ const KgraphMapMlParam * const        paraptr)    /*+ Method parameters
   coargrafptr->comploadavg = finegrafptr->comploadavg; /* By default, use fine target load arrays as coarse load arrays */
   coargrafptr->comploaddlt = finegrafptr->comploaddlt;
   coargrafptr->frontab     = finegrafptr->frontab; /* Share frontier array of finer graph as coarse frontier array (no freeing) */
+  coargrafptr->mlcaptr     = NULL;
   coargrafptr->contptr     = finegrafptr->contptr;
 
   coargrafptr->r.cmloval = finegrafptr->r.cmloval;
@@ -145,11 +205,35 @@ const KgraphMapMlParam * const        paraptr)    /*+ Method parameters
 
       finevertnum0 = coarmulttab[coarvertnum].vertnum[0];
       finevertnum1 = coarmulttab[coarvertnum].vertnum[1];
+      if ((cachptr != NULL) &&                    /* If cached multinode spans two old parts */
+          (fineparotax[finevertnum1] != fineparotax[finevertnum0])) {
+        Gnum                finevmloval0;
+        Gnum                finevmloval1;
+
+        finevmloval0 = (finevmlotax != NULL) ? finevmlotax[finevertnum0] : 1;
+        finevmloval1 = (finevmlotax != NULL) ? finevmlotax[finevertnum1] : 1;
+        if (finevmloval1 > finevmloval0) {        /* Keep old part of most costly vertex to migrate */
+          coarparotab[coarvertnum] = fineparotax[finevertnum1];
+          coarvmlotab[coarvertnum] = finevmloval1;
+        }
+        else {
+          coarparotab[coarvertnum] = fineparotax[finevertnum0];
+          coarvmlotab[coarvertnum] = finevmloval0;
+        }
+        continue;
+      }
       coarparotab[coarvertnum] = fineparotax[finevertnum0];
       coarvmlotab[coarvertnum] = (finevmlotax != NULL)
                                  ? ((finevertnum0 == finevertnum1) ? 0 : finevmlotax[finevertnum1]) + finevmlotax[finevertnum0]
                                  : ((finevertnum0 == finevertnum1) ? 1 : 2);
+    }
 #ifdef SCOTCH_DEBUG_KGRAPH2
+    for (coarvertnum = 0; (cachptr == NULL) && (coarvertnum < coarvertnbr); coarvertnum ++) { /* Without cache, matching honors old parts */
+      Gnum                finevertnum0;
+      Gnum                finevertnum1;
+
+      finevertnum0 = coarmulttab[coarvertnum].vertnum[0];
+      finevertnum1 = coarmulttab[coarvertnum].vertnum[1];
       if ((fineparotax[finevertnum1] != fineparotax[finevertnum0]) && /* If vertices were not in the same part */
           ((finegrafptr->pfixtax == NULL) ||
            ((finepfixtax[finevertnum1] == -1) &&  /* And both are not fixed */
@@ -157,8 +241,8 @@ const KgraphMapMlParam * const        paraptr)    /*+ Method parameters
         errorPrint ("kgraphMapMlCoarsen: internal error (2)");
         return (1);
       }
-#endif /* SCOTCH_DEBUG_KGRAPH2 */
     }
+#endif /* SCOTCH_DEBUG_KGRAPH2 */
   }
   else
     coargrafptr->r.vmlotax = NULL;
@@ -363,20 +447,23 @@ static
 int
 kgraphMapMl2 (
 Kgraph * restrict const           grafptr,        /*+ Active graph      +*/
-const KgraphMapMlParam * const    paraptr)        /*+ Method parameters +*/
+const KgraphMapMlParam * const    paraptr,        /*+ Method parameters       +*/
+KgraphMapMlCache * const          cachptr)        /*+ Hierarchy cache, if any +*/
 {
   Kgraph              coargrafdat;
   GraphCoarsenMulti * coarmulttab;                /* Pointer to un-based multinode array */
   int                 o;
 
-  if (kgraphMapMlCoarsen (grafptr, &coargrafdat, &coarmulttab, paraptr) == 0) {
-    if (((o = kgraphMapMl2         (&coargrafdat, paraptr))              == 0) &&
+  if (kgraphMapMlCoarsen (grafptr, &coargrafdat, &coarmulttab, paraptr, cachptr) == 0) {
+    if (((o = kgraphMapMl2         (&coargrafdat, paraptr, cachptr))     == 0) &&
         ((o = kgraphMapMlUncoarsen (grafptr, &coargrafdat, coarmulttab)) == 0) &&
         ((o = kgraphMapSt          (grafptr, paraptr->stratasc))         != 0)) /* Apply ascending strategy */
       errorPrint ("kgraphMapMl2: cannot apply ascending strategy");
     kgraphExit (&coargrafdat);
   }
   else {                                          /* Cannot coarsen due to lack of memory or error */
+    if (cachptr != NULL)                          /* Cached hierarchy is complete at this level    */
+      cachptr->flagval |= KGRAPHMAPMLCACHEFULL;
     if (((o = kgraphMapMlUncoarsen (grafptr, NULL, NULL))        == 0) && /* Finalize graph        */
         ((o = kgraphMapSt          (grafptr, paraptr->stratlow)) != 0)) /* Apply low strategy      */
       errorPrint ("kgraphMapMl2: cannot apply low strategy");
@@ -402,14 +489,89 @@ kgraphMapMl (
 Kgraph * const                  grafptr,          /*+ Active graph      +*/
 const KgraphMapMlParam * const  paraptr)          /*+ Method parameters +*/
 {
+  KgraphMapMlCache *  cachptr;
   Gnum                levlnum;                    /* Save value for graph level */
   int                 o;
 
+  cachptr = grafptr->mlcaptr;
+  if (cachptr != NULL) {                          /* If hierarchy cache provided                      */
+    grafptr->mlcaptr = NULL;                      /* Only first multilevel method of strategy uses it */
+
+    if ((cachptr->levlnbr > 0) ||                 /* If cache not empty, check it still applies       */
+        ((cachptr->flagval & KGRAPHMAPMLCACHEFULL) != 0)) {
+      if ((cachptr->baseval != grafptr->s.baseval) ||
+          (cachptr->vertnbr != grafptr->s.vertnbr) ||
+          (cachptr->edgenbr != grafptr->s.edgenbr) ||
+          (cachptr->vfixnbr != grafptr->vfixnbr)   ||
+          (cachptr->coarnbr != paraptr->coarnbr)   ||
+          (cachptr->coarval != paraptr->coarval)) {
+        kgraphMapMlCacheExit (cachptr);           /* Hierarchy will be re-computed */
+        kgraphMapMlCacheInit (cachptr);
+      }
+    }
+    cachptr->baseval = grafptr->s.baseval;
+    cachptr->vertnbr = grafptr->s.vertnbr;
+    cachptr->edgenbr = grafptr->s.edgenbr;
+    cachptr->vfixnbr = grafptr->vfixnbr;
+    cachptr->coarnbr = paraptr->coarnbr;
+    cachptr->coarval = paraptr->coarval;
+  }
+
   levlnum = grafptr->levlnum;                     /* Save graph level            */
   grafptr->levlnum = 0;                           /* Initialize coarsening level */
-  o = kgraphMapMl2 (grafptr, paraptr);            /* Perform multi-level mapping */
+  o = kgraphMapMl2 (grafptr, paraptr, cachptr);   /* Perform multi-level mapping */
   grafptr->levlnum = levlnum;                     /* Restore graph level         */
 
+  if ((o != 0) && (cachptr != NULL)) {            /* Do not trust cache if an error occurred */
+    kgraphMapMlCacheExit (cachptr);
+    kgraphMapMlCacheInit (cachptr);
+  }
+
   return (o);
 }
 
+/*****************************************/
+/*                                       */
+/* These routines handle the cache which */
+/* keeps the coarsening hierarchy across */
+/* successive multilevel mappings.       */
+/*                                       */
+/*****************************************/
+
+/* This routine initializes an empty
+** hierarchy cache.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+void
+kgraphMapMlCacheInit (
+KgraphMapMlCache * const    cachptr)
+{
+  memSet (cachptr, 0, sizeof (KgraphMapMlCache));
+  cachptr->flagval = KGRAPHMAPMLCACHENONE;
+}
+
+/* This routine frees the contents
+** of the given hierarchy cache.
+** It returns:
+** - VOID  : in all cases.
+*/
+
+void
+kgraphMapMlCacheExit (
+KgraphMapMlCache * const    cachptr)
+{
+  INT                 levlnum;
+
+  for (levlnum = 0; levlnum < cachptr->levlnbr; levlnum ++)
+    graphExit (&cachptr->levltab[levlnum].grafdat); /* Also frees multinode arrays */
+
+  if (cachptr->levltab != NULL)
+    memFree (cachptr->levltab);
+
+#ifdef SCOTCH_DEBUG_KGRAPH2
+  memSet (cachptr, ~0, sizeof (KgraphMapMlCache));
+#endif /* SCOTCH_DEBUG_KGRAPH2 */
+}
+
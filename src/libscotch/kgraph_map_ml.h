@@ -44,9 +44,20 @@
 /**                                 to   : 10 jul 2010     **/
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 07 jun 2018     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
+/*
+**  The defines.
+*/
+
+/*+ Multilevel cache flags. +*/
+
+#define KGRAPHMAPMLCACHENONE        0x0000        /*+ No flags                       +*/
+#define KGRAPHMAPMLCACHEFULL        0x0001        /*+ Coarsening hierarchy completed +*/
+
 /*
 **  The type and structure definitions.
 */
@@ -61,14 +72,49 @@ typedef struct KgraphMapMlParam_ {
   int                       typeval;              /*+ Not used                     +*/
 } KgraphMapMlParam;
 
+/*+ This structure holds a cached coarse
+    graph, along with the multinode array
+    which links it to its finer graph.    +*/
+
+typedef struct KgraphMapMlCacheLevl_ {
+  Graph                     grafdat;              /*+ Coarse graph, owning the multinode array +*/
+  GraphCoarsenMulti *       multtab;              /*+ Un-based multinode array                 +*/
+} KgraphMapMlCacheLevl;
+
+/*+ This structure holds the coarsening
+    hierarchy of a multilevel mapping, so
+    that it can be re-used by subsequent
+    mappings of the same graph in which
+    only vertex loads may have changed.
+    As the hierarchy has to be valid for
+    any old mapping, it is computed without
+    regard to old parts.                    +*/
+
+typedef struct KgraphMapMlCache_ {
+  int                       flagval;              /*+ Cache flags                                +*/
+  Gnum                      baseval;              /*+ Base value of finest graph                 +*/
+  Gnum                      vertnbr;              /*+ Number of vertices of finest graph         +*/
+  Gnum                      edgenbr;              /*+ Number of edges of finest graph            +*/
+  Gnum                      vfixnbr;              /*+ Number of fixed vertices of finest graph   +*/
+  INT                       coarnbr;              /*+ Minimum number of vertices used to coarsen +*/
+  double                    coarval;              /*+ Coarsening ratio used to coarsen           +*/
+  INT                       levlnbr;              /*+ Number of cached coarse graphs             +*/
+  INT                       levlmax;              /*+ Size of level array                        +*/
+  INT                       coarcnt;              /*+ Number of coarsenings performed            +*/
+  KgraphMapMlCacheLevl *    levltab;              /*+ Array of cached coarse graphs              +*/
+} KgraphMapMlCache;
+
 /*
 **  The function prototypes.
 */
 
 #ifdef KGRAPH_MAP_ML
-static int                  kgraphMapMlCoarsen  (Kgraph * const, Kgraph * restrict const, GraphCoarsenMulti * restrict * const, const KgraphMapMlParam * const);
+static int                  kgraphMapMlCoarsen  (Kgraph * const, Kgraph * restrict const, GraphCoarsenMulti * restrict * const, const KgraphMapMlParam * const, KgraphMapMlCache * const);
 static int                  kgraphMapMlUncoarsen (Kgraph * restrict const, Kgraph * const, const GraphCoarsenMulti * const);
-static int                  kgraphMapMl2        (Kgraph * restrict const, const KgraphMapMlParam * const);
+static int                  kgraphMapMl2        (Kgraph * restrict const, const KgraphMapMlParam * const, KgraphMapMlCache * const);
 #endif /* KGRAPH_MAP_ML */
 
 int                         kgraphMapMl         (Kgraph * restrict const, const KgraphMapMlParam * const);
+
+void                        kgraphMapMlCacheInit (KgraphMapMlCache * const);
+void                        kgraphMapMlCacheExit (KgraphMapMlCache * const);
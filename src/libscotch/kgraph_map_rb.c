@@ -149,7 +149,7 @@ const KgraphMapRbParam * restrict const paraptr)
   }
   else {
     if (kgraphMapRbVfloBuild (grafptr->m.archptr, &grafptr->s, grafptr->vfixnbr, grafptr->pfixtax,
-                              &indgrafdat, &vflonbr, &vflotab) != 0) {
+                              &indgrafdat, &vflonbr, &vflotab, grafptr->contptr) != 0) {
       errorPrint ("kgraphMapRb: cannot create induced graph");
       return (1);
     }
@@ -218,7 +218,8 @@ const Gnum                                  orgvfixnbr, /*+ Number of fixed vert
 const Anum * restrict const                 orgpfixtax, /*+ Array of fixed vertex terminal domains     +*/
 Graph * restrict const                      indgrafptr, /*+ Induced subgraph without fixed vertices    +*/
 Anum * restrict const                       vflonbrptr, /*+ Pointer to number of fixed vertex slots    +*/
-KgraphMapRbVflo * restrict * restrict const vflotabptr) /*+ Pointer to fixed vertex load array pointer +*/
+KgraphMapRbVflo * restrict * restrict const vflotabptr, /*+ Pointer to fixed vertex load array pointer +*/
+Context * const                             contptr) /*+ Execution context                           +*/
 {
   ArchDom                     domndat;
   Gnum                        orgvertnum;
@@ -284,7 +285,7 @@ KgraphMapRbVflo * restrict * restrict const vflotabptr) /*+ Pointer to fixed ver
       orgparttax[orgvertnum] = 0;                 /* Keep non-fixed vertex in induced subgraph */
   }
 
-  if (graphInducePart (orggrafptr, orgparttax, orggrafptr->vertnbr - orgvfixnbr, 0, indgrafptr) != 0) { /* Keep non-fixed vertices in induced graph */
+  if (graphInducePart (orggrafptr, orgparttax, orggrafptr->vertnbr - orgvfixnbr, 0, indgrafptr, contptr) != 0) { /* Keep non-fixed vertices in induced graph */
     errorPrint ("kgraphMapRbVfloBuild: cannot build induced subgraph");
     memFree    (hashtab);
     return (1);
@@ -1027,7 +1027,7 @@ Context * const                         contptr)  /*+ Execution context
 
         partval = i;                              /* At least this subjob works */
 
-        if (graphInducePart (&actgrafdat.s, actgrafdat.parttax, jobsubsiz[i], (GraphPart) i, &jobsubptr->grafdat) != 0) {
+        if (graphInducePart (&actgrafdat.s, actgrafdat.parttax, jobsubsiz[i], (GraphPart) i, &jobsubptr->grafdat, contptr) != 0) {
           errorPrint             ("kgraphMapRbMap: cannot create induced subgraph");
           bgraphExit             (&actgrafdat);
           kgraphMapRbMapPoolExit (&pooldat);
@@ -243,7 +243,7 @@ KgraphMapRbPartSplit * const  spltptr)
   if ((srcparttax != NULL) &&                     /* If not the case, build induced subgraph   */
       (indvertnbr < srcgrafptr->vertnbr)) {
     indgrafptr = &indgrafdat;
-    if ((o = graphInducePart (srcgrafptr, srcparttax, indvertnbr, indpartval, &indgrafdat)) != 0) {
+    if ((o = graphInducePart (srcgrafptr, srcparttax, indvertnbr, indpartval, &indgrafdat, contptr)) != 0) {
       errorPrint ("kgraphMapRbPart2: cannot induce graph");
       goto end3;
     }
@@ -54,6 +54,8 @@
 /**                                 to   : 04 aug 2018     **/
 /**                # Version 6.1  : from : 18 jul 2021     **/
 /**                                 to   : 18 jul 2021     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -80,6 +82,7 @@
 #include "kgraph_map_df.h"
 #include "kgraph_map_ex.h"
 #include "kgraph_map_fm.h"
+#include "kgraph_map_lp.h"
 #include "kgraph_map_ml.h"
 #include "kgraph_map_rb.h"
 #include "kgraph_map_st.h"
@@ -114,6 +117,11 @@ static union {
   StratNodeMethodData       padding;
 } kgraphmapstdefaultfm = { { 200, ~0, 0.05 } };
 
+static union {
+  KgraphMapLpParam          param;
+  StratNodeMethodData       padding;
+} kgraphmapstdefaultlp = { { 10, 0.05 } };
+
 static union {
   KgraphMapMlParam          param;
   StratNodeMethodData       padding;
@@ -130,6 +138,7 @@ static StratMethodTab       kgraphmapstmethtab[] = { /* Mapping methods array */
                               { KGRAPHMAPSTMETHDF, "d",  kgraphMapDf, &kgraphmapstdefaultdf },
                               { KGRAPHMAPSTMETHEX, "x",  kgraphMapEx, &kgraphmapstdefaultex },
                               { KGRAPHMAPSTMETHFM, "f",  kgraphMapFm, &kgraphmapstdefaultfm },
+                              { KGRAPHMAPSTMETHLP, "l",  kgraphMapLp, &kgraphmapstdefaultlp },
                               { KGRAPHMAPSTMETHML, "m",  kgraphMapMl, &kgraphmapstdefaultml },
                               { KGRAPHMAPSTMETHRB, "r",  kgraphMapRb, &kgraphmapstdefaultrb },
                               { -1,                NULL, NULL,        NULL } };
@@ -175,6 +184,14 @@ static StratParamTab        kgraphmapstparatab[] = { /* Method parameter list */
                                 (byte *) &kgraphmapstdefaultfm.param,
                                 (byte *) &kgraphmapstdefaultfm.param.deltval,
                                 NULL },
+                              { KGRAPHMAPSTMETHLP,  STRATPARAMDOUBLE, "bal",
+                                (byte *) &kgraphmapstdefaultlp.param,
+                                (byte *) &kgraphmapstdefaultlp.param.deltval,
+                                NULL },
+                              { KGRAPHMAPSTMETHLP,  STRATPARAMINT,    "pass",
+                                (byte *) &kgraphmapstdefaultlp.param,
+                                (byte *) &kgraphmapstdefaultlp.param.passnbr,
+                                NULL },
                               { KGRAPHMAPSTMETHML,  STRATPARAMSTRAT,  "asc",
                                 (byte *) &kgraphmapstdefaultml.param,
                                 (byte *) &kgraphmapstdefaultml.param.stratasc,
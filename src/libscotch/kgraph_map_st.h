@@ -51,6 +51,8 @@
 /**                                 to   : 13 jul 2010     **/
 /**                # Version 6.0  : from : 08 jun 2011     **/
 /**                                 to   : 07 jun 2018     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -66,6 +68,7 @@ typedef enum KgraphMapStMethodType_ {
   KGRAPHMAPSTMETHDF,                              /*+ Diffusion                     +*/
   KGRAPHMAPSTMETHEX,                              /*+ Exactifier                    +*/
   KGRAPHMAPSTMETHFM,                              /*+ Fiduccia-Mattheyses           +*/
+  KGRAPHMAPSTMETHLP,                              /*+ Label propagation             +*/
   KGRAPHMAPSTMETHML,                              /*+ Multi-level (strategy)        +*/
   KGRAPHMAPSTMETHRB,                              /*+ Dual Recursive Bipartitioning +*/
   KGRAPHMAPSTMETHNBR                              /*+ Number of methods             +*/
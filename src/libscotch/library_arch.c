@@ -56,6 +56,8 @@
 /**                                 to   : 05 jun 2018     **/
 /**                # Version 6.1  : from : 15 mar 2021     **/
 /**                                 to   : 15 mar 2021     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -189,7 +191,13 @@ SCOTCH_archLoad (
 SCOTCH_Arch * const         archptr,
 FILE * const                stream)
 {
-  return (archLoad ((Arch *) archptr, stream));
+  int                 o;
+
+  fileStreamLock (stream);                        /* Lock stream once for the whole architecture */
+  o = archLoad ((Arch *) archptr, stream);
+  fileStreamUnlock (stream);
+
+  return (o);
 }
 
 /*+ This routine saves the given opaque
@@ -208,6 +216,23 @@ FILE * const                stream)
   return (archSave ((Arch *) archptr, stream));
 }
 
+/*+ This routine saves the given opaque
+*** architecture structure to the given
+*** stream, in binary form if the class
+*** of the architecture supports it.
+*** It returns:
+*** - 0   : if the saving succeeded.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_archSaveBin (
+const SCOTCH_Arch * const   archptr,
+FILE * const                stream)
+{
+  return (archSaveBin ((Arch *) archptr, stream));
+}
+
 /*+ This routine returns the name of the
 *** given target architecture.
 *** It returns:
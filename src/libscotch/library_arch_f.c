@@ -49,6 +49,8 @@
 /**                                 to   : 31 may 2018     **/
 /**                # Version 6.1  : from : 15 mar 2021     **/
 /**                                 to   : 15 mar 2021     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -197,6 +199,41 @@ int * const                 revaptr), \
 **
 */
 
+SCOTCH_FORTRAN (                      \
+ARCHSAVEBIN, archsavebin, (           \
+SCOTCH_Arch * const         archptr,  \
+int * const                 fileptr,  \
+int * const                 revaptr), \
+(archptr, fileptr, revaptr))
+{
+  FILE *              stream;                     /* Stream to build from handle */
+  int                 filenum;                    /* Duplicated handle           */
+  int                 o;
+
+  if ((filenum = dup (*fileptr)) < 0) {           /* If cannot duplicate file descriptor */
+    errorPrint (STRINGIFY (SCOTCH_NAME_PUBLICFU (ARCHSAVEBIN)) ": cannot duplicate handle");
+
+    *revaptr = 1;                                 /* Indicate error */
+    return;
+  }
+  if ((stream = fdopen (filenum, "w")) == NULL) { /* Build stream from handle */
+    errorPrint (STRINGIFY (SCOTCH_NAME_PUBLICFU (ARCHSAVEBIN)) ": cannot open output stream");
+    close      (filenum);
+    *revaptr = 1;
+    return;
+  }
+
+  o = SCOTCH_archSaveBin (archptr, stream);
+
+  fclose (stream);                                /* This closes filenum too */
+
+  *revaptr = o;
+}
+
+/*
+**
+*/
+
 SCOTCH_FORTRAN (                      \
 ARCHNAME, archname, (                 \
 SCOTCH_Arch * const         archptr,  \
@@ -89,6 +89,7 @@ const SCOTCH_Num            baseval,
 const SCOTCH_Num            flagval)
 {
   GraphFlag           srcgrafflag;                /* Graph flags */
+  int                 o;
 
   if ((baseval < -1) || (baseval > 1)) {
     errorPrint (STRINGIFY (SCOTCH_dgraphLoad) ": invalid base parameter");
@@ -102,5 +103,11 @@ const SCOTCH_Num            flagval)
   srcgrafflag = (((flagval & 1) != 0) ? GRAPHIONOLOADVERT : 0) +
                 (((flagval & 2) != 0) ? GRAPHIONOLOADEDGE : 0);
 
-  return (dgraphLoad ((Dgraph * const) CONTEXTOBJECT (grafptr), stream, (Gnum) baseval, srcgrafflag));
+  if (stream != NULL)                             /* Not all processes may have a stream */
+    fileStreamLock (stream);
+  o = dgraphLoad ((Dgraph * const) CONTEXTOBJECT (grafptr), stream, (Gnum) baseval, srcgrafflag);
+  if (stream != NULL)
+    fileStreamUnlock (stream);
+
+  return (o);
 }
@@ -44,7 +44,7 @@
 /**                # Version 6.0  : from : 29 nov 2012     **/
 /**                                 to   : 29 nov 2012     **/
 /**                # Version 7.0  : from : 20 sep 2019     **/
-/**                                 to   : 20 sep 2019     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -83,3 +83,21 @@ FILE * const                stream)
 {
   return (dgraphSave ((Dgraph * const) CONTEXTOBJECT (grafptr), stream));
 }
+
+/*+ This routine saves the contents of the given
+*** opaque distributed graph structure to the
+*** given streams, in binary format. Either all
+*** streams refer to the same regular file, or
+*** only one process holds a stream.
+*** It returns:
+*** - 0   : if the saving succeeded.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_dgraphSaveBin (
+SCOTCH_Dgraph * const       grafptr,
+FILE * const                stream)
+{
+  return (dgraphSaveBin ((Dgraph * const) CONTEXTOBJECT (grafptr), stream));
+}
@@ -45,6 +45,8 @@
 /**                                 to   : 27 mar 2010     **/
 /**                # Version 6.0  : from : 29 nov 2012     **/
 /**                                 to   : 25 apr 2018     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -99,3 +101,38 @@ int * const                 revaptr), \
 
   *revaptr = o;
 }
+
+/*
+**
+*/
+
+SCOTCH_FORTRAN (                      \
+DGRAPHSAVEBIN, dgraphsavebin, (       \
+SCOTCH_Dgraph * const       grafptr,  \
+int * const                 fileptr,  \
+int * const                 revaptr), \
+(grafptr, fileptr, revaptr))
+{
+  FILE *              stream;                     /* Stream to build from handle */
+  int                 filenum;                    /* Duplicated handle           */
+  int                 o;
+
+  if ((filenum = dup (*fileptr)) < 0) {           /* If cannot duplicate file descriptor */
+    errorPrint (STRINGIFY (SCOTCH_NAME_PUBLICFU (DGRAPHSAVEBIN)) ": cannot duplicate handle");
+
+    *revaptr = 1;                                 /* Indicate error */
+    return;
+  }
+  if ((stream = fdopen (filenum, "w")) == NULL) { /* Build stream from handle */
+    errorPrint (STRINGIFY (SCOTCH_NAME_PUBLICFU (DGRAPHSAVEBIN)) ": cannot open output stream");
+    close      (filenum);
+    *revaptr = 1;
+    return;
+  }
+
+  o = SCOTCH_dgraphSaveBin (grafptr, stream);
+
+  fclose (stream);                                /* This closes filenum too */
+
+  *revaptr = o;
+}
@@ -53,7 +53,7 @@
 !*                # Version 6.1  : from : 22 jun 2021     **
 !*                                 to   : 22 jun 2021     **
 !*                # Version 7.0  : from : 25 aug 2019     **
-!*                                 to   : 23 oct 2021     **
+!*                                 to   : 17 oct 2026     **
 !*                                                        **
 !***********************************************************
 
@@ -86,6 +86,16 @@
         PARAMETER (SCOTCH_COARSENFOLDDUP = 768)
         PARAMETER (SCOTCH_COARSENNOMERGE = 16384)
 
+!* Flag definitions for the coloring
+!* routine.
+
+        INTEGER SCOTCH_COLORNONE
+        INTEGER SCOTCH_COLORDEGREE
+        INTEGER SCOTCH_COLORSMALLEST
+        PARAMETER (SCOTCH_COLORNONE     = 0)
+        PARAMETER (SCOTCH_COLORDEGREE   = 1)
+        PARAMETER (SCOTCH_COLORSMALLEST = 2)
+
 !* Flag definitions for the strategy
 !* string selection routines.
 
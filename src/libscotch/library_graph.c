@@ -176,7 +176,9 @@ FILE * const                stream,
 const SCOTCH_Num            baseval,
 const SCOTCH_Num            flagval)
 {
+  CONTEXTDECL         (grafptr);
   GraphFlag           srcgrafflag;                /* Graph flags */
+  int                 o;
 
   if ((flagval < 0) || (flagval > 3)) {
     errorPrint (STRINGIFY (SCOTCH_graphLoad) ": invalid flag parameter");
@@ -194,7 +196,18 @@ const SCOTCH_Num            flagval)
   srcgrafflag = (((flagval & 1) != 0) ? GRAPHIONOLOADVERT : 0) +
                 (((flagval & 2) != 0) ? GRAPHIONOLOADEDGE : 0);
 
-  return (graphLoad ((Graph * const) CONTEXTOBJECT (grafptr), stream, (Gnum) baseval, srcgrafflag));
+  if (CONTEXTINIT (grafptr) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphLoad) ": cannot initialize context");
+    return (1);
+  }
+
+  fileStreamLock (stream);                        /* Lock stream once for the whole graph */
+  o = graphLoadCont ((Graph * const) CONTEXTGETOBJECT (grafptr), stream, (Gnum) baseval, srcgrafflag, CONTEXTGETDATA (grafptr));
+  fileStreamUnlock (stream);
+
+  CONTEXTEXIT (grafptr);
+
+  return (o);
 }
 
 /*+ This routine saves the contents of the given
@@ -42,7 +42,7 @@
 /**   DATES      : # Version 6.0  : from : 14 jan 2018     **/
 /**                                 to   : 21 apr 2018     **/
 /**                # Version 7.0  : from : 07 may 2019     **/
-/**                                 to   : 07 may 2019     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -84,10 +84,21 @@ const SCOTCH_Num                    vnumnbr,
 const SCOTCH_Num * restrict const   vnumtab,
 SCOTCH_Graph * restrict const       indgrafptr)
 {
-  return (graphInduceList ((const Graph * restrict const) CONTEXTOBJECT (orggrafptr),
-                           (const Gnum) vnumnbr,
-                           (const Gnum * restrict const) vnumtab,
-                           (Graph * const) indgrafptr));
+  CONTEXTDECL         (orggrafptr);
+  int                 o;
+
+  if (CONTEXTINIT (orggrafptr) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphInduceList) ": cannot initialize context");
+    return     (1);
+  }
+
+  o = graphInduceList ((const Graph * restrict const) CONTEXTGETOBJECT (orggrafptr),
+                       (const Gnum) vnumnbr,
+                       (const Gnum * restrict const) vnumtab,
+                       (Graph * const) indgrafptr, CONTEXTGETDATA (orggrafptr));
+
+  CONTEXTEXIT (orggrafptr);
+  return (o);
 }
 
 /* This routine builds the graph induced
@@ -110,9 +121,20 @@ const SCOTCH_GraphPart2 * restrict const  parttab,
 const SCOTCH_GraphPart2                   partval,
 SCOTCH_Graph * restrict const             indgrafptr)
 {
-  return (graphInducePart ((const Graph * restrict const) CONTEXTOBJECT (orggrafptr),
-                           ((GraphPart * restrict const) parttab) - ((const Graph * const) orggrafptr)->baseval,
-                           (const Gnum) vnumnbr,
-                           (const GraphPart) partval,
-                           (Graph * restrict const) indgrafptr));
+  CONTEXTDECL         (orggrafptr);
+  int                 o;
+
+  if (CONTEXTINIT (orggrafptr) != 0) {
+    errorPrint (STRINGIFY (SCOTCH_graphInducePart) ": cannot initialize context");
+    return     (1);
+  }
+
+  o = graphInducePart ((const Graph * restrict const) CONTEXTGETOBJECT (orggrafptr),
+                       ((GraphPart * restrict const) parttab) - ((const Graph * const) CONTEXTGETOBJECT (orggrafptr))->baseval,
+                       (const Gnum) vnumnbr,
+                       (const GraphPart) partval,
+                       (Graph * restrict const) indgrafptr, CONTEXTGETDATA (orggrafptr));
+
+  CONTEXTEXIT (orggrafptr);
+  return (o);
 }
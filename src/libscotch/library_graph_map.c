@@ -52,7 +52,7 @@
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 15 may 2018     **/
 /**                # Version 7.0  : from : 07 may 2019     **/
-/**                                 to   : 14 jul 2021     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -70,7 +70,9 @@
 #include "arch.h"
 #include "arch_dist.h"
 #include "mapping.h"
+#include "graph_coarsen.h"
 #include "kgraph.h"
+#include "kgraph_map_ml.h"
 #include "kgraph_map_st.h"
 #include "library_mapping.h"
 #include "scotch.h"
@@ -102,6 +104,7 @@ SCOTCH_Num * const          parttab)              /*+ Mapping array
   lmapptr->flagval = LIBMAPPINGNONE;              /* No options set */
   lmapptr->grafptr = (Graph *) CONTEXTOBJECT (grafptr);
   lmapptr->archptr = (Arch *)  archptr;
+  lmapptr->cachptr = NULL;                        /* Not a mapping session */
   if (parttab == NULL) {
     if ((lmapptr->parttab = (Gnum *) memAlloc (lmapptr->grafptr->vertnbr * sizeof (Gnum))) == NULL) {
       errorPrint (STRINGIFY (SCOTCH_graphMapInit) ": out of memory");
@@ -132,9 +135,77 @@ SCOTCH_Mapping * const      mappptr)
       (lmapptr->parttab != NULL))                 /* And if exists                  */
     memFree (lmapptr->parttab);                   /* Free it                        */
 
+  if (lmapptr->cachptr != NULL) {                 /* If mapping session, free hierarchy cache */
+    kgraphMapMlCacheExit (lmapptr->cachptr);
+    memFree (lmapptr->cachptr);
+  }
+
   memSet (lmapptr, 0, sizeof (LibMapping));
 }
 
+/*+ This routine turns the given API mapping
+*** into a mapping session. The coarsening
+*** hierarchy computed by the first multilevel
+*** method of the mapping strategy is kept
+*** within the mapping, and re-used by all the
+*** subsequent computations of this mapping, as
+*** long as only vertex loads and old mappings
+*** vary. Only the initial mapping and the
+*** refinement steps are then performed.
+*** It returns:
+*** - 0   : on success.
+*** - !0  : on error.
++*/
+
+int
+SCOTCH_graphMapSessionInit (
+const SCOTCH_Graph * const  grafptr,              /*+ Graph to map                +*/
+SCOTCH_Mapping * const      mappptr)              /*+ Mapping to turn into session +*/
+{
+  LibMapping * restrict const lmapptr = (LibMapping *) mappptr;
+
+#ifdef SCOTCH_DEBUG_LIBRARY1
+  if ((Graph *) CONTEXTOBJECT (grafptr) != lmapptr->grafptr) {
+    errorPrint (STRINGIFY (SCOTCH_graphMapSessionInit) ": mapping does not correspond to input graph");
+    return (1);
+  }
+#endif /* SCOTCH_DEBUG_LIBRARY1 */
+
+  if (lmapptr->cachptr != NULL)                   /* If already a mapping session, nothing to do */
+    return (0);
+
+  if ((lmapptr->cachptr = (KgraphMapMlCache *) memAlloc (sizeof (KgraphMapMlCache))) == NULL) {
+    errorPrint (STRINGIFY (SCOTCH_graphMapSessionInit) ": out of memory");
+    return (1);
+  }
+  kgraphMapMlCacheInit (lmapptr->cachptr);
+
+  return (0);
+}
+
+/*+ This routine discards the coarsening
+*** hierarchy kept by the given mapping
+*** session, e.g. because the topology or
+*** the edge loads of the graph changed.
+*** The hierarchy will be re-computed by
+*** the next mapping computation.
+*** It returns:
+*** - VOID  : in all cases.
++*/
+
+void
+SCOTCH_graphMapSessionReset (
+const SCOTCH_Graph * const  grafptr,              /*+ Graph to map    +*/
+SCOTCH_Mapping * const      mappptr)              /*+ Mapping session +*/
+{
+  LibMapping * restrict const lmapptr = (LibMapping *) mappptr;
+
+  if (lmapptr->cachptr != NULL) {
+    kgraphMapMlCacheExit (lmapptr->cachptr);
+    kgraphMapMlCacheInit (lmapptr->cachptr);
+  }
+}
+
 /*+ This routine computes a mapping or a
 *** remapping, with or without fixed
 *** vertices, of the API mapping
@@ -284,6 +355,7 @@ SCOTCH_Strat * const        straptr)              /*+ Mapping strategy
     }
   }
 
+  mapgrafdat.mlcaptr = lmapptr->cachptr;          /* Provide hierarchy cache if mapping session */
   mapgrafdat.contptr = CONTEXTGETDATA (actgrafptr);
 
   o = kgraphMapSt (&mapgrafdat, mapstraptr);
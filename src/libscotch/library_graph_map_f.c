@@ -48,6 +48,8 @@
 /**                                 to   : 31 aug 2011     **/
 /**                # Version 6.0  : from : 17 apr 2011     **/
 /**                                 to   : 25 apr 2018     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -102,6 +104,33 @@ SCOTCH_Mapping * const      mappptr), \
 **
 */
 
+SCOTCH_FORTRAN (                      \
+GRAPHMAPSESSIONINIT, graphmapsessioninit, ( \
+const SCOTCH_Graph * const  grafptr,  \
+SCOTCH_Mapping * const      mappptr,  \
+int * const                 revaptr), \
+(grafptr, mappptr, revaptr))
+{
+  *revaptr = SCOTCH_graphMapSessionInit (grafptr, mappptr);
+}
+
+/*
+**
+*/
+
+SCOTCH_FORTRAN (                      \
+GRAPHMAPSESSIONRESET, graphmapsessionreset, ( \
+const SCOTCH_Graph * const  grafptr,  \
+SCOTCH_Mapping * const      mappptr), \
+(grafptr, mappptr))
+{
+  SCOTCH_graphMapSessionReset (grafptr, mappptr);
+}
+
+/*
+**
+*/
+
 SCOTCH_FORTRAN (                      \
 GRAPHMAPCOMPUTE, graphmapcompute, (   \
 SCOTCH_Graph * const        grafptr,  \
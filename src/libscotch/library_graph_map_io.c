@@ -42,7 +42,7 @@
 /**   DATES      : # Version 6.0  : from : 16 apr 2011     **/
 /**                                 to   : 26 oct 2019     **/
 /**                # Version 7.0  : from : 07 may 2019     **/
-/**                                 to   : 07 may 2019     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -92,13 +92,15 @@ FILE * const                  stream)             /*+ Input stream  +*/
   Gnum                  mappfilenbr;              /* Number of mapping pairs in file          */
   Gnum                  mappfilenum;              /* Counter of mapping pairs in file         */
   Graph *               grafptr;
+  Context *             contptr;                  /* Context for threaded sorting, if any     */
   Gnum                  vertnbr;
 
   grafptr = (Graph *) CONTEXTOBJECT (actgrafptr);
+  contptr = (contextContainerTrue (actgrafptr)) ? contextContainerData (actgrafptr) : NULL; /* Do not create a context just for sorting */
   vertnbr = grafptr->vertnbr;
   memSet (parttab, ~0, vertnbr * sizeof (Anum));  /* Pre-initialize the partition array */
 
-  if ((fscanf (stream, GNUMSTRING, &mappfileval) != 1) || /* Read number of mapping pairs */
+  if ((intLoad (stream, &mappfileval) != 1) ||    /* Read number of mapping pairs */
       (mappfileval < 1)) {
     errorPrint (STRINGIFY (SCOTCH_graphTabLoad) ": bad input (1)");
     return     (1);
@@ -119,9 +121,8 @@ FILE * const                  stream)             /*+ Input stream  +*/
   mappsortflag = 1;                               /* Assume mapping data sorted */
   mappsortlabl = GNUMMIN;
   for (mappfilenum = 0; mappfilenum < mappfilenbr; mappfilenum ++) {
-    if (fscanf (stream, GNUMSTRING GNUMSTRING,
-                &mappsortval,
-                &mappfileval) != 2) {
+    if ((intLoad (stream, &mappsortval) != 1) ||
+        (intLoad (stream, &mappfileval) != 1)) {
       errorPrint (STRINGIFY (SCOTCH_graphTabLoad) ": bad input (2)");
       memFree    (mappsorttab);                   /* Free group leader */
       return     (1);
@@ -134,7 +135,7 @@ FILE * const                  stream)             /*+ Input stream  +*/
     mappsortlabl = mappsortval;
   }
   if (mappsortflag != 1)                          /* If mapping data not sorted    */
-    intSort2asc1 (mappsorttab, mappfilenbr);      /* Sort area by ascending labels */
+    intRsort2asc1 (mappsorttab, mappfilenbr, contptr); /* Sort area by ascending labels */
 
   for (mappfilenum = 1; mappfilenum < mappfilenbr; mappfilenum ++) { /* Check mapping data integrity */
     if (mappsorttab[mappfilenum].labl == mappsorttab[mappfilenum - 1].labl) {
@@ -160,7 +161,7 @@ FILE * const                  stream)             /*+ Input stream  +*/
       vertsortlabl = vertsorttab[vertsortnum].labl;
     }
     if (vertsortflag != 1)                        /* If graph label data not sorted     */
-      intSort2asc1 (vertsorttab, vertnbr);        /* Sort sort area by ascending labels */
+      intRsort2asc1 (vertsorttab, vertnbr, contptr); /* Sort sort area by ascending labels */
 
     for (vertsortnum = 0, mappfilenum = 0; vertsortnum < vertnbr; vertsortnum ++) { /* For all vertices in graph */
       while (mappsorttab[mappfilenum].labl < vertsorttab[vertsortnum].labl) {
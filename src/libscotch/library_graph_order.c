@@ -145,8 +145,12 @@ FILE * restrict const             stream)         /*+ Output stream    +*/
 {
   const Graph * const srcgrafptr = (Graph *) CONTEXTOBJECT (grafptr); /* Use structure as source graph */
   LibOrder * const    libordeptr = (LibOrder *) ordeptr;
+  int                 o;
 
-  if (orderLoad (&libordeptr->o, srcgrafptr->vlbltax, stream) != 0)
+  fileStreamLock (stream);                        /* Lock stream once for the whole ordering */
+  o = orderLoad (&libordeptr->o, srcgrafptr->vlbltax, stream);
+  fileStreamUnlock (stream);
+  if (o != 0)
     return (1);
 
   if (libordeptr->permtab != NULL)                /* Build inverse permutation if wanted */
@@ -46,6 +46,8 @@
 /**                                 to   : 17 nov 2010     **/
 /**                # Version 6.0  : from : 15 apr 2011     **/
 /**                                 to   : 23 aug 2014     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -67,7 +69,8 @@
 
 typedef struct LibMapping_ {
   Gnum                      flagval;
-  Graph *                   grafptr;              /*+ Graph data        +*/
-  Arch *                    archptr;              /*+ Architecture data +*/
-  Gnum *                    parttab;              /*+ Mapping array     +*/
+  Graph *                   grafptr;              /*+ Graph data                       +*/
+  Arch *                    archptr;              /*+ Architecture data                +*/
+  Gnum *                    parttab;              /*+ Mapping array                    +*/
+  struct KgraphMapMlCache_ * cachptr;             /*+ Session multilevel cache, if any +*/
 } LibMapping;
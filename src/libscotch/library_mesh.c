@@ -149,12 +149,18 @@ SCOTCH_Mesh * const         meshptr,
 FILE * const                stream,
 const SCOTCH_Num            baseval)
 {
+  int                 o;
+
   if ((baseval < -1) || (baseval > 1)) {
     errorPrint (STRINGIFY (SCOTCH_meshLoad) ": invalid base parameter");
     return     (1);
   }
 
-  return (meshLoad ((Mesh * const) meshptr, stream, (Gnum) baseval));
+  fileStreamLock (stream);                        /* Lock stream once for the whole mesh */
+  o = meshLoad ((Mesh * const) meshptr, stream, (Gnum) baseval);
+  fileStreamUnlock (stream);
+
+  return (o);
 }
 
 /*+ This routine saves the contents of the given
@@ -68,6 +68,8 @@
 /**                                 to   : 11 aug 2010     **/
 /**                # Version 6.0  : from : 03 mar 2011     **/
 /**                                 to   : 22 aug 2014     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -155,7 +157,7 @@ FILE * restrict const           stream)
       return     (1);
     }
   }
-  intSort2asc1 (mapptab, mappnbr);                /* Sort mapping array by increasing source labels */
+  intRsort2asc1 (mapptab, mappnbr, NULL);         /* Sort mapping array by increasing source labels */
 
   if (vlbltab != NULL) {                          /* If graph has vertex labels */
     Gnum                vertnum;
@@ -164,7 +166,7 @@ FILE * restrict const           stream)
       permtab[vertnum].vertnum = vertnum + mappptr->grafptr->baseval;
       permtab[vertnum].vlblnum = vlbltab[vertnum];
     }
-    intSort2asc1 (permtab, mappptr->grafptr->vertnbr); /* Sort vertex array by increasing labels */
+    intRsort2asc1 (permtab, mappptr->grafptr->vertnbr, NULL); /* Sort vertex array by increasing labels */
   }
   else {
     Gnum                vertnum;
@@ -45,7 +45,7 @@
 /**                # Version 6.0  : from : 23 jan 2020     **/
 /**                                 to   : 23 jan 2020     **/
 /**                # Version 7.0  : from : 12 sep 2019     **/
-/**                                 to   : 28 aug 2020     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # The coarsening process is as follows. **/
 /**                  First, node collapsing is performed,  **/
@@ -64,6 +64,7 @@
 
 #include "module.h"
 #include "common.h"
+#include "context.h"
 #include "graph.h"
 #include "mesh.h"
 #include "mesh_coarsen.h"
@@ -124,6 +125,12 @@ Context * restrict const      contptr)            /*+ Execution context
   Gnum                        coaredgetmp;
   size_t                      coarvelooftval;
   size_t                      coaredgeoftval;
+#ifndef MESHCOARSENNOTHREAD
+  MeshCoarsenData             coardat;            /* Data for threaded coarsening                */
+  int                         thrdnbr;
+  int                         thrdnum;
+  Gnum                        deteval;            /* Flag set if deterministic behavior          */
+#endif /* MESHCOARSENNOTHREAD */
 
 #ifdef SCOTCH_DEBUG_MESH2
   if (coartype >= MESHCOARSENNBR) {
@@ -163,6 +170,70 @@ Context * restrict const      contptr)            /*+ Execution context
   memSet (coarhbdgtab, ~0, coarhashsiz * sizeof (MeshCoarsenHbdg));
   finemulttax -= coarmeshptr->baseval;
 
+#ifndef MESHCOARSENNOTHREAD
+  coardat.thrdtab = NULL;                         /* Assume sequential coarsening */
+  thrdnbr = contextThreadNbr (contptr);
+  contextValuesGetInt (contptr, CONTEXTOPTIONNUMDETERMINISTIC, &deteval);
+  if ((deteval == 0) && (thrdnbr > 1)) {          /* If non-deterministic behavior accepted and several threads available */
+    Gnum *              finepairtab;
+    Gnum *              finequeutab;
+    int *               finelocktab;
+
+    if ((coardat.thrdtab = (MeshCoarsenThread *) memAlloc (thrdnbr * sizeof (MeshCoarsenThread))) == NULL) {
+      errorPrint ("meshCoarsen: out of memory (3)");
+      memFree    (coarverttax);
+      memFree    (finecoartax + finemeshptr->baseval);
+      return     (2);
+    }
+    if (memAllocGroup ((void **) (void *)
+          &finepairtab, (size_t) (finemeshptr->velmnbr * 2 * sizeof (Gnum)),
+          &finequeutab, (size_t) (finemeshptr->velmnbr     * sizeof (Gnum)),
+          &finelocktab, (size_t) (finemeshptr->velmnbr     * sizeof (int)), NULL) == NULL) {
+      errorPrint ("meshCoarsen: out of memory (4)");
+      memFree    (coardat.thrdtab);
+      memFree    (coarverttax);
+      memFree    (finecoartax + finemeshptr->baseval);
+      return     (2);
+    }
+    memSet (finelocktab, 0, finemeshptr->velmnbr * sizeof (int));
+
+    coardat.finemeshptr = finemeshptr;
+    coardat.finecoartax = finecoartax;
+    coardat.finemulttax = finemulttax;
+    coardat.finelocktax = finelocktab - finemeshptr->velmbas;
+    coardat.finepertnbr = 2 + contextIntRandVal (contptr, MESHCOARSENPERTPRIME - 2);
+    coardat.coarhashmsk = coarhashmsk;
+    coardat.retuval     = 0;
+    for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++) {
+      MeshCoarsenThread * restrict  thrdptr = &coardat.thrdtab[thrdnum];
+
+      thrdptr->finevelmbas = finemeshptr->velmbas + DATASCAN (finemeshptr->velmnbr, thrdnbr, thrdnum);
+      thrdptr->finevelmnnd = finemeshptr->velmbas + DATASCAN (finemeshptr->velmnbr, thrdnbr, thrdnum + 1);
+      thrdptr->finepairtab = finepairtab + 2 * (thrdptr->finevelmbas - finemeshptr->velmbas);
+      thrdptr->finequeutab = finequeutab +      (thrdptr->finevelmbas - finemeshptr->velmbas);
+    }
+
+    contextThreadLaunch (contptr, (ThreadFunc) meshCoarsenMatchNgThr, (void *) &coardat); /* Only one matching type available */
+
+    memFree (finepairtab);
+    if (coardat.retuval != 0) {
+      errorPrint ("meshCoarsen: out of memory (5)");
+      memFree    (coardat.thrdtab);
+      memFree    (coarverttax);
+      memFree    (finecoartax + finemeshptr->baseval);
+      return     (2);
+    }
+    coarvelmnbr = coardat.coarvelmnbr;
+
+    for (thrdnum = 0; thrdnum < thrdnbr; thrdnum ++) {
+      MeshCoarsenThread * restrict  thrdptr = &coardat.thrdtab[thrdnum];
+
+      thrdptr->coarvelmbas = coarmeshptr->baseval + DATASCAN (coarvelmnbr, thrdnbr, thrdnum);
+      thrdptr->coarvelmnnd = coarmeshptr->baseval + DATASCAN (coarvelmnbr, thrdnbr, thrdnum + 1);
+    }
+  }
+  else
+#endif /* MESHCOARSENNOTHREAD */
   meshCoarFuncTab[coartype] (finemeshptr, finemulttax, finecoartax, &coarvelmnbr, &coarvnodnbr, &coaredgenbr, contptr); /* Call proper matching function */
 
 #ifndef DEAD_CODE
@@ -184,150 +255,178 @@ Context * restrict const      contptr)            /*+ Execution context
   coarmeshptr->velmnnd  =
   coarmeshptr->vnodbas  = coarvelmnbr + coarmeshptr->velmbas;
 
-  for (coarvelmnum = coaredgenum = coarmeshptr->baseval, coarvnodnum = coarmeshptr->vnodbas, coarveisnbr = coardegrmax = 0; /* For all coarse elements */
-       coarvelmnum < coarmeshptr->velmnnd; coarvelmnum ++) {
-    Gnum                coardegrval;              /* Degree of coarsened element    */
-    Gnum                coarveloval;              /* Weight of coarsened element    */
-    Gnum                coarvnisnum;              /* Number of coarse isolated node */
-    Gnum                finevelmnum;              /* Number of current element      */
-    int                 i;
-
-    coarverttax[coarvelmnum] = coaredgenum;
-
-    coarvnisnum = ~0;                             /* No isolated node yet for this element pair */
-    coarveloval = 0;
-    i = 0;
-    do {                                          /* For both elements of element pair (if they are different) */
-      Gnum                fineeelmnum;
-
-      finevelmnum = finemulttax[coarvelmnum].finevelmnum[i]; /* Get number of current element */
-      coarveloval += ((finemeshptr->velotax != NULL) ? finemeshptr->velotax[finevelmnum] : 1);
-      for (fineeelmnum = finemeshptr->verttax[finevelmnum];
-           fineeelmnum < finemeshptr->vendtax[finevelmnum]; fineeelmnum ++) {
-        Gnum                finevnodnum;          /* Number of current node neighbor */
-        Gnum                fineenodnum;
-        Gnum                finevdegval;
-        Gnum                finevnloval;
-        Gnum                finevelmend;
-        Gnum                coarvnodtmp;
-        Gnum                coarhnodtmp;
-
-        finevnodnum = finemeshptr->edgetax[fineeelmnum];
-        fineenodnum = finemeshptr->verttax[finevnodnum];
-        finevdegval = finemeshptr->vendtax[finevnodnum] - fineenodnum;
-        finevnloval = (finemeshptr->vnlotax != NULL) ? finemeshptr->vnlotax[finevnodnum] : 1;
-
-        if ((finevdegval == 2) &&                 /* If node is an external bridge to another coarse element */
-            ((finevelmend = (finemeshptr->edgetax[fineenodnum] + finemeshptr->edgetax[fineenodnum + 1] - finevelmnum)) != finemulttax[coarvelmnum].finevelmnum[1 - i])) {
-          Gnum                coarvelmend;
-          Gnum                coarhelmend;
-
-          coarvelmend = finecoartax[finevelmend]; /* Get coarse index of end element */
-          coarvnodtmp = finecoartax[finevnodnum]; /* Get coarse number of fine node  */
-          for (coarhelmend = (coarvelmend * MESHCOARSENHASHPRIME) & coarhashmsk; ; coarhelmend = (coarhelmend + 1) & coarhashmsk) {
-            if (coarhbdgtab[coarhelmend].coarvelmnum != coarvelmnum) { /* If bridge not yet considered */
-              coarhbdgtab[coarhelmend].coarvelmnum = coarvelmnum; /* Add it to element neighbor list   */
-              coarhbdgtab[coarhelmend].coarvelmend = coarvelmend;
-              if (coarvnodtmp == -1) {            /* If bridge nodes not considered before by other element */
-                coarhbdgtab[coarhelmend].coarvnodnum   = /* Assign it                                       */
-                finecoartax[finevnodnum] = coarvnodtmp = coarvnodnum ++;
-                coarverttax[coarvnodtmp] = 2;     /* Prepare the fact that another element will see the node */
-                coarvelotax[coarvnodtmp] = finevnloval;
+#ifndef MESHCOARSENNOTHREAD
+  if (coardat.thrdtab != NULL) {                 /* If threaded coarsening */
+    coardat.coarverttax = coarverttax;
+    coardat.coarvelotax = coarvelotax;
+    coardat.coaredgetax = coaredgetax;
+    contextThreadLaunch (contptr, (ThreadFunc) meshCoarsenBuildThr, (void *) &coardat);
+
+    memFree (coardat.thrdtab);
+    if (coardat.retuval != 0) {
+      errorPrint ("meshCoarsen: cannot build coarse mesh");
+      memFree    (coarverttax + coarmeshptr->baseval);
+      memFree    (finecoartax + finemeshptr->baseval);
+      return     (2);
+    }
+    coarvnodnum = coardat.coarvnodnnd;
+    coaredgenum = coardat.coaredgenbr + coarmeshptr->baseval;
+    coarmeshptr->veisnbr = coardat.coarveisnbr;
+    coarmeshptr->vnodnnd = coarvnodnum;
+    coarmeshptr->vnodnbr = coarvnodnum - coarmeshptr->vnodbas;
+    coarmeshptr->velosum = finemeshptr->velosum;
+    coarmeshptr->vnlosum = finemeshptr->vnlosum;
+    coarmeshptr->edgenbr = 2 * (coaredgenum - coarmeshptr->baseval);
+    coarmeshptr->degrmax = coardat.coardegrmax;
+  }
+  else
+#endif /* MESHCOARSENNOTHREAD */
+  {
+    for (coarvelmnum = coaredgenum = coarmeshptr->baseval, coarvnodnum = coarmeshptr->vnodbas, coarveisnbr = coardegrmax = 0; /* For all coarse elements */
+         coarvelmnum < coarmeshptr->velmnnd; coarvelmnum ++) {
+      Gnum                coardegrval;              /* Degree of coarsened element    */
+      Gnum                coarveloval;              /* Weight of coarsened element    */
+      Gnum                coarvnisnum;              /* Number of coarse isolated node */
+      Gnum                finevelmnum;              /* Number of current element      */
+      int                 i;
+
+      coarverttax[coarvelmnum] = coaredgenum;
+
+      coarvnisnum = ~0;                             /* No isolated node yet for this element pair */
+      coarveloval = 0;
+      i = 0;
+      do {                                          /* For both elements of element pair (if they are different) */
+        Gnum                fineeelmnum;
+
+        finevelmnum = finemulttax[coarvelmnum].finevelmnum[i]; /* Get number of current element */
+        coarveloval += ((finemeshptr->velotax != NULL) ? finemeshptr->velotax[finevelmnum] : 1);
+        for (fineeelmnum = finemeshptr->verttax[finevelmnum];
+             fineeelmnum < finemeshptr->vendtax[finevelmnum]; fineeelmnum ++) {
+          Gnum                finevnodnum;          /* Number of current node neighbor */
+          Gnum                fineenodnum;
+          Gnum                finevdegval;
+          Gnum                finevnloval;
+          Gnum                finevelmend;
+          Gnum                coarvnodtmp;
+          Gnum                coarhnodtmp;
+
+          finevnodnum = finemeshptr->edgetax[fineeelmnum];
+          fineenodnum = finemeshptr->verttax[finevnodnum];
+          finevdegval = finemeshptr->vendtax[finevnodnum] - fineenodnum;
+          finevnloval = (finemeshptr->vnlotax != NULL) ? finemeshptr->vnlotax[finevnodnum] : 1;
+
+          if ((finevdegval == 2) &&                 /* If node is an external bridge to another coarse element */
+              ((finevelmend = (finemeshptr->edgetax[fineenodnum] + finemeshptr->edgetax[fineenodnum + 1] - finevelmnum)) != finemulttax[coarvelmnum].finevelmnum[1 - i])) {
+            Gnum                coarvelmend;
+            Gnum                coarhelmend;
+
+            coarvelmend = finecoartax[finevelmend]; /* Get coarse index of end element */
+            coarvnodtmp = finecoartax[finevnodnum]; /* Get coarse number of fine node  */
+            for (coarhelmend = (coarvelmend * MESHCOARSENHASHPRIME) & coarhashmsk; ; coarhelmend = (coarhelmend + 1) & coarhashmsk) {
+              if (coarhbdgtab[coarhelmend].coarvelmnum != coarvelmnum) { /* If bridge not yet considered */
+                coarhbdgtab[coarhelmend].coarvelmnum = coarvelmnum; /* Add it to element neighbor list   */
+                coarhbdgtab[coarhelmend].coarvelmend = coarvelmend;
+                if (coarvnodtmp == -1) {            /* If bridge nodes not considered before by other element */
+                  coarhbdgtab[coarhelmend].coarvnodnum   = /* Assign it                                       */
+                  finecoartax[finevnodnum] = coarvnodtmp = coarvnodnum ++;
+                  coarverttax[coarvnodtmp] = 2;     /* Prepare the fact that another element will see the node */
+                  coarvelotax[coarvnodtmp] = finevnloval;
+                }
+                coaredgetax[coaredgenum ++] = coarvnodtmp; /* Directly add coarse node to element neighborhood */
+                break;
+              }
+              if (coarhbdgtab[coarhelmend].coarvelmend == coarvelmend) { /* If bridge already present               */
+                if (coarvnodtmp == -1) {            /* If we are the first element to see the bridge node           */
+                  finecoartax[finevnodnum]  = coarvnodtmp = coarhbdgtab[coarhelmend].coarvnodnum; /* Assign it      */
+                  coarvelotax[coarvnodtmp] += finevnloval; /* Update the weight of the node                         */
+                }                                   /* Else node already processed with full load, so nothing to do */
+                break;
               }
-              coaredgetax[coaredgenum ++] = coarvnodtmp; /* Directly add coarse node to element neighborhood */
-              break;
-            }
-            if (coarhbdgtab[coarhelmend].coarvelmend == coarvelmend) { /* If bridge already present               */
-              if (coarvnodtmp == -1) {            /* If we are the first element to see the bridge node           */
-                finecoartax[finevnodnum]  = coarvnodtmp = coarhbdgtab[coarhelmend].coarvnodnum; /* Assign it      */
-                coarvelotax[coarvnodtmp] += finevnloval; /* Update the weight of the node                         */
-              }                                   /* Else node already processed with full load, so nothing to do */
-              break;
             }
+            continue;                               /* Edge has been added or will not be */
           }
-          continue;                               /* Edge has been added or will not be */
-        }
-        else if (finevdegval < 3) {               /* Else if node is isolated or is an internal bridge */
-          if ((finevdegval == 2) &&               /* Process bridge edges only once                    */
-              (finevelmnum >= finemulttax[coarvelmnum].finevelmnum[1 - i]))
-            continue;
+          else if (finevdegval < 3) {               /* Else if node is isolated or is an internal bridge */
+            if ((finevdegval == 2) &&               /* Process bridge edges only once                    */
+                (finevelmnum >= finemulttax[coarvelmnum].finevelmnum[1 - i]))
+              continue;
 
-          if (coarvnisnum == ~0) {                /* If no isolated node for this element pair */
-            coarvnisnum = coarvnodnum ++;         /* Create isolated node                      */
-            coarverttax[coarvnisnum]    = 1;
-            coarvelotax[coarvnisnum]    = finevnloval;
-            coaredgetax[coaredgenum ++] = coarvnisnum;
+            if (coarvnisnum == ~0) {                /* If no isolated node for this element pair */
+              coarvnisnum = coarvnodnum ++;         /* Create isolated node                      */
+              coarverttax[coarvnisnum]    = 1;
+              coarvelotax[coarvnisnum]    = finevnloval;
+              coaredgetax[coaredgenum ++] = coarvnisnum;
+            }
+            else                                    /* If isolated node already exists */
+              coarvelotax[coarvnisnum] += finevnloval; /* Add node contribution to it  */
+            finecoartax[finevnodnum] = coarvnisnum; /* Map fine node to isolated node  */
+            continue;
           }
-          else                                    /* If isolated node already exists */
-            coarvelotax[coarvnisnum] += finevnloval; /* Add node contribution to it  */
-          finecoartax[finevnodnum] = coarvnisnum; /* Map fine node to isolated node  */
-          continue;
-        }
-        else {
-          coarvnodtmp = finecoartax[finevnodnum]; /* Get coarse number of fine node    */
-          if (coarvnodtmp == ~0) {                /* If coarse number not yet assigned */
-            finecoartax[finevnodnum] = coarvnodtmp = coarvnodnum ++; /* Assign it      */
-            coarverttax[coarvnodtmp] = 0;         /* No connections to the node yet    */
-            coarvelotax[coarvnodtmp] = finevnloval;
+          else {
+            coarvnodtmp = finecoartax[finevnodnum]; /* Get coarse number of fine node    */
+            if (coarvnodtmp == ~0) {                /* If coarse number not yet assigned */
+              finecoartax[finevnodnum] = coarvnodtmp = coarvnodnum ++; /* Assign it      */
+              coarverttax[coarvnodtmp] = 0;         /* No connections to the node yet    */
+              coarvelotax[coarvnodtmp] = finevnloval;
+            }
           }
-        }
 
-        for (coarhnodtmp = (coarvnodtmp * MESHCOARSENHASHPRIME) & coarhashmsk; ; coarhnodtmp = (coarhnodtmp + 1) & coarhashmsk) {
-          if (coarhngbtab[coarhnodtmp].coarvelmnum != coarvelmnum) { /* If node neighbor not yet considered */
-            coarhngbtab[coarhnodtmp].coarvelmnum = coarvelmnum; /* Add it to element neighbor list          */
-            coarhngbtab[coarhnodtmp].coarvnodnum = coarvnodtmp;
-            coaredgetax[coaredgenum ++]          = coarvnodtmp;
-            coarverttax[coarvnodtmp] ++;          /* One more edge referencing the node */
-            break;
+          for (coarhnodtmp = (coarvnodtmp * MESHCOARSENHASHPRIME) & coarhashmsk; ; coarhnodtmp = (coarhnodtmp + 1) & coarhashmsk) {
+            if (coarhngbtab[coarhnodtmp].coarvelmnum != coarvelmnum) { /* If node neighbor not yet considered */
+              coarhngbtab[coarhnodtmp].coarvelmnum = coarvelmnum; /* Add it to element neighbor list          */
+              coarhngbtab[coarhnodtmp].coarvnodnum = coarvnodtmp;
+              coaredgetax[coaredgenum ++]          = coarvnodtmp;
+              coarverttax[coarvnodtmp] ++;          /* One more edge referencing the node */
+              break;
+            }
+            if (coarhngbtab[coarhnodtmp].coarvnodnum == coarvnodtmp) /* If node already present, nothing to do */
+              break;
           }
-          if (coarhngbtab[coarhnodtmp].coarvnodnum == coarvnodtmp) /* If node already present, nothing to do */
-            break;
         }
-      }
-    } while (i ++, finevelmnum != finemulttax[coarvelmnum].finevelmnum[1]);
-
-    coarvelotax[coarvelmnum] = coarveloval;       /* Lose initial weights of elements, if any, to keep coarsening weights */
-    coardegrval = coaredgenum - coarverttax[coarvelmnum];
-    if (coardegrval <= 0)                         /* If zero degree, one more isolated element */
-      coarveisnbr ++;
-    if (coardegrval > coardegrmax)
-      coardegrmax = coardegrval;
-  }
-  coarmeshptr->veisnbr = coarveisnbr;
-  coarmeshptr->vnodnnd = coarvnodnum;
-  coarmeshptr->vnodnbr = coarvnodnum - coarmeshptr->vnodbas;
-  coarmeshptr->velosum = finemeshptr->velosum;
-  coarmeshptr->vnlosum = finemeshptr->vnlosum;
-  coarmeshptr->edgenbr = 2 * (coaredgenum - coarmeshptr->baseval);
-
-  for (coarvnodnum = coarmeshptr->vnodbas, coaredgetmp = coaredgenum; /* Build start indices for node edge sub-arrays */
-       coarvnodnum < coarmeshptr->vnodnnd; coarvnodnum ++) {
-    Gnum                coardegrval;
-
-    coardegrval = coarverttax[coarvnodnum];
-    coarverttax[coarvnodnum] = coaredgetmp;
-    coaredgetmp += coardegrval;
-
-    if (coardegrval > coardegrmax)
-      coardegrmax = coardegrval;
-  }
-  coarmeshptr->degrmax = coardegrmax;
-  for (coarvelmnum = coareelmnum = coarmeshptr->baseval;
-       coarvelmnum < coarmeshptr->velmnnd; coarvelmnum ++) {
-    Gnum                coareelmnnd;
+      } while (i ++, finevelmnum != finemulttax[coarvelmnum].finevelmnum[1]);
+
+      coarvelotax[coarvelmnum] = coarveloval;       /* Lose initial weights of elements, if any, to keep coarsening weights */
+      coardegrval = coaredgenum - coarverttax[coarvelmnum];
+      if (coardegrval <= 0)                         /* If zero degree, one more isolated element */
+        coarveisnbr ++;
+      if (coardegrval > coardegrmax)
+        coardegrmax = coardegrval;
+    }
+    coarmeshptr->veisnbr = coarveisnbr;
+    coarmeshptr->vnodnnd = coarvnodnum;
+    coarmeshptr->vnodnbr = coarvnodnum - coarmeshptr->vnodbas;
+    coarmeshptr->velosum = finemeshptr->velosum;
+    coarmeshptr->vnlosum = finemeshptr->vnlosum;
+    coarmeshptr->edgenbr = 2 * (coaredgenum - coarmeshptr->baseval);
+
+    for (coarvnodnum = coarmeshptr->vnodbas, coaredgetmp = coaredgenum; /* Build start indices for node edge sub-arrays */
+         coarvnodnum < coarmeshptr->vnodnnd; coarvnodnum ++) {
+      Gnum                coardegrval;
+
+      coardegrval = coarverttax[coarvnodnum];
+      coarverttax[coarvnodnum] = coaredgetmp;
+      coaredgetmp += coardegrval;
+
+      if (coardegrval > coardegrmax)
+        coardegrmax = coardegrval;
+    }
+    coarmeshptr->degrmax = coardegrmax;
+    for (coarvelmnum = coareelmnum = coarmeshptr->baseval;
+         coarvelmnum < coarmeshptr->velmnnd; coarvelmnum ++) {
+      Gnum                coareelmnnd;
 
-    coareelmnnd = (coarvelmnum < (coarmeshptr->velmnnd - 1)) ? coarverttax[coarvelmnum + 1] : coaredgenum;
-    while (coareelmnum < coareelmnnd) {
-      Gnum                coarvnodnum;
+      coareelmnnd = (coarvelmnum < (coarmeshptr->velmnnd - 1)) ? coarverttax[coarvelmnum + 1] : coaredgenum;
+      while (coareelmnum < coareelmnnd) {
+        Gnum                coarvnodnum;
 
-      coarvnodnum = coaredgetax[coareelmnum ++];
-      coaredgetax[coarverttax[coarvnodnum] ++] = coarvelmnum;
+        coarvnodnum = coaredgetax[coareelmnum ++];
+        coaredgetax[coarverttax[coarvnodnum] ++] = coarvelmnum;
+      }
     }
+    memMov (&coarverttax[coarmeshptr->vnodbas + 1], /* Re-build start indices for node edge sub-arrays */
+            &coarverttax[coarmeshptr->vnodbas],
+            coarmeshptr->vnodnbr * sizeof (Gnum));
+    coarverttax[coarmeshptr->vnodbas] = coaredgenum;
   }
-  memMov (&coarverttax[coarmeshptr->vnodbas + 1], /* Re-build start indices for node edge sub-arrays */
-          &coarverttax[coarmeshptr->vnodbas],
-          coarmeshptr->vnodnbr * sizeof (Gnum));
-  coarverttax[coarmeshptr->vnodbas] = coaredgenum;
 
   coarvelooftval = coarvelotax - coarverttax;
   coaredgeoftval = coaredgetax - coarverttax;
@@ -612,3 +711,688 @@ fprintf (stderr, "++ %ld %ld\n", (long) finevelmnum, (long) finemeshptr->velotax
 
   return;
 }
+
+#ifndef MESHCOARSENNOTHREAD
+
+/**************************************/
+/*                                    */
+/* The threaded matching and building */
+/* subroutines.                       */
+/*                                    */
+/**************************************/
+
+/* This routine performs the reduction of
+** the per-thread coarse mesh data.
+*/
+
+static
+void
+meshCoarsenReduce (
+MeshCoarsenThread * restrict const  tlocptr,      /* Pointer to local thread block  */
+MeshCoarsenThread * restrict const  tremptr,      /* Pointer to remote thread block */
+const void * const                  globptr)      /* Unused                         */
+{
+  tlocptr->coarveisnbr += tremptr->coarveisnbr;   /* Sum number of isolated elements */
+  if (tremptr->coardegrmax > tlocptr->coardegrmax) /* Take maximum of degrees        */
+    tlocptr->coardegrmax = tremptr->coardegrmax;
+}
+
+/* This routine performs a prefix scan
+** sum operation on two Gnum values,
+** backed by a temporary area.
+*/
+
+static
+void
+meshCoarsenScan (
+Gnum * restrict const       tlocptr,              /* Pointer to local area   */
+Gnum * restrict const       tremptr,              /* Pointer to remote area  */
+const int                   srcpval,              /* Source phase value      */
+const int                   dstpval,              /* Destination phase value */
+const void * const          globptr)              /* Unused                  */
+{
+  tlocptr[2 * dstpval]     = tlocptr[2 * srcpval]     + ((tremptr == NULL) ? 0 : tremptr[2 * srcpval]);
+  tlocptr[2 * dstpval + 1] = tlocptr[2 * srcpval + 1] + ((tremptr == NULL) ? 0 : tremptr[2 * srcpval + 1]);
+}
+
+/* This routine selects, for the given element,
+** the unmatched element that shares most nodes
+** with it. The hash table is tagged with the
+** given pass number, which must be different
+** for each call, since an element may be
+** considered several times.
+** It returns:
+** - the number of the best element, which
+**   is the element itself if no unmatched
+**   neighbor element could be found.
+*/
+
+static
+Gnum
+meshCoarsenMatchNgElem (
+const Mesh * restrict const         finemeshptr,  /* Fine mesh to perform matching on */
+volatile Gnum * restrict const      finecoartax,  /* Fine to coarse (mate) array      */
+MeshCoarsenNgHash * restrict const  finehashtab,  /* Hash table of neighbor elements  */
+const Gnum                          finehashmsk,
+const Gnum                          finepassnum,  /* Pass number for hash table       */
+const Gnum                          finevelmnum)  /* Element to match                 */
+{
+  Gnum                fineeelmnum;
+  Gnum                finehelmnum;
+  Gnum                finehebsnum;                /* Hash number of best matching element     */
+  Gnum                finevnbsnbr;                /* Number of nodes shared with best element */
+
+  const Gnum * restrict const fineverttax = finemeshptr->verttax;
+  const Gnum * restrict const finevendtax = finemeshptr->vendtax;
+  const Gnum * restrict const fineedgetax = finemeshptr->edgetax;
+
+  finehelmnum = (finevelmnum * MESHCOARSENHASHPRIME) & finehashmsk;
+  finehashtab[finehelmnum].velmnum = finepassnum; /* Put element in hash table so that number of end vertex is right even for uncoarsened elements */
+  finehashtab[finehelmnum].velmend = finevelmnum;
+  finehebsnum = finehelmnum;                      /* Mate is element itself */
+  finevnbsnbr = 0;                                /* Will never be selected */
+
+  for (fineeelmnum = fineverttax[finevelmnum];    /* For all node neighbors of current element */
+       fineeelmnum < finevendtax[finevelmnum]; fineeelmnum ++) {
+    Gnum                finevnodnum;
+    Gnum                fineenodnum;
+    Gnum                fineenodnnd;
+
+    finevnodnum = fineedgetax[fineeelmnum];
+    fineenodnum = fineverttax[finevnodnum];
+    fineenodnnd = finevendtax[finevnodnum];
+    if ((fineenodnnd - fineenodnum) == 1)         /* If node is isolated, skip to next node */
+      continue;
+
+    for ( ; fineenodnum < fineenodnnd; fineenodnum ++) { /* For all elements which are neighbors of current node */
+      Gnum                finevelmend;
+      Gnum                finehelmend;
+      Gnum                finevnngnbr;            /* Current number of neighboring nodes that connect the two elements */
+
+      finevelmend = fineedgetax[fineenodnum];
+      if ((finevelmend == finevelmnum) ||         /* If end element is current element or is already matched, do not consider it */
+          (finecoartax[finevelmend] != ~0))
+        continue;
+
+      for (finehelmend = (finevelmend * MESHCOARSENHASHPRIME) & finehashmsk; ; finehelmend = (finehelmend + 1) & finehashmsk) {
+        if (finehashtab[finehelmend].velmnum != finepassnum) { /* If element neighbor not yet considered */
+          finevnngnbr = 1;
+          finehashtab[finehelmend].velmnum = finepassnum;
+          finehashtab[finehelmend].velmend = finevelmend;
+          finehashtab[finehelmend].vnngnbr = finevnngnbr;
+        }
+        else if (finehashtab[finehelmend].velmend == finevelmend) /* Else if element found */
+          finevnngnbr = ++ finehashtab[finehelmend].vnngnbr;
+        else                                      /* Else go on searching */
+          continue;
+
+        if (finevnngnbr > finevnbsnbr) {
+          finehebsnum = finehelmend;
+          finevnbsnbr = finevnngnbr;
+        }
+        break;
+      }
+    }
+  }
+
+  return (finehashtab[finehebsnum].velmend);
+}
+
+/* This routine performs the threaded matching
+** of elements. Every thread matches the elements
+** of its slice, locking both elements of a pair
+** before mating them. Elements whose mate could
+** not be locked are queued, and processed
+** sequentially by thread 0 once all threads
+** are done. Coarse elements are then numbered
+** by prefix scan over the local pair counts.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+meshCoarsenMatchNgThr (
+ThreadDescriptor * restrict const descptr,
+MeshCoarsenData * restrict const  coarptr)
+{
+  MeshCoarsenNgHash * restrict  finehashtab;      /* Hash table of neighbor elements         */
+  Gnum                          finehashsiz;
+  Gnum                          finehashmsk;
+  Gnum                          finepassnum;      /* Pass number for hash table              */
+  Gnum                          finepairnbr;
+  Gnum                          finepairnum;
+  Gnum                          finequeunbr;
+  Gnum                          finepertbas;      /* Index of base of perturbation area      */
+  Gnum                          finepertnbr;      /* Size of perturbation area               */
+  Gnum                          finevelmnum;
+  Gnum                          finevebsnum;      /* Number of best matching element         */
+  Gnum                          coarvelmnum;      /* Number of current coarse element vertex */
+
+  const Mesh * restrict const         finemeshptr = coarptr->finemeshptr;
+  volatile Gnum * restrict const      finecoartax = coarptr->finecoartax;
+  volatile int * const                finelocktax = coarptr->finelocktax;
+  const int                           thrdnbr = threadNbr (descptr);
+  const int                           thrdnum = threadNum (descptr);
+  MeshCoarsenThread * restrict const  thrdptr = &coarptr->thrdtab[thrdnum];
+  Gnum * restrict const               finepairtab = thrdptr->finepairtab;
+  Gnum * restrict const               finequeutab = thrdptr->finequeutab;
+  const Gnum                          finevelmbas = thrdptr->finevelmbas;
+  const Gnum                          finevelmnnd = thrdptr->finevelmnnd;
+
+  for (finehashmsk = 31, finehashsiz = finemeshptr->degrmax * finemeshptr->degrmax - 1; /* Compute size of hash table */
+       finehashmsk < finehashsiz; finehashmsk = finehashmsk * 2 + 1) ;
+  finehashsiz = finehashmsk + 1;
+  if ((finehashtab = (MeshCoarsenNgHash *) memAlloc (finehashsiz * sizeof (MeshCoarsenNgHash))) == NULL)
+    coarptr->retuval = 1;
+  else
+    memSet (finehashtab, ~0, finehashsiz * sizeof (MeshCoarsenNgHash));
+
+  threadBarrier (descptr);                        /* Synchronization for retuval */
+
+  if (coarptr->retuval != 0) {                    /* If someone's allocation failed */
+    if (finehashtab != NULL)
+      memFree (finehashtab);
+    return;
+  }
+
+  finepassnum = 0;
+  finepairnbr = 0;
+  if (finemeshptr->velotax != NULL) {             /* If fine mesh has element coarsening vertex weights, perform first pass */
+    Gnum                finevelomin;
+    Gnum                finevelomax;
+
+    const Gnum * restrict const finevelotax = finemeshptr->velotax;
+
+    finevelomin = (3 * finemeshptr->velosum) / (5 * finemeshptr->velmnbr);
+    finevelomax = (5 * finemeshptr->velosum) /      finemeshptr->velmnbr;
+
+    for (finevelmnum = finevelmbas; finevelmnum < finevelmnnd; finevelmnum ++) {
+      if (finecoartax[finevelmnum] != ~0)         /* If element already selected */
+        continue;
+      if (finevelotax[finevelmnum] >= finevelomin) { /* If element is large enough, leave it for the second pass */
+        if ((finevelotax[finevelmnum] > finevelomax) && /* Except if it is too large, as then it is not matched   */
+            (__sync_lock_test_and_set (&finelocktax[finevelmnum], 1) == 0)) {
+          finecoartax[finevelmnum]       = finevelmnum;
+          finepairtab[2 * finepairnbr]     =
+          finepairtab[2 * finepairnbr + 1] = finevelmnum;
+          finepairnbr ++;
+        }
+        continue;
+      }
+
+      finevebsnum = meshCoarsenMatchNgElem (finemeshptr, finecoartax, finehashtab, finehashmsk, finepassnum ++, finevelmnum);
+      if (__sync_lock_test_and_set (&finelocktax[finevelmnum], 1)) /* If could not acquire local element */
+        continue;                                 /* Some other thread will mate it                  */
+      if (finevebsnum != finevelmnum) {
+        if (__sync_lock_test_and_set (&finelocktax[finevebsnum], 1)) { /* If could not acquire mate element */
+          __sync_lock_release (&finelocktax[finevelmnum]); /* Element will be considered in second pass */
+          continue;
+        }
+        finecoartax[finevebsnum] = finevelmnum;
+      }
+      finecoartax[finevelmnum]         = finevebsnum;
+      finepairtab[2 * finepairnbr]     = finevelmnum;
+      finepairtab[2 * finepairnbr + 1] = finevebsnum;
+      finepairnbr ++;
+    }
+
+    threadBarrier (descptr);                      /* Light elements must have been processed before all others */
+  }
+
+  for (finepertbas = finevelmbas, finepertnbr = coarptr->finepertnbr, finequeunbr = 0; /* Run cache-friendly perturbation on local elements */
+       finepertbas < finevelmnnd; finepertbas += finepertnbr) {
+    Gnum                finepertval;              /* Current index in perturbation area */
+
+    if (finepertbas + finepertnbr > finevelmnnd)
+      finepertnbr = finevelmnnd - finepertbas;
+
+    finepertval = 0;                              /* Start from first perturbation element vertex */
+    do {                                          /* Loop on perturbation element vertices        */
+      finevelmnum = finepertbas + finepertval;    /* Compute corresponding element number         */
+      if (finecoartax[finevelmnum] != ~0)         /* If element already selected                  */
+        continue;
+
+      finevebsnum = meshCoarsenMatchNgElem (finemeshptr, finecoartax, finehashtab, finehashmsk, finepassnum ++, finevelmnum);
+      if (__sync_lock_test_and_set (&finelocktax[finevelmnum], 1)) /* If could not acquire local element */
+        continue;                                 /* Some other thread will mate it                  */
+      if (finevebsnum != finevelmnum) {
+        if (__sync_lock_test_and_set (&finelocktax[finevebsnum], 1)) { /* If could not acquire mate element */
+          __sync_lock_release (&finelocktax[finevelmnum]); /* Release lock on local element             */
+          finequeutab[finequeunbr ++] = finevelmnum; /* Postpone processing to sequential pass          */
+          continue;
+        }
+        finecoartax[finevebsnum] = finevelmnum;
+      }
+      finecoartax[finevelmnum]         = finevebsnum;
+      finepairtab[2 * finepairnbr]     = finevelmnum;
+      finepairtab[2 * finepairnbr + 1] = finevebsnum;
+      finepairnbr ++;
+    } while ((finepertval = (finepertval + MESHCOARSENPERTPRIME) % finepertnbr) != 0); /* Compute next perturbation index */
+  }
+  thrdptr->finepairnbr = finepairnbr;
+  thrdptr->finequeunbr = finequeunbr;
+
+  threadBarrier (descptr);                        /* All threads must have completed their matching */
+
+  if (thrdnum == 0) {                             /* Sequential processing of remaining elements */
+    int                 thrdtmp;
+
+    for (thrdtmp = 0; thrdtmp < thrdnbr; thrdtmp ++) {
+      MeshCoarsenThread * restrict  thrdtmpptr = &coarptr->thrdtab[thrdtmp];
+      Gnum                          finequeunum;
+
+      for (finequeunum = 0; finequeunum < thrdtmpptr->finequeunbr; finequeunum ++) {
+        finevelmnum = thrdtmpptr->finequeutab[finequeunum];
+        if (finecoartax[finevelmnum] != ~0)       /* If element mated in the meantime */
+          continue;
+
+        finevebsnum = meshCoarsenMatchNgElem (finemeshptr, finecoartax, finehashtab, finehashmsk, finepassnum ++, finevelmnum);
+        finecoartax[finevebsnum] = finevelmnum;
+        finecoartax[finevelmnum] = finevebsnum;
+        thrdtmpptr->finepairtab[2 * thrdtmpptr->finepairnbr]     = finevelmnum; /* Pair is accounted for by thread of element */
+        thrdtmpptr->finepairtab[2 * thrdtmpptr->finepairnbr + 1] = finevebsnum;
+        thrdtmpptr->finepairnbr ++;
+      }
+    }
+  }
+
+  memFree (finehashtab);
+
+  threadBarrier (descptr);                        /* Pair counts must be final */
+
+  finepairnbr = thrdptr->finepairnbr;
+  thrdptr->scantab[0] = finepairnbr;
+  thrdptr->scantab[1] = 0;
+  threadScan (descptr, (void *) &thrdptr->scantab[0], sizeof (MeshCoarsenThread), (ThreadScanFunc) meshCoarsenScan, NULL); /* Compute start indices of coarse elements */
+
+  for (finepairnum = 0, coarvelmnum = thrdptr->scantab[0] - finepairnbr + finemeshptr->baseval; /* Number coarse elements */
+       finepairnum < finepairnbr; finepairnum ++, coarvelmnum ++) {
+    Gnum                finevelmtmp;
+
+    finevelmnum = finepairtab[2 * finepairnum];
+    finevelmtmp = finepairtab[2 * finepairnum + 1];
+    coarptr->finemulttax[coarvelmnum].finevelmnum[0] = finevelmnum;
+    coarptr->finemulttax[coarvelmnum].finevelmnum[1] = finevelmtmp;
+    finecoartax[finevelmnum] =
+    finecoartax[finevelmtmp] = coarvelmnum;
+  }
+
+  if (thrdnum == (thrdnbr - 1))                   /* Last thread knows the number of coarse elements */
+    coarptr->coarvelmnbr = thrdptr->scantab[0];
+}
+
+/* This routine builds the coarse mesh from
+** the fine mesh and the element matching,
+** using all threads. Every coarse node is
+** owned by a single coarse element: the element
+** of its first fine neighbor for regular nodes,
+** the smallest of the two elements for bridge
+** nodes, and the element itself for isolated
+** nodes. Coarse node numbers are computed by
+** prefix scan over the owned node counts, so
+** that they only depend on the matching. Node
+** adjacency lists are filled concurrently, then
+** sorted, so that they are the same as those
+** of the sequential building.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+meshCoarsenBuildThr (
+ThreadDescriptor * restrict const descptr,
+MeshCoarsenData * restrict const  coarptr)
+{
+  MeshCoarsenHngb * restrict  coarhngbtab;        /* Table of edges to other multinodes        */
+  MeshCoarsenHbdg * restrict  coarhbdgtab;        /* Table of bridge nodes to other multinodes */
+  Gnum                        coarhashsiz;
+  Gnum                        coarvelmnum;
+  Gnum                        coarvnodnum;
+  Gnum                        coarvnodnnd;
+  Gnum                        coaredgenum;
+  Gnum                        coaredgennd;        /* End of local element edge range           */
+  Gnum                        coaredgenbr;
+  Gnum                        coarvnodnbr;
+  Gnum                        coarveisnbr;
+  Gnum                        coardegrmax;
+
+  const Mesh * restrict const             finemeshptr = coarptr->finemeshptr;
+  const Gnum * restrict const             fineverttax = finemeshptr->verttax;
+  const Gnum * restrict const             finevendtax = finemeshptr->vendtax;
+  const Gnum * restrict const             fineedgetax = finemeshptr->edgetax;
+  const Gnum * restrict const             finevelotax = finemeshptr->velotax;
+  const Gnum * restrict const             finevnlotax = finemeshptr->vnlotax;
+  Gnum * restrict const                   finecoartax = coarptr->finecoartax;
+  const MeshCoarsenMult * restrict const  finemulttax = coarptr->finemulttax;
+  Gnum * restrict const                   coarverttax = coarptr->coarverttax;
+  Gnum * restrict const                   coarvelotax = coarptr->coarvelotax;
+  Gnum * restrict const                   coaredgetax = coarptr->coaredgetax;
+  const Gnum                              coarhashmsk = coarptr->coarhashmsk;
+  const Gnum                              baseval = finemeshptr->baseval;
+  const int                               thrdnbr = threadNbr (descptr);
+  const int                               thrdnum = threadNum (descptr);
+  MeshCoarsenThread * restrict const      thrdptr = &coarptr->thrdtab[thrdnum];
+  const Gnum                              coarvelmbas = thrdptr->coarvelmbas;
+  const Gnum                              coarvelmnnd = thrdptr->coarvelmnnd;
+
+  coarhashsiz = coarhashmsk + 1;
+  if (memAllocGroup ((void **) (void *)
+        &coarhngbtab, (size_t) (coarhashsiz * sizeof (MeshCoarsenHngb)),
+        &coarhbdgtab, (size_t) (coarhashsiz * sizeof (MeshCoarsenHbdg)), NULL) == NULL) {
+    coarptr->retuval = 1;
+    coarhngbtab = NULL;
+  }
+
+  threadBarrier (descptr);                        /* Synchronization for retuval */
+
+  if (coarptr->retuval != 0) {                    /* If someone's allocation failed */
+    if (coarhngbtab != NULL)
+      memFree (coarhngbtab);
+    return;
+  }
+
+  memSet (coarhngbtab, ~0, coarhashsiz * sizeof (MeshCoarsenHngb));
+  memSet (coarhbdgtab, ~0, coarhashsiz * sizeof (MeshCoarsenHbdg));
+  for (coarvelmnum = coarvelmbas, coaredgenbr = coarvnodnbr = coarveisnbr = coardegrmax = 0; /* First pass: count edges and owned nodes */
+       coarvelmnum < coarvelmnnd; coarvelmnum ++) {
+    Gnum                coardegrval;              /* Degree of coarsened element          */
+    int                 coarvnisflg;              /* Flag set if isolated node accounted  */
+    Gnum                finevelmnum;              /* Number of current element            */
+    int                 i;
+
+    coardegrval = 0;
+    coarvnisflg = 0;
+    i = 0;
+    do {                                          /* For both elements of element pair (if they are different) */
+      Gnum                fineeelmnum;
+
+      finevelmnum = finemulttax[coarvelmnum].finevelmnum[i];
+      for (fineeelmnum = fineverttax[finevelmnum];
+           fineeelmnum < finevendtax[finevelmnum]; fineeelmnum ++) {
+        Gnum                finevnodnum;          /* Number of current node neighbor */
+        Gnum                fineenodnum;
+        Gnum                finevdegval;
+        Gnum                coarhnodtmp;
+
+        finevnodnum = fineedgetax[fineeelmnum];
+        fineenodnum = fineverttax[finevnodnum];
+        finevdegval = finevendtax[finevnodnum] - fineenodnum;
+
+        if (finevdegval == 2) {                   /* If node is a bridge */
+          Gnum                finevelmend;
+          Gnum                coarvelmend;
+
+          finevelmend = fineedgetax[fineenodnum] + fineedgetax[fineenodnum + 1] - finevelmnum;
+          coarvelmend = finecoartax[finevelmend];
+          if (coarvelmend != coarvelmnum) {       /* If node is an external bridge to another coarse element */
+            Gnum                coarhelmend;
+
+            for (coarhelmend = (coarvelmend * MESHCOARSENHASHPRIME) & coarhashmsk; ; coarhelmend = (coarhelmend + 1) & coarhashmsk) {
+              if (coarhbdgtab[coarhelmend].coarvelmnum != coarvelmnum) { /* If bridge not yet considered */
+                coarhbdgtab[coarhelmend].coarvelmnum = coarvelmnum;
+                coarhbdgtab[coarhelmend].coarvelmend = coarvelmend;
+                coardegrval ++;
+                if (coarvelmnum < coarvelmend)    /* Bridge node is owned by smallest element */
+                  coarvnodnbr ++;
+                break;
+              }
+              if (coarhbdgtab[coarhelmend].coarvelmend == coarvelmend) /* If bridge already present */
+                break;
+            }
+            continue;
+          }
+          if (finevelmnum >= finevelmend)         /* Process internal bridge edges only once */
+            continue;
+        }
+        if (finevdegval < 3) {                    /* If node is isolated or is an internal bridge */
+          if (coarvnisflg == 0) {                 /* All such nodes are merged into a single node */
+            coarvnisflg = 1;
+            coardegrval ++;
+            coarvnodnbr ++;
+          }
+          continue;
+        }
+
+        for (coarhnodtmp = (finevnodnum * MESHCOARSENHASHPRIME) & coarhashmsk; ; coarhnodtmp = (coarhnodtmp + 1) & coarhashmsk) {
+          if (coarhngbtab[coarhnodtmp].coarvelmnum != coarvelmnum) { /* If node neighbor not yet considered */
+            coarhngbtab[coarhnodtmp].coarvelmnum = coarvelmnum;
+            coarhngbtab[coarhnodtmp].coarvnodnum = finevnodnum;
+            coardegrval ++;
+            if (finecoartax[fineedgetax[fineenodnum]] == coarvelmnum) /* Regular node is owned by element of its first neighbor */
+              coarvnodnbr ++;
+            break;
+          }
+          if (coarhngbtab[coarhnodtmp].coarvnodnum == finevnodnum) /* If node already present, nothing to do */
+            break;
+        }
+      }
+    } while (i ++, finevelmnum != finemulttax[coarvelmnum].finevelmnum[1]);
+
+    coarverttax[coarvelmnum] = coardegrval;       /* Record degree until start indices are known */
+    coaredgenbr += coardegrval;
+    if (coardegrval <= 0)                         /* If zero degree, one more isolated element */
+      coarveisnbr ++;
+    if (coardegrval > coardegrmax)
+      coardegrmax = coardegrval;
+  }
+
+  thrdptr->coaredgenbr = coaredgenbr;
+  thrdptr->coarvnodnbr = coarvnodnbr;
+  thrdptr->scantab[0]  = coaredgenbr;
+  thrdptr->scantab[1]  = coarvnodnbr;
+  threadScan (descptr, (void *) &thrdptr->scantab[0], sizeof (MeshCoarsenThread), (ThreadScanFunc) meshCoarsenScan, NULL); /* Compute start indices of element edges and owned nodes */
+
+  coaredgenum = thrdptr->scantab[0] - coaredgenbr + baseval;
+  coarvnodnum =
+  thrdptr->coarvnodbas = thrdptr->scantab[1] - coarvnodnbr + baseval + coarptr->coarvelmnbr;
+  if (thrdnum == (thrdnbr - 1)) {                 /* Last thread knows global counts */
+    coarptr->coaredgenbr = thrdptr->scantab[0];
+    coarptr->coarvnodnnd = thrdptr->scantab[1] + baseval + coarptr->coarvelmnbr;
+  }
+
+  memSet (coarhbdgtab, ~0, coarhashsiz * sizeof (MeshCoarsenHbdg));
+  for (coarvelmnum = coarvelmbas; coarvelmnum < coarvelmnnd; coarvelmnum ++) { /* Second pass: number owned nodes */
+    Gnum                coardegrval;
+    Gnum                coarveloval;              /* Weight of coarsened element    */
+    Gnum                coarvnisnum;              /* Number of coarse isolated node */
+    Gnum                finevelmnum;
+    int                 i;
+
+    coardegrval = coarverttax[coarvelmnum];
+    coarverttax[coarvelmnum] = coaredgenum;       /* Set start index of element edge sub-array */
+    coaredgenum += coardegrval;
+
+    coarvnisnum = ~0;                             /* No isolated node yet for this element pair */
+    coarveloval = 0;
+    i = 0;
+    do {
+      Gnum                fineeelmnum;
+
+      finevelmnum  = finemulttax[coarvelmnum].finevelmnum[i];
+      coarveloval += (finevelotax != NULL) ? finevelotax[finevelmnum] : 1;
+      for (fineeelmnum = fineverttax[finevelmnum];
+           fineeelmnum < finevendtax[finevelmnum]; fineeelmnum ++) {
+        Gnum                finevnodnum;
+        Gnum                fineenodnum;
+        Gnum                finevdegval;
+        Gnum                finevnloval;
+
+        finevnodnum = fineedgetax[fineeelmnum];
+        fineenodnum = fineverttax[finevnodnum];
+        finevdegval = finevendtax[finevnodnum] - fineenodnum;
+        finevnloval = (finevnlotax != NULL) ? finevnlotax[finevnodnum] : 1;
+
+        if (finevdegval == 2) {
+          Gnum                finevelmend;
+          Gnum                coarvelmend;
+
+          finevelmend = fineedgetax[fineenodnum] + fineedgetax[fineenodnum + 1] - finevelmnum;
+          coarvelmend = finecoartax[finevelmend];
+          if (coarvelmend != coarvelmnum) {       /* If node is an external bridge to another coarse element */
+            Gnum                coarhelmend;
+
+            if (coarvelmnum > coarvelmend)        /* If bridge node not owned by current element, skip it */
+              continue;
+
+            for (coarhelmend = (coarvelmend * MESHCOARSENHASHPRIME) & coarhashmsk; ; coarhelmend = (coarhelmend + 1) & coarhashmsk) {
+              if (coarhbdgtab[coarhelmend].coarvelmnum != coarvelmnum) { /* If bridge not yet considered */
+                coarhbdgtab[coarhelmend].coarvelmnum = coarvelmnum;
+                coarhbdgtab[coarhelmend].coarvelmend = coarvelmend;
+                coarhbdgtab[coarhelmend].coarvnodnum =
+                finecoartax[finevnodnum] = coarvnodnum;
+                coarverttax[coarvnodnum] = 0;     /* No connections to the node yet */
+                coarvelotax[coarvnodnum] = finevnloval;
+                coarvnodnum ++;
+                break;
+              }
+              if (coarhbdgtab[coarhelmend].coarvelmend == coarvelmend) { /* If bridge already present, merge fine node into it */
+                finecoartax[finevnodnum]  = coarhbdgtab[coarhelmend].coarvnodnum;
+                coarvelotax[finecoartax[finevnodnum]] += finevnloval;
+                break;
+              }
+            }
+            continue;
+          }
+          if (finevelmnum >= finevelmend)         /* Process internal bridge edges only once */
+            continue;
+        }
+        if (finevdegval < 3) {                    /* If node is isolated or is an internal bridge */
+          if (coarvnisnum == ~0) {                /* If no isolated node for this element pair    */
+            coarvnisnum = coarvnodnum ++;         /* Create isolated node                         */
+            coarverttax[coarvnisnum] = 0;
+            coarvelotax[coarvnisnum] = finevnloval;
+          }
+          else
+            coarvelotax[coarvnisnum] += finevnloval;
+          finecoartax[finevnodnum] = coarvnisnum;
+          continue;
+        }
+        if ((finecoartax[fineedgetax[fineenodnum]] == coarvelmnum) && /* If regular node owned by current element */
+            (finecoartax[finevnodnum] == ~0)) {   /* And not yet numbered                                         */
+          finecoartax[finevnodnum] = coarvnodnum;
+          coarverttax[coarvnodnum] = 0;
+          coarvelotax[coarvnodnum] = finevnloval;
+          coarvnodnum ++;
+        }
+      }
+    } while (i ++, finevelmnum != finemulttax[coarvelmnum].finevelmnum[1]);
+
+    coarvelotax[coarvelmnum] = coarveloval;       /* Lose initial weights of elements, if any, to keep coarsening weights */
+  }
+  coaredgennd = coaredgenum;                      /* End of local element edge range */
+#ifdef SCOTCH_DEBUG_MESH2
+  if (coarvnodnum != (thrdptr->coarvnodbas + coarvnodnbr)) {
+    errorPrint ("meshCoarsenBuildThr: internal error (1)");
+    coarptr->retuval = 1;                         /* Other threads must still reach barriers */
+  }
+#endif /* SCOTCH_DEBUG_MESH2 */
+
+  threadBarrier (descptr);                        /* All fine nodes must have been numbered */
+
+#ifdef SCOTCH_DEBUG_MESH2
+  if (coarptr->retuval != 0) {                    /* All threads see the same value before the next barrier */
+    memFree (coarhngbtab);
+    return;
+  }
+  threadBarrier (descptr);                        /* Value must be read by all threads before it can be set again */
+#endif /* SCOTCH_DEBUG_MESH2 */
+
+  memSet (coarhngbtab, ~0, coarhashsiz * sizeof (MeshCoarsenHngb));
+  for (coarvelmnum = coarvelmbas; coarvelmnum < coarvelmnnd; coarvelmnum ++) { /* Third pass: build element edges */
+    Gnum                finevelmnum;
+    int                 i;
+
+    coaredgenum = coarverttax[coarvelmnum];
+    i = 0;
+    do {
+      Gnum                fineeelmnum;
+
+      finevelmnum = finemulttax[coarvelmnum].finevelmnum[i];
+      for (fineeelmnum = fineverttax[finevelmnum];
+           fineeelmnum < finevendtax[finevelmnum]; fineeelmnum ++) {
+        Gnum                coarvnodtmp;
+        Gnum                coarhnodtmp;
+
+        coarvnodtmp = finecoartax[fineedgetax[fineeelmnum]];
+        for (coarhnodtmp = (coarvnodtmp * MESHCOARSENHASHPRIME) & coarhashmsk; ; coarhnodtmp = (coarhnodtmp + 1) & coarhashmsk) {
+          if (coarhngbtab[coarhnodtmp].coarvelmnum != coarvelmnum) { /* If node neighbor not yet considered */
+            coarhngbtab[coarhnodtmp].coarvelmnum = coarvelmnum;
+            coarhngbtab[coarhnodtmp].coarvnodnum = coarvnodtmp;
+            coaredgetax[coaredgenum ++]          = coarvnodtmp;
+            __sync_fetch_and_add (&coarverttax[coarvnodtmp], 1); /* One more edge referencing the node */
+            break;
+          }
+          if (coarhngbtab[coarhnodtmp].coarvnodnum == coarvnodtmp) /* If node already present, nothing to do */
+            break;
+        }
+      }
+    } while (i ++, finevelmnum != finemulttax[coarvelmnum].finevelmnum[1]);
+#ifdef SCOTCH_DEBUG_MESH2
+    if (coaredgenum != ((coarvelmnum < (coarvelmnnd - 1)) ? coarverttax[coarvelmnum + 1] : coaredgennd)) {
+      errorPrint ("meshCoarsenBuildThr: internal error (2)");
+      coarptr->retuval = 1;
+      break;
+    }
+#endif /* SCOTCH_DEBUG_MESH2 */
+  }
+
+  memFree (coarhngbtab);                          /* Free group leader */
+
+  threadBarrier (descptr);                        /* All node degrees must be known */
+
+#ifdef SCOTCH_DEBUG_MESH2
+  if (coarptr->retuval != 0)                      /* No thread sets it again from now on */
+    return;
+#endif /* SCOTCH_DEBUG_MESH2 */
+
+  for (coarvnodnum = thrdptr->coarvnodbas, coarvnodnnd = coarvnodnum + coarvnodnbr, coaredgenbr = 0; /* Sum degrees of owned nodes */
+       coarvnodnum < coarvnodnnd; coarvnodnum ++) {
+    Gnum                coardegrval;
+
+    coardegrval  = coarverttax[coarvnodnum];
+    coaredgenbr += coardegrval;
+    if (coardegrval > coardegrmax)
+      coardegrmax = coardegrval;
+  }
+  thrdptr->scantab[0] = coaredgenbr;
+  thrdptr->scantab[1] = 0;
+  threadScan (descptr, (void *) &thrdptr->scantab[0], sizeof (MeshCoarsenThread), (ThreadScanFunc) meshCoarsenScan, NULL); /* Compute start indices of node edges */
+
+  for (coarvnodnum = thrdptr->coarvnodbas, /* Set end indices of node edge sub-arrays */
+       coaredgenum = thrdptr->scantab[0] - coaredgenbr + coarptr->coaredgenbr + baseval;
+       coarvnodnum < coarvnodnnd; coarvnodnum ++) {
+    coaredgenum += coarverttax[coarvnodnum];
+    coarverttax[coarvnodnum] = coaredgenum;
+  }
+  if (thrdnum == (thrdnbr - 1))                   /* Last thread marks end of edge array */
+    coarverttax[coarptr->coarvnodnnd] = coaredgenum;
+
+  threadBarrier (descptr);                        /* All end indices must be set */
+
+  for (coarvelmnum = coarvelmbas; coarvelmnum < coarvelmnnd; coarvelmnum ++) { /* Fill node edges by decreasing end indices */
+    Gnum                coareelmnum;
+    Gnum                coareelmnnd;
+
+    coareelmnnd = (coarvelmnum < (coarvelmnnd - 1)) ? coarverttax[coarvelmnum + 1] : coaredgennd;
+    for (coareelmnum = coarverttax[coarvelmnum]; coareelmnum < coareelmnnd; coareelmnum ++)
+      coaredgetax[__sync_sub_and_fetch (&coarverttax[coaredgetax[coareelmnum]], 1)] = coarvelmnum;
+  }
+
+  threadBarrier (descptr);                        /* All node edges must be set */
+
+  for (coarvnodnum = thrdptr->coarvnodbas; coarvnodnum < coarvnodnnd; coarvnodnum ++) /* Sort node edges to get same result as sequential building */
+    intSort1asc1 (coaredgetax + coarverttax[coarvnodnum], coarverttax[coarvnodnum + 1] - coarverttax[coarvnodnum]);
+
+  thrdptr->coarveisnbr = coarveisnbr;
+  thrdptr->coardegrmax = coardegrmax;
+  threadReduce (descptr, (void *) thrdptr, sizeof (MeshCoarsenThread), (ThreadReduceFunc) meshCoarsenReduce, 0, NULL);
+
+  if (thrdnum == 0) {
+    coarptr->coarveisnbr = thrdptr->coarveisnbr;
+    coarptr->coardegrmax = thrdptr->coardegrmax;
+  }
+}
+
+#endif /* MESHCOARSENNOTHREAD */
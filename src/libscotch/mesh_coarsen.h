@@ -44,7 +44,7 @@
 /**                # Version 6.0  : from : 06 jun 2018     **/
 /**                                 to   : 06 jun 2018     **/
 /**                # Version 7.0  : from : 12 sep 2019     **/
-/**                                 to   : 28 aug 2020     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -52,6 +52,12 @@
 **  The defines.
 */
 
+/** Threaded coarsening requires threads. **/
+
+#if (! defined SCOTCH_PTHREAD) && (! defined MESHCOARSENNOTHREAD)
+#define MESHCOARSENNOTHREAD
+#endif /* (! defined SCOTCH_PTHREAD) && (! defined MESHCOARSENNOTHREAD) */
+
 /** Prime number for cache-friendly perturbations. **/
 
 #define MESHCOARSENPERTPRIME        31            /* Prime number */
@@ -110,12 +116,64 @@ typedef struct MeshCoarsenNgHash_ {
   Gnum                      vnbgnbr;              /*+ Number of bridge neighboring node vertices +*/
 } MeshCoarsenNgHash;
 
+#ifndef MESHCOARSENNOTHREAD
+
+/*+ The thread-specific data block. +*/
+
+typedef struct MeshCoarsenThread_ {
+  Gnum                      finevelmbas;          /*+ Start of fine element range                 +*/
+  Gnum                      finevelmnnd;          /*+ End of fine element range                   +*/
+  Gnum *                    finepairtab;          /*+ Pairs of fine elements matched locally      +*/
+  Gnum                      finepairnbr;          /*+ Number of local pairs                       +*/
+  Gnum *                    finequeutab;          /*+ Queue of elements whose mating failed       +*/
+  Gnum                      finequeunbr;          /*+ Number of queued elements                   +*/
+  Gnum                      coarvelmbas;          /*+ Start of coarse element range               +*/
+  Gnum                      coarvelmnnd;          /*+ End of coarse element range                 +*/
+  Gnum                      coarvnodbas;          /*+ Start of range of coarse nodes owned        +*/
+  Gnum                      coarvnodnbr;          /*+ Number of coarse nodes owned                +*/
+  Gnum                      coaredgenbr;          /*+ Number of local element (or node) edges     +*/
+  Gnum                      coarveisnbr;          /*+ Number of local isolated coarse elements    +*/
+  Gnum                      coardegrmax;          /*+ Local maximum degree                        +*/
+  Gnum                      scantab[4];           /*+ Scan areas for edge and node start indices +*/
+} MeshCoarsenThread;
+
+/*+ The threaded coarsening data block. +*/
+
+typedef struct MeshCoarsenData_ {
+  const Mesh *              finemeshptr;          /*+ Fine mesh to coarsen                +*/
+  Gnum *                    finecoartax;          /*+ Fine to coarse vertex array         +*/
+  MeshCoarsenMult *         finemulttax;          /*+ Array of coarse multielements       +*/
+  volatile int *            finelocktax;          /*+ Element lock array                  +*/
+  Gnum                      finepertnbr;          /*+ Size of perturbation area           +*/
+  Gnum                      finehashmsk;          /*+ Mask of matching hash tables        +*/
+  Gnum                      coarhashmsk;          /*+ Mask of building hash tables        +*/
+  Gnum                      coarvelmnbr;          /*+ Number of coarse elements           +*/
+  Gnum *                    coarverttax;          /*+ Coarse vertex array                 +*/
+  Gnum *                    coarvelotax;          /*+ Coarse vertex load array            +*/
+  Gnum *                    coaredgetax;          /*+ Coarse edge array                   +*/
+  Gnum                      coarvnodnnd;          /*+ End of coarse node range            +*/
+  Gnum                      coaredgenbr;          /*+ Number of coarse element edges      +*/
+  Gnum                      coarveisnbr;          /*+ Number of isolated coarse elements  +*/
+  Gnum                      coardegrmax;          /*+ Maximum degree of coarse mesh       +*/
+  int                       retuval;              /*+ Return value                        +*/
+  MeshCoarsenThread *       thrdtab;              /*+ Array of thread-specific blocks     +*/
+} MeshCoarsenData;
+
+#endif /* MESHCOARSENNOTHREAD */
+
 /*
 **  The function prototypes.
 */
 
 #ifdef MESH_COARSEN
 static void                 meshCoarsenMatchNg  (const Mesh * restrict const, MeshCoarsenMult * restrict const, Gnum * restrict const, Gnum * restrict const, Gnum * restrict const, Gnum * restrict const, Context * restrict const);
+#ifndef MESHCOARSENNOTHREAD
+static void                 meshCoarsenMatchNgThr (ThreadDescriptor * restrict const, MeshCoarsenData * restrict const);
+static Gnum                 meshCoarsenMatchNgElem (const Mesh * restrict const, volatile Gnum * restrict const, MeshCoarsenNgHash * restrict const, const Gnum, const Gnum, const Gnum);
+static void                 meshCoarsenBuildThr (ThreadDescriptor * restrict const, MeshCoarsenData * restrict const);
+static void                 meshCoarsenReduce   (MeshCoarsenThread * restrict const, MeshCoarsenThread * restrict const, const void * const);
+static void                 meshCoarsenScan     (Gnum * restrict const, Gnum * restrict const, const int, const int, const void * const);
+#endif /* MESHCOARSENNOTHREAD */
 #endif /* MESH_COARSEN */
 
 int                         meshCoarsen         (const Mesh * restrict const, Mesh * restrict const, Gnum * restrict * const, const Gnum, const double, const MeshCoarsenType, Context * restrict const);
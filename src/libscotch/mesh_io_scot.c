@@ -46,6 +46,8 @@
 /**                                 to   : 11 aug 2010     **/
 /**                # Version 6.0  : from : 28 apr 2019     **/
 /**                                 to   : 28 apr 2019     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -89,7 +91,10 @@ const char * const          dataptr)              /* No use           */
   int                         o;
 
   if (filesrcptr != NULL) {
-    if (meshLoad (meshptr, filesrcptr, -1) != 0)
+    fileStreamLock (filesrcptr);                  /* Lock stream once for the whole mesh */
+    o = meshLoad (meshptr, filesrcptr, -1);
+    fileStreamUnlock (filesrcptr);
+    if (o != 0)
       return (1);
   }
 
@@ -154,7 +159,7 @@ const char * const          dataptr)              /* No use           */
   }
 
   if (coorsortflag != 1)                          /* If geometry data not sorted        */
-    intSort2asc1 (coorsorttab, coornbr);          /* Sort sort area by ascending labels */
+    intRsort2asc1 (coorsorttab, coornbr, NULL);   /* Sort sort area by ascending labels */
   for (coornum = 1; coornum < coornbr; coornum ++) { /* Check geometric data integrity  */
     if (coorsorttab[coornum].labl == coorsorttab[coornum - 1].labl) {
       errorPrint ("meshGeomLoadScot: duplicate vertex label");
@@ -173,7 +178,7 @@ const char * const          dataptr)              /* No use           */
         vnodsortflag = 0;                         /* Graph data not sorted */
     }
     if (vnodsortflag != 1)                        /* If graph data not sorted             */
-      intSort2asc1 (vnodsorttab, meshptr->vnodnbr); /* Sort sort area by ascending labels */
+      intRsort2asc1 (vnodsorttab, meshptr->vnodnbr, NULL); /* Sort sort area by ascending labels */
   }
   else {                                          /* Graph does not have vertex labels */
     for (vnodnum = 0; vnodnum < meshptr->vnodnbr; vnodnum ++)
@@ -55,7 +55,7 @@
 /**                # Version 6.1  : from : 24 aug 2020     **/
 /**                                 to   : 30 dec 2021     **/
 /**                # Version 7.0  : from : 02 mar 2018     **/
-/**                                 to   : 08 jan 2022     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -260,6 +260,9 @@
 #define SCOTCH_COARSENFOLD          SCOTCH_NAME_PUBLIC (SCOTCH_COARSENFOLD)
 #define SCOTCH_COARSENFOLDDUP       SCOTCH_NAME_PUBLIC (SCOTCH_COARSENFOLDDUP)
 #define SCOTCH_COARSENNOMERGE       SCOTCH_NAME_PUBLIC (SCOTCH_COARSENNOMERGE)
+#define SCOTCH_COLORNONE            SCOTCH_NAME_PUBLIC (SCOTCH_COLORNONE)
+#define SCOTCH_COLORDEGREE          SCOTCH_NAME_PUBLIC (SCOTCH_COLORDEGREE)
+#define SCOTCH_COLORSMALLEST        SCOTCH_NAME_PUBLIC (SCOTCH_COLORSMALLEST)
 #define SCOTCH_STRATDEFAULT         SCOTCH_NAME_PUBLIC (SCOTCH_STRATDEFAULT)
 #define SCOTCH_STRATQUALITY         SCOTCH_NAME_PUBLIC (SCOTCH_STRATQUALITY)
 #define SCOTCH_STRATSPEED           SCOTCH_NAME_PUBLIC (SCOTCH_STRATSPEED)
@@ -341,6 +344,9 @@
 #define intRandVal                  SCOTCH_NAME_INTERN (intRandVal)
 #define intRandVal2                 SCOTCH_NAME_INTERN (intRandVal2)
 #define intRandVal3                 SCOTCH_NAME_INTERN (intRandVal3)
+#define intRsort1asc1               SCOTCH_NAME_INTERN (intRsort1asc1)
+#define intRsort2asc1               SCOTCH_NAME_INTERN (intRsort2asc1)
+#define intRsort2asc2               SCOTCH_NAME_INTERN (intRsort2asc2)
 #define intSort1asc1                SCOTCH_NAME_INTERN (intSort1asc1)
 #define intSort2asc1                SCOTCH_NAME_INTERN (intSort2asc1)
 #define intSort2asc2                SCOTCH_NAME_INTERN (intSort2asc2)
@@ -380,6 +386,7 @@
 #define archFree                    SCOTCH_NAME_INTERN (archFree)
 #define archLoad                    SCOTCH_NAME_INTERN (archLoad)
 #define archSave                    SCOTCH_NAME_INTERN (archSave)
+#define archSaveBin                 SCOTCH_NAME_INTERN (archSaveBin)
 /* #define archName                 SCOTCH_NAME_INTERN (archName) Already a macro */
 #define archClass                   SCOTCH_NAME_INTERN (archClass)
 #define archClass2                  SCOTCH_NAME_INTERN (archClass2)
@@ -431,9 +438,11 @@
 #define archCmpltwDomMpiType        SCOTCH_NAME_INTERN (archCmpltwDomMpiType)
 #define archDecoArchBuild           SCOTCH_NAME_INTERN (archDecoArchBuild)
 #define archDecoArchBuild2          SCOTCH_NAME_INTERN (archDecoArchBuild2)
+#define archDecoArchDistNbr         SCOTCH_NAME_INTERN (archDecoArchDistNbr)
 #define archDecoArchFree            SCOTCH_NAME_INTERN (archDecoArchFree)
 #define archDecoArchLoad            SCOTCH_NAME_INTERN (archDecoArchLoad)
 #define archDecoArchSave            SCOTCH_NAME_INTERN (archDecoArchSave)
+#define archDecoArchSaveBin         SCOTCH_NAME_INTERN (archDecoArchSaveBin)
 #define archDecoDomNum              SCOTCH_NAME_INTERN (archDecoDomNum)
 #define archDecoDomTerm             SCOTCH_NAME_INTERN (archDecoDomTerm)
 #define archDecoDomSize             SCOTCH_NAME_INTERN (archDecoDomSize)
@@ -446,6 +455,7 @@
 #define archDecoDomBipart           SCOTCH_NAME_INTERN (archDecoDomBipart)
 #define archDecoDomMpiType          SCOTCH_NAME_INTERN (archDecoDomMpiType)
 #define archDeco2ArchBuild          SCOTCH_NAME_INTERN (archDeco2ArchBuild)
+#define archDeco2ArchDist           SCOTCH_NAME_INTERN (archDeco2ArchDist)
 #define archDeco2ArchFree           SCOTCH_NAME_INTERN (archDeco2ArchFree)
 #define archDeco2ArchLoad2          SCOTCH_NAME_INTERN (archDeco2ArchLoad2)
 #define archDeco2ArchSave           SCOTCH_NAME_INTERN (archDeco2ArchSave)
@@ -728,6 +738,8 @@
 #define dgraphFold                  SCOTCH_NAME_INTERN (dgraphFold)
 #define dgraphFold2                 SCOTCH_NAME_INTERN (dgraphFold2)
 #define dgraphFoldComm              SCOTCH_NAME_INTERN (dgraphFoldComm)
+#define dgraphFoldCommNode          SCOTCH_NAME_INTERN (dgraphFoldCommNode)
+#define dgraphFoldCommNode2         SCOTCH_NAME_INTERN (dgraphFoldCommNode2)
 #define dgraphFoldDup               SCOTCH_NAME_INTERN (dgraphFoldDup)
 #define dgraphFree                  SCOTCH_NAME_INTERN (dgraphFree)
 #define dgraphGather                SCOTCH_NAME_INTERN (dgraphGather)
@@ -749,10 +761,13 @@
 #define dgraphInduce2               SCOTCH_NAME_INTERN (dgraphInduce2)
 #define dgraphInit                  SCOTCH_NAME_INTERN (dgraphInit)
 #define dgraphLoad                  SCOTCH_NAME_INTERN (dgraphLoad)
+#define dgraphLoadBin               SCOTCH_NAME_INTERN (dgraphLoadBin)
 #define dgraphMatchInit             SCOTCH_NAME_INTERN (dgraphMatchInit)
 #define dgraphMatchExit             SCOTCH_NAME_INTERN (dgraphMatchExit)
 #define dgraphMatchSync             SCOTCH_NAME_INTERN (dgraphMatchSync)
 #define dgraphMatchSyncColl         SCOTCH_NAME_INTERN (dgraphMatchSyncColl)
+#define dgraphMatchSyncCollAsync    SCOTCH_NAME_INTERN (dgraphMatchSyncCollAsync)
+#define dgraphMatchSyncCollWait     SCOTCH_NAME_INTERN (dgraphMatchSyncCollWait)
 #define dgraphMatchSyncPtop         SCOTCH_NAME_INTERN (dgraphMatchSyncPtop)
 #define dgraphMatchCheck            SCOTCH_NAME_INTERN (dgraphMatchCheck)
 #define dgraphMatchHl               SCOTCH_NAME_INTERN (dgraphMatchHl)
@@ -762,6 +777,7 @@
 #define dgraphMatchSc               SCOTCH_NAME_INTERN (dgraphMatchSc)
 #define dgraphRedist                SCOTCH_NAME_INTERN (dgraphRedist)
 #define dgraphSave                  SCOTCH_NAME_INTERN (dgraphSave)
+#define dgraphSaveBin               SCOTCH_NAME_INTERN (dgraphSaveBin)
 #define dgraphScatter               SCOTCH_NAME_INTERN (dgraphScatter)
 #define dgraphView                  SCOTCH_NAME_INTERN (dgraphView)
 
@@ -821,7 +837,13 @@
 #define graphFree                   SCOTCH_NAME_INTERN (graphFree)
 #define graphLoad                   SCOTCH_NAME_INTERN (graphLoad)
 #define graphLoad2                  SCOTCH_NAME_INTERN (graphLoad2)
+#define graphLoadBin                SCOTCH_NAME_INTERN (graphLoadBin)
+#define graphBinLayout              SCOTCH_NAME_INTERN (graphBinLayout)
+#define graphLoadCont               SCOTCH_NAME_INTERN (graphLoadCont)
+#define graphFreeBin                SCOTCH_NAME_INTERN (graphFreeBin)
 #define graphSave                   SCOTCH_NAME_INTERN (graphSave)
+#define graphSaveBin                SCOTCH_NAME_INTERN (graphSaveBin)
+#define graphSaveBin2               SCOTCH_NAME_INTERN (graphSaveBin2)
 #define graphBand                   SCOTCH_NAME_INTERN (graphBand)
 #define graphBase                   SCOTCH_NAME_INTERN (graphBase)
 #define graphCheck                  SCOTCH_NAME_INTERN (graphCheck)
@@ -829,6 +851,7 @@
 #define graphCoarsen                SCOTCH_NAME_INTERN (graphCoarsen)
 #define graphCoarsenBuild           SCOTCH_NAME_INTERN (graphCoarsenBuild)
 #define graphCoarsenMatch           SCOTCH_NAME_INTERN (graphCoarsenMatch)
+#define graphColor                  SCOTCH_NAME_INTERN (graphColor)
 #define graphDiamPV                 SCOTCH_NAME_INTERN (graphDiamPV)
 #define graphDump                   SCOTCH_NAME_INTERN (graphDump)
 #define graphDump2                  SCOTCH_NAME_INTERN (graphDump2)
@@ -840,10 +863,12 @@
 #define graphMatch                  SCOTCH_NAME_INTERN (graphMatch)
 #define graphMatchInit              SCOTCH_NAME_INTERN (graphMatchInit)
 #define graphMatchNone              SCOTCH_NAME_INTERN (graphMatchNone)
+#define graphGeomLoadBin            SCOTCH_NAME_INTERN (graphGeomLoadBin)
 #define graphGeomLoadChac           SCOTCH_NAME_INTERN (graphGeomLoadChac)
 #define graphGeomLoadHabo           SCOTCH_NAME_INTERN (graphGeomLoadHabo)
 #define graphGeomLoadMmkt           SCOTCH_NAME_INTERN (graphGeomLoadMmkt)
 #define graphGeomLoadScot           SCOTCH_NAME_INTERN (graphGeomLoadScot)
+#define graphGeomSaveBin            SCOTCH_NAME_INTERN (graphGeomSaveBin)
 #define graphGeomSaveChac           SCOTCH_NAME_INTERN (graphGeomSaveChac)
 #define graphGeomSaveScot           SCOTCH_NAME_INTERN (graphGeomSaveScot)
 #define graphGeomSaveMmkt           SCOTCH_NAME_INTERN (graphGeomSaveMmkt)
@@ -911,6 +936,8 @@
 #define kdgraphInit                 SCOTCH_NAME_INTERN (kdgraphInit)
 #define kdgraphExit                 SCOTCH_NAME_INTERN (kdgraphExit)
 #define kdgraphGather               SCOTCH_NAME_INTERN (kdgraphGather)
+#define kdgraphMapLp                SCOTCH_NAME_INTERN (kdgraphMapLp)
+#define kdgraphMapMl                SCOTCH_NAME_INTERN (kdgraphMapMl)
 #define kdgraphMapRb                SCOTCH_NAME_INTERN (kdgraphMapRb)
 #define kdgraphMapRbAdd2            SCOTCH_NAME_INTERN (kdgraphMapRbAdd2)
 #define kdgraphMapRbAddBoth         SCOTCH_NAME_INTERN (kdgraphMapRbAddBoth)
@@ -933,7 +960,10 @@
 #define kgraphMapDf                 SCOTCH_NAME_INTERN (kgraphMapDf)
 #define kgraphMapEx                 SCOTCH_NAME_INTERN (kgraphMapEx)
 #define kgraphMapFm                 SCOTCH_NAME_INTERN (kgraphMapFm)
+#define kgraphMapLp                 SCOTCH_NAME_INTERN (kgraphMapLp)
 #define kgraphMapMl                 SCOTCH_NAME_INTERN (kgraphMapMl)
+#define kgraphMapMlCacheExit        SCOTCH_NAME_INTERN (kgraphMapMlCacheExit)
+#define kgraphMapMlCacheInit        SCOTCH_NAME_INTERN (kgraphMapMlCacheInit)
 #define kgraphMapRb                 SCOTCH_NAME_INTERN (kgraphMapRb)
 #define kgraphMapRbMap              SCOTCH_NAME_INTERN (kgraphMapRbMap)
 #define kgraphMapRbBgraph           SCOTCH_NAME_INTERN (kgraphMapRbBgraph)
@@ -1051,6 +1081,7 @@
 #define vgraphSeparateBd            SCOTCH_NAME_INTERN (vgraphSeparateBd)
 #define vgraphSeparateDf            SCOTCH_NAME_INTERN (vgraphSeparateDf)
 #define vgraphSeparateEs            SCOTCH_NAME_INTERN (vgraphSeparateEs)
+#define vgraphSeparateEsCover       SCOTCH_NAME_INTERN (vgraphSeparateEsCover)
 #define vgraphSeparateFm            SCOTCH_NAME_INTERN (vgraphSeparateFm)
 #define vgraphSeparateGg            SCOTCH_NAME_INTERN (vgraphSeparateGg)
 #define vgraphSeparateGp            SCOTCH_NAME_INTERN (vgraphSeparateGp)
@@ -1119,6 +1150,7 @@
 #define SCOTCH_archMeshX            SCOTCH_NAME_PUBLIC (SCOTCH_archMeshX)
 #define SCOTCH_archName             SCOTCH_NAME_PUBLIC (SCOTCH_archName)
 #define SCOTCH_archSave             SCOTCH_NAME_PUBLIC (SCOTCH_archSave)
+#define SCOTCH_archSaveBin          SCOTCH_NAME_PUBLIC (SCOTCH_archSaveBin)
 #define SCOTCH_archSize             SCOTCH_NAME_PUBLIC (SCOTCH_archSize)
 #define SCOTCH_archSizeof           SCOTCH_NAME_PUBLIC (SCOTCH_archSizeof)
 #define SCOTCH_archSub              SCOTCH_NAME_PUBLIC (SCOTCH_archSub)
@@ -1172,6 +1204,7 @@
 #define SCOTCH_dgraphPart           SCOTCH_NAME_PUBLIC (SCOTCH_dgraphPart)
 #define SCOTCH_dgraphRedist         SCOTCH_NAME_PUBLIC (SCOTCH_dgraphRedist)
 #define SCOTCH_dgraphSave           SCOTCH_NAME_PUBLIC (SCOTCH_dgraphSave)
+#define SCOTCH_dgraphSaveBin        SCOTCH_NAME_PUBLIC (SCOTCH_dgraphSaveBin)
 #define SCOTCH_dgraphSizeof         SCOTCH_NAME_PUBLIC (SCOTCH_dgraphSizeof)
 #define SCOTCH_dgraphScatter        SCOTCH_NAME_PUBLIC (SCOTCH_dgraphScatter)
 #define SCOTCH_dgraphSize           SCOTCH_NAME_PUBLIC (SCOTCH_dgraphSize)
@@ -1197,10 +1230,12 @@
 #define SCOTCH_graphDiamPV          SCOTCH_NAME_PUBLIC (SCOTCH_graphDiamPV)
 #define SCOTCH_graphExit            SCOTCH_NAME_PUBLIC (SCOTCH_graphExit)
 #define SCOTCH_graphFree            SCOTCH_NAME_PUBLIC (SCOTCH_graphFree)
+#define SCOTCH_graphGeomLoadBin     SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomLoadBin)
 #define SCOTCH_graphGeomLoadChac    SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomLoadChac)
 #define SCOTCH_graphGeomLoadHabo    SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomLoadHabo)
 #define SCOTCH_graphGeomLoadMmkt    SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomLoadMmkt)
 #define SCOTCH_graphGeomLoadScot    SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomLoadScot)
+#define SCOTCH_graphGeomSaveBin     SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomSaveBin)
 #define SCOTCH_graphGeomSaveChac    SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomSaveChac)
 #define SCOTCH_graphGeomSaveMmkt    SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomSaveMmkt)
 #define SCOTCH_graphGeomSaveScot    SCOTCH_NAME_PUBLIC (SCOTCH_graphGeomSaveScot)
@@ -1216,6 +1251,8 @@
 #define SCOTCH_graphMapInit         SCOTCH_NAME_PUBLIC (SCOTCH_graphMapInit)
 #define SCOTCH_graphMapLoad         SCOTCH_NAME_PUBLIC (SCOTCH_graphMapLoad)
 #define SCOTCH_graphMapSave         SCOTCH_NAME_PUBLIC (SCOTCH_graphMapSave)
+#define SCOTCH_graphMapSessionInit  SCOTCH_NAME_PUBLIC (SCOTCH_graphMapSessionInit)
+#define SCOTCH_graphMapSessionReset SCOTCH_NAME_PUBLIC (SCOTCH_graphMapSessionReset)
 #define SCOTCH_graphMapView         SCOTCH_NAME_PUBLIC (SCOTCH_graphMapView)
 #define SCOTCH_graphMapViewRaw      SCOTCH_NAME_PUBLIC (SCOTCH_graphMapViewRaw)
 #define SCOTCH_graphOrder           SCOTCH_NAME_PUBLIC (SCOTCH_graphOrder)
@@ -45,6 +45,8 @@
 /**                                                        **/
 /**   DATES      : # Version 5.1  : from : 15 feb 2006     **/
 /**                                 to   : 30 jul 2010     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -62,6 +64,7 @@
 #include "vgraph.h"
 #include "vgraph_separate_st.h"
 #include "dgraph.h"
+#include "dgraph_sq.h"
 #include "vdgraph.h"
 #include "vdgraph_separate_sq.h"
 
@@ -109,6 +112,104 @@ const MPI_Datatype * const  typedat)              /* MPI datatype; not used
   }
 }
 
+/* This routine computes the quality criteria
+** of the given centralized separator, in the
+** order used by the reduction operator.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+vdgraphSeparateSqCost (
+const Vgraph * const        grafptr,              /*+ Centralized separator graph +*/
+Gnum * const                costtab)              /*+ Array of criteria to fill   +*/
+{
+  costtab[0] = ((grafptr->fronnbr != 0) || ((grafptr->compload[0] != 0) && (grafptr->compload[1] != 0)))
+               ? grafptr->fronnbr
+               : (grafptr->fronnbr + grafptr->s.vertnbr); /* Partitions with empty separators unwanted if they are completely unbalanced */
+  costtab[1] = grafptr->comploaddlt;
+}
+
+/* This routine runs the sequential strategy
+** on the given centralized graph, within the
+** given (sub-)context.
+** It returns:
+** - 0   : if the separator could be computed.
+** - !0  : on error.
+*/
+
+static
+int
+vdgraphSeparateSq3 (
+Vgraph * restrict const       grafptr,            /*+ Centralized separator graph +*/
+Context * const               contptr,            /*+ (Sub-)context               +*/
+const Strat * restrict const  stratptr)           /*+ Sequential strategy         +*/
+{
+  Context * const     contold = grafptr->contptr;
+  int                 o;
+
+  grafptr->contptr = contptr;                     /* Run strategy in sub-context */
+  o = vgraphSeparateSt (grafptr, stratptr);
+  grafptr->contptr = contold;
+
+  return (o);
+}
+
+/* This routine separates the centralized
+** graph. When the execution context holds
+** several threads, two runs of the sequential
+** strategy are performed concurrently, and
+** the best separator is kept.
+** It returns:
+** - 0   : if the separator could be computed.
+** - !0  : on error.
+*/
+
+static
+int
+vdgraphSeparateSq2 (
+Vgraph * restrict const       grafptr,            /*+ Centralized separator graph +*/
+const Strat * restrict const  stratptr)           /*+ Sequential strategy         +*/
+{
+#ifndef VDGRAPHSEPARATESQNOTHREAD
+  if (contextThreadNbr (grafptr->contptr) > 1) {  /* If two runs can be performed concurrently */
+    VgraphStore             savedat;              /* Save area hosting separator arrays of second run */
+    Vgraph                  seltgrafdat;          /* Graph for second run                             */
+    int                     o;
+
+    if (vgraphStoreInit (grafptr, &savedat) != 0) {
+      errorPrint ("vdgraphSeparateSq2: out of memory");
+      return     (1);
+    }
+
+    seltgrafdat         = *grafptr;               /* Share graph structure but not separator data */
+    seltgrafdat.frontab = (Gnum *) savedat.datatab;
+    seltgrafdat.parttax = (GraphPart *) (seltgrafdat.frontab + grafptr->s.vertnbr) - grafptr->s.baseval;
+    memCpy (seltgrafdat.frontab, grafptr->frontab, grafptr->fronnbr * sizeof (Gnum));
+    memCpy (seltgrafdat.parttax + grafptr->s.baseval, grafptr->parttax + grafptr->s.baseval, grafptr->s.vertnbr * sizeof (GraphPart));
+
+    o = dgraphSqBest (grafptr->contptr, grafptr, &seltgrafdat, (DgraphSqFunc) vdgraphSeparateSq3, (DgraphSqCost) vdgraphSeparateSqCost, stratptr);
+    if (o == 1) {                                 /* If second result is better, copy it back */
+      grafptr->compload[0] = seltgrafdat.compload[0];
+      grafptr->compload[1] = seltgrafdat.compload[1];
+      grafptr->compload[2] = seltgrafdat.compload[2];
+      grafptr->comploaddlt = seltgrafdat.comploaddlt;
+      grafptr->compsize[0] = seltgrafdat.compsize[0];
+      grafptr->compsize[1] = seltgrafdat.compsize[1];
+      grafptr->fronnbr     = seltgrafdat.fronnbr;
+      memCpy (grafptr->frontab, seltgrafdat.frontab, seltgrafdat.fronnbr * sizeof (Gnum));
+      memCpy (grafptr->parttax + grafptr->s.baseval, seltgrafdat.parttax + grafptr->s.baseval, grafptr->s.vertnbr * sizeof (GraphPart));
+    }
+
+    vgraphStoreExit (&savedat);
+    return ((o == 2) ? 1 : 0);
+  }
+#endif /* VDGRAPHSEPARATESQNOTHREAD */
+
+  return (vgraphSeparateSt (grafptr, stratptr));
+}
+
 /* This routine computes a partition of the
 ** given distributed graph by gathering as many
 ** copies of the graph as there are processes
@@ -160,16 +261,12 @@ const VdgraphSeparateSqParam * const  paraptr)    /*+ Method parameters +*/
     return     (1);
   }
 
-  if (vgraphSeparateSt (&cgrfdat, paraptr->strat) != 0) { /* Separate centralized graph */
+  if (vdgraphSeparateSq2 (&cgrfdat, paraptr->strat) != 0) { /* Separate centralized graph */
     errorPrint ("vdgraphSeparateSq: cannot separate centralized graph");
     reduloctab[3] = 1;
   }
-  else {                                          /* Fill local array with local separator data */
-    reduloctab[0] = ((cgrfdat.fronnbr != 0) || ((cgrfdat.compload[0] != 0) && (cgrfdat.compload[1] != 0)))
-                    ? cgrfdat.fronnbr
-                    : (cgrfdat.fronnbr + cgrfdat.s.vertnbr); /* Partitions with empty separators unwanted if they are completely unbalanced */
-    reduloctab[1] = cgrfdat.comploaddlt;
-  }
+  else                                            /* Fill local array with local separator data */
+    vdgraphSeparateSqCost (&cgrfdat, reduloctab);
 
   if (MPI_Allreduce (reduloctab, reduglbtab, 1, besttypedat, bestoperdat, dgrfptr->s.proccomm) != MPI_SUCCESS) {
     errorPrint ("vdgraphSeparateSq: communication error (2)");
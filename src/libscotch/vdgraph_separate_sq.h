@@ -43,6 +43,8 @@
 /**                                 to   : 01 mar 2006     **/
 /**                # Version 6.0  : from : 06 jun 2018     **/
 /**                                 to   : 06 jun 2018     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -62,6 +64,9 @@ typedef struct VdgraphSeparateSqParam_ {
 
 #ifdef VDGRAPH_SEPARATE_SQ
 static void                 vdgraphSeparateSqOpBest (const Gnum * const, Gnum * const, const int * const, const MPI_Datatype * const);
+static void                 vdgraphSeparateSqCost (const Vgraph * const, Gnum * const);
+static int                  vdgraphSeparateSq2  (Vgraph * const, const Strat * const);
+static int                  vdgraphSeparateSq3  (Vgraph * const, Context * const, const Strat * const);
 #endif /* VDGRAPH_SEPARATE_SQ */
 
 int                         vdgraphSeparateSq   (Vdgraph * const, const VdgraphSeparateSqParam * const);
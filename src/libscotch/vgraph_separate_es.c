@@ -52,6 +52,8 @@
 /**                                 to   : 09 nov 2008     **/
 /**                # Version 6.1  : from : 01 nov 2021     **/
 /**                                 to   : 01 nov 2021     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /**   NOTES      : # This algorithm comes from:            **/
 /**                  "Computing the Block Triangular form  **/
@@ -110,12 +112,14 @@
 /* This routine computes a vertex separator
 ** from an edge separator represented as a
 ** bipartite graph, by minimum covering.
+** The bipartite graph must be based from 0,
+** its first partnbr vertices being the column
+** vertices and the remaining ones the rows.
 ** It returns:
 ** - 0   : if a separator could be computed.
 ** - !0  : on error.
 */
 
-static
 int
 vgraphSeparateEsCover (
 const Graph * restrict const  grafptr,            /* Bipartite graph to cover         */
@@ -129,6 +133,7 @@ Gnum * const                  sepaptr)            /* Pointer to size of the arra
   Gnum                            listnbr;        /* Number of items in list           */
   Gnum * restrict                 matetax;        /* Matching array                    */
   Gnum *                          queutab;        /* Queue of (free) column nodes      */
+  Gnum * restrict                 stactab;        /* Stack of augmenting path vertices */
   Gnum * restrict                 queuhead;       /* Head of queue                     */
   Gnum * restrict                 queutail;       /* Tail of queue                     */
   VgraphSeparateEsTrav * restrict travtax;        /* Array of traversal flag values    */
@@ -152,9 +157,10 @@ Gnum * const                  sepaptr)            /* Pointer to size of the arra
     return     (1);
   }
   if (memAllocGroup ((void **) (void *)
-                     &queutab, (size_t) (partnbr          * sizeof (Gnum)),
+                     &queutab, (size_t) (grafptr->vertnbr * sizeof (Gnum)), /* Also used by covering traversals */
                      &levltax, (size_t) (grafptr->vertnbr * sizeof (Gnum)),
-                     &listtab, (size_t) (grafptr->vertnbr * sizeof (Gnum)), NULL) == NULL) {
+                     &listtab, (size_t) (grafptr->vertnbr * sizeof (Gnum)),
+                     &stactab, (size_t) ((partnbr + 1) * 2 * sizeof (Gnum)), NULL) == NULL) {
     errorPrint ("vgraphSeparateEsCover: out of memory (2)");
     memFree    (travtax);                         /* Not based yet */
     return     (1);
@@ -163,33 +169,48 @@ Gnum * const                  sepaptr)            /* Pointer to size of the arra
   matetax -= grafptr->baseval;
   levltax -= grafptr->baseval;
 
-  memSet (matetax + (partnbr + grafptr->baseval), ~0, (grafptr->vertnbr - partnbr) * sizeof (Gnum));
-  for (vertnum = grafptr->baseval;                /* Compute a cheap matching */
+  memSet (matetax + grafptr->baseval, ~0, grafptr->vertnbr * sizeof (Gnum));
+  for (vertnum = partnbr + grafptr->baseval;      /* Match first rows linked to a single column, as this can never harm */
+       vertnum < grafptr->vertnnd; vertnum ++) {
+    Gnum              edgenum;
+
+    edgenum = grafptr->verttax[vertnum];
+    if ((grafptr->vendtax[vertnum] - edgenum) == 1) { /* If row has only one neighbor */
+      Gnum              vertend;
+
+      vertend = grafptr->edgetax[edgenum];
+      if (matetax[vertend] == ~0) {               /* If column not already matched */
+        matetax[vertend] = vertnum;
+        matetax[vertnum] = vertend;
+      }
+    }
+  }
+  for (vertnum = grafptr->baseval;                /* Complete with a cheap matching */
        vertnum < (partnbr + grafptr->baseval); vertnum ++) {
     Gnum              edgenum;
-    Gnum              matenum;
 
-    for (edgenum = grafptr->verttax[vertnum], matenum = ~0; /* Search a matching end vertex */
+    if (matetax[vertnum] != ~0)                   /* If column already matched */
+      continue;
+
+    for (edgenum = grafptr->verttax[vertnum];     /* Search a matching end vertex */
          edgenum < grafptr->vendtax[vertnum]; edgenum ++) {
       Gnum              vertend;
 
       vertend = grafptr->edgetax[edgenum];
       if (matetax[vertend] == ~0) {               /* If an unmatched end vertex is found */
-        matenum          = vertend;
         matetax[vertend] = vertnum;
+        matetax[vertnum] = vertend;
         break;
       }
     }
-    matetax[vertnum] = matenum;
   }
 
   do {                                            /* Matching augmentation loop */
     queuhead =                                    /* Flush the data structures  */
     queutail = queutab;
     listnbr  = 0;
-    memSet (levltax + grafptr->baseval, 0, grafptr->vertnbr * sizeof (Gnum));
-    memSet (travtax + grafptr->baseval, 0, grafptr->vertnbr * sizeof (VgraphSeparateEsTrav));
-    levlmax = ~0;
+    memSet (travtax + grafptr->baseval, 0, grafptr->vertnbr * sizeof (VgraphSeparateEsTrav)); /* Levels need not be reset, as only read for reached columns */
+    levlmax = GNUMMAX;                            /* No free row reached yet */
 
     for (vertnum = grafptr->baseval;              /* Enqueue unmatched column nodes */
          vertnum < (partnbr + grafptr->baseval); vertnum ++) {
@@ -203,7 +224,7 @@ Gnum * const                  sepaptr)            /* Pointer to size of the arra
       Gnum              vertcol;
 
       vertcol = *queutail ++;                     /* Get the free column vertex */
-      if (levltax[vertcol] < levlmax) {
+      if (levltax[vertcol] <= levlmax) {
         Gnum              edgenum;
 
         travtax[vertcol] = VGRAPHSEPAESTRAVUSED;  /* Column has been reached */
@@ -232,11 +253,10 @@ Gnum * const                  sepaptr)            /* Pointer to size of the arra
       break;                                      /* Then the matching is maximal     */
 
     while (-- listnbr >= 0)                       /* For all rows in list, try to augment the matching */
-      vgraphSeparateEsCoverAugment (levltax, levlmax, matetax, travtax, grafptr->verttax, grafptr->vendtax, grafptr->edgetax, listtab[listnbr]);
+      vgraphSeparateEsCoverAugment (levltax, levlmax, matetax, travtax, grafptr->verttax, grafptr->vendtax, grafptr->edgetax, stactab, listtab[listnbr]);
   } while (1);
 
-  memFree (queutab);                              /* Free group leader of arrays no longer in use */
-  typetax = (VgraphSeparateEsType *) travtax;     /* TRICK: re-use traversal table as type table  */
+  typetax = (VgraphSeparateEsType *) travtax;     /* TRICK: re-use traversal table as type table */
 
   for (vertnum = grafptr->baseval; vertnum < (partnbr + grafptr->baseval); vertnum ++) /* Pre-set vertex types */
     typetax[vertnum] = VGRAPHSEPAESTYPESC;
@@ -244,10 +264,12 @@ Gnum * const                  sepaptr)            /* Pointer to size of the arra
     typetax[vertnum] = VGRAPHSEPAESTYPESR;
   for (vertnum = grafptr->baseval; vertnum < (partnbr + grafptr->baseval); vertnum ++) /* For all column vertices */
     if (matetax[vertnum] == ~0)                   /* If vertex is unmatched */
-      vgraphSeparateEsCoverCol (matetax, typetax, grafptr->verttax, grafptr->vendtax, grafptr->edgetax, vertnum); /* Find HC and HR */
+      vgraphSeparateEsCoverCol (matetax, typetax, grafptr->verttax, grafptr->vendtax, grafptr->edgetax, queutab, vertnum); /* Find HC and HR */
   for ( ; vertnum < grafptr->vertnnd; vertnum ++) /* For all row vertices   */
     if (matetax[vertnum] == ~0)                   /* If vertex is unmatched */
-      vgraphSeparateEsCoverRow (matetax, typetax, grafptr->verttax, grafptr->vendtax, grafptr->edgetax, vertnum); /* Find VC and VR */
+      vgraphSeparateEsCoverRow (matetax, typetax, grafptr->verttax, grafptr->vendtax, grafptr->edgetax, queutab, vertnum); /* Find VC and VR */
+
+  memFree (queutab);                              /* Free group leader of arrays no longer in use */
 
   sizecval =                                      /* Reset sizes */
   sizerval = 0;
@@ -350,6 +372,12 @@ Gnum * const                  sepaptr)            /* Pointer to size of the arra
 ** by performing a backtracking depth-first
 ** search from a free row vertex to a free
 ** column vertex, guided by the level values.
+** The search is iterative, so that very long
+** augmenting paths, as found in large frontiers,
+** cannot overflow the system stack. The stack
+** array must hold (levlmax * 2) values, that is,
+** a row vertex and the index of the edge being
+** followed for every level.
 ** It returns:
 ** - 0   : backtracking succeeded.
 ** - !0  : could not find a valid return path.
@@ -359,43 +387,72 @@ static
 int
 vgraphSeparateEsCoverAugment (
 const Gnum * restrict const           levltax,
-const Gnum                            levlcur,    /* Current backtracking level */
+const Gnum                            levlmax,    /* Level of row to backtrack from */
 Gnum * restrict const                 matetax,
 VgraphSeparateEsTrav * restrict const travtax,
 const Gnum * restrict const           verttax,
 const Gnum * restrict const           vendtax,
 const Gnum * restrict const           edgetax,
-const Gnum                            vertrow)    /* Row vertex to backtrack from */
+Gnum * restrict const                 stactab,    /* Stack of row vertices and edge indices */
+const Gnum                            vertrow)    /* Row vertex to backtrack from           */
 {
-  Gnum                edgenum;
+  Gnum                stacnum;                    /* Current stack level */
 
   travtax[vertrow] = VGRAPHSEPAESTRAVDRTY;        /* Never re-use this row */
+  stactab[0] = vertrow;
+  stactab[1] = verttax[vertrow];
 
-  for (edgenum = verttax[vertrow]; edgenum < vendtax[vertrow]; edgenum ++) {
+  for (stacnum = 0; stacnum >= 0; ) {
+    Gnum                vertcur;
+    Gnum                levlcur;
+    Gnum                edgenum;
     Gnum                vertcol;
 
-    vertcol = edgetax[edgenum];                   /* Get column vertex                                     */
-    if ((travtax[vertcol] == VGRAPHSEPAESTRAVUSED) && /* If this column may be a backtracking path         */
-        (levltax[vertcol] == levlcur)) {          /* At the proper distance from a free column             */
-      travtax[vertcol] = VGRAPHSEPAESTRAVDRTY;    /* Never re-use this column                              */
-      if ((levlcur == 1) ||                       /* If we have (recursively) reached a free column vertex */
-          (vgraphSeparateEsCoverAugment (levltax, levlcur - 1, matetax, travtax, verttax, vendtax, edgetax, matetax[vertcol]) == 0)) {
-        matetax[vertcol] = vertrow;               /* Switch the edges of the augmenting path */
-        matetax[vertrow] = vertcol;
-        return (0);                               /* Backtracking process is under way */
+    vertcur = stactab[2 * stacnum];
+    levlcur = levlmax - stacnum;                  /* Level decreases by one at every stack level */
+    for (edgenum = stactab[2 * stacnum + 1], vertcol = ~0;
+         edgenum < vendtax[vertcur]; edgenum ++) {
+      vertcol = edgetax[edgenum];                 /* Get column vertex                             */
+      if ((travtax[vertcol] == VGRAPHSEPAESTRAVUSED) && /* If this column may be a backtracking path */
+          (levltax[vertcol] == levlcur))          /* At the proper distance from a free column     */
+        break;
+    }
+    if (edgenum >= vendtax[vertcur]) {            /* If no path can be found from this row   */
+      if (-- stacnum >= 0)                        /* Backtrack and skip edge that led to it  */
+        stactab[2 * stacnum + 1] ++;
+      continue;
+    }
+
+    travtax[vertcol] = VGRAPHSEPAESTRAVDRTY;      /* Never re-use this column */
+    stactab[2 * stacnum + 1] = edgenum;           /* Record edge being followed */
+
+    if (levlcur == 1) {                           /* If we have reached a free column vertex */
+      for ( ; stacnum >= 0; stacnum --) {         /* Switch the edges of the augmenting path */
+        vertcur = stactab[2 * stacnum];
+        vertcol = edgetax[stactab[2 * stacnum + 1]];
+        matetax[vertcol] = vertcur;
+        matetax[vertcur] = vertcol;
       }
+      return (0);
     }
+
+    vertcur = matetax[vertcol];                   /* Proceed with row matched to column */
+    travtax[vertcur] = VGRAPHSEPAESTRAVDRTY;      /* Never re-use this row              */
+    stacnum ++;
+    stactab[2 * stacnum]     = vertcur;
+    stactab[2 * stacnum + 1] = verttax[vertcur];
   }
 
   return (1);                                     /* No improvement could be done */
 }
 
 /* Starting from unmatched column and row vertices,
-** these routines perform depth-first traversals of
-** the bipartite graph, following alternating paths.
-** It is assumed that the matchings are sufficently
-** large, so that the depth of the trees is small
-** and the stack will not overflow.
+** these routines perform breadth-first traversals
+** of the bipartite graph, following alternating
+** paths. Traversals are iterative, so that they
+** can handle frontiers of any size. The queue
+** array must be able to hold all the column
+** (respectively, row) vertices of the graph.
 ** They return:
 ** - VOID  : in all cases.
 */
@@ -408,24 +465,37 @@ VgraphSeparateEsType * restrict const typetax,
 const Gnum * restrict const           verttax,
 const Gnum * restrict const           vendtax,
 const Gnum * restrict const           edgetax,
-const Gnum                            vertcol)    /* Column vertex index */
+Gnum * restrict const                 queutab,    /* Queue of column vertices */
+const Gnum                            vertcol)    /* Column vertex index      */
 {
-  Gnum              edgenum;
+  Gnum              queuhead;
+  Gnum              queutail;
 
   if (typetax[vertcol] == VGRAPHSEPAESTYPEHC)     /* If vertex already traversed */
     return;
 
   typetax[vertcol] = VGRAPHSEPAESTYPEHC;
+  queutab[0] = vertcol;
+  for (queuhead = 1, queutail = 0; queutail < queuhead; queutail ++) {
+    Gnum              vertcur;
+    Gnum              edgenum;
 
-  for (edgenum = verttax[vertcol]; edgenum < vendtax[vertcol]; edgenum ++) {
-    Gnum              vertrow;
+    vertcur = queutab[queutail];
+    for (edgenum = verttax[vertcur]; edgenum < vendtax[vertcur]; edgenum ++) {
+      Gnum              vertrow;
+      Gnum              vertend;
 
-    vertrow = edgetax[edgenum];
-    if (typetax[vertrow] == VGRAPHSEPAESTYPEHR)   /* If end vertex already traversed */
-      continue;                                   /* Skip to next vertex             */
-    typetax[vertrow] = VGRAPHSEPAESTYPEHR;
-    if (matetax[vertrow] != ~0)                   /* If end vertex matched */
-      vgraphSeparateEsCoverCol (matetax, typetax, verttax, vendtax, edgetax, matetax[vertrow]);
+      vertrow = edgetax[edgenum];
+      if (typetax[vertrow] == VGRAPHSEPAESTYPEHR) /* If end vertex already traversed */
+        continue;                                 /* Skip to next vertex             */
+      typetax[vertrow] = VGRAPHSEPAESTYPEHR;
+      vertend = matetax[vertrow];
+      if ((vertend != ~0) &&                      /* If end vertex matched and its mate not yet traversed */
+          (typetax[vertend] != VGRAPHSEPAESTYPEHC)) {
+        typetax[vertend] = VGRAPHSEPAESTYPEHC;
+        queutab[queuhead ++] = vertend;
+      }
+    }
   }
 }
 
@@ -437,24 +507,37 @@ VgraphSeparateEsType * restrict const typetax,
 const Gnum * restrict const           verttax,
 const Gnum * restrict const           vendtax,
 const Gnum * restrict const           edgetax,
-const Gnum                            vertrow)    /* Row vertex index */
+Gnum * restrict const                 queutab,    /* Queue of row vertices */
+const Gnum                            vertrow)    /* Row vertex index      */
 {
-  Gnum              edgenum;
+  Gnum              queuhead;
+  Gnum              queutail;
 
   if (typetax[vertrow] == VGRAPHSEPAESTYPEVR)     /* If vertex already traversed */
     return;
 
   typetax[vertrow] = VGRAPHSEPAESTYPEVR;
+  queutab[0] = vertrow;
+  for (queuhead = 1, queutail = 0; queutail < queuhead; queutail ++) {
+    Gnum              vertcur;
+    Gnum              edgenum;
 
-  for (edgenum = verttax[vertrow]; edgenum < vendtax[vertrow]; edgenum ++) {
-    Gnum              vertcol;
+    vertcur = queutab[queutail];
+    for (edgenum = verttax[vertcur]; edgenum < vendtax[vertcur]; edgenum ++) {
+      Gnum              vertcol;
+      Gnum              vertend;
 
-    vertcol = edgetax[edgenum];
-    if (typetax[vertcol] == VGRAPHSEPAESTYPEVC)   /* If end vertex already traversed */
-      continue;                                   /* Skip to next vertex             */
-    typetax[vertcol] = VGRAPHSEPAESTYPEVC;
-    if (matetax[vertcol] != ~0)                   /* If end vertex matched */
-      vgraphSeparateEsCoverRow (matetax, typetax, verttax, vendtax, edgetax, matetax[vertcol]);
+      vertcol = edgetax[edgenum];
+      if (typetax[vertcol] == VGRAPHSEPAESTYPEVC) /* If end vertex already traversed */
+        continue;                                 /* Skip to next vertex             */
+      typetax[vertcol] = VGRAPHSEPAESTYPEVC;
+      vertend = matetax[vertcol];
+      if ((vertend != ~0) &&                      /* If end vertex matched and its mate not yet traversed */
+          (typetax[vertend] != VGRAPHSEPAESTYPEVR)) {
+        typetax[vertend] = VGRAPHSEPAESTYPEVR;
+        queutab[queuhead ++] = vertend;
+      }
+    }
   }
 }
 
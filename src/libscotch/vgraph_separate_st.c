@@ -51,6 +51,8 @@
 /**                                 to   : 01 jul 2008     **/
 /**                # Version 6.0  : from : 09 mar 2011     **/
 /**                                 to   : 01 may 2014     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -218,6 +220,34 @@ StratTab                    vgraphseparateststratab = { /* Strategy tables for v
                               vgraphseparatestparatab,
                               vgraphseparatestcondtab };
 
+/***************************/
+/*                         */
+/* Multi-threaded routine. */
+/*                         */
+/***************************/
+
+/* This routine applies one of the two
+** strategies of a selection node, within
+** its own sub-context.
+** It returns:
+** - void  : in all cases.
+*/
+
+static
+void
+vgraphSeparateSt2 (
+Context * restrict const              contptr,    /*+ (Sub-)context                          +*/
+const int                             spltnum,    /*+ Rank of sub-context in initial context +*/
+VgraphSeparateStSplit * restrict const spltptr)
+{
+  Vgraph * restrict const   grafptr = spltptr->splttab[spltnum].grafptr;
+  Context * const           contold = grafptr->contptr;
+
+  grafptr->contptr = contptr;                     /* Run strategy in sub-context */
+  spltptr->splttab[spltnum].o = vgraphSeparateSt (grafptr, spltptr->splttab[spltnum].stratptr);
+  grafptr->contptr = contold;
+}
+
 /*******************************************/
 /*                                         */
 /* This is the generic separation routine. */
@@ -300,6 +330,47 @@ const Strat * restrict const  strat)              /*+ Separation strategy +*/
       }
 
       vgraphStoreSave (grafptr, &savetab[1]);     /* Save initial bipartition                              */
+#ifndef VGRAPHSEPARATESTNOTHREAD
+      if (contextThreadNbr (grafptr->contptr) > 1) { /* If both strategies can be run concurrently */
+        VgraphSeparateStSplit spltdat;
+        Vgraph              seltgrafdat;          /* Graph for second strategy, using first save area as its arrays */
+
+        seltgrafdat         = *grafptr;           /* Share graph structure but not separator data */
+        seltgrafdat.frontab = (Gnum *) savetab[0].datatab;
+        seltgrafdat.parttax = (GraphPart *) (seltgrafdat.frontab + grafptr->s.vertnbr) - grafptr->s.baseval;
+        memCpy (seltgrafdat.frontab, grafptr->frontab, grafptr->fronnbr * sizeof (Gnum));
+        memCpy (seltgrafdat.parttax + grafptr->s.baseval, grafptr->parttax + grafptr->s.baseval, grafptr->s.vertnbr * sizeof (GraphPart));
+
+        spltdat.splttab[0].grafptr  = grafptr;
+        spltdat.splttab[0].stratptr = strat->data.select.strat[0];
+        spltdat.splttab[1].grafptr  = &seltgrafdat;
+        spltdat.splttab[1].stratptr = strat->data.select.strat[1];
+        if (contextThreadLaunchSplit (grafptr->contptr, (ContextSplitFunc) vgraphSeparateSt2, &spltdat) == 0) {
+          if (spltdat.splttab[0].o != 0)          /* If first strategy didn't work */
+            vgraphStoreUpdt (grafptr, &savetab[1]); /* Restore initial bipartition as its result */
+          if (spltdat.splttab[1].o != 0)          /* If second strategy didn't work */
+            vgraphStoreUpdt (&seltgrafdat, &savetab[1]);
+
+          if ((seltgrafdat.compload[2] < grafptr->compload[2]) || /* If first strategy is not better, keep second result */
+              ((seltgrafdat.compload[2] == grafptr->compload[2]) &&
+               (abs (seltgrafdat.comploaddlt) <= abs (grafptr->comploaddlt)))) {
+            grafptr->compload[0] = seltgrafdat.compload[0];
+            grafptr->compload[1] = seltgrafdat.compload[1];
+            grafptr->compload[2] = seltgrafdat.compload[2];
+            grafptr->comploaddlt = seltgrafdat.comploaddlt;
+            grafptr->compsize[0] = seltgrafdat.compsize[0];
+            grafptr->compsize[1] = seltgrafdat.compsize[1];
+            grafptr->fronnbr     = seltgrafdat.fronnbr;
+            memCpy (grafptr->frontab, seltgrafdat.frontab, seltgrafdat.fronnbr * sizeof (Gnum));
+            memCpy (grafptr->parttax + grafptr->s.baseval, seltgrafdat.parttax + grafptr->s.baseval, grafptr->s.vertnbr * sizeof (GraphPart));
+          }
+
+          vgraphStoreExit (&savetab[0]);          /* Free both save areas */
+          vgraphStoreExit (&savetab[1]);
+          break;
+        }
+      }
+#endif /* VGRAPHSEPARATESTNOTHREAD */
       if (vgraphSeparateSt (grafptr, strat->data.select.strat[0]) != 0) { /* If first strategy didn't work */
         vgraphStoreUpdt (grafptr, &savetab[1]);   /* Restore initial bipartition                           */
         vgraphStoreSave (grafptr, &savetab[0]);   /* Save it as result                                     */
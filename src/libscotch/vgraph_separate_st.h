@@ -51,6 +51,8 @@
 /**                                 to   : 30 oct 2007     **/
 /**                # Version 6.0  : from : 30 apr 2018     **/
 /**                                 to   : 30 apr 2018     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -72,6 +74,20 @@ typedef enum VgraphSeparateStMethodType_ {
   VGRAPHSEPASTMETHNBR                             /*+ Number of methods        +*/
 } VgraphSeparateStMethodType;
 
+/*+ This structure holds the splitting
+    parameters for the concurrent
+    evaluation of selection nodes.     +*/
+
+typedef struct VgraphSeparateStSplit2_ {
+  Vgraph *                  grafptr;              /*+ Graph to separate        +*/
+  const Strat *             stratptr;             /*+ Strategy to apply to it  +*/
+  int                       o;                    /*+ Return value of strategy +*/
+} VgraphSeparateStSplit2;
+
+typedef struct VgraphSeparateStSplit_ {
+  VgraphSeparateStSplit2    splttab[2];           /*+ Array of strategy data +*/
+} VgraphSeparateStSplit;
+
 /*
 **  The external declarations.
 */
@@ -82,4 +98,8 @@ extern StratTab             vgraphseparateststratab;
 **  The function prototypes.
 */
 
+#ifdef VGRAPH_SEPARATE_ST
+static void                 vgraphSeparateSt2   (Context * restrict const, const int, VgraphSeparateStSplit * const);
+#endif /* VGRAPH_SEPARATE_ST */
+
 int                         vgraphSeparateSt    (Vgraph * const, const Strat * const);
@@ -311,7 +311,7 @@ const WgraphPartRbSplit * const spltptr)
     actgrafdat.s.vlbltax  = NULL;                 /* Vertex labels are no use           */
   }
   else {                                          /* If not the case, build induced subgraph */
-    if (graphInducePart (orggrafptr, orgparttax, indvertnbr, indpartval, &actgrafdat.s) != 0) {
+    if (graphInducePart (orggrafptr, orgparttax, indvertnbr, indpartval, &actgrafdat.s, contptr) != 0) {
       errorPrint ("wgraphPartRb2: cannot induce graph");
       goto abort;
     }
@@ -57,6 +57,8 @@
 /**                                 to   : 14 feb 2011     **/
 /**                # Version 6.0  : from : 01 jan 2012     **/
 /**                                 to   : 24 sep 2019     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -82,6 +84,7 @@ static File                 C_fileTab[C_FILENBR] = { /* File array
 
 static const char *         C_usageList[] = {
   "acpl [<input target file> [<output target file>]] <options>",
+  "  -b  : Write compiled architecture in binary form",
   "  -h  : Display this help",
   "  -V  : Print program version and copyright",
   NULL };
@@ -98,6 +101,7 @@ int                         argc,
 char *                      argv[])
 {
   SCOTCH_Arch         arch;                       /* Architecture read and written */
+  int                 flagval;                    /* Process flags                 */
   int                 i;
 
   errorProg ("acpl");
@@ -107,6 +111,7 @@ char *                      argv[])
     return     (EXIT_SUCCESS);
   }
 
+  flagval = C_FLAGNONE;
   fileBlockInit (C_fileTab, C_FILENBR);           /* Set default stream pointers */
 
   for (i = 1; i < argc; i ++) {                   /* Loop for all option codes                        */
@@ -118,6 +123,10 @@ char *                      argv[])
     }
     else {                                        /* If found an option name */
       switch (argv[i][1]) {
+        case 'B' :                                /* Binary output */
+        case 'b' :
+          flagval |= C_FLAGBINOUT;
+          break;
         case 'H' :                                /* Give the usage message */
         case 'h' :
           usagePrint (stdout, C_usageList);
@@ -140,7 +149,10 @@ char *                      argv[])
   if (strcmp (SCOTCH_archName (&arch), "deco") != 0) /* If not a decomposition         */
     errorPrint ("main: architecture is not decomposition-defined");
 
-  SCOTCH_archSave (&arch, C_filepntrtgtout);      /* Save the compiled architecture */
+  if ((flagval & C_FLAGBINOUT) != 0)
+    SCOTCH_archSaveBin (&arch, C_filepntrtgtout); /* Save the compiled architecture in binary form */
+  else
+    SCOTCH_archSave (&arch, C_filepntrtgtout);    /* Save the compiled architecture */
 
   fileBlockClose (C_fileTab, C_FILENBR);          /* Always close explicitely to end eventual (un)compression tasks */
 
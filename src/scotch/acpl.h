@@ -49,6 +49,8 @@
 /**                                 to   : 02 oct 1998     **/
 /**                # Version 6.0  : from : 12 nov 2014     **/
 /**                                 to   : 12 nov 2014     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -66,3 +68,9 @@
 
 #define C_filepntrtgtinp            fileBlockFile (C_fileTab, 0) /* Target architecture input file  */
 #define C_filepntrtgtout            fileBlockFile (C_fileTab, 1) /* Target architecture output file */
+
+/*+ Process flags. +*/
+
+#define C_FLAGBINOUT                0x0001        /* Binary output */
+
+#define C_FLAGNONE                  0x0000        /* Default flags */
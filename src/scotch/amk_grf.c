@@ -56,6 +56,8 @@
 /**                                 to   : 17 jul 2011     **/
 /**                # Version 6.0  : from : 01 jan 2012     **/
 /**                                 to   : 24 sep 2019     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -84,6 +86,7 @@ static const char *         C_usageList[] = {     /* Usage */
   "amk_grf [<input source file> [<output target file>]] <options>",
   "  -2         : Create a 'deco 2' instead of a 'deco 0' architecture",
   "  -b<strat>  : Apply bipartitioning strategy <strat> (for 'deco 0' architectures)",
+  "  -c         : Write compiled architecture in binary form (for 'deco 0' architectures)",
   "  -h         : Display this help",
   "  -l<file>   : Load vertex list from <file>",
   "  -V         : Print program version and copyright",
@@ -145,6 +148,10 @@ char *                      argv[])
           if ((SCOTCH_stratGraphBipart (&bipastrat, &argv[i][2])) != 0)
             errorPrint ("main: invalid bipartitioning strategy");
           break;
+        case 'C' :                                /* Binary output */
+        case 'c' :
+          flagval |= C_FLAGBINOUT;
+          break;
         case 'H' :                                /* Give the usage message */
         case 'h' :
           usagePrint (stdout, C_usageList);
@@ -226,7 +233,10 @@ char *                      argv[])
     SCOTCH_archBuild2 (&archdat, &grafdat, listnbr, listtab); /* Compute type-2 architecture */
   else
     SCOTCH_archBuild0 (&archdat, &grafdat, listnbr, listtab, &bipastrat); /* Compute type-0 architecture */
-  SCOTCH_archSave  (&archdat, C_filepntrtgtout);  /* Write target architecture                           */
+  if ((flagval & C_FLAGBINOUT) != 0)
+    SCOTCH_archSaveBin (&archdat, C_filepntrtgtout); /* Write target architecture in binary form, if possible */
+  else
+    SCOTCH_archSave (&archdat, C_filepntrtgtout); /* Write target architecture */
 
   fileBlockClose (C_fileTab, C_FILENBR);          /* Always close explicitely to end potential (un)compression tasks */
 
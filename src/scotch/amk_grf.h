@@ -51,6 +51,8 @@
 /**                                 to   : 17 jul 2011     **/
 /**                # Version 6.0  : from : 12 nov 2014     **/
 /**                                 to   : 11 feb 2018     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -75,6 +77,7 @@
 
 #define C_FLAGVRTINP              0x0001         /* Input vertex list   */
 #define C_FLAGDECO2               0x0002         /* Type-2 architecture */
+#define C_FLAGBINOUT              0x0004         /* Binary output       */
 
 #define C_FLAGNONE                0x0000          /* Default flags */
 
@@ -46,7 +46,7 @@
 /**                # Version 6.0  : from : 01 jan 2012     **/
 /**                                 to   : 17 apr 2019     **/
 /**                # Version 7.0  : from : 03 sep 2020     **/
-/**                                 to   : 24 oct 2021     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -392,10 +392,12 @@ char *                      argv[])
   if (((straval != 0) || ((flagval & C_FLAGKBALVAL) != 0)) && (straptr != NULL))
     errorPrint ("main: options '-b' / '-c' and '-m' are exclusive");
 
-  if ((flagval & C_FLAGCLUSTER) != 0)             /* If clustering wanted */
-    SCOTCH_stratDgraphClusterBuild (&stradat, straval, (SCOTCH_Num) procglbnbr, (SCOTCH_Num) C_partNbr, 1.0, kbalval);
-  else
-    SCOTCH_stratDgraphMapBuild (&stradat, straval, (SCOTCH_Num) procglbnbr, (SCOTCH_Num) C_partNbr, kbalval);
+  if (straptr == NULL) {                          /* If no user-provided strategy */
+    if ((flagval & C_FLAGCLUSTER) != 0)           /* If clustering wanted         */
+      SCOTCH_stratDgraphClusterBuild (&stradat, straval, (SCOTCH_Num) procglbnbr, (SCOTCH_Num) C_partNbr, 1.0, kbalval);
+    else
+      SCOTCH_stratDgraphMapBuild (&stradat, straval, (SCOTCH_Num) procglbnbr, (SCOTCH_Num) C_partNbr, kbalval);
+  }
 
   SCOTCH_contextBindDgraph (&contdat, &grafdat, &cogrdat);
 
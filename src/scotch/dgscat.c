@@ -47,7 +47,7 @@
 /**                # Version 6.0  : from : 01 jan 2012     **/
 /**                                 to   : 17 apr 2019     **/
 /**                # Version 7.0  : from : 03 sep 2020     **/
-/**                                 to   : 03 sep 2020     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -74,6 +74,7 @@ static File                 C_fileTab[C_FILENBR] = { /* File array
 
 static const char *         C_usageList[] = {
   "dgscat [<input (centralized) source file> [<output distributed source file>]] <options>",
+  "  -b       : Save output graph in binary format",
   "  -c       : Check the input graph after loading",
   "  -h       : Display this help",
   "  -r<num>  : Set root process for centralized files (default is 0)",
@@ -137,6 +138,10 @@ char *              argv[])
     }
     else {                                        /* If found an option name */
       switch (argv[i][1]) {
+        case 'B' :
+        case 'b' :
+          flagval |= C_FLAGBIN;
+          break;
         case 'C' :
         case 'c' :
           flagval |= C_FLAGCHECK;
@@ -192,7 +197,10 @@ char *              argv[])
   if ((flagval & C_FLAGCHECK) != 0)
     SCOTCH_dgraphCheck (&grafdat);
 
-  SCOTCH_dgraphSave (&grafdat, C_filepntrsrcout);
+  if ((flagval & C_FLAGBIN) != 0)
+    SCOTCH_dgraphSaveBin (&grafdat, C_filepntrsrcout);
+  else
+    SCOTCH_dgraphSave (&grafdat, C_filepntrsrcout);
 
   fileBlockClose (C_fileTab, C_FILENBR);          /* Always close explicitely to end eventual (un)compression tasks */
 
@@ -45,6 +45,8 @@
 /**                                 to   : 21 may 2007     **/
 /**                # Version 6.0  : from : 10 nov 2014     **/
 /**                                 to   : 10 nov 2014     **/
+/**                # Version 7.0  : from : 17 oct 2026     **/
+/**                                 to   : 17 oct 2026     **/
 /**                                                        **/
 /************************************************************/
 
@@ -65,6 +67,7 @@
 
 /*+ Process flags. +*/
 
-#define C_FLAGNONE                  0x0000        /* No flags                        */
-#define C_FLAGCHECK                 0x0001        /* Check distributed source graph  */
-#define C_FLAGDEBUG                 0x0002        /* Enable easy debugger attachment */
+#define C_FLAGNONE                  0x0000        /* No flags                           */
+#define C_FLAGCHECK                 0x0001        /* Check distributed source graph     */
+#define C_FLAGDEBUG                 0x0002        /* Enable easy debugger attachment    */
+#define C_FLAGBIN                   0x0004        /* Save output graph in binary format */
@@ -90,6 +90,8 @@ static const C_Format       C_inpFormatTab[] = {  /* Table of input formats
                               { 'm',  SCOTCH_graphGeomLoadMmkt },
                               { 'S',  SCOTCH_graphGeomLoadScot },
                               { 's',  SCOTCH_graphGeomLoadScot },
+                              { 'X',  SCOTCH_graphGeomLoadBin },
+                              { 'x',  SCOTCH_graphGeomLoadBin },
                               { '\0', NULL } };
 
 static int                  C_outFormatType  = 4; /* Output graph format          */
@@ -101,6 +103,8 @@ static C_Format             C_outFormatTab[] = {  /* Table of output formats
                               { 'm',  SCOTCH_graphGeomSaveMmkt },
                               { 'S',  SCOTCH_graphGeomSaveScot },
                               { 's',  SCOTCH_graphGeomSaveScot },
+                              { 'X',  SCOTCH_graphGeomSaveBin },
+                              { 'x',  SCOTCH_graphGeomSaveBin },
                               { '\0', NULL } };
 
 static int                  C_fileNum    = 0;     /* Number of file in arg list  */
@@ -117,10 +121,12 @@ static const char *         C_usageList[] = {
   "                  c  : Chaco v2.0 format (adjacency)",
   "                  m  : Matrix Market format (edges, symmetrized)",
   "                  s  : Scotch v3.0 format (adjacency)",
+  "                  x  : Scotch binary format (adjacency)",
   "  -o<format>  : Select output file format",
   "                  c  : Chaco v2.0 format (adjacency)",
   "                  m  : Matrix Market symmetric pattern format (edges)",
   "                  s  : Scotch v3.0 format (adjacency)",
+  "                  x  : Scotch binary format (adjacency)",
   "  -V          : Print program version and copyright",
   "",
   "Default option set is : '-Ib -Os'",